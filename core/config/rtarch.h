@@ -108,6 +108,11 @@
  *  - rtarch_x32_512x2v2.h - fp32, 32 SIMD regs, 16 512-bit pairs, 32 used
  *  - rtarch_x64_512x2v2.h - fp64, 32 SIMD regs, 16 512-bit pairs, 32 used
  *
+ *  - rtarch_c32.h         - portable C reference, 16 BASE regs, 14 used
+ *  - rtarch_c64.h         - portable C reference, 16 BASE regs, 14 used
+ *  - rtarch_c32_128x1v1.h - fp32, 32 SIMD regs, C-reference 128-bit, 30 used
+ *  - rtarch_c64_128x1v1.h - fp64, 32 SIMD regs, C-reference 128-bit, 30 used
+ *
  * Future 32/64-bit BASE
  *   plus 32/64-bit SIMD combinations:
  *
@@ -196,7 +201,20 @@
  * cvy*s_** - SIMD-data args, SIMD ISA (convert to fp-precision above selected)
  * conversion to lower fp-precision narrows onto lower-half of selected vec-size
  * conversion to higher fp-precision widens from lower-half of selected vec-size
- * cux*s_**, cuy*s_** are reserved for fp-precision conversion of the upper-half
+ * cux*s_**, cuy*s_** narrow onto (widen from) upper-half of selected vec-size
+ * fp16 is stored in cmdm*, cmda*, cmdg* (movmx, cvxos, cvyms), see rtbase.h
+ * fp32 <-> fp64 use cvxqs, cuxqs, cvyos, cuyos (cmdq*, cmdo*), see rtbase.h
+ *
+ * cmdpb_** - SIMD-data args, SIMD ISA (packed byte-int subset, unsigned)
+ * cmdpc_** - SIMD-data args, SIMD ISA (packed byte-int subset, signed)
+ * cmdph_** - SIMD-data args, SIMD ISA (packed half-int subset, unsigned)
+ * cmdpi_** - SIMD-data args, SIMD ISA (packed half-int subset, signed)
+ * sub-word ints have fixed-size views cmdo*, cmdc*, cmdi* with same suffixes
+ * cvxph, cvxpi narrow half to byte, cvxpx, cvxpn narrow 32-bit to half ints
+ * cvypb, cvypc widen byte to half, cvyph, cvypi widen half to 32-bit ints
+ *
+ * ceq*x, cne*x, clt*x, cle*x, cgt*x, cge*x compare unsigned ints to all-1 mask
+ * clt*n, cle*n, cgt*n, cge*n compare signed ints to all-1 mask (as for fp ops)
  *
  * cu**s_rr, cu**s_ld are reserved for fp-to-unsigned-int conversion, keeps size
  * cv**n_rr, cv**n_ld already in use for signed-int-to-fp conversion, keeps size
@@ -219,9 +237,6 @@
  * cmdu*_** - SIMD-data args, SIMD ISA (packed f128/int subset, quad-precision)
  * cmdv*_** - SIMD-elem args, SIMD ISA (scalar f128/int subset, quad-precision)
  *
- * cmdpb_** - SIMD-data args, SIMD ISA (packed byte-int subset)
- * cmdph_** - SIMD-data args, SIMD ISA (packed half-int subset)
- *
  * packed SIMD instructions above are vector-length-agnostic: 128-bit multiples
  *
  * cmdg*_** - SIMD-data args, SIMD ISA (data element is 16-bit, packed-128-bit)
@@ -299,7 +314,7 @@
  * Working with sub-word BASE elements (byte, half) is reserved for future use.
  * However, current displacement types may not work due to natural alignment.
  * Signed/unsigned types can be supported orthogonally in cmd*n_**, cmd*x_**.
- * Working with sub-word SIMD elements (byte, half) has not been investigated.
+ * Working with sub-word SIMD elements (byte, half) is limited to packed ints.
  * However, as current major ISAs lack the ability to do sub-word fp-compute,
  * these corresponding subsets cannot be viewed as valid targets for SPMD.
  *
@@ -354,13 +369,64 @@
  * Short name for true-condition sign in assembler evaluation of (A == B).
  * The result of the condition evaluation is used as a mask for selection:
  * ((A == B) & C) | ((A != B) & D), therefore it needs to be (-1) if true.
+ * Run-time code generation (RT_JIT) evaluates conditions in C/C++ (+1).
  */
-#if __llvm__
+#if __llvm__ || (defined RT_JIT)
 #define M   -
 #else /* GAS */
 #define M   +
 #endif /* M */
 
+#if   (defined RT_JIT) && !(defined RT_X32) && !(defined RT_X64)
+#error "run-time code generation is only supported on x86_64, check build flags"
+#endif /* RT_JIT */
+
+/*
+ * Register masks for ASM_ENTER_R(_F)(info, base, simd), which save/restore
+ * only BASE registers listed in "base" and SIMD registers XmmN with bit N set
+ * in "simd" (constant expressions), instead of all available registers.
+ * Rebp (Info) and internal temporaries are always saved, registers destroyed
+ * implicitly by instructions (such as Xmm0 in mmv) need to be listed as well.
+ * Multi-register SIMD targets save register groups, legacy ARM/X86 targets
+ * always save all BASE registers, MSVC (RT_WIN32) always saves everything.
+ */
+#define RT_BASE_Reax    0x0001
+#define RT_BASE_Recx    0x0002
+#define RT_BASE_Redx    0x0004
+#define RT_BASE_Rebx    0x0008
+#define RT_BASE_Rebp    0x0010
+#define RT_BASE_Resi    0x0020
+#define RT_BASE_Redi    0x0040
+#define RT_BASE_Reg8    0x0080
+#define RT_BASE_Reg9    0x0100
+#define RT_BASE_RegA    0x0200
+#define RT_BASE_RegB    0x0400
+#define RT_BASE_RegC    0x0800
+#define RT_BASE_RegD    0x1000
+#define RT_BASE_RegE    0x2000
+#define RT_BASE_ALL     0x3FFF
+#define RT_SIMD_ALL     0xFFFFFFFF
+
+/* conditional emission of register saves in ASM_ENTER_R (internal) */
+#if   (defined RT_JIT)
+#define ASM_MSK(base, simd)     rt_ui32 __Mbase__ = (base);                 \
+                                rt_ui32 __Msimd__ = (simd);
+#define ASM_IFB(mask)           if (__Mbase__ & (mask)) {
+#define ASM_IFS(mask)           if (__Msimd__ & (mask)) {
+#define ASM_FI                  }
+#elif (defined RT_WIN32) /* MSVC: all registers are saved */
+#define ASM_MSK(base, simd)
+#define ASM_IFB(mask)
+#define ASM_IFS(mask)
+#define ASM_FI
+#else  /* GAS: assembler-time conditionals */
+#define ASM_MSK(base, simd)     ASM_BEG ASM_OP0(__Mbase__ = (base)) ASM_END \
+                                ASM_BEG ASM_OP0(__Msimd__ = (simd)) ASM_END
+#define ASM_IFB(mask)           ASM_BEG ASM_OP1(.if, __Mbase__&(mask)) ASM_END
+#define ASM_IFS(mask)           ASM_BEG ASM_OP1(.if, __Msimd__&(mask)) ASM_END
+#define ASM_FI                  ASM_BEG ASM_OP0(.endif) ASM_END
+#endif /* ASM_MSK */
+
 /******************************************************************************/
 /***************************   OS, COMPILER, ARCH   ***************************/
 /******************************************************************************/
@@ -497,21 +563,22 @@
 
 /* use 1 local to fix optimized builds, where locals are referenced via SP,
  * while stack ops from within the asm block aren't counted into offsets */
-#define ASM_ENTER(__Info__)                                                 \
+#define ASM_ENTER_R(__Info__, __Base__, __Simd__)                           \
 {                                                                           \
     rt_word __Reax__;                                                       \
     asm volatile                                                            \
     (                                                                       \
         movlb_st(%[Reax_])                                                  \
         movlb_ld(%[Info_])                                                  \
-        stack_sa()                                                          \
+        ASM_MSK(__Base__, __Simd__)                                         \
+        stack_sm()                                                          \
         movxx_rr(Rebp, Reax)                                                \
         sregs_sa()                                                          \
         EMITW(0xE3A00500 | MRM(TNxx, 0x00, 0x00)) /* r8  <- (0 << 22) */
 
 #define ASM_LEAVE(__Info__)                                                 \
         sregs_la()                                                          \
-        stack_la()                                                          \
+        stack_lm()                                                          \
         movlb_ld(%[Reax_])                                                  \
         : [Reax_] "+r" (__Reax__)                                           \
         : [Info_]  "r" ((rt_word)__Info__)                                  \
@@ -523,14 +590,15 @@
 
 /* use 1 local to fix optimized builds, where locals are referenced via SP,
  * while stack ops from within the asm block aren't counted into offsets */
-#define ASM_ENTER(__Info__)                                                 \
+#define ASM_ENTER_R(__Info__, __Base__, __Simd__)                           \
 {                                                                           \
     rt_word __Reax__;                                                       \
     asm volatile                                                            \
     (                                                                       \
         movlb_st(%[Reax_])                                                  \
         movlb_ld(%[Info_])                                                  \
-        stack_sa()                                                          \
+        ASM_MSK(__Base__, __Simd__)                                         \
+        stack_sm()                                                          \
         movxx_rr(Rebp, Reax)                                                \
         sregs_sa()                                                          \
         EMITW(0xE3A00503 | MRM(TExx, 0x00, 0x00)) /* r14 <- (3 << 22) */    \
@@ -540,7 +608,7 @@
 
 #define ASM_LEAVE(__Info__)                                                 \
         sregs_la()                                                          \
-        stack_la()                                                          \
+        stack_lm()                                                          \
         movlb_ld(%[Reax_])                                                  \
         : [Reax_] "+r" (__Reax__)                                           \
         : [Info_]  "r" ((rt_word)__Info__)                                  \
@@ -551,7 +619,8 @@
 #endif /* RT_SIMD_FAST_FCTRL */
 #else /* RT_SIMD_FLUSH_ZERO */
 
-#define ASM_ENTER(__Info__) ASM_ENTER_F(__Info__)
+#define ASM_ENTER_R(__Info__, __Base__, __Simd__)                           \
+        ASM_ENTER_F_R(__Info__, __Base__, __Simd__)
 
 #define ASM_LEAVE(__Info__) ASM_LEAVE_F(__Info__)
 
@@ -568,14 +637,15 @@
 
 /* use 1 local to fix optimized builds, where locals are referenced via SP,
  * while stack ops from within the asm block aren't counted into offsets */
-#define ASM_ENTER_F(__Info__)                                               \
+#define ASM_ENTER_F_R(__Info__, __Base__, __Simd__)                         \
 {                                                                           \
     rt_word __Reax__;                                                       \
     asm volatile                                                            \
     (                                                                       \
         movlb_st(%[Reax_])                                                  \
         movlb_ld(%[Info_])                                                  \
-        stack_sa()                                                          \
+        ASM_MSK(__Base__, __Simd__)                                         \
+        stack_sm()                                                          \
         movxx_rr(Rebp, Reax)                                                \
         sregs_sa()                                                          \
         EMITW(0xE3A00504 | MRM(TNxx, 0x00, 0x00)) /* r8  <- (4 << 22) */    \
@@ -585,7 +655,7 @@
         EMITW(0xE3A00500 | MRM(TNxx, 0x00, 0x00)) /* r8  <- (0 << 22) */    \
         EMITW(0xEEE10A10 | MRM(TNxx, 0x00, 0x00)) /* fpscr <- r8 */         \
         sregs_la()                                                          \
-        stack_la()                                                          \
+        stack_lm()                                                          \
         movlb_ld(%[Reax_])                                                  \
         : [Reax_] "+r" (__Reax__)                                           \
         : [Info_]  "r" ((rt_word)__Info__)                                  \
@@ -597,14 +667,15 @@
 
 /* use 1 local to fix optimized builds, where locals are referenced via SP,
  * while stack ops from within the asm block aren't counted into offsets */
-#define ASM_ENTER_F(__Info__)                                               \
+#define ASM_ENTER_F_R(__Info__, __Base__, __Simd__)                         \
 {                                                                           \
     rt_word __Reax__;                                                       \
     asm volatile                                                            \
     (                                                                       \
         movlb_st(%[Reax_])                                                  \
         movlb_ld(%[Info_])                                                  \
-        stack_sa()                                                          \
+        ASM_MSK(__Base__, __Simd__)                                         \
+        stack_sm()                                                          \
         movxx_rr(Rebp, Reax)                                                \
         sregs_sa()                                                          \
         EMITW(0xE3A00507 | MRM(TExx, 0x00, 0x00)) /* r14 <- (7 << 22) */    \
@@ -617,7 +688,7 @@
         EMITW(0xE3A00500 | MRM(TNxx, 0x00, 0x00)) /* r8  <- (0 << 22) */    \
         EMITW(0xEEE10A10 | MRM(TNxx, 0x00, 0x00)) /* fpscr <- r8 */         \
         sregs_la()                                                          \
-        stack_la()                                                          \
+        stack_lm()                                                          \
         movlb_ld(%[Reax_])                                                  \
         : [Reax_] "+r" (__Reax__)                                           \
         : [Info_]  "r" ((rt_word)__Info__)                                  \
@@ -756,14 +827,15 @@
 
 /* use 1 local to fix optimized builds, where locals are referenced via SP,
  * while stack ops from within the asm block aren't counted into offsets */
-#define ASM_ENTER(__Info__)                                                 \
+#define ASM_ENTER_R(__Info__, __Base__, __Simd__)                           \
 {                                                                           \
     rt_full __Reax__;                                                       \
     asm volatile                                                            \
     (                                                                       \
         movlb_st(%[Reax_])                                                  \
         movlb_ld(%[Info_])                                                  \
-        stack_sa()                                                          \
+        ASM_MSK(__Base__, (__Simd__) | 0x4000)                              \
+        stack_sm()                                                          \
         movxx_rr(Rebp, Reax)                                                \
         sregs_sa()                                                          \
         EMITS(0x2518E3E0)                    /* SVE: p0  <- all-ones */     \
@@ -773,7 +845,7 @@
 
 #define ASM_LEAVE(__Info__)                                                 \
         sregs_la()                                                          \
-        stack_la()                                                          \
+        stack_lm()                                                          \
         movlb_ld(%[Reax_])                                                  \
         : [Reax_] "+r" (__Reax__)                                           \
         : [Info_]  "r" ((rt_full)__Info__)                                  \
@@ -785,14 +857,15 @@
 
 /* use 1 local to fix optimized builds, where locals are referenced via SP,
  * while stack ops from within the asm block aren't counted into offsets */
-#define ASM_ENTER(__Info__)                                                 \
+#define ASM_ENTER_R(__Info__, __Base__, __Simd__)                           \
 {                                                                           \
     rt_full __Reax__;                                                       \
     asm volatile                                                            \
     (                                                                       \
         movlb_st(%[Reax_])                                                  \
         movlb_ld(%[Info_])                                                  \
-        stack_sa()                                                          \
+        ASM_MSK(__Base__, (__Simd__) | 0x4000)                              \
+        stack_sm()                                                          \
         movxx_rr(Rebp, Reax)                                                \
         sregs_sa()                                                          \
         EMITS(0x2518E3E0)                    /* SVE: p0  <- all-ones */     \
@@ -805,7 +878,7 @@
 
 #define ASM_LEAVE(__Info__)                                                 \
         sregs_la()                                                          \
-        stack_la()                                                          \
+        stack_lm()                                                          \
         movlb_ld(%[Reax_])                                                  \
         : [Reax_] "+r" (__Reax__)                                           \
         : [Info_]  "r" ((rt_full)__Info__)                                  \
@@ -816,7 +889,8 @@
 #endif /* RT_SIMD_FAST_FCTRL */
 #else /* RT_SIMD_FLUSH_ZERO */
 
-#define ASM_ENTER(__Info__) ASM_ENTER_F(__Info__)
+#define ASM_ENTER_R(__Info__, __Base__, __Simd__)                           \
+        ASM_ENTER_F_R(__Info__, __Base__, __Simd__)
 
 #define ASM_LEAVE(__Info__) ASM_LEAVE_F(__Info__)
 
@@ -833,14 +907,15 @@
 
 /* use 1 local to fix optimized builds, where locals are referenced via SP,
  * while stack ops from within the asm block aren't counted into offsets */
-#define ASM_ENTER_F(__Info__)                                               \
+#define ASM_ENTER_F_R(__Info__, __Base__, __Simd__)                         \
 {                                                                           \
     rt_full __Reax__;                                                       \
     asm volatile                                                            \
     (                                                                       \
         movlb_st(%[Reax_])                                                  \
         movlb_ld(%[Info_])                                                  \
-        stack_sa()                                                          \
+        ASM_MSK(__Base__, (__Simd__) | 0x4000)                              \
+        stack_sm()                                                          \
         movxx_rr(Rebp, Reax)                                                \
         sregs_sa()                                                          \
         EMITS(0x2518E3E0)                    /* SVE: p0  <- all-ones */     \
@@ -853,7 +928,7 @@
         EMITW(0x52A00000 | MRM(TNxx, 0x00, 0x00)) /* x20 <- (0 << 22) */    \
         EMITW(0xD51B4400 | MRM(TNxx, 0x00, 0x00)) /* fpcr <- x20 */         \
         sregs_la()                                                          \
-        stack_la()                                                          \
+        stack_lm()                                                          \
         movlb_ld(%[Reax_])                                                  \
         : [Reax_] "+r" (__Reax__)                                           \
         : [Info_]  "r" ((rt_full)__Info__)                                  \
@@ -865,14 +940,15 @@
 
 /* use 1 local to fix optimized builds, where locals are referenced via SP,
  * while stack ops from within the asm block aren't counted into offsets */
-#define ASM_ENTER_F(__Info__)                                               \
+#define ASM_ENTER_F_R(__Info__, __Base__, __Simd__)                         \
 {                                                                           \
     rt_full __Reax__;                                                       \
     asm volatile                                                            \
     (                                                                       \
         movlb_st(%[Reax_])                                                  \
         movlb_ld(%[Info_])                                                  \
-        stack_sa()                                                          \
+        ASM_MSK(__Base__, (__Simd__) | 0x4000)                              \
+        stack_sm()                                                          \
         movxx_rr(Rebp, Reax)                                                \
         sregs_sa()                                                          \
         EMITS(0x2518E3E0)                    /* SVE: p0  <- all-ones */     \
@@ -888,7 +964,7 @@
         EMITW(0x52A00000 | MRM(TNxx, 0x00, 0x00)) /* x20 <- (0 << 22) */    \
         EMITW(0xD51B4400 | MRM(TNxx, 0x00, 0x00)) /* fpcr <- x20 */         \
         sregs_la()                                                          \
-        stack_la()                                                          \
+        stack_lm()                                                          \
         movlb_ld(%[Reax_])                                                  \
         : [Reax_] "+r" (__Reax__)                                           \
         : [Info_]  "r" ((rt_full)__Info__)                                  \
@@ -1058,14 +1134,15 @@
 
 /* use 1 local to fix optimized builds, where locals are referenced via SP,
  * while stack ops from within the asm block aren't counted into offsets */
-#define ASM_ENTER(__Info__)                                                 \
+#define ASM_ENTER_R(__Info__, __Base__, __Simd__)                           \
 {                                                                           \
     rt_word __Reax__;                                                       \
     asm volatile                                                            \
     (                                                                       \
         movlb_st(%[Reax_])                                                  \
         movlb_ld(%[Info_])                                                  \
-        stack_sa()                                                          \
+        ASM_MSK(__Base__, __Simd__)                                         \
+        stack_sm()                                                          \
         movxx_rr(Rebp, Reax)                                                \
         sregs_sa()                                                          \
         EMITS(0x7860001E | MXM(TmmZ, TmmZ, TmmZ)) /* w30 <- 0 (xor) */      \
@@ -1073,7 +1150,7 @@
 
 #define ASM_LEAVE(__Info__)                                                 \
         sregs_la()                                                          \
-        stack_la()                                                          \
+        stack_lm()                                                          \
         movlb_ld(%[Reax_])                                                  \
         : [Reax_] "+r" (__Reax__)                                           \
         : [Info_]  "r" ((rt_word)__Info__)                                  \
@@ -1085,14 +1162,15 @@
 
 /* use 1 local to fix optimized builds, where locals are referenced via SP,
  * while stack ops from within the asm block aren't counted into offsets */
-#define ASM_ENTER(__Info__)                                                 \
+#define ASM_ENTER_R(__Info__, __Base__, __Simd__)                           \
 {                                                                           \
     rt_word __Reax__;                                                       \
     asm volatile                                                            \
     (                                                                       \
         movlb_st(%[Reax_])                                                  \
         movlb_ld(%[Info_])                                                  \
-        stack_sa()                                                          \
+        ASM_MSK(__Base__, __Simd__)                                         \
+        stack_sm()                                                          \
         movxx_rr(Rebp, Reax)                                                \
         sregs_sa()                                                          \
         EMITS(0x7860001E | MXM(TmmZ, TmmZ, TmmZ)) /* w30 <- 0 (xor) */      \
@@ -1103,7 +1181,7 @@
 
 #define ASM_LEAVE(__Info__)                                                 \
         sregs_la()                                                          \
-        stack_la()                                                          \
+        stack_lm()                                                          \
         movlb_ld(%[Reax_])                                                  \
         : [Reax_] "+r" (__Reax__)                                           \
         : [Info_]  "r" ((rt_word)__Info__)                                  \
@@ -1114,7 +1192,8 @@
 #endif /* RT_SIMD_FAST_FCTRL */
 #else /* RT_SIMD_FLUSH_ZERO */
 
-#define ASM_ENTER(__Info__) ASM_ENTER_F(__Info__)
+#define ASM_ENTER_R(__Info__, __Base__, __Simd__)                           \
+        ASM_ENTER_F_R(__Info__, __Base__, __Simd__)
 
 #define ASM_LEAVE(__Info__) ASM_LEAVE_F(__Info__)
 
@@ -1131,14 +1210,15 @@
 
 /* use 1 local to fix optimized builds, where locals are referenced via SP,
  * while stack ops from within the asm block aren't counted into offsets */
-#define ASM_ENTER_F(__Info__)                                               \
+#define ASM_ENTER_F_R(__Info__, __Base__, __Simd__)                         \
 {                                                                           \
     rt_word __Reax__;                                                       \
     asm volatile                                                            \
     (                                                                       \
         movlb_st(%[Reax_])                                                  \
         movlb_ld(%[Info_])                                                  \
-        stack_sa()                                                          \
+        ASM_MSK(__Base__, __Simd__)                                         \
+        stack_sm()                                                          \
         movxx_rr(Rebp, Reax)                                                \
         sregs_sa()                                                          \
         EMITS(0x7860001E | MXM(TmmZ, TmmZ, TmmZ)) /* w30 <- 0 (xor) */      \
@@ -1151,7 +1231,7 @@
         EMITW(0x44C0F800 | MRM(0x00, 0x00, TNxx)) /* fcsr <- r20 */         \
         EMITS(0x783E0059 | MXM(0x00, TNxx, 0x00)) /* msacsr <- r20 */       \
         sregs_la()                                                          \
-        stack_la()                                                          \
+        stack_lm()                                                          \
         movlb_ld(%[Reax_])                                                  \
         : [Reax_] "+r" (__Reax__)                                           \
         : [Info_]  "r" ((rt_word)__Info__)                                  \
@@ -1163,14 +1243,15 @@
 
 /* use 1 local to fix optimized builds, where locals are referenced via SP,
  * while stack ops from within the asm block aren't counted into offsets */
-#define ASM_ENTER_F(__Info__)                                               \
+#define ASM_ENTER_F_R(__Info__, __Base__, __Simd__)                         \
 {                                                                           \
     rt_word __Reax__;                                                       \
     asm volatile                                                            \
     (                                                                       \
         movlb_st(%[Reax_])                                                  \
         movlb_ld(%[Info_])                                                  \
-        stack_sa()                                                          \
+        ASM_MSK(__Base__, __Simd__)                                         \
+        stack_sm()                                                          \
         movxx_rr(Rebp, Reax)                                                \
         sregs_sa()                                                          \
         EMITS(0x7860001E | MXM(TmmZ, TmmZ, TmmZ)) /* w30 <- 0 (xor) */      \
@@ -1186,7 +1267,7 @@
         EMITW(0x44C0F800 | MRM(0x00, 0x00, TNxx)) /* fcsr <- r20 */         \
         EMITS(0x783E0059 | MXM(0x00, TNxx, 0x00)) /* msacsr <- r20 */       \
         sregs_la()                                                          \
-        stack_la()                                                          \
+        stack_lm()                                                          \
         movlb_ld(%[Reax_])                                                  \
         : [Reax_] "+r" (__Reax__)                                           \
         : [Info_]  "r" ((rt_word)__Info__)                                  \
@@ -1378,14 +1459,15 @@
 
 /* use 1 local to fix optimized builds, where locals are referenced via SP,
  * while stack ops from within the asm block aren't counted into offsets */
-#define ASM_ENTER(__Info__)                                                 \
+#define ASM_ENTER_R(__Info__, __Base__, __Simd__)                           \
 {                                                                           \
     rt_word __Reax__;                                                       \
     asm volatile                                                            \
     (                                                                       \
         movlb_st(%[Reax_])                                                  \
         movlb_ld(%[Info_])                                                  \
-        stack_sa()                                                          \
+        ASM_MSK(__Base__, (__Simd__) | 0x0114)                              \
+        stack_sm()                                                          \
         movxx_rr(Rebp, Reax)                                                \
         EMITS(0x38000000 | MRM(T0xx, 0x00, 0x00)) /* r20 <- 0 */            \
         EMITS(0x38000010 | MRM(T1xx, 0x00, 0x00)) /* r21 <- 16 */           \
@@ -1413,7 +1495,7 @@
         EMITW(0x7C0003A6 | MRM(TCxx, 0x00, 0x09)) /* ctr <- r28 */          \
         EMITS(0x7C0003A6 | MRM(TVxx, 0x08, 0x00)) /* vrsave <- r29 */       \
         sregs_la()                                                          \
-        stack_la()                                                          \
+        stack_lm()                                                          \
         movlb_ld(%[Reax_])                                                  \
         : [Reax_] "+r" (__Reax__)                                           \
         : [Info_]  "r" ((rt_word)__Info__)                                  \
@@ -1423,7 +1505,8 @@
 
 #else /* RT_SIMD_FLUSH_ZERO */
 
-#define ASM_ENTER(__Info__) ASM_ENTER_F(__Info__)
+#define ASM_ENTER_R(__Info__, __Base__, __Simd__)                           \
+        ASM_ENTER_F_R(__Info__, __Base__, __Simd__)
 
 #define ASM_LEAVE(__Info__) ASM_LEAVE_F(__Info__)
 
@@ -1438,14 +1521,15 @@
 
 /* use 1 local to fix optimized builds, where locals are referenced via SP,
  * while stack ops from within the asm block aren't counted into offsets */
-#define ASM_ENTER_F(__Info__)                                               \
+#define ASM_ENTER_F_R(__Info__, __Base__, __Simd__)                         \
 {                                                                           \
     rt_word __Reax__;                                                       \
     asm volatile                                                            \
     (                                                                       \
         movlb_st(%[Reax_])                                                  \
         movlb_ld(%[Info_])                                                  \
-        stack_sa()                                                          \
+        ASM_MSK(__Base__, (__Simd__) | 0x0114)                              \
+        stack_sm()                                                          \
         movxx_rr(Rebp, Reax)                                                \
         EMITS(0x38000000 | MRM(T0xx, 0x00, 0x00)) /* r20 <- 0 */            \
         EMITS(0x38000010 | MRM(T1xx, 0x00, 0x00)) /* r21 <- 16 */           \
@@ -1479,7 +1563,7 @@
         EMITW(0x7C0003A6 | MRM(TCxx, 0x00, 0x09)) /* ctr <- r28 */          \
         EMITS(0x7C0003A6 | MRM(TVxx, 0x08, 0x00)) /* vrsave <- r29 */       \
         sregs_la()                                                          \
-        stack_la()                                                          \
+        stack_lm()                                                          \
         movlb_ld(%[Reax_])                                                  \
         : [Reax_] "+r" (__Reax__)                                           \
         : [Info_]  "r" ((rt_word)__Info__)                                  \
@@ -1516,6 +1600,28 @@
 #define ASM_BEG /*internal*/    ""
 #define ASM_END /*internal*/    "\n"
 
+#if   (defined RT_JIT) /* run-time code generation into a memory buffer */
+
+#include "rtjit.h"
+
+#define EMPTY                   /* EMPTY */
+#define EMITB(b)                jit_emitb(__Jit__, (rt_ui32)(b));
+#define EMITW(w)                jit_emitw(__Jit__, (rt_ui32)(w));
+
+#define ASM_REF(lb)/*rel32*/    jit_refer(__Jit__, #lb, RT_JIT_ADR);
+#define ASM_JMP(lb)/*label*/    jit_refer(__Jit__, #lb, RT_JIT_JMP);
+#define ASM_JCC(cc, lb)         jit_refer(__Jit__, #lb, cc);
+#define ASM_LBL(lb)/*label*/    jit_label(__Jit__, #lb);
+
+#if   (defined RT_WIN64)
+#define movlb_ld(lb)/*Reax*/    movzx_rr(Reax, Recx) /* <- Info in 1st arg */
+#else  /* Linux, SysV ABI */
+#define movlb_ld(lb)/*Reax*/    movzx_rr(Reax, Redi) /* <- Info in 1st arg */
+#endif /* 1st arg register */
+#define movlb_st(lb)/*Reax*/    /* EMPTY: Reax is not preserved across calls */
+
+#else  /* RT_JIT: static code generation via inline assembly */
+
 #define EMPTY                   ASM_BEG ASM_END /* endian-agnostic */
 #define EMITB(b)                ASM_BEG ASM_OP1(.byte, b) ASM_END
 #define EMITW(w)                ASM_BEG ASM_OP1(.long, w) ASM_END
@@ -1523,6 +1629,8 @@
 #define movlb_ld(lb)/*Reax*/    ASM_BEG ASM_OP2(movq, %%rax, lb) ASM_END
 #define movlb_st(lb)/*Reax*/    ASM_BEG ASM_OP2(movq, lb, %%rax) ASM_END
 
+#endif /* RT_JIT */
+
 #if   (defined RT_X32)
 
 #define label_ld(lb)/*Reax*/                                                \
@@ -1547,6 +1655,16 @@
 
 #endif /* defined (RT_X32, RT_X64) */
 
+#if   (defined RT_JIT)
+
+#undef  label_ld
+#define label_ld(lb)/*Reax*/                                                \
+        REW(0,             0) EMITB(0x8D)     /* <- rip-relative address */ \
+        MRM(0x00,       0x00, 0x05)                                         \
+        ASM_REF(lb)
+
+#endif /* RT_JIT */
+
 /* RT_SIMD_FAST_FCTRL saves 1 instruction on FCTRL blocks entry
  * and can be enabled if ASM_ENTER(_F)/ASM_LEAVE(_F)/ROUND*(_F)
  * with (_F) and without (_F) are not intermixed in the code */
@@ -1664,6 +1782,156 @@
 #error "couldn't select appropriate SIMD target, check build flags"
 #endif /* RT_SIMD: 2048, 1024, 512, 256, 128 */
 
+#if   (defined RT_JIT)
+
+/*
+ * In run-time code generation mode (RT_JIT) ASM_ENTER starts a new code buffer
+ * on the stack of the calling function, where the instructions up to ASM_LEAVE
+ * are emitted as regular C/C++ statements (check rtjit.h for details).
+ * ASM_LEAVE completes the code, which is then called with Info in 1st arg.
+ * Prologue/epilogue of the generated code match those of the static version.
+ * Completed code is saved in the code cache, subsequent calls from the same
+ * call site (kernel id) with the same SIMD target in Info skip the emitters.
+ * ASM_ENTER_S(_F) also key the code on "size" bytes of specialization data
+ * at "spec" (run-time values used in the code), closed with ASM_LEAVE(_F).
+ * ASM_ENTER_RS(_F) take both register masks (as ASM_ENTER_R) and "spec".
+ */
+
+#if RT_SIMD_FLUSH_ZERO == 0
+#if RT_SIMD_FAST_FCTRL == 0
+
+#define ASM_ENTER_RS(__Info__, __Base__, __Simd__, __Spec__, __Size__)      \
+{                                                                           \
+    static rt_char __Site__; /* <- kernel id */                             \
+    rt_JIT_CODE __Code__, *__Jit__ = jit_init(&__Code__, &__Site__,         \
+                        (rt_pntr)(__Info__), (__Spec__), (__Size__));       \
+    if (__Jit__->ent == RT_NULL)                                            \
+    {                                                                       \
+        movlb_ld(__Info__)                                                  \
+        ASM_MSK(__Base__, __Simd__)                                         \
+        stack_sm()                                                          \
+        movxx_rr(Rebp, Reax)                                                \
+        sregs_sa()                                                          \
+        movwx_mi(Mebp, inf_FCTRL(0*4), IH(0x1F80))
+
+#define ASM_LEAVE(__Info__)                                                 \
+        sregs_la()                                                          \
+        stack_lm()                                                          \
+        EMITB(0xC3)                         /* <- return from the code */   \
+    }                                                                       \
+    jit_leave(__Jit__, (rt_pntr)(__Info__));                                \
+}
+
+#else /* RT_SIMD_FAST_FCTRL */
+
+#define ASM_ENTER_RS(__Info__, __Base__, __Simd__, __Spec__, __Size__)      \
+{                                                                           \
+    static rt_char __Site__; /* <- kernel id */                             \
+    rt_JIT_CODE __Code__, *__Jit__ = jit_init(&__Code__, &__Site__,         \
+                        (rt_pntr)(__Info__), (__Spec__), (__Size__));       \
+    if (__Jit__->ent == RT_NULL)                                            \
+    {                                                                       \
+        movlb_ld(__Info__)                                                  \
+        ASM_MSK(__Base__, __Simd__)                                         \
+        stack_sm()                                                          \
+        movxx_rr(Rebp, Reax)                                                \
+        sregs_sa()                                                          \
+        movwx_mi(Mebp, inf_FCTRL(3*4), IH(0x7F80))                          \
+        movwx_mi(Mebp, inf_FCTRL(2*4), IH(0x5F80))                          \
+        movwx_mi(Mebp, inf_FCTRL(1*4), IH(0x3F80))                          \
+        movwx_mi(Mebp, inf_FCTRL(0*4), IH(0x1F80))
+
+#define ASM_LEAVE(__Info__)                                                 \
+        sregs_la()                                                          \
+        stack_lm()                                                          \
+        EMITB(0xC3)                         /* <- return from the code */   \
+    }                                                                       \
+    jit_leave(__Jit__, (rt_pntr)(__Info__));                                \
+}
+
+#endif /* RT_SIMD_FAST_FCTRL */
+#else /* RT_SIMD_FLUSH_ZERO */
+
+#define ASM_ENTER_RS(__Info__, __Base__, __Simd__, __Spec__, __Size__)      \
+        ASM_ENTER_F_RS(__Info__, __Base__, __Simd__, __Spec__, __Size__)
+
+#define ASM_LEAVE(__Info__) ASM_LEAVE_F(__Info__)
+
+#endif /* RT_SIMD_FLUSH_ZERO */
+
+#if RT_SIMD_FAST_FCTRL == 0
+
+#define ASM_ENTER_F_RS(__Info__, __Base__, __Simd__, __Spec__, __Size__)    \
+{                                                                           \
+    static rt_char __Site__; /* <- kernel id */                             \
+    rt_JIT_CODE __Code__, *__Jit__ = jit_init(&__Code__, &__Site__,         \
+                        (rt_pntr)(__Info__), (__Spec__), (__Size__));       \
+    if (__Jit__->ent == RT_NULL)                                            \
+    {                                                                       \
+        movlb_ld(__Info__)                                                  \
+        ASM_MSK(__Base__, __Simd__)                                         \
+        stack_sm()                                                          \
+        movxx_rr(Rebp, Reax)                                                \
+        sregs_sa()                                                          \
+        movwx_mi(Mebp, inf_FCTRL(0*4), IH(0x9F80))                          \
+        mxcsr_ld(Mebp, inf_FCTRL(0*4))
+
+#define ASM_LEAVE_F(__Info__)                                               \
+        movwx_mi(Mebp, inf_FCTRL(0*4), IH(0x1F80))                          \
+        mxcsr_ld(Mebp, inf_FCTRL(0*4))                                      \
+        sregs_la()                                                          \
+        stack_lm()                                                          \
+        EMITB(0xC3)                         /* <- return from the code */   \
+    }                                                                       \
+    jit_leave(__Jit__, (rt_pntr)(__Info__));                                \
+}
+
+#else /* RT_SIMD_FAST_FCTRL */
+
+#define ASM_ENTER_F_RS(__Info__, __Base__, __Simd__, __Spec__, __Size__)    \
+{                                                                           \
+    static rt_char __Site__; /* <- kernel id */                             \
+    rt_JIT_CODE __Code__, *__Jit__ = jit_init(&__Code__, &__Site__,         \
+                        (rt_pntr)(__Info__), (__Spec__), (__Size__));       \
+    if (__Jit__->ent == RT_NULL)                                            \
+    {                                                                       \
+        movlb_ld(__Info__)                                                  \
+        ASM_MSK(__Base__, __Simd__)                                         \
+        stack_sm()                                                          \
+        movxx_rr(Rebp, Reax)                                                \
+        sregs_sa()                                                          \
+        movwx_mi(Mebp, inf_FCTRL(3*4), IH(0xFF80))                          \
+        movwx_mi(Mebp, inf_FCTRL(2*4), IH(0xDF80))                          \
+        movwx_mi(Mebp, inf_FCTRL(1*4), IH(0xBF80))                          \
+        movwx_mi(Mebp, inf_FCTRL(0*4), IH(0x9F80))                          \
+        mxcsr_ld(Mebp, inf_FCTRL(0*4))
+
+#define ASM_LEAVE_F(__Info__)                                               \
+        movwx_mi(Mebp, inf_FCTRL(0*4), IH(0x1F80))                          \
+        mxcsr_ld(Mebp, inf_FCTRL(0*4))                                      \
+        sregs_la()                                                          \
+        stack_lm()                                                          \
+        EMITB(0xC3)                         /* <- return from the code */   \
+    }                                                                       \
+    jit_leave(__Jit__, (rt_pntr)(__Info__));                                \
+}
+
+#endif /* RT_SIMD_FAST_FCTRL */
+
+#define ASM_ENTER_S(__Info__, __Spec__, __Size__)                           \
+        ASM_ENTER_RS(__Info__, RT_BASE_ALL, RT_SIMD_ALL, __Spec__, __Size__)
+
+#define ASM_ENTER_F_S(__Info__, __Spec__, __Size__)                         \
+        ASM_ENTER_F_RS(__Info__, RT_BASE_ALL, RT_SIMD_ALL, __Spec__, __Size__)
+
+#define ASM_ENTER_R(__Info__, __Base__, __Simd__)                           \
+        ASM_ENTER_RS(__Info__, __Base__, __Simd__, RT_NULL, 0)
+
+#define ASM_ENTER_F_R(__Info__, __Base__, __Simd__)                         \
+        ASM_ENTER_F_RS(__Info__, __Base__, __Simd__, RT_NULL, 0)
+
+#else  /* RT_JIT */
+
 /*
  * As ASM_ENTER/ASM_LEAVE save/load a sizeable portion of registers onto/from
  * the stack, they are considered heavy and therefore best suited for compute
@@ -1676,21 +1944,22 @@
 
 /* use 1 local to fix optimized builds, where locals are referenced via SP,
  * while stack ops from within the asm block aren't counted into offsets */
-#define ASM_ENTER(__Info__)                                                 \
+#define ASM_ENTER_R(__Info__, __Base__, __Simd__)                           \
 {                                                                           \
     rt_full __Reax__;                                                       \
     asm volatile                                                            \
     (                                                                       \
         movlb_st(%[Reax_])                                                  \
         movlb_ld(%[Info_])                                                  \
-        stack_sa()                                                          \
+        ASM_MSK(__Base__, __Simd__)                                         \
+        stack_sm()                                                          \
         movxx_rr(Rebp, Reax)                                                \
         sregs_sa()                                                          \
         movwx_mi(Mebp, inf_FCTRL(0*4), IH(0x1F80))
 
 #define ASM_LEAVE(__Info__)                                                 \
         sregs_la()                                                          \
-        stack_la()                                                          \
+        stack_lm()                                                          \
         movlb_ld(%[Reax_])                                                  \
         : [Reax_] "+r" (__Reax__)                                           \
         : [Info_]  "r" ((rt_full)__Info__)                                  \
@@ -1702,14 +1971,15 @@
 
 /* use 1 local to fix optimized builds, where locals are referenced via SP,
  * while stack ops from within the asm block aren't counted into offsets */
-#define ASM_ENTER(__Info__)                                                 \
+#define ASM_ENTER_R(__Info__, __Base__, __Simd__)                           \
 {                                                                           \
     rt_full __Reax__;                                                       \
     asm volatile                                                            \
     (                                                                       \
         movlb_st(%[Reax_])                                                  \
         movlb_ld(%[Info_])                                                  \
-        stack_sa()                                                          \
+        ASM_MSK(__Base__, __Simd__)                                         \
+        stack_sm()                                                          \
         movxx_rr(Rebp, Reax)                                                \
         sregs_sa()                                                          \
         movwx_mi(Mebp, inf_FCTRL(3*4), IH(0x7F80))                          \
@@ -1719,7 +1989,7 @@
 
 #define ASM_LEAVE(__Info__)                                                 \
         sregs_la()                                                          \
-        stack_la()                                                          \
+        stack_lm()                                                          \
         movlb_ld(%[Reax_])                                                  \
         : [Reax_] "+r" (__Reax__)                                           \
         : [Info_]  "r" ((rt_full)__Info__)                                  \
@@ -1730,7 +2000,8 @@
 #endif /* RT_SIMD_FAST_FCTRL */
 #else /* RT_SIMD_FLUSH_ZERO */
 
-#define ASM_ENTER(__Info__) ASM_ENTER_F(__Info__)
+#define ASM_ENTER_R(__Info__, __Base__, __Simd__)                           \
+        ASM_ENTER_F_R(__Info__, __Base__, __Simd__)
 
 #define ASM_LEAVE(__Info__) ASM_LEAVE_F(__Info__)
 
@@ -1747,14 +2018,15 @@
 
 /* use 1 local to fix optimized builds, where locals are referenced via SP,
  * while stack ops from within the asm block aren't counted into offsets */
-#define ASM_ENTER_F(__Info__)                                               \
+#define ASM_ENTER_F_R(__Info__, __Base__, __Simd__)                         \
 {                                                                           \
     rt_full __Reax__;                                                       \
     asm volatile                                                            \
     (                                                                       \
         movlb_st(%[Reax_])                                                  \
         movlb_ld(%[Info_])                                                  \
-        stack_sa()                                                          \
+        ASM_MSK(__Base__, __Simd__)                                         \
+        stack_sm()                                                          \
         movxx_rr(Rebp, Reax)                                                \
         sregs_sa()                                                          \
         movwx_mi(Mebp, inf_FCTRL(0*4), IH(0x9F80))                          \
@@ -1764,7 +2036,7 @@
         movwx_mi(Mebp, inf_FCTRL(0*4), IH(0x1F80))                          \
         mxcsr_ld(Mebp, inf_FCTRL(0*4))                                      \
         sregs_la()                                                          \
-        stack_la()                                                          \
+        stack_lm()                                                          \
         movlb_ld(%[Reax_])                                                  \
         : [Reax_] "+r" (__Reax__)                                           \
         : [Info_]  "r" ((rt_full)__Info__)                                  \
@@ -1776,14 +2048,15 @@
 
 /* use 1 local to fix optimized builds, where locals are referenced via SP,
  * while stack ops from within the asm block aren't counted into offsets */
-#define ASM_ENTER_F(__Info__)                                               \
+#define ASM_ENTER_F_R(__Info__, __Base__, __Simd__)                         \
 {                                                                           \
     rt_full __Reax__;                                                       \
     asm volatile                                                            \
     (                                                                       \
         movlb_st(%[Reax_])                                                  \
         movlb_ld(%[Info_])                                                  \
-        stack_sa()                                                          \
+        ASM_MSK(__Base__, __Simd__)                                         \
+        stack_sm()                                                          \
         movxx_rr(Rebp, Reax)                                                \
         sregs_sa()                                                          \
         movwx_mi(Mebp, inf_FCTRL(3*4), IH(0xFF80))                          \
@@ -1796,7 +2069,7 @@
         movwx_mi(Mebp, inf_FCTRL(0*4), IH(0x1F80))                          \
         mxcsr_ld(Mebp, inf_FCTRL(0*4))                                      \
         sregs_la()                                                          \
-        stack_la()                                                          \
+        stack_lm()                                                          \
         movlb_ld(%[Reax_])                                                  \
         : [Reax_] "+r" (__Reax__)                                           \
         : [Info_]  "r" ((rt_full)__Info__)                                  \
@@ -1806,6 +2079,8 @@
 
 #endif /* RT_SIMD_FAST_FCTRL */
 
+#endif /* RT_JIT */
+
 #ifndef RT_SIMD_CODE
 #define sregs_sa()
 #define sregs_la()
@@ -1939,21 +2214,22 @@
 
 /* use 1 local to fix optimized builds, where locals are referenced via SP,
  * while stack ops from within the asm block aren't counted into offsets */
-#define ASM_ENTER(__Info__)                                                 \
+#define ASM_ENTER_R(__Info__, __Base__, __Simd__)                           \
 {                                                                           \
     rt_word __Reax__;                                                       \
     asm volatile                                                            \
     (                                                                       \
         movlb_st(%[Reax_])                                                  \
         movlb_ld(%[Info_])                                                  \
-        stack_sa()                                                          \
+        ASM_MSK(__Base__, __Simd__)                                         \
+        stack_sm()                                                          \
         movxx_rr(Rebp, Reax)                                                \
         sregs_sa()                                                          \
         movwx_mi(Mebp, inf_FCTRL(0*4), IH(0x1F80))
 
 #define ASM_LEAVE(__Info__)                                                 \
         sregs_la()                                                          \
-        stack_la()                                                          \
+        stack_lm()                                                          \
         movlb_ld(%[Reax_])                                                  \
         : [Reax_] "+r" (__Reax__)                                           \
         : [Info_]  "r" ((rt_word)__Info__)                                  \
@@ -1965,14 +2241,15 @@
 
 /* use 1 local to fix optimized builds, where locals are referenced via SP,
  * while stack ops from within the asm block aren't counted into offsets */
-#define ASM_ENTER(__Info__)                                                 \
+#define ASM_ENTER_R(__Info__, __Base__, __Simd__)                           \
 {                                                                           \
     rt_word __Reax__;                                                       \
     asm volatile                                                            \
     (                                                                       \
         movlb_st(%[Reax_])                                                  \
         movlb_ld(%[Info_])                                                  \
-        stack_sa()                                                          \
+        ASM_MSK(__Base__, __Simd__)                                         \
+        stack_sm()                                                          \
         movxx_rr(Rebp, Reax)                                                \
         sregs_sa()                                                          \
         movwx_mi(Mebp, inf_FCTRL(3*4), IH(0x7F80))                          \
@@ -1982,7 +2259,7 @@
 
 #define ASM_LEAVE(__Info__)                                                 \
         sregs_la()                                                          \
-        stack_la()                                                          \
+        stack_lm()                                                          \
         movlb_ld(%[Reax_])                                                  \
         : [Reax_] "+r" (__Reax__)                                           \
         : [Info_]  "r" ((rt_word)__Info__)                                  \
@@ -1993,7 +2270,8 @@
 #endif /* RT_SIMD_FAST_FCTRL */
 #else /* RT_SIMD_FLUSH_ZERO */
 
-#define ASM_ENTER(__Info__) ASM_ENTER_F(__Info__)
+#define ASM_ENTER_R(__Info__, __Base__, __Simd__)                           \
+        ASM_ENTER_F_R(__Info__, __Base__, __Simd__)
 
 #define ASM_LEAVE(__Info__) ASM_LEAVE_F(__Info__)
 
@@ -2010,14 +2288,15 @@
 
 /* use 1 local to fix optimized builds, where locals are referenced via SP,
  * while stack ops from within the asm block aren't counted into offsets */
-#define ASM_ENTER_F(__Info__)                                               \
+#define ASM_ENTER_F_R(__Info__, __Base__, __Simd__)                         \
 {                                                                           \
     rt_word __Reax__;                                                       \
     asm volatile                                                            \
     (                                                                       \
         movlb_st(%[Reax_])                                                  \
         movlb_ld(%[Info_])                                                  \
-        stack_sa()                                                          \
+        ASM_MSK(__Base__, __Simd__)                                         \
+        stack_sm()                                                          \
         movxx_rr(Rebp, Reax)                                                \
         sregs_sa()                                                          \
         movwx_mi(Mebp, inf_FCTRL(0*4), IH(0x9F80))                          \
@@ -2027,7 +2306,7 @@
         movwx_mi(Mebp, inf_FCTRL(0*4), IH(0x1F80))                          \
         mxcsr_ld(Mebp, inf_FCTRL(0*4))                                      \
         sregs_la()                                                          \
-        stack_la()                                                          \
+        stack_lm()                                                          \
         movlb_ld(%[Reax_])                                                  \
         : [Reax_] "+r" (__Reax__)                                           \
         : [Info_]  "r" ((rt_word)__Info__)                                  \
@@ -2039,14 +2318,15 @@
 
 /* use 1 local to fix optimized builds, where locals are referenced via SP,
  * while stack ops from within the asm block aren't counted into offsets */
-#define ASM_ENTER_F(__Info__)                                               \
+#define ASM_ENTER_F_R(__Info__, __Base__, __Simd__)                         \
 {                                                                           \
     rt_word __Reax__;                                                       \
     asm volatile                                                            \
     (                                                                       \
         movlb_st(%[Reax_])                                                  \
         movlb_ld(%[Info_])                                                  \
-        stack_sa()                                                          \
+        ASM_MSK(__Base__, __Simd__)                                         \
+        stack_sm()                                                          \
         movxx_rr(Rebp, Reax)                                                \
         sregs_sa()                                                          \
         movwx_mi(Mebp, inf_FCTRL(3*4), IH(0xFF80))                          \
@@ -2059,7 +2339,7 @@
         movwx_mi(Mebp, inf_FCTRL(0*4), IH(0x1F80))                          \
         mxcsr_ld(Mebp, inf_FCTRL(0*4))                                      \
         sregs_la()                                                          \
-        stack_la()                                                          \
+        stack_lm()                                                          \
         movlb_ld(%[Reax_])                                                  \
         : [Reax_] "+r" (__Reax__)                                           \
         : [Info_]  "r" ((rt_word)__Info__)                                  \
@@ -2075,7 +2355,112 @@
 #define mxcsr_ld(MS, DS)
 #endif /* RT_SIMD_CODE */
 
-#endif /* RT_ARM, RT_A32/A64, RT_M32/M64, RT_P32/P64, RT_X32/X64, RT_X86 */
+/* ------------------------------   C32, C64   ------------------------------ */
+
+#elif (defined RT_C32) || (defined RT_C64)
+
+/* the C reference target expands every instruction into a plain C statement,
+ * BASE regs/flags/stack are locals of the ASM block, SIMD regs are emulated
+ * in rt_SIMD_REGS storage, labels rely on GCC/Clang labels-as-values */
+
+#define EMPTY                   /* empty */
+
+#define movlb_ld(lb)/*Reax*/                                                \
+        __Reg__[Teax] = (rt_uptr)(lb);
+
+#define movlb_st(lb)/*Reax*/                                                \
+        lb = (rt_word)__Reg__[Teax];
+
+#define label_ld(lb)/*Reax*/                                                \
+        __Reg__[Teax] = (rt_uptr)&&lb;
+
+#define label_st(lb, MD, DD)                                                \
+        label_ld(lb)/*Reax*/                                                \
+        *(rt_pntr *)ADR(MD, DD) = (rt_pntr)(rt_uptr)__Reg__[Teax];
+
+/* RT_SIMD_FAST_FCTRL saves 1 instruction on FCTRL blocks entry
+ * and can be enabled if ASM_ENTER(_F)/ASM_LEAVE(_F)/ROUND*(_F)
+ * with (_F) and without (_F) are not intermixed in the code */
+#ifndef RT_SIMD_FAST_FCTRL
+#define RT_SIMD_FAST_FCTRL      1
+#endif /* RT_SIMD_FAST_FCTRL */
+
+/* RT_SIMD_FLUSH_ZERO when enabled changes the default behavior
+ * of ASM_ENTER/ASM_LEAVE/ROUND* to corresponding _F version */
+#ifndef RT_SIMD_FLUSH_ZERO
+#define RT_SIMD_FLUSH_ZERO      RT_SIMD_FLUSH_ZERO_MASTER
+#endif /* RT_SIMD_FLUSH_ZERO */
+
+/* RT_SIMD_COMPAT_XMM distinguishes between SIMD reg-file sizes
+ * with current top values: 0 - 16, 1 - 15, 2 - 14 SIMD regs */
+#ifndef RT_SIMD_COMPAT_XMM
+#define RT_SIMD_COMPAT_XMM      RT_SIMD_COMPAT_XMM_MASTER
+#endif /* RT_SIMD_COMPAT_XMM */
+
+/* RT_SIMD_COMPAT_RCP when enabled changes the default behavior
+ * of rcpps_** instructions to their full-precision fallback */
+#ifndef RT_SIMD_COMPAT_RCP
+#define RT_SIMD_COMPAT_RCP      RT_SIMD_COMPAT_RCP_MASTER
+#endif /* RT_SIMD_COMPAT_RCP */
+
+/* RT_SIMD_COMPAT_RSQ when enabled changes the default behavior
+ * of rsqps_** instructions to their full-precision fallback */
+#ifndef RT_SIMD_COMPAT_RSQ
+#define RT_SIMD_COMPAT_RSQ      RT_SIMD_COMPAT_RSQ_MASTER
+#endif /* RT_SIMD_COMPAT_RSQ */
+
+/* RT_SIMD_COMPAT_FMA when enabled changes the default behavior
+ * of fmaps_** instructions to their full-precision fallback */
+#ifndef RT_SIMD_COMPAT_FMA
+#define RT_SIMD_COMPAT_FMA      RT_SIMD_COMPAT_FMA_MASTER
+#endif /* RT_SIMD_COMPAT_FMA */
+
+/* RT_SIMD_COMPAT_FMS when enabled changes the default behavior
+ * of fmsps_** instructions to their full-precision fallback */
+#ifndef RT_SIMD_COMPAT_FMS
+#define RT_SIMD_COMPAT_FMS      RT_SIMD_COMPAT_FMS_MASTER
+#endif /* RT_SIMD_COMPAT_FMS */
+
+#if   (RT_128X1 >= 1) && (RT_SIMD == 128) && (RT_REGS <= 32)
+#include "rtarch_c64_128x1v1.h"
+#else  /* report an error if header file is not selected */
+#error "couldn't select appropriate SIMD target, check build flags"
+#endif /* RT_SIMD: 128 */
+
+/*
+ * ASM_ENTER/ASM_LEAVE open/close a C block, which holds the emulated BASE
+ * register file, flags and stack, while SIMD registers are kept in memory
+ * pointed to by inf_REGS, thus the whole section can be stepped through
+ * in a debugger statement by statement (best built with -O0 -g options).
+ * Flush-to-zero mode isn't emulated, therefore _F versions are the same.
+ */
+
+#define ASM_ENTER_R(__Info__, __Base__, __Simd__)                           \
+{                                                                           \
+    rt_ui64 __Reg__[RT_BASE_REGS], __Stk__[128], __Cfs__ = 0, __Cft__ = 0;  \
+    rt_pntr __Xmm__ = (rt_pntr)(rt_word)((__Info__)->regs);                 \
+    rt_si32 __Stp__ = 0;                                                    \
+    (void)__Stk__; (void)__Stp__; (void)__Cfs__; (void)__Cft__;             \
+    (void)__Xmm__;                                                          \
+        movlb_ld(__Info__)                                                  \
+        movxx_rr(Rebp, Reax)                                                \
+        sregs_sa()
+
+#define ASM_LEAVE(__Info__)                                                 \
+        sregs_la()                                                          \
+}
+
+#define ASM_ENTER_F_R(__Info__, __Base__, __Simd__)                         \
+        ASM_ENTER_R(__Info__, __Base__, __Simd__)
+
+#define ASM_LEAVE_F(__Info__) ASM_LEAVE(__Info__)
+
+#ifndef RT_SIMD_CODE
+#define sregs_sa()
+#define sregs_la()
+#endif /* RT_SIMD_CODE */
+
+#endif /* RT_ARM, RT_A32/A64, RT_M32/M64, RT_P32/P64, RT_X32/X64, X86, C32/64 */
 
 /*******************************   WIN32, MSVC   ******************************/
 
@@ -2211,21 +2596,22 @@
 
 /* use 1 local to fix optimized builds, where locals are referenced via SP,
  * while stack ops from within the asm block aren't counted into offsets */
-#define ASM_ENTER(__Info__)                                                 \
+#define ASM_ENTER_R(__Info__, __Base__, __Simd__)                           \
 {                                                                           \
     rt_word __Reax__;                                                       \
     __asm                                                                   \
     {                                                                       \
         movlb_st(__Reax__)                                                  \
         movlb_ld(__Info__)                                                  \
-        stack_sa()                                                          \
+        ASM_MSK(__Base__, __Simd__)                                         \
+        stack_sm()                                                          \
         movxx_rr(Rebp, Reax)                                                \
         sregs_sa()                                                          \
         movwx_mi(Mebp, inf_FCTRL(0*4), IH(0x1F80))
 
 #define ASM_LEAVE(__Info__)                                                 \
         sregs_la()                                                          \
-        stack_la()                                                          \
+        stack_lm()                                                          \
         movlb_ld(__Reax__)                                                  \
     }                                                                       \
 }
@@ -2234,14 +2620,15 @@
 
 /* use 1 local to fix optimized builds, where locals are referenced via SP,
  * while stack ops from within the asm block aren't counted into offsets */
-#define ASM_ENTER(__Info__)                                                 \
+#define ASM_ENTER_R(__Info__, __Base__, __Simd__)                           \
 {                                                                           \
     rt_word __Reax__;                                                       \
     __asm                                                                   \
     {                                                                       \
         movlb_st(__Reax__)                                                  \
         movlb_ld(__Info__)                                                  \
-        stack_sa()                                                          \
+        ASM_MSK(__Base__, __Simd__)                                         \
+        stack_sm()                                                          \
         movxx_rr(Rebp, Reax)                                                \
         sregs_sa()                                                          \
         movwx_mi(Mebp, inf_FCTRL(3*4), IH(0x7F80))                          \
@@ -2251,7 +2638,7 @@
 
 #define ASM_LEAVE(__Info__)                                                 \
         sregs_la()                                                          \
-        stack_la()                                                          \
+        stack_lm()                                                          \
         movlb_ld(__Reax__)                                                  \
     }                                                                       \
 }
@@ -2259,7 +2646,8 @@
 #endif /* RT_SIMD_FAST_FCTRL */
 #else /* RT_SIMD_FLUSH_ZERO */
 
-#define ASM_ENTER(__Info__) ASM_ENTER_F(__Info__)
+#define ASM_ENTER_R(__Info__, __Base__, __Simd__)                           \
+        ASM_ENTER_F_R(__Info__, __Base__, __Simd__)
 
 #define ASM_LEAVE(__Info__) ASM_LEAVE_F(__Info__)
 
@@ -2276,14 +2664,15 @@
 
 /* use 1 local to fix optimized builds, where locals are referenced via SP,
  * while stack ops from within the asm block aren't counted into offsets */
-#define ASM_ENTER_F(__Info__)                                               \
+#define ASM_ENTER_F_R(__Info__, __Base__, __Simd__)                         \
 {                                                                           \
     rt_word __Reax__;                                                       \
     __asm                                                                   \
     {                                                                       \
         movlb_st(__Reax__)                                                  \
         movlb_ld(__Info__)                                                  \
-        stack_sa()                                                          \
+        ASM_MSK(__Base__, __Simd__)                                         \
+        stack_sm()                                                          \
         movxx_rr(Rebp, Reax)                                                \
         sregs_sa()                                                          \
         movwx_mi(Mebp, inf_FCTRL(0*4), IH(0x9F80))                          \
@@ -2293,7 +2682,7 @@
         movwx_mi(Mebp, inf_FCTRL(0*4), IH(0x1F80))                          \
         mxcsr_ld(Mebp, inf_FCTRL(0*4))                                      \
         sregs_la()                                                          \
-        stack_la()                                                          \
+        stack_lm()                                                          \
         movlb_ld(__Reax__)                                                  \
     }                                                                       \
 }
@@ -2302,14 +2691,15 @@
 
 /* use 1 local to fix optimized builds, where locals are referenced via SP,
  * while stack ops from within the asm block aren't counted into offsets */
-#define ASM_ENTER_F(__Info__)                                               \
+#define ASM_ENTER_F_R(__Info__, __Base__, __Simd__)                         \
 {                                                                           \
     rt_word __Reax__;                                                       \
     __asm                                                                   \
     {                                                                       \
         movlb_st(__Reax__)                                                  \
         movlb_ld(__Info__)                                                  \
-        stack_sa()                                                          \
+        ASM_MSK(__Base__, __Simd__)                                         \
+        stack_sm()                                                          \
         movxx_rr(Rebp, Reax)                                                \
         sregs_sa()                                                          \
         movwx_mi(Mebp, inf_FCTRL(3*4), IH(0xFF80))                          \
@@ -2322,7 +2712,7 @@
         movwx_mi(Mebp, inf_FCTRL(0*4), IH(0x1F80))                          \
         mxcsr_ld(Mebp, inf_FCTRL(0*4))                                      \
         sregs_la()                                                          \
-        stack_la()                                                          \
+        stack_lm()                                                          \
         movlb_ld(__Reax__)                                                  \
     }                                                                       \
 }
@@ -2339,6 +2729,18 @@
 
 #endif /* OS, COMPILER, ARCH */
 
+/*
+ * ASM_ENTER(_F) save/load all available registers, while ASM_ENTER_R(_F)
+ * save/load only registers listed in "base" (RT_BASE_*) and "simd" (XmmN
+ * as bit N) masks, which allows to reduce the cost of short ASM sections.
+ * Both are closed with the same ASM_LEAVE(_F) (check definitions above).
+ */
+#define ASM_ENTER(__Info__)                                                 \
+        ASM_ENTER_R(__Info__, RT_BASE_ALL, RT_SIMD_ALL)
+
+#define ASM_ENTER_F(__Info__)                                               \
+        ASM_ENTER_F_R(__Info__, RT_BASE_ALL, RT_SIMD_ALL)
+
 #endif /* RT_RTARCH_H */
 
 /******************************************************************************/
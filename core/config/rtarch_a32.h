@@ -1491,6 +1491,20 @@
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C3(DS), EMPTY2)   \
         EMITW(0x0B000000 | MRM(REG(RD), MOD(MS), TDxx) | ADR)
 
+/* prf (prefetch M into cache level hint: PF_L1, PF_L2, PF_LL, PF_NT)
+ * set-flags: no, never faults, may be issued past the end of an array
+ * hints map to prfm pldl1keep/l2keep/l3keep/l1strm */
+
+#define PF_L1   0x00
+#define PF_L2   0x02
+#define PF_LL   0x04
+#define PF_NT   0x01
+
+#define prfxx_ld(MS, DS, hint)                                              \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C3(DS), EMPTY2)   \
+        EMITW(0x0B000000 | MRM(TPxx,    MOD(MS), TDxx) | ADR)               \
+        EMITW(0xF9800000 | MRM((hint),  TPxx,    0x00))
+
 /************************* pointer-sized instructions *************************/
 
 /* label (D = Reax = adr lb)
@@ -1606,6 +1620,56 @@
         EMITW(0xA8C10000 | MRM(Tedx,    SPxx,    0x00) | Tebx << 10)        \
         EMITW(0xA8C10000 | MRM(Teax,    SPxx,    0x00) | Tecx << 10)
 
+#define stack_sm()   /* save listed [Reax - RegE] in pairs + 8 temps */     \
+        ASM_IFB(RT_BASE_Reax | RT_BASE_Recx)                                \
+        EMITW(0xA9BF0000 | MRM(Teax,    SPxx,    0x00) | Tecx << 10)        \
+        ASM_FI                                                              \
+        ASM_IFB(RT_BASE_Redx | RT_BASE_Rebx)                                \
+        EMITW(0xA9BF0000 | MRM(Tedx,    SPxx,    0x00) | Tebx << 10)        \
+        ASM_FI                                                              \
+        EMITW(0xA9BF0000 | MRM(Tebp,    SPxx,    0x00) | Tesi << 10)        \
+        ASM_IFB(RT_BASE_Redi | RT_BASE_Reg8)                                \
+        EMITW(0xA9BF0000 | MRM(Tedi,    SPxx,    0x00) | Teg8 << 10)        \
+        ASM_FI                                                              \
+        ASM_IFB(RT_BASE_Reg9 | RT_BASE_RegA)                                \
+        EMITW(0xA9BF0000 | MRM(Teg9,    SPxx,    0x00) | TegA << 10)        \
+        ASM_FI                                                              \
+        ASM_IFB(RT_BASE_RegB | RT_BASE_RegC)                                \
+        EMITW(0xA9BF0000 | MRM(TegB,    SPxx,    0x00) | TegC << 10)        \
+        ASM_FI                                                              \
+        ASM_IFB(RT_BASE_RegD | RT_BASE_RegE)                                \
+        EMITW(0xA9BF0000 | MRM(TegD,    SPxx,    0x00) | TegE << 10)        \
+        ASM_FI                                                              \
+        EMITW(0xA9BF0000 | MRM(TMxx,    SPxx,    0x00) | TIxx << 10)        \
+        EMITW(0xA9BF0000 | MRM(TDxx,    SPxx,    0x00) | TPxx << 10)        \
+        EMITW(0xA9BF0000 | MRM(TNxx,    SPxx,    0x00) | TAxx << 10)        \
+        EMITW(0xA9BF0000 | MRM(TCxx,    SPxx,    0x00) | TExx << 10)
+
+#define stack_lm()   /* load listed 8 temps + [RegE - Reax] in pairs */     \
+        EMITW(0xA8C10000 | MRM(TCxx,    SPxx,    0x00) | TExx << 10)        \
+        EMITW(0xA8C10000 | MRM(TNxx,    SPxx,    0x00) | TAxx << 10)        \
+        EMITW(0xA8C10000 | MRM(TDxx,    SPxx,    0x00) | TPxx << 10)        \
+        EMITW(0xA8C10000 | MRM(TMxx,    SPxx,    0x00) | TIxx << 10)        \
+        ASM_IFB(RT_BASE_RegD | RT_BASE_RegE)                                \
+        EMITW(0xA8C10000 | MRM(TegD,    SPxx,    0x00) | TegE << 10)        \
+        ASM_FI                                                              \
+        ASM_IFB(RT_BASE_RegB | RT_BASE_RegC)                                \
+        EMITW(0xA8C10000 | MRM(TegB,    SPxx,    0x00) | TegC << 10)        \
+        ASM_FI                                                              \
+        ASM_IFB(RT_BASE_Reg9 | RT_BASE_RegA)                                \
+        EMITW(0xA8C10000 | MRM(Teg9,    SPxx,    0x00) | TegA << 10)        \
+        ASM_FI                                                              \
+        ASM_IFB(RT_BASE_Redi | RT_BASE_Reg8)                                \
+        EMITW(0xA8C10000 | MRM(Tedi,    SPxx,    0x00) | Teg8 << 10)        \
+        ASM_FI                                                              \
+        EMITW(0xA8C10000 | MRM(Tebp,    SPxx,    0x00) | Tesi << 10)        \
+        ASM_IFB(RT_BASE_Redx | RT_BASE_Rebx)                                \
+        EMITW(0xA8C10000 | MRM(Tedx,    SPxx,    0x00) | Tebx << 10)        \
+        ASM_FI                                                              \
+        ASM_IFB(RT_BASE_Reax | RT_BASE_Recx)                                \
+        EMITW(0xA8C10000 | MRM(Teax,    SPxx,    0x00) | Tecx << 10)        \
+        ASM_FI
+
 /******************************************************************************/
 /********************************   INTERNAL   ********************************/
 /******************************************************************************/
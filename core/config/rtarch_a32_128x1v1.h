@@ -248,6 +248,25 @@
         EMITW(0x6EA01C00 | MXM(TmmM,    REG(XS), Tmm0))                     \
         EMITW(0x3C800000 | MPM(TmmM,    MOD(MG), VAL(DG), B2(DG), P2(DG)))
 
+/* cvx, cux, cvy, cuy use fcvtn/fcvtn2 and fcvtl/fcvtl2 (rounding follows
+ * FPCR), fp16 elements are packed in lower/upper 64-bit halves */
+
+#undef  cvxis_rr
+#define cvxis_rr(XD, XS)                                                    \
+        EMITW(0x0E216800 | MXM(REG(XD), REG(XS), 0x00))
+
+#undef  cuxis_rr
+#define cuxis_rr(XG, XS)                                                    \
+        EMITW(0x4E216800 | MXM(REG(XG), REG(XS), 0x00))
+
+#undef  cvygs_rr
+#define cvygs_rr(XD, XS)                                                    \
+        EMITW(0x0E217800 | MXM(REG(XD), REG(XS), 0x00))
+
+#undef  cuygs_rr
+#define cuygs_rr(XD, XS)                                                    \
+        EMITW(0x4E217800 | MXM(REG(XD), REG(XS), 0x00))
+
 /* and (G = G & S), (D = S & T) if (#D != #S) */
 
 #define andix_rr(XG, XS)                                                    \
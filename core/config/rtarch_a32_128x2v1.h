@@ -1045,35 +1045,35 @@
 #undef  sregs_sa
 #define sregs_sa() /* save all SIMD regs, destroys Reax */                  \
         movxx_ld(Reax, Mebp, inf_REGS)                                      \
-        movcx_st(Xmm0, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFF8001) movcx_st(Xmm0, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(Xmm1, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFF8002) movcx_st(Xmm1, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(Xmm2, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFF8004) movcx_st(Xmm2, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(Xmm3, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFF8008) movcx_st(Xmm3, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(Xmm4, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFF8010) movcx_st(Xmm4, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(Xmm5, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFF8020) movcx_st(Xmm5, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(Xmm6, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFF8040) movcx_st(Xmm6, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(Xmm7, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFF8080) movcx_st(Xmm7, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(Xmm8, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFF8100) movcx_st(Xmm8, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(Xmm9, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFF8200) movcx_st(Xmm9, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(XmmA, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFF8400) movcx_st(XmmA, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(XmmB, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFF8800) movcx_st(XmmB, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(XmmC, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFF9000) movcx_st(XmmC, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(XmmD, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFFA000) movcx_st(XmmD, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(XmmE, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFFC000) movcx_st(XmmE, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
         EMITW(0x3D800000 | MXM(TmmQ,    Teax,    0x00))                     \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_128*4))                           \
@@ -1082,35 +1082,35 @@
 #undef  sregs_la
 #define sregs_la() /* load all SIMD regs, destroys Reax */                  \
         movxx_ld(Reax, Mebp, inf_REGS)                                      \
-        movcx_ld(Xmm0, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFF8001) movcx_ld(Xmm0, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(Xmm1, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFF8002) movcx_ld(Xmm1, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(Xmm2, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFF8004) movcx_ld(Xmm2, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(Xmm3, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFF8008) movcx_ld(Xmm3, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(Xmm4, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFF8010) movcx_ld(Xmm4, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(Xmm5, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFF8020) movcx_ld(Xmm5, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(Xmm6, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFF8040) movcx_ld(Xmm6, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(Xmm7, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFF8080) movcx_ld(Xmm7, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(Xmm8, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFF8100) movcx_ld(Xmm8, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(Xmm9, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFF8200) movcx_ld(Xmm9, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(XmmA, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFF8400) movcx_ld(XmmA, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(XmmB, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFF8800) movcx_ld(XmmB, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(XmmC, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFF9000) movcx_ld(XmmC, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(XmmD, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFFA000) movcx_ld(XmmD, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(XmmE, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFFC000) movcx_ld(XmmE, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
         EMITW(0x3DC00000 | MXM(TmmQ,    Teax,    0x00))                     \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_128*4))                           \
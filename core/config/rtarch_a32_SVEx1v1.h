@@ -180,6 +180,84 @@
         EMITW(0x05A0C400 | MXM(TmmM,    REG(XS), TmmM))                     \
         EMITW(0xE5804000 | MPM(TmmM,    MOD(MG), VAL(DG), B3(DG), F1(DG)))
 
+/* gth (D = [M + S]), sct ([M + T] = S) use SVE vector-index addressing */
+
+#undef  gthox_ld
+#define gthox_ld(XD, XS, MT, DT) /* M: Oeax, M*** only */                   \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C3(DT), EMPTY2)   \
+        EMITW(0x0B000000 | MRM(TPxx,    MOD(MT), TDxx) | ADR)               \
+        EMITW(0x85204000 | MXM(REG(XD), TPxx,    REG(XS)))
+
+#undef  sctox_st
+#define sctox_st(XS, XT, MD, DD) /* M: Oeax, M*** only */                   \
+        AUW(SIB(MD),  EMPTY,  EMPTY,    MOD(MD), VAL(DD), C3(DD), EMPTY2)   \
+        EMITW(0x0B000000 | MRM(TPxx,    MOD(MD), TDxx) | ADR)               \
+        EMITW(0xE5608000 | MXM(REG(XS), TPxx,    REG(XT)))
+
+/* spl, rev, rot, unl, unh, tbl use SVE dup, rev, ext, zip1/zip2 and tbl,
+ * indices are taken modulo lane-count via and-immediate in TmmM first */
+
+#undef  splox_ri
+#define splox_ri(XD, XS, IS)                                                \
+        EMITW(0x2538C000 | MXM(TmmM,    (VAL(IS) & (Q*4-1)), 0x00))         \
+        EMITW(0x05A03000 | MXM(REG(XD), REG(XS), TmmM))
+
+#undef  revox_rr
+#define revox_rr(XD, XS)                                                    \
+        EMITW(0x05B83800 | MXM(REG(XD), REG(XS), 0x00))
+
+#undef  rotox_ri
+#define rotox_ri(XD, XS, IS)                                                \
+        movox_rr(W(XD), W(XS))                                              \
+        EMITW(0x05200000 | MXM(REG(XD), REG(XD), (VAL(IS) & (Q*4-1)) >> 1)  \
+                         | (VAL(IS) & 1) << 12)
+
+#undef  unlox_rr
+#define unlox_rr(XG, XS)                                                    \
+        EMITW(0x05A06000 | MXM(REG(XG), REG(XG), REG(XS)))
+
+#undef  unhox_rr
+#define unhox_rr(XG, XS)                                                    \
+        EMITW(0x05A06400 | MXM(REG(XG), REG(XG), REG(XS)))
+
+#undef  tblox_rr
+#define tblox_rr(XD, XS, XT)                                                \
+        EMITW(0x04603000 | MXM(TmmM,    REG(XT), REG(XT)))                  \
+        EMITW(0x05800000 | MXM(TmmM,    (2 + Q/4 - Q/16), 0x00))            \
+        EMITW(0x05A03000 | MXM(REG(XD), REG(XS), TmmM))
+
+#undef  tblox_ld
+#define tblox_ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A1(DT), EMPTY2)   \
+        EMITW(0x85804000 | MPM(TmmM,    MOD(MT), VAL(DT), B3(DT), F1(DT)))  \
+        EMITW(0x05800000 | MXM(TmmM,    (2 + Q/4 - Q/16), 0x00))            \
+        EMITW(0x05A03000 | MXM(REG(XD), REG(XS), TmmM))
+
+/* mtl (D = first RS elements from M), see rtbase.h for notes, p1 is set
+ * by whilelt from zero to the count, contiguous ld1/st1 are predicated */
+
+#undef  mtlox_ld
+#define mtlox_ld(XD, RS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C3(DT), EMPTY2)   \
+        EMITW(0x0B000000 | MRM(TPxx,    MOD(MT), TDxx) | ADR)               \
+        EMITW(0x25A00400 | MXM(0x01,    0x1F,    REG(RS)))                  \
+        EMITW(0xA540A400 | MXM(REG(XD), TPxx,    0x00))
+
+#undef  mtlox_st
+#define mtlox_st(XS, RT, MD, DD)                                            \
+        AUW(SIB(MD),  EMPTY,  EMPTY,    MOD(MD), VAL(DD), C3(DD), EMPTY2)   \
+        EMITW(0x0B000000 | MRM(TPxx,    MOD(MD), TDxx) | ADR)               \
+        EMITW(0x25A00400 | MXM(0x01,    0x1F,    REG(RT)))                  \
+        EMITW(0xE540E400 | MXM(REG(XS), TPxx,    0x00))
+
+/* stn (M = S) streams to M bypassing caches (stnt1, all-true p0) */
+
+#undef  stnox_st
+#define stnox_st(XS, MD, DD)                                                \
+        AUW(SIB(MD),  EMPTY,  EMPTY,    MOD(MD), VAL(DD), C3(DD), EMPTY2)   \
+        EMITW(0x0B000000 | MRM(TPxx,    MOD(MD), TDxx) | ADR)               \
+        EMITW(0xE510E000 | MXM(REG(XS), TPxx,    0x00))
+
 /* and (G = G & S), (D = S & T) if (#D != #S) */
 
 #define andox_rr(XG, XS)                                                    \
@@ -1077,65 +1155,65 @@
 #undef  sregs_sa
 #define sregs_sa() /* save all SIMD regs, destroys Reax */                  \
         movxx_ld(Reax, Mebp, inf_REGS)                                      \
-        movox_st(Xmm0, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000001) movox_st(Xmm0, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(Xmm1, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000002) movox_st(Xmm1, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(Xmm2, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000004) movox_st(Xmm2, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(Xmm3, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000008) movox_st(Xmm3, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(Xmm4, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000010) movox_st(Xmm4, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(Xmm5, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000020) movox_st(Xmm5, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(Xmm6, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000040) movox_st(Xmm6, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(Xmm7, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000080) movox_st(Xmm7, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(Xmm8, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000100) movox_st(Xmm8, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(Xmm9, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000200) movox_st(Xmm9, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(XmmA, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000400) movox_st(XmmA, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(XmmB, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000800) movox_st(XmmB, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(XmmC, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00001000) movox_st(XmmC, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(XmmD, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00002000) movox_st(XmmD, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(XmmE, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00004000) movox_st(XmmE, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(XmmF, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00008000) movox_st(XmmF, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(XmmG, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00010000) movox_st(XmmG, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(XmmH, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00020000) movox_st(XmmH, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(XmmI, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00040000) movox_st(XmmI, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(XmmJ, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00080000) movox_st(XmmJ, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(XmmK, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00100000) movox_st(XmmK, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(XmmL, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00200000) movox_st(XmmL, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(XmmM, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00400000) movox_st(XmmM, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(XmmN, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00800000) movox_st(XmmN, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(XmmO, Oeax, PLAIN)                                         \
+        ASM_IFS(0x01000000) movox_st(XmmO, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(XmmP, Oeax, PLAIN)                                         \
+        ASM_IFS(0x02000000) movox_st(XmmP, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(XmmQ, Oeax, PLAIN)                                         \
+        ASM_IFS(0x04000000) movox_st(XmmQ, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(XmmR, Oeax, PLAIN)                                         \
+        ASM_IFS(0x08000000) movox_st(XmmR, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(XmmS, Oeax, PLAIN)                                         \
+        ASM_IFS(0x10000000) movox_st(XmmS, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(XmmT, Oeax, PLAIN)                                         \
+        ASM_IFS(0x20000000) movox_st(XmmT, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
         EMITW(0xE5804000 | MXM(TmmQ,    Teax,    0x00))                     \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
@@ -1148,65 +1226,65 @@
 #undef  sregs_la
 #define sregs_la() /* load all SIMD regs, destroys Reax */                  \
         movxx_ld(Reax, Mebp, inf_REGS)                                      \
-        movox_ld(Xmm0, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000001) movox_ld(Xmm0, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(Xmm1, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000002) movox_ld(Xmm1, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(Xmm2, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000004) movox_ld(Xmm2, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(Xmm3, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000008) movox_ld(Xmm3, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(Xmm4, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000010) movox_ld(Xmm4, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(Xmm5, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000020) movox_ld(Xmm5, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(Xmm6, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000040) movox_ld(Xmm6, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(Xmm7, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000080) movox_ld(Xmm7, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(Xmm8, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000100) movox_ld(Xmm8, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(Xmm9, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000200) movox_ld(Xmm9, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(XmmA, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000400) movox_ld(XmmA, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(XmmB, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000800) movox_ld(XmmB, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(XmmC, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00001000) movox_ld(XmmC, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(XmmD, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00002000) movox_ld(XmmD, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(XmmE, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00004000) movox_ld(XmmE, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(XmmF, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00008000) movox_ld(XmmF, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(XmmG, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00010000) movox_ld(XmmG, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(XmmH, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00020000) movox_ld(XmmH, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(XmmI, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00040000) movox_ld(XmmI, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(XmmJ, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00080000) movox_ld(XmmJ, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(XmmK, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00100000) movox_ld(XmmK, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(XmmL, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00200000) movox_ld(XmmL, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(XmmM, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00400000) movox_ld(XmmM, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(XmmN, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00800000) movox_ld(XmmN, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(XmmO, Oeax, PLAIN)                                         \
+        ASM_IFS(0x01000000) movox_ld(XmmO, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(XmmP, Oeax, PLAIN)                                         \
+        ASM_IFS(0x02000000) movox_ld(XmmP, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(XmmQ, Oeax, PLAIN)                                         \
+        ASM_IFS(0x04000000) movox_ld(XmmQ, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(XmmR, Oeax, PLAIN)                                         \
+        ASM_IFS(0x08000000) movox_ld(XmmR, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(XmmS, Oeax, PLAIN)                                         \
+        ASM_IFS(0x10000000) movox_ld(XmmS, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(XmmT, Oeax, PLAIN)                                         \
+        ASM_IFS(0x20000000) movox_ld(XmmT, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
         EMITW(0x85804000 | MXM(TmmQ,    Teax,    0x00))                     \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
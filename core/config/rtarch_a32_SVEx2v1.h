@@ -1090,35 +1090,35 @@
 #undef  sregs_sa
 #define sregs_sa() /* save all SIMD regs, destroys Reax */                  \
         movxx_ld(Reax, Mebp, inf_REGS)                                      \
-        movox_st(Xmm0, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFF8001) movox_st(Xmm0, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(Xmm1, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFF8002) movox_st(Xmm1, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(Xmm2, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFF8004) movox_st(Xmm2, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(Xmm3, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFF8008) movox_st(Xmm3, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(Xmm4, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFF8010) movox_st(Xmm4, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(Xmm5, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFF8020) movox_st(Xmm5, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(Xmm6, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFF8040) movox_st(Xmm6, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(Xmm7, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFF8080) movox_st(Xmm7, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(Xmm8, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFF8100) movox_st(Xmm8, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(Xmm9, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFF8200) movox_st(Xmm9, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(XmmA, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFF8400) movox_st(XmmA, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(XmmB, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFF8800) movox_st(XmmB, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(XmmC, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFF9000) movox_st(XmmC, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(XmmD, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFFA000) movox_st(XmmD, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(XmmE, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFFC000) movox_st(XmmE, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
         EMITW(0xE5804000 | MXM(TmmQ,    Teax,    0x00))                     \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
@@ -1131,35 +1131,35 @@
 #undef  sregs_la
 #define sregs_la() /* load all SIMD regs, destroys Reax */                  \
         movxx_ld(Reax, Mebp, inf_REGS)                                      \
-        movox_ld(Xmm0, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFF8001) movox_ld(Xmm0, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(Xmm1, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFF8002) movox_ld(Xmm1, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(Xmm2, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFF8004) movox_ld(Xmm2, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(Xmm3, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFF8008) movox_ld(Xmm3, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(Xmm4, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFF8010) movox_ld(Xmm4, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(Xmm5, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFF8020) movox_ld(Xmm5, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(Xmm6, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFF8040) movox_ld(Xmm6, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(Xmm7, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFF8080) movox_ld(Xmm7, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(Xmm8, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFF8100) movox_ld(Xmm8, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(Xmm9, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFF8200) movox_ld(Xmm9, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(XmmA, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFF8400) movox_ld(XmmA, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(XmmB, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFF8800) movox_ld(XmmB, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(XmmC, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFF9000) movox_ld(XmmC, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(XmmD, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFFA000) movox_ld(XmmD, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(XmmE, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFFC000) movox_ld(XmmE, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
         EMITW(0x85804000 | MXM(TmmQ,    Teax,    0x00))                     \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
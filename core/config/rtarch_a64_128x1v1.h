@@ -710,6 +710,25 @@
         EMITW(0x4E61A800 | MXM(REG(XD), REG(XS), 0x00) |                    \
         (RT_SIMD_MODE_##mode&1) << 23 | (RT_SIMD_MODE_##mode&2) << 11)
 
+/* cvx, cux, cvy, cuy use fcvtn/fcvtn2 and fcvtl/fcvtl2 (rounding follows
+ * FPCR), fp32 elements are packed in lower/upper 64-bit halves */
+
+#undef  cvxjs_rr
+#define cvxjs_rr(XD, XS)                                                    \
+        EMITW(0x0E616800 | MXM(REG(XD), REG(XS), 0x00))
+
+#undef  cuxjs_rr
+#define cuxjs_rr(XG, XS)                                                    \
+        EMITW(0x4E616800 | MXM(REG(XG), REG(XS), 0x00))
+
+#undef  cvyis_rr
+#define cvyis_rr(XD, XS)                                                    \
+        EMITW(0x0E617800 | MXM(REG(XD), REG(XS), 0x00))
+
+#undef  cuyis_rr
+#define cuyis_rr(XD, XS)                                                    \
+        EMITW(0x4E617800 | MXM(REG(XD), REG(XS), 0x00))
+
 /************   packed double-precision integer arithmetic/shifts   ***********/
 
 /* add (G = G + S), (D = S + T) if (#D != #S) */
@@ -160,6 +160,83 @@
         EMITW(0x05E0C400 | MXM(TmmM,    REG(XS), TmmM))                     \
         EMITW(0xE5804000 | MPM(TmmM,    MOD(MG), VAL(DG), B3(DG), F1(DG)))
 
+/* gth (D = [M + S]), sct ([M + T] = S) use SVE vector-index addressing */
+
+#undef  gthqx_ld
+#define gthqx_ld(XD, XS, MT, DT) /* M: Oeax, M*** only */                   \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C3(DT), EMPTY2)   \
+        EMITW(0x0B000000 | MRM(TPxx,    MOD(MT), TDxx) | ADR)               \
+        EMITW(0xC5E0C000 | MXM(REG(XD), TPxx,    REG(XS)))
+
+#undef  sctqx_st
+#define sctqx_st(XS, XT, MD, DD) /* M: Oeax, M*** only */                   \
+        AUW(SIB(MD),  EMPTY,  EMPTY,    MOD(MD), VAL(DD), C3(DD), EMPTY2)   \
+        EMITW(0x0B000000 | MRM(TPxx,    MOD(MD), TDxx) | ADR)               \
+        EMITW(0xE5A0A000 | MXM(REG(XS), TPxx,    REG(XT)))
+
+/* spl, rev, rot, unl, unh, tbl use SVE dup, rev, ext, zip1/zip2 and tbl,
+ * indices are taken modulo lane-count via and-immediate in TmmM first */
+
+#undef  splqx_ri
+#define splqx_ri(XD, XS, IS)                                                \
+        EMITW(0x25F8C000 | MXM(TmmM,    (VAL(IS) & (Q*2-1)), 0x00))         \
+        EMITW(0x05E03000 | MXM(REG(XD), REG(XS), TmmM))
+
+#undef  revqx_rr
+#define revqx_rr(XD, XS)                                                    \
+        EMITW(0x05F83800 | MXM(REG(XD), REG(XS), 0x00))
+
+#undef  rotqx_ri
+#define rotqx_ri(XD, XS, IS)                                                \
+        movqx_rr(W(XD), W(XS))                                              \
+        EMITW(0x05200000 | MXM(REG(XD), REG(XD), (VAL(IS) & (Q*2-1))))
+
+#undef  unlqx_rr
+#define unlqx_rr(XG, XS)                                                    \
+        EMITW(0x05E06000 | MXM(REG(XG), REG(XG), REG(XS)))
+
+#undef  unhqx_rr
+#define unhqx_rr(XG, XS)                                                    \
+        EMITW(0x05E06400 | MXM(REG(XG), REG(XG), REG(XS)))
+
+#undef  tblqx_rr
+#define tblqx_rr(XD, XS, XT)                                                \
+        EMITW(0x04603000 | MXM(TmmM,    REG(XT), REG(XT)))                  \
+        EMITW(0x05820000 | MXM(TmmM,    (1 + Q/4 - Q/16), 0x00))            \
+        EMITW(0x05E03000 | MXM(REG(XD), REG(XS), TmmM))
+
+#undef  tblqx_ld
+#define tblqx_ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A1(DT), EMPTY2)   \
+        EMITW(0x85804000 | MPM(TmmM,    MOD(MT), VAL(DT), B3(DT), F1(DT)))  \
+        EMITW(0x05820000 | MXM(TmmM,    (1 + Q/4 - Q/16), 0x00))            \
+        EMITW(0x05E03000 | MXM(REG(XD), REG(XS), TmmM))
+
+/* mtl (D = first RS elements from M), see rtbase.h for notes, p1 is set
+ * by whilelt from zero to the count, contiguous ld1/st1 are predicated */
+
+#undef  mtlqx_ld
+#define mtlqx_ld(XD, RS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C3(DT), EMPTY2)   \
+        EMITW(0x0B000000 | MRM(TPxx,    MOD(MT), TDxx) | ADR)               \
+        EMITW(0x25E00400 | MXM(0x01,    0x1F,    REG(RS)))                  \
+        EMITW(0xA5E0A400 | MXM(REG(XD), TPxx,    0x00))
+
+#undef  mtlqx_st
+#define mtlqx_st(XS, RT, MD, DD)                                            \
+        AUW(SIB(MD),  EMPTY,  EMPTY,    MOD(MD), VAL(DD), C3(DD), EMPTY2)   \
+        EMITW(0x0B000000 | MRM(TPxx,    MOD(MD), TDxx) | ADR)               \
+        EMITW(0x25E00400 | MXM(0x01,    0x1F,    REG(RT)))                  \
+        EMITW(0xE5E0E400 | MXM(REG(XS), TPxx,    0x00))
+
+/* stn (M = S) streams to M bypassing caches (stnt1, all-true p0) */
+
+#undef  stnqx_st
+#define stnqx_st(XS, MD, DD)                                                \
+        AUW(SIB(MD),  EMPTY,  EMPTY,    MOD(MD), VAL(DD), C3(DD), EMPTY2)   \
+        EMITW(0x0B000000 | MRM(TPxx,    MOD(MD), TDxx) | ADR)               \
+        EMITW(0xE590E000 | MXM(REG(XS), TPxx,    0x00))
+
 /* and (G = G & S), (D = S & T) if (#D != #S) */
 
 #define andqx_rr(XG, XS)                                                    \
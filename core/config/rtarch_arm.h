@@ -1528,6 +1528,19 @@
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C3(DS), EMPTY2)   \
         EMITW(0xE0800000 | MRM(REG(RD), MOD(MS), TDxx))
 
+/* prf (prefetch M into cache level hint: PF_L1, PF_L2, PF_LL, PF_NT)
+ * set-flags: no, never faults, may be issued past the end of an array
+ * hints are ignored here, plain pld is issued */
+
+#define PF_L1   0x00
+#define PF_L2   0x00
+#define PF_LL   0x00
+#define PF_NT   0x00
+
+#define prfxx_ld(MS, DS, hint)                                              \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C3(DS), EMPTY2)   \
+        EMITW(0xF7D0F000 | MRM(0x00,    MOD(MS), TDxx))
+
 /************************* pointer-sized instructions *************************/
 
 /* label (D = Reax = adr lb)
@@ -1611,6 +1624,12 @@
 #define stack_la()   /* load all, 7 temps + [Redi - Reax], 14 regs total */ \
         EMITW(0xE8B05FFF | MRM(0x00,    SPxx,    0x00))
 
+#define stack_sm()   /* save listed, same as stack_sa on legacy target */   \
+        stack_sa()
+
+#define stack_lm()   /* load listed, same as stack_la on legacy target */   \
+        stack_la()
+
 /******************************************************************************/
 /********************************   INTERNAL   ********************************/
 /******************************************************************************/
@@ -1875,21 +1875,21 @@
 #undef  sregs_sa
 #define sregs_sa() /* save all SIMD regs, destroys Reax */                  \
         movxx_ld(Reax, Mebp, inf_REGS)                                      \
-        movix_st(Xmm0, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000001) movix_st(Xmm0, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_128*4))                           \
-        movix_st(Xmm1, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000002) movix_st(Xmm1, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_128*4))                           \
-        movix_st(Xmm2, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000004) movix_st(Xmm2, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_128*4))                           \
-        movix_st(Xmm3, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000008) movix_st(Xmm3, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_128*4))                           \
-        movix_st(Xmm4, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000010) movix_st(Xmm4, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_128*4))                           \
-        movix_st(Xmm5, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000020) movix_st(Xmm5, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_128*4))                           \
-        movix_st(Xmm6, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000040) movix_st(Xmm6, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_128*4))                           \
-        movix_st(Xmm7, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000080) movix_st(Xmm7, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_128*4))                           \
         EMITW(0xF4000AAF | MXM(TmmM,    Teax,    0x00))                     \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_128*4))                           \
@@ -1904,21 +1904,21 @@
 #undef  sregs_la
 #define sregs_la() /* load all SIMD regs, destroys Reax */                  \
         movxx_ld(Reax, Mebp, inf_REGS)                                      \
-        movix_ld(Xmm0, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000001) movix_ld(Xmm0, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_128*4))                           \
-        movix_ld(Xmm1, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000002) movix_ld(Xmm1, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_128*4))                           \
-        movix_ld(Xmm2, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000004) movix_ld(Xmm2, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_128*4))                           \
-        movix_ld(Xmm3, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000008) movix_ld(Xmm3, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_128*4))                           \
-        movix_ld(Xmm4, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000010) movix_ld(Xmm4, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_128*4))                           \
-        movix_ld(Xmm5, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000020) movix_ld(Xmm5, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_128*4))                           \
-        movix_ld(Xmm6, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000040) movix_ld(Xmm6, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_128*4))                           \
-        movix_ld(Xmm7, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000080) movix_ld(Xmm7, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_128*4))                           \
         EMITW(0xF4200AAF | MXM(TmmM,    Teax,    0x00))                     \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_128*4))                           \
@@ -0,0 +1,1293 @@
+/******************************************************************************/
+/* Copyright (c) 2013-2019 VectorChief (at github, bitbucket, sourceforge)    */
+/* Distributed under the MIT software license, see the accompanying           */
+/* file COPYING or http://www.opensource.org/licenses/mit-license.php         */
+/******************************************************************************/
+
+#ifndef RT_RTARCH_C32_H
+#define RT_RTARCH_C32_H
+
+#define RT_BASE_REGS        16
+
+/******************************************************************************/
+/*********************************   LEGEND   *********************************/
+/******************************************************************************/
+
+/*
+ * rtarch_c32.h: Implementation of portable C reference BASE instructions.
+ *
+ * This file is a part of the unified SIMD assembler framework (rtarch.h)
+ * designed to be compatible with different processor architectures,
+ * while maintaining strictly defined common API.
+ *
+ * The C reference target expands every instruction into plain C statements
+ * operating on an emulated register file: BASE registers and the stack are
+ * locals of each ASM_ENTER/ASM_LEAVE block (check rtarch.h), while SIMD
+ * registers reside in the rt_SIMD_REGS storage referenced from rt_SIMD_INFO.
+ * Condition flags are kept as the last compared pair of operands, jumps and
+ * labels map to goto and labels-as-values (GCC/Clang extension).
+ * Being free of inline assembly, this target can be single-stepped in any
+ * debugger, serves as a bit-exact reference for other targets and provides
+ * a naive scalar baseline when measuring the speedup of native SIMD code.
+ *
+ * Recommended naming scheme for instructions:
+ *
+ * cmdxx_ri - applies [cmd] to [r]egister from [i]mmediate
+ * cmdxx_mi - applies [cmd] to [m]emory   from [i]mmediate
+ * cmdxx_rz - applies [cmd] to [r]egister from [z]ero-arg
+ * cmdxx_mz - applies [cmd] to [m]emory   from [z]ero-arg
+ *
+ * cmdxx_rm - applies [cmd] to [r]egister from [m]emory
+ * cmdxx_ld - applies [cmd] as above
+ * cmdxx_mr - applies [cmd] to [m]emory   from [r]egister
+ * cmdxx_st - applies [cmd] as above (arg list as cmdxx_ld)
+ *
+ * cmdxx_rr - applies [cmd] to [r]egister from [r]egister
+ * cmdxx_mm - applies [cmd] to [m]emory   from [m]emory
+ * cmdxx_rx - applies [cmd] to [r]egister (one-operand cmd)
+ * cmdxx_mx - applies [cmd] to [m]emory   (one-operand cmd)
+ *
+ * cmdxx_rx - applies [cmd] to [r]egister from x-register
+ * cmdxx_mx - applies [cmd] to [m]emory   from x-register
+ * cmdxx_xr - applies [cmd] to x-register from [r]egister
+ * cmdxx_xm - applies [cmd] to x-register from [m]emory
+ *
+ * cmdxx_rl - applies [cmd] to [r]egister from [l]abel
+ * cmdxx_xl - applies [cmd] to x-register from [l]abel
+ * cmdxx_lb - applies [cmd] as above
+ * label_ld - applies [adr] as above
+ *
+ * stack_st - applies [mov] to stack from register (push)
+ * stack_ld - applies [mov] to register from stack (pop)
+ * stack_sa - applies [mov] to stack from all registers
+ * stack_la - applies [mov] to all registers from stack
+ *
+ * cmdw*_** - applies [cmd] to 32-bit BASE register/memory/immediate args
+ * cmdx*_** - applies [cmd] to A-size BASE register/memory/immediate args
+ * cmdy*_** - applies [cmd] to L-size BASE register/memory/immediate args
+ * cmdz*_** - applies [cmd] to 64-bit BASE register/memory/immediate args
+ *
+ * cmd*x_** - applies [cmd] to unsigned integer args, [x] - default
+ * cmd*n_** - applies [cmd] to   signed integer args, [n] - negatable
+ * cmd*p_** - applies [cmd] to   signed integer args, [p] - part-range
+ *
+ * cmd*z_** - applies [cmd] while setting condition flags, [z] - zero flag.
+ * Regular cmd*x_**, cmd*n_** instructions may or may not set flags depending
+ * on the target architecture, thus no assumptions can be made for jezxx/jnzxx.
+ *
+ * Interpretation of instruction parameters:
+ *
+ * upper-case params have triplet structure and require W to pass-forward
+ * lower-case params are singular and can be used/passed as such directly
+ *
+ * RD - BASE register serving as destination only, if present
+ * RG - BASE register serving as destination and fisrt source
+ * RS - BASE register serving as second source (first if any)
+ * RT - BASE register serving as third source (second if any)
+ *
+ * MD - BASE addressing mode (Oeax, M***, I***) (memory-dest)
+ * MG - BASE addressing mode (Oeax, M***, I***) (memory-dsrc)
+ * MS - BASE addressing mode (Oeax, M***, I***) (memory-src2)
+ * MT - BASE addressing mode (Oeax, M***, I***) (memory-src3)
+ *
+ * DD - displacement value (DP, DF, DG, DH, DV) (memory-dest)
+ * DG - displacement value (DP, DF, DG, DH, DV) (memory-dsrc)
+ * DS - displacement value (DP, DF, DG, DH, DV) (memory-src2)
+ * DT - displacement value (DP, DF, DG, DH, DV) (memory-src3)
+ *
+ * IS - immediate value (is used as a second or first source)
+ * IT - immediate value (is used as a third or second source)
+ *
+ * Alphabetical view of current/future instruction namespaces is in rtzero.h.
+ * Configurable BASE/SIMD subsets (cmdx*, cmdy*, cmdp*) are defined in rtconf.h.
+ * Mixing of 64/32-bit fields in backend structures may lead to misalignment
+ * of 64-bit fields to 4-byte boundary, which is not supported on some targets.
+ * Place fields carefully to ensure natural alignment for all data types.
+ * Note that within cmdx*_** subset most of the instructions follow in-heap
+ * address size (RT_ADDRESS or A) and only label_ld/st, jmpxx_xr/xm follow
+ * pointer size (RT_POINTER or P) as code/data/stack segments are fixed.
+ * Stack ops always work with full registers regardless of the mode chosen.
+ *
+ * 32-bit and 64-bit BASE subsets are not easily compatible on all targets,
+ * thus any register modified with 32-bit op cannot be used in 64-bit subset.
+ * Alternatively, data flow must not exceed 31-bit range for 32-bit operations
+ * to produce consistent results usable in 64-bit subsets across all targets.
+ * Registers written with 64-bit op aren't always compatible with 32-bit either,
+ * as m64 requires the upper half to be all 0s or all 1s for m32 arithmetic.
+ * Only a64 and x64 have a complete 32-bit support in 64-bit mode both zeroing
+ * the upper half of the result, while m64 sign-extending all 32-bit operations
+ * and p64 overflowing 32-bit arithmetic into the upper half. Similar reasons
+ * of inconsistency prohibit use of IW immediate type within 64-bit subsets,
+ * where a64 and p64 zero-extend, while x64 and m64 sign-extend 32-bit value.
+ *
+ * Note that offset correction for endianness E is only applicable for addresses
+ * within pointer fields, when (in-heap) address and pointer sizes don't match.
+ * Working with 32-bit data in 64-bit fields in any other circumstances must be
+ * done consistently within a subset of one size (32-bit, 64-bit or C/C++).
+ * Alternatively, data written natively in C/C++ can be worked on from within
+ * a given (one) subset if appropriate offset correction is used from rtbase.h.
+ *
+ * Setting-flags instruction naming scheme may change again in the future for
+ * better orthogonality with operand size, type and args-list. It is therefore
+ * recommended to use combined-arithmetic-jump (arj) for better API stability
+ * and maximum efficiency across all supported targets. For similar reasons
+ * of higher performance on MIPS and POWER use combined-compare-jump (cmj).
+ * Not all canonical forms of BASE instructions have efficient implementation.
+ * For example, some forms of shifts and division use stack ops on x86 targets,
+ * while standalone remainder operations can only be done natively on MIPS.
+ * Consider using special fixed-register forms for maximum performance.
+ *
+ * Argument x-register (implied) is fixed by the implementation.
+ * Some formal definitions are not given below to encourage
+ * use of friendly aliases for better code readability.
+ */
+
+/******************************************************************************/
+/********************************   INTERNAL   ********************************/
+/******************************************************************************/
+
+/* structural */
+
+typedef rt_ui32 rt_au32 __attribute__((__may_alias__));
+typedef rt_si32 rt_as32 __attribute__((__may_alias__));
+typedef rt_ui64 rt_au64 __attribute__((__may_alias__));
+typedef rt_si64 rt_as64 __attribute__((__may_alias__));
+
+#define ADR(reg, mod, sib, val, tp1, tp2)                                   \
+        ((rt_pntr)(rt_uptr)(rt_uadr)(__Reg__[mod] sib + (val)))
+
+/* selectors  */
+
+#define REG(reg, mod, sib)  reg
+#define MOD(reg, mod, sib)  mod
+#define SIB(reg, mod, sib)  sib
+
+#define VAL(val, tp1, tp2)  val
+#define TP1(val, tp1, tp2)  tp1
+#define TP2(val, tp1, tp2)  tp2
+
+/* register/memory access (32-bit, 64-bit) */
+
+#define GW(reg, mod, sib)   ((rt_ui32)__Reg__[reg])
+#define GN(reg, mod, sib)   ((rt_si32)__Reg__[reg])
+#define GZ(reg, mod, sib)   (__Reg__[reg])
+#define GM(reg, mod, sib)   ((rt_si64)__Reg__[reg])
+
+#define MW(reg, mod, sib, val, tp1, tp2)                                    \
+        (*(rt_au32 *)ADR(reg, mod, sib, val, tp1, tp2))
+
+#define MN(reg, mod, sib, val, tp1, tp2)                                    \
+        (*(rt_as32 *)ADR(reg, mod, sib, val, tp1, tp2))
+
+#define MZ(reg, mod, sib, val, tp1, tp2)                                    \
+        (*(rt_au64 *)ADR(reg, mod, sib, val, tp1, tp2))
+
+#define MM(reg, mod, sib, val, tp1, tp2)                                    \
+        (*(rt_as64 *)ADR(reg, mod, sib, val, tp1, tp2))
+
+/* flags are kept as the last compared pair, 32-bit values are shifted
+ * to the upper half so that 64-bit signed/unsigned compares hold for both */
+
+#define CMW(s, t)                                                           \
+        __Cfs__ = (rt_ui64)(rt_ui32)(s) << 32;                              \
+        __Cft__ = (rt_ui64)(rt_ui32)(t) << 32;
+
+#define CMZ(s, t)                                                           \
+        __Cfs__ = (rt_ui64)(s);                                             \
+        __Cft__ = (rt_ui64)(t);
+
+/* rotate right (32-bit, 64-bit) */
+
+#define RRW(a, c)                                                           \
+        ((a) >> ((c) & 0x1F) | (a) << (-(c) & 0x1F))
+
+#define RRZ(a, c)                                                           \
+        ((a) >> ((c) & 0x3F) | (a) << (-(c) & 0x3F))
+
+/* registers    REG   (check mapping with ASM_ENTER/ASM_LEAVE in rtarch.h) */
+
+#define Teax    0x00  /* __Reg__[0] */
+#define Tecx    0x01  /* __Reg__[1] */
+#define Tedx    0x02  /* __Reg__[2] */
+#define Tebx    0x03  /* __Reg__[3] */
+#define Tebp    0x05  /* __Reg__[5] */
+#define Tesi    0x06  /* __Reg__[6] */
+#define Tedi    0x07  /* __Reg__[7] */
+#define Teg8    0x08  /* __Reg__[8] */
+#define Teg9    0x09  /* __Reg__[9] */
+#define TegA    0x0A  /* __Reg__[10] */
+#define TegB    0x0B  /* __Reg__[11] */
+#define TegC    0x0C  /* __Reg__[12] */
+#define TegD    0x0D  /* __Reg__[13] */
+#define TegE    0x0E  /* __Reg__[14] */
+
+#define TMxx    0x0F  /* __Reg__[15], divisor for rem after div_xm */
+
+/******************************************************************************/
+/********************************   EXTERNAL   ********************************/
+/******************************************************************************/
+
+/* registers    REG,  MOD,  SIB */
+
+#define Reax    Teax, 0x00, EMPTY
+#define Recx    Tecx, 0x00, EMPTY
+#define Redx    Tedx, 0x00, EMPTY
+#define Rebx    Tebx, 0x00, EMPTY
+#define Rebp    Tebp, 0x00, EMPTY
+#define Resi    Tesi, 0x00, EMPTY
+#define Redi    Tedi, 0x00, EMPTY
+#define Reg8    Teg8, 0x00, EMPTY
+#define Reg9    Teg9, 0x00, EMPTY
+#define RegA    TegA, 0x00, EMPTY
+#define RegB    TegB, 0x00, EMPTY
+#define RegC    TegC, 0x00, EMPTY
+#define RegD    TegD, 0x00, EMPTY
+#define RegE    TegE, 0x00, EMPTY
+
+/* addressing   REG,  MOD,  SIB */
+
+#define Oeax    Teax, Teax, EMPTY
+
+#define Mecx    Tecx, Tecx, EMPTY
+#define Medx    Tedx, Tedx, EMPTY
+#define Mebx    Tebx, Tebx, EMPTY
+#define Mebp    Tebp, Tebp, EMPTY
+#define Mesi    Tesi, Tesi, EMPTY
+#define Medi    Tedi, Tedi, EMPTY
+#define Meg8    Teg8, Teg8, EMPTY
+#define Meg9    Teg9, Teg9, EMPTY
+#define MegA    TegA, TegA, EMPTY
+#define MegB    TegB, TegB, EMPTY
+#define MegC    TegC, TegC, EMPTY
+#define MegD    TegD, TegD, EMPTY
+#define MegE    TegE, TegE, EMPTY
+
+#define Iecx    Tecx, Tecx, + __Reg__[Teax]
+#define Iedx    Tedx, Tedx, + __Reg__[Teax]
+#define Iebx    Tebx, Tebx, + __Reg__[Teax]
+#define Iebp    Tebp, Tebp, + __Reg__[Teax]
+#define Iesi    Tesi, Tesi, + __Reg__[Teax]
+#define Iedi    Tedi, Tedi, + __Reg__[Teax]
+#define Ieg8    Teg8, Teg8, + __Reg__[Teax]
+#define Ieg9    Teg9, Teg9, + __Reg__[Teax]
+#define IegA    TegA, TegA, + __Reg__[Teax]
+#define IegB    TegB, TegB, + __Reg__[Teax]
+#define IegC    TegC, TegC, + __Reg__[Teax]
+#define IegD    TegD, TegD, + __Reg__[Teax]
+#define IegE    TegE, TegE, + __Reg__[Teax]
+
+/* immediate    VAL,  TP1,  TP2            (all immediate types are unsigned) */
+
+#define  IC(im) ((im) & 0x7F),          0, 1        /* drop sign-ext (on x86) */
+#define  IB(im) ((im) & 0xFF),          0, 1          /* 32-bit word (on x86) */
+#define  IM(im) ((im) & 0xFFF),         0, 1    /* native AArch64 add/sub/cmp */
+#define  IG(im) ((im) & 0x7FFF),        1, 1 /* native MIPS/POWER add/sub/cmp */
+#define  IH(im) ((im) & 0xFFFF),        1, 1    /* second native on ARMs/MIPS */
+#define  IV(im) ((im) & 0x7FFFFFFF),    2, 2       /* native x86_64 long mode */
+#define  IW(im) ((im) & 0xFFFFFFFF),    2, 2         /* only for cmdw*_** set */
+
+/* displacement VAL,  TP1,  TP2         (all displacement types are unsigned) */
+/* public scalable DP/DE/DF/DG/DH/DV definitions are now provided in rtbase.h */
+
+#define _DP(dp) ((dp) & 0xFFC),         0, 0      /* native on all ARMs, MIPS */
+#define _DE(dp) ((dp) & 0x1FFC),        0, 0     /* AArch64 256-bit SVE ld/st */
+#define _DF(dp) ((dp) & 0x3FFC),        0, 0     /* native AArch64 BASE ld/st */
+#define _DG(dp) ((dp) & 0x7FFC),        1, 0  /* native MIPS/POWER BASE ld/st */
+#define _DH(dp) ((dp) & 0xFFFC),        1, 0     /* second native on all ARMs */
+#define _DV(dp) ((dp) & 0x7FFFFFFC),    2, 2       /* native x86_64 long mode */
+#define  PLAIN  DP(0)                /* special type for Oeax addressing mode */
+
+/* triplet pass-through wrapper */
+
+#define W(p1, p2, p3)       p1,  p2,  p3
+
+/******************************************************************************/
+/**********************************   BASE   **********************************/
+/******************************************************************************/
+
+/* mov (D = S)
+ * set-flags: no */
+
+#define movwx_ri(RD, IS)                                                    \
+        __Reg__[REG(RD)] = (rt_ui32)VAL(IS);
+
+#define movwx_mi(MD, DD, IS)                                                \
+        MW(MD, DD) = VAL(IS);
+
+#define movwx_rr(RD, RS)                                                    \
+        __Reg__[REG(RD)] = GW(RS);
+
+#define movwx_ld(RD, MS, DS)                                                \
+        __Reg__[REG(RD)] = MW(MS, DS);
+
+#define movwx_st(RS, MD, DD)                                                \
+        MW(MD, DD) = GW(RS);
+
+
+#define movwx_rj(RD, IT, IS)     /* IT - upper 32-bit, IS - lower 32-bit */ \
+        movwx_ri(W(RD), W(IS))
+
+#define movwx_mj(MD, DD, IT, IS) /* IT - upper 32-bit, IS - lower 32-bit */ \
+        movwx_mi(W(MD), W(DD), W(IS))
+
+/* and (G = G & S)
+ * set-flags: undefined (*x), yes (*z) */
+
+#define andwx_ri(RG, IS)                                                    \
+        __Reg__[REG(RG)] = GW(RG) & VAL(IS);
+
+#define andwx_mi(MG, DG, IS)                                                \
+        MW(MG, DG) &= VAL(IS);
+
+#define andwx_rr(RG, RS)                                                    \
+        __Reg__[REG(RG)] = GW(RG) & GW(RS);
+
+#define andwx_ld(RG, MS, DS)                                                \
+        __Reg__[REG(RG)] = GW(RG) & MW(MS, DS);
+
+#define andwx_st(RS, MG, DG)                                                \
+        MW(MG, DG) &= GW(RS);
+
+#define andwx_mr(MG, DG, RS)                                                \
+        andwx_st(W(RS), W(MG), W(DG))
+
+
+#define andwz_ri(RG, IS)                                                    \
+        andwx_ri(W(RG), W(IS))                                              \
+        CMW(GW(RG), 0)
+
+#define andwz_mi(MG, DG, IS)                                                \
+        andwx_mi(W(MG), W(DG), W(IS))                                       \
+        CMW(MW(MG, DG), 0)
+
+#define andwz_rr(RG, RS)                                                    \
+        andwx_rr(W(RG), W(RS))                                              \
+        CMW(GW(RG), 0)
+
+#define andwz_ld(RG, MS, DS)                                                \
+        andwx_ld(W(RG), W(MS), W(DS))                                       \
+        CMW(GW(RG), 0)
+
+#define andwz_st(RS, MG, DG)                                                \
+        andwx_st(W(RS), W(MG), W(DG))                                       \
+        CMW(MW(MG, DG), 0)
+
+#define andwz_mr(MG, DG, RS)                                                \
+        andwz_st(W(RS), W(MG), W(DG))
+
+/* ann (G = ~G & S)
+ * set-flags: undefined (*x), yes (*z) */
+
+#define annwx_ri(RG, IS)                                                    \
+        __Reg__[REG(RG)] = ~GW(RG) & VAL(IS);
+
+#define annwx_mi(MG, DG, IS)                                                \
+        MW(MG, DG) = ~MW(MG, DG) & VAL(IS);
+
+#define annwx_rr(RG, RS)                                                    \
+        __Reg__[REG(RG)] = ~GW(RG) & GW(RS);
+
+#define annwx_ld(RG, MS, DS)                                                \
+        __Reg__[REG(RG)] = ~GW(RG) & MW(MS, DS);
+
+#define annwx_st(RS, MG, DG)                                                \
+        MW(MG, DG) = ~MW(MG, DG) & GW(RS);
+
+#define annwx_mr(MG, DG, RS)                                                \
+        annwx_st(W(RS), W(MG), W(DG))
+
+
+#define annwz_ri(RG, IS)                                                    \
+        annwx_ri(W(RG), W(IS))                                              \
+        CMW(GW(RG), 0)
+
+#define annwz_mi(MG, DG, IS)                                                \
+        annwx_mi(W(MG), W(DG), W(IS))                                       \
+        CMW(MW(MG, DG), 0)
+
+#define annwz_rr(RG, RS)                                                    \
+        annwx_rr(W(RG), W(RS))                                              \
+        CMW(GW(RG), 0)
+
+#define annwz_ld(RG, MS, DS)                                                \
+        annwx_ld(W(RG), W(MS), W(DS))                                       \
+        CMW(GW(RG), 0)
+
+#define annwz_st(RS, MG, DG)                                                \
+        annwx_st(W(RS), W(MG), W(DG))                                       \
+        CMW(MW(MG, DG), 0)
+
+#define annwz_mr(MG, DG, RS)                                                \
+        annwz_st(W(RS), W(MG), W(DG))
+
+/* orr (G = G | S)
+ * set-flags: undefined (*x), yes (*z) */
+
+#define orrwx_ri(RG, IS)                                                    \
+        __Reg__[REG(RG)] = GW(RG) | VAL(IS);
+
+#define orrwx_mi(MG, DG, IS)                                                \
+        MW(MG, DG) |= VAL(IS);
+
+#define orrwx_rr(RG, RS)                                                    \
+        __Reg__[REG(RG)] = GW(RG) | GW(RS);
+
+#define orrwx_ld(RG, MS, DS)                                                \
+        __Reg__[REG(RG)] = GW(RG) | MW(MS, DS);
+
+#define orrwx_st(RS, MG, DG)                                                \
+        MW(MG, DG) |= GW(RS);
+
+#define orrwx_mr(MG, DG, RS)                                                \
+        orrwx_st(W(RS), W(MG), W(DG))
+
+
+#define orrwz_ri(RG, IS)                                                    \
+        orrwx_ri(W(RG), W(IS))                                              \
+        CMW(GW(RG), 0)
+
+#define orrwz_mi(MG, DG, IS)                                                \
+        orrwx_mi(W(MG), W(DG), W(IS))                                       \
+        CMW(MW(MG, DG), 0)
+
+#define orrwz_rr(RG, RS)                                                    \
+        orrwx_rr(W(RG), W(RS))                                              \
+        CMW(GW(RG), 0)
+
+#define orrwz_ld(RG, MS, DS)                                                \
+        orrwx_ld(W(RG), W(MS), W(DS))                                       \
+        CMW(GW(RG), 0)
+
+#define orrwz_st(RS, MG, DG)                                                \
+        orrwx_st(W(RS), W(MG), W(DG))                                       \
+        CMW(MW(MG, DG), 0)
+
+#define orrwz_mr(MG, DG, RS)                                                \
+        orrwz_st(W(RS), W(MG), W(DG))
+
+/* orn (G = ~G | S)
+ * set-flags: undefined (*x), yes (*z) */
+
+#define ornwx_ri(RG, IS)                                                    \
+        __Reg__[REG(RG)] = ~GW(RG) | VAL(IS);
+
+#define ornwx_mi(MG, DG, IS)                                                \
+        MW(MG, DG) = ~MW(MG, DG) | VAL(IS);
+
+#define ornwx_rr(RG, RS)                                                    \
+        __Reg__[REG(RG)] = ~GW(RG) | GW(RS);
+
+#define ornwx_ld(RG, MS, DS)                                                \
+        __Reg__[REG(RG)] = ~GW(RG) | MW(MS, DS);
+
+#define ornwx_st(RS, MG, DG)                                                \
+        MW(MG, DG) = ~MW(MG, DG) | GW(RS);
+
+#define ornwx_mr(MG, DG, RS)                                                \
+        ornwx_st(W(RS), W(MG), W(DG))
+
+
+#define ornwz_ri(RG, IS)                                                    \
+        ornwx_ri(W(RG), W(IS))                                              \
+        CMW(GW(RG), 0)
+
+#define ornwz_mi(MG, DG, IS)                                                \
+        ornwx_mi(W(MG), W(DG), W(IS))                                       \
+        CMW(MW(MG, DG), 0)
+
+#define ornwz_rr(RG, RS)                                                    \
+        ornwx_rr(W(RG), W(RS))                                              \
+        CMW(GW(RG), 0)
+
+#define ornwz_ld(RG, MS, DS)                                                \
+        ornwx_ld(W(RG), W(MS), W(DS))                                       \
+        CMW(GW(RG), 0)
+
+#define ornwz_st(RS, MG, DG)                                                \
+        ornwx_st(W(RS), W(MG), W(DG))                                       \
+        CMW(MW(MG, DG), 0)
+
+#define ornwz_mr(MG, DG, RS)                                                \
+        ornwz_st(W(RS), W(MG), W(DG))
+
+/* xor (G = G ^ S)
+ * set-flags: undefined (*x), yes (*z) */
+
+#define xorwx_ri(RG, IS)                                                    \
+        __Reg__[REG(RG)] = GW(RG) ^ VAL(IS);
+
+#define xorwx_mi(MG, DG, IS)                                                \
+        MW(MG, DG) ^= VAL(IS);
+
+#define xorwx_rr(RG, RS)                                                    \
+        __Reg__[REG(RG)] = GW(RG) ^ GW(RS);
+
+#define xorwx_ld(RG, MS, DS)                                                \
+        __Reg__[REG(RG)] = GW(RG) ^ MW(MS, DS);
+
+#define xorwx_st(RS, MG, DG)                                                \
+        MW(MG, DG) ^= GW(RS);
+
+#define xorwx_mr(MG, DG, RS)                                                \
+        xorwx_st(W(RS), W(MG), W(DG))
+
+
+#define xorwz_ri(RG, IS)                                                    \
+        xorwx_ri(W(RG), W(IS))                                              \
+        CMW(GW(RG), 0)
+
+#define xorwz_mi(MG, DG, IS)                                                \
+        xorwx_mi(W(MG), W(DG), W(IS))                                       \
+        CMW(MW(MG, DG), 0)
+
+#define xorwz_rr(RG, RS)                                                    \
+        xorwx_rr(W(RG), W(RS))                                              \
+        CMW(GW(RG), 0)
+
+#define xorwz_ld(RG, MS, DS)                                                \
+        xorwx_ld(W(RG), W(MS), W(DS))                                       \
+        CMW(GW(RG), 0)
+
+#define xorwz_st(RS, MG, DG)                                                \
+        xorwx_st(W(RS), W(MG), W(DG))                                       \
+        CMW(MW(MG, DG), 0)
+
+#define xorwz_mr(MG, DG, RS)                                                \
+        xorwz_st(W(RS), W(MG), W(DG))
+
+/* not (G = ~G)
+ * set-flags: no */
+
+#define notwx_rx(RG)                                                        \
+        __Reg__[REG(RG)] = ~GW(RG);
+
+#define notwx_mx(MG, DG)                                                    \
+        MW(MG, DG) = ~MW(MG, DG);
+
+/* neg (G = -G)
+ * set-flags: undefined (*x), yes (*z) */
+
+#define negwx_rx(RG)                                                        \
+        __Reg__[REG(RG)] = -GW(RG);
+
+#define negwx_mx(MG, DG)                                                    \
+        MW(MG, DG) = -MW(MG, DG);
+
+
+#define negwz_rx(RG)                                                        \
+        negwx_rx(W(RG))                                                     \
+        CMW(GW(RG), 0)
+
+#define negwz_mx(MG, DG)                                                    \
+        negwx_mx(W(MG), W(DG))                                              \
+        CMW(MW(MG, DG), 0)
+
+/* add (G = G + S)
+ * set-flags: undefined (*x), yes (*z) */
+
+#define addwx_ri(RG, IS)                                                    \
+        __Reg__[REG(RG)] = GW(RG) + VAL(IS);
+
+#define addwx_mi(MG, DG, IS)                                                \
+        MW(MG, DG) += VAL(IS);
+
+#define addwx_rr(RG, RS)                                                    \
+        __Reg__[REG(RG)] = GW(RG) + GW(RS);
+
+#define addwx_ld(RG, MS, DS)                                                \
+        __Reg__[REG(RG)] = GW(RG) + MW(MS, DS);
+
+#define addwx_st(RS, MG, DG)                                                \
+        MW(MG, DG) += GW(RS);
+
+#define addwx_mr(MG, DG, RS)                                                \
+        addwx_st(W(RS), W(MG), W(DG))
+
+
+#define addwz_ri(RG, IS)                                                    \
+        addwx_ri(W(RG), W(IS))                                              \
+        CMW(GW(RG), 0)
+
+#define addwz_mi(MG, DG, IS)                                                \
+        addwx_mi(W(MG), W(DG), W(IS))                                       \
+        CMW(MW(MG, DG), 0)
+
+#define addwz_rr(RG, RS)                                                    \
+        addwx_rr(W(RG), W(RS))                                              \
+        CMW(GW(RG), 0)
+
+#define addwz_ld(RG, MS, DS)                                                \
+        addwx_ld(W(RG), W(MS), W(DS))                                       \
+        CMW(GW(RG), 0)
+
+#define addwz_st(RS, MG, DG)                                                \
+        addwx_st(W(RS), W(MG), W(DG))                                       \
+        CMW(MW(MG, DG), 0)
+
+#define addwz_mr(MG, DG, RS)                                                \
+        addwz_st(W(RS), W(MG), W(DG))
+
+/* sub (G = G - S)
+ * set-flags: undefined (*x), yes (*z) */
+
+#define subwx_ri(RG, IS)                                                    \
+        __Reg__[REG(RG)] = GW(RG) - VAL(IS);
+
+#define subwx_mi(MG, DG, IS)                                                \
+        MW(MG, DG) -= VAL(IS);
+
+#define subwx_rr(RG, RS)                                                    \
+        __Reg__[REG(RG)] = GW(RG) - GW(RS);
+
+#define subwx_ld(RG, MS, DS)                                                \
+        __Reg__[REG(RG)] = GW(RG) - MW(MS, DS);
+
+#define subwx_st(RS, MG, DG)                                                \
+        MW(MG, DG) -= GW(RS);
+
+#define subwx_mr(MG, DG, RS)                                                \
+        subwx_st(W(RS), W(MG), W(DG))
+
+
+#define subwz_ri(RG, IS)                                                    \
+        subwx_ri(W(RG), W(IS))                                              \
+        CMW(GW(RG), 0)
+
+#define subwz_mi(MG, DG, IS)                                                \
+        subwx_mi(W(MG), W(DG), W(IS))                                       \
+        CMW(MW(MG, DG), 0)
+
+#define subwz_rr(RG, RS)                                                    \
+        subwx_rr(W(RG), W(RS))                                              \
+        CMW(GW(RG), 0)
+
+#define subwz_ld(RG, MS, DS)                                                \
+        subwx_ld(W(RG), W(MS), W(DS))                                       \
+        CMW(GW(RG), 0)
+
+#define subwz_st(RS, MG, DG)                                                \
+        subwx_st(W(RS), W(MG), W(DG))                                       \
+        CMW(MW(MG, DG), 0)
+
+#define subwz_mr(MG, DG, RS)                                                \
+        subwz_st(W(RS), W(MG), W(DG))
+
+/* shl (G = G << S)
+ * set-flags: undefined (*x), yes (*z) */
+
+#define shlwx_rx(RG)                     /* reads Recx for shift count */   \
+        __Reg__[REG(RG)] = GW(RG) << (__Reg__[Tecx] & 0x1F);
+
+#define shlwx_mx(MG, DG)                 /* reads Recx for shift count */   \
+        MW(MG, DG) <<= __Reg__[Tecx] & 0x1F;
+
+#define shlwx_ri(RG, IS)                                                    \
+        __Reg__[REG(RG)] = GW(RG) << (VAL(IS) & 0x1F);
+
+#define shlwx_mi(MG, DG, IS)                                                \
+        MW(MG, DG) <<= VAL(IS) & 0x1F;
+
+#define shlwx_rr(RG, RS)       /* Recx cannot be used as first operand */   \
+        __Reg__[REG(RG)] = GW(RG) << (GW(RS) & 0x1F);
+
+#define shlwx_ld(RG, MS, DS)   /* Recx cannot be used as first operand */   \
+        __Reg__[REG(RG)] = GW(RG) << (MW(MS, DS) & 0x1F);
+
+#define shlwx_st(RS, MG, DG)                                                \
+        MW(MG, DG) <<= GW(RS) & 0x1F;
+
+#define shlwx_mr(MG, DG, RS)                                                \
+        shlwx_st(W(RS), W(MG), W(DG))
+
+
+#define shlwz_rx(RG)                     /* reads Recx for shift count */   \
+        shlwx_rx(W(RG))                                                     \
+        CMW(GW(RG), 0)
+
+#define shlwz_mx(MG, DG)                 /* reads Recx for shift count */   \
+        shlwx_mx(W(MG), W(DG))                                              \
+        CMW(MW(MG, DG), 0)
+
+#define shlwz_ri(RG, IS)                                                    \
+        shlwx_ri(W(RG), W(IS))                                              \
+        CMW(GW(RG), 0)
+
+#define shlwz_mi(MG, DG, IS)                                                \
+        shlwx_mi(W(MG), W(DG), W(IS))                                       \
+        CMW(MW(MG, DG), 0)
+
+#define shlwz_rr(RG, RS)       /* Recx cannot be used as first operand */   \
+        shlwx_rr(W(RG), W(RS))                                              \
+        CMW(GW(RG), 0)
+
+#define shlwz_ld(RG, MS, DS)   /* Recx cannot be used as first operand */   \
+        shlwx_ld(W(RG), W(MS), W(DS))                                       \
+        CMW(GW(RG), 0)
+
+#define shlwz_st(RS, MG, DG)                                                \
+        shlwx_st(W(RS), W(MG), W(DG))                                       \
+        CMW(MW(MG, DG), 0)
+
+#define shlwz_mr(MG, DG, RS)                                                \
+        shlwz_st(W(RS), W(MG), W(DG))
+
+/* shr (G = G >> S)
+ * set-flags: undefined (*x), yes (*z) */
+
+#define shrwx_rx(RG)                     /* reads Recx for shift count */   \
+        __Reg__[REG(RG)] = GW(RG) >> (__Reg__[Tecx] & 0x1F);
+
+#define shrwx_mx(MG, DG)                 /* reads Recx for shift count */   \
+        MW(MG, DG) >>= __Reg__[Tecx] & 0x1F;
+
+#define shrwx_ri(RG, IS)                                                    \
+        __Reg__[REG(RG)] = GW(RG) >> (VAL(IS) & 0x1F);
+
+#define shrwx_mi(MG, DG, IS)                                                \
+        MW(MG, DG) >>= VAL(IS) & 0x1F;
+
+#define shrwx_rr(RG, RS)       /* Recx cannot be used as first operand */   \
+        __Reg__[REG(RG)] = GW(RG) >> (GW(RS) & 0x1F);
+
+#define shrwx_ld(RG, MS, DS)   /* Recx cannot be used as first operand */   \
+        __Reg__[REG(RG)] = GW(RG) >> (MW(MS, DS) & 0x1F);
+
+#define shrwx_st(RS, MG, DG)                                                \
+        MW(MG, DG) >>= GW(RS) & 0x1F;
+
+#define shrwx_mr(MG, DG, RS)                                                \
+        shrwx_st(W(RS), W(MG), W(DG))
+
+
+#define shrwz_rx(RG)                     /* reads Recx for shift count */   \
+        shrwx_rx(W(RG))                                                     \
+        CMW(GW(RG), 0)
+
+#define shrwz_mx(MG, DG)                 /* reads Recx for shift count */   \
+        shrwx_mx(W(MG), W(DG))                                              \
+        CMW(MW(MG, DG), 0)
+
+#define shrwz_ri(RG, IS)                                                    \
+        shrwx_ri(W(RG), W(IS))                                              \
+        CMW(GW(RG), 0)
+
+#define shrwz_mi(MG, DG, IS)                                                \
+        shrwx_mi(W(MG), W(DG), W(IS))                                       \
+        CMW(MW(MG, DG), 0)
+
+#define shrwz_rr(RG, RS)       /* Recx cannot be used as first operand */   \
+        shrwx_rr(W(RG), W(RS))                                              \
+        CMW(GW(RG), 0)
+
+#define shrwz_ld(RG, MS, DS)   /* Recx cannot be used as first operand */   \
+        shrwx_ld(W(RG), W(MS), W(DS))                                       \
+        CMW(GW(RG), 0)
+
+#define shrwz_st(RS, MG, DG)                                                \
+        shrwx_st(W(RS), W(MG), W(DG))                                       \
+        CMW(MW(MG, DG), 0)
+
+#define shrwz_mr(MG, DG, RS)                                                \
+        shrwz_st(W(RS), W(MG), W(DG))
+
+
+#define shrwn_rx(RG)                     /* reads Recx for shift count */   \
+        __Reg__[REG(RG)] = (rt_ui32)(GN(RG) >> (__Reg__[Tecx] & 0x1F));
+
+#define shrwn_mx(MG, DG)                 /* reads Recx for shift count */   \
+        MN(MG, DG) >>= __Reg__[Tecx] & 0x1F;
+
+#define shrwn_ri(RG, IS)                                                    \
+        __Reg__[REG(RG)] = (rt_ui32)(GN(RG) >> (VAL(IS) & 0x1F));
+
+#define shrwn_mi(MG, DG, IS)                                                \
+        MN(MG, DG) >>= VAL(IS) & 0x1F;
+
+#define shrwn_rr(RG, RS)       /* Recx cannot be used as first operand */   \
+        __Reg__[REG(RG)] = (rt_ui32)(GN(RG) >> (GW(RS) & 0x1F));
+
+#define shrwn_ld(RG, MS, DS)   /* Recx cannot be used as first operand */   \
+        __Reg__[REG(RG)] = (rt_ui32)(GN(RG) >> (MW(MS, DS) & 0x1F));
+
+#define shrwn_st(RS, MG, DG)                                                \
+        MN(MG, DG) >>= GW(RS) & 0x1F;
+
+#define shrwn_mr(MG, DG, RS)                                                \
+        shrwn_st(W(RS), W(MG), W(DG))
+
+/* ror (G = G >> S | G << 32 - S)
+ * set-flags: undefined (*x), yes (*z) */
+
+#define rorwx_rx(RG)                     /* reads Recx for shift count */   \
+        __Reg__[REG(RG)] = RRW(GW(RG), __Reg__[Tecx]);
+
+#define rorwx_mx(MG, DG)                 /* reads Recx for shift count */   \
+        MW(MG, DG) = RRW(MW(MG, DG), __Reg__[Tecx]);
+
+#define rorwx_ri(RG, IS)                                                    \
+        __Reg__[REG(RG)] = RRW(GW(RG), VAL(IS));
+
+#define rorwx_mi(MG, DG, IS)                                                \
+        MW(MG, DG) = RRW(MW(MG, DG), VAL(IS));
+
+#define rorwx_rr(RG, RS)       /* Recx cannot be used as first operand */   \
+        __Reg__[REG(RG)] = RRW(GW(RG), GW(RS));
+
+#define rorwx_ld(RG, MS, DS)   /* Recx cannot be used as first operand */   \
+        __Reg__[REG(RG)] = RRW(GW(RG), MW(MS, DS));
+
+#define rorwx_st(RS, MG, DG)                                                \
+        MW(MG, DG) = RRW(MW(MG, DG), GW(RS));
+
+#define rorwx_mr(MG, DG, RS)                                                \
+        rorwx_st(W(RS), W(MG), W(DG))
+
+
+#define rorwz_rx(RG)                     /* reads Recx for shift count */   \
+        rorwx_rx(W(RG))                                                     \
+        CMW(GW(RG), 0)
+
+#define rorwz_mx(MG, DG)                 /* reads Recx for shift count */   \
+        rorwx_mx(W(MG), W(DG))                                              \
+        CMW(MW(MG, DG), 0)
+
+#define rorwz_ri(RG, IS)                                                    \
+        rorwx_ri(W(RG), W(IS))                                              \
+        CMW(GW(RG), 0)
+
+#define rorwz_mi(MG, DG, IS)                                                \
+        rorwx_mi(W(MG), W(DG), W(IS))                                       \
+        CMW(MW(MG, DG), 0)
+
+#define rorwz_rr(RG, RS)       /* Recx cannot be used as first operand */   \
+        rorwx_rr(W(RG), W(RS))                                              \
+        CMW(GW(RG), 0)
+
+#define rorwz_ld(RG, MS, DS)   /* Recx cannot be used as first operand */   \
+        rorwx_ld(W(RG), W(MS), W(DS))                                       \
+        CMW(GW(RG), 0)
+
+#define rorwz_st(RS, MG, DG)                                                \
+        rorwx_st(W(RS), W(MG), W(DG))                                       \
+        CMW(MW(MG, DG), 0)
+
+#define rorwz_mr(MG, DG, RS)                                                \
+        rorwz_st(W(RS), W(MG), W(DG))
+
+/* mul (G = G * S)
+ * set-flags: undefined */
+
+#define mulwx_ri(RG, IS)                                                    \
+        __Reg__[REG(RG)] = GW(RG) * VAL(IS);
+
+#define mulwx_rr(RG, RS)                                                    \
+        __Reg__[REG(RG)] = GW(RG) * GW(RS);
+
+#define mulwx_ld(RG, MS, DS)                                                \
+        __Reg__[REG(RG)] = GW(RG) * MW(MS, DS);
+
+
+#define mulwx_xr(RS)     /* Reax is in/out, Redx is out(high)-zero-ext */   \
+        __Reg__[Teax] = (rt_ui64)(rt_ui32)__Reg__[Teax] * GW(RS);           \
+        __Reg__[Tedx] = __Reg__[Teax] >> 32;                                \
+        __Reg__[Teax] = (rt_ui32)__Reg__[Teax];
+
+#define mulwx_xm(MS, DS) /* Reax is in/out, Redx is out(high)-zero-ext */   \
+        __Reg__[Teax] = (rt_ui64)(rt_ui32)__Reg__[Teax] * MW(MS, DS);       \
+        __Reg__[Tedx] = __Reg__[Teax] >> 32;                                \
+        __Reg__[Teax] = (rt_ui32)__Reg__[Teax];
+
+
+#define mulwn_xr(RS)     /* Reax is in/out, Redx is out(high)-sign-ext */   \
+        __Reg__[Teax] = (rt_si64)(rt_si32)__Reg__[Teax] * GN(RS);           \
+        __Reg__[Tedx] = (rt_ui32)(__Reg__[Teax] >> 32);                     \
+        __Reg__[Teax] = (rt_ui32)__Reg__[Teax];
+
+#define mulwn_xm(MS, DS) /* Reax is in/out, Redx is out(high)-sign-ext */   \
+        __Reg__[Teax] = (rt_si64)(rt_si32)__Reg__[Teax] * MN(MS, DS);       \
+        __Reg__[Tedx] = (rt_ui32)(__Reg__[Teax] >> 32);                     \
+        __Reg__[Teax] = (rt_ui32)__Reg__[Teax];
+
+
+#define mulwp_xr(RS)     /* Reax is in/out, prepares Redx for divwn_x* */   \
+        mulwx_rr(Reax, W(RS)) /* product must not exceed operands size */
+
+#define mulwp_xm(MS, DS) /* Reax is in/out, prepares Redx for divwn_x* */   \
+        mulwx_ld(Reax, W(MS), W(DS))  /* must not exceed operands size */
+
+/* div (G = G / S)
+ * set-flags: undefined */
+
+#define divwx_ri(RG, IS)       /* Reax cannot be used as first operand */   \
+        __Reg__[REG(RG)] = GW(RG) / VAL(IS);
+
+#define divwx_rr(RG, RS)                /* RG no Reax, RS no Reax/Redx */   \
+        __Reg__[REG(RG)] = GW(RG) / GW(RS);
+
+#define divwx_ld(RG, MS, DS)            /* RG no Reax, MS no Oeax/Medx */   \
+        __Reg__[REG(RG)] = GW(RG) / MW(MS, DS);
+
+
+#define divwn_ri(RG, IS)       /* Reax cannot be used as first operand */   \
+        __Reg__[REG(RG)] = (rt_ui32)(GN(RG) / (rt_si32)VAL(IS));
+
+#define divwn_rr(RG, RS)                /* RG no Reax, RS no Reax/Redx */   \
+        __Reg__[REG(RG)] = (rt_ui32)(GN(RG) / GN(RS));
+
+#define divwn_ld(RG, MS, DS)            /* RG no Reax, MS no Oeax/Medx */   \
+        __Reg__[REG(RG)] = (rt_ui32)(GN(RG) / MN(MS, DS));
+
+
+#define prewx_xx()          /* to be placed immediately prior divwx_x* */   \
+                                     /* to prepare Redx for int-divide */
+
+#define prewn_xx()          /* to be placed immediately prior divwn_x* */   \
+                                     /* to prepare Redx for int-divide */
+
+
+#define divwx_xr(RS)     /* Reax is in/out, Redx is in(zero)/out(junk) */   \
+        __Reg__[Teax] = (rt_ui32)__Reg__[Teax] / GW(RS);
+
+#define divwx_xm(MS, DS) /* Reax is in/out, Redx is in(zero)/out(junk) */   \
+        __Reg__[TMxx] = MW(MS, DS);                                         \
+        __Reg__[Teax] = (rt_ui32)__Reg__[Teax] / (rt_ui32)__Reg__[TMxx];
+
+
+#define divwn_xr(RS)     /* Reax is in/out, Redx is in-sign-ext-(Reax) */   \
+        __Reg__[Teax] = (rt_ui32)((rt_si32)__Reg__[Teax] / GN(RS));
+
+#define divwn_xm(MS, DS) /* Reax is in/out, Redx is in-sign-ext-(Reax) */   \
+        __Reg__[TMxx] = MW(MS, DS);                                         \
+        __Reg__[Teax] = (rt_ui32)((rt_si32)__Reg__[Teax] /                  \
+                                  (rt_si32)__Reg__[TMxx]);
+
+
+#define divwp_xr(RS)     /* Reax is in/out, Redx is in-sign-ext-(Reax) */   \
+        divwn_xr(W(RS))
+
+#define divwp_xm(MS, DS) /* Reax is in/out, Redx is in-sign-ext-(Reax) */   \
+        divwn_xm(W(MS), W(DS))
+
+/* rem (G = G % S)
+ * set-flags: undefined */
+
+#define remwx_ri(RG, IS)       /* Redx cannot be used as first operand */   \
+        __Reg__[REG(RG)] = GW(RG) % VAL(IS);
+
+#define remwx_rr(RG, RS)                /* RG no Redx, RS no Reax/Redx */   \
+        __Reg__[REG(RG)] = GW(RG) % GW(RS);
+
+#define remwx_ld(RG, MS, DS)            /* RG no Redx, MS no Oeax/Medx */   \
+        __Reg__[REG(RG)] = GW(RG) % MW(MS, DS);
+
+
+#define remwn_ri(RG, IS)       /* Redx cannot be used as first operand */   \
+        __Reg__[REG(RG)] = (rt_ui32)(GN(RG) % (rt_si32)VAL(IS));
+
+#define remwn_rr(RG, RS)                /* RG no Redx, RS no Reax/Redx */   \
+        __Reg__[REG(RG)] = (rt_ui32)(GN(RG) % GN(RS));
+
+#define remwn_ld(RG, MS, DS)            /* RG no Redx, MS no Oeax/Medx */   \
+        __Reg__[REG(RG)] = (rt_ui32)(GN(RG) % MN(MS, DS));
+
+
+#define remwx_xx()          /* to be placed immediately prior divwx_x* */   \
+        movwx_rr(Redx, Reax)         /* to prepare for rem calculation */
+
+#define remwx_xr(RS)        /* to be placed immediately after divwx_xr */   \
+        __Reg__[Tedx] -= __Reg__[Teax] * GW(RS);                            \
+        __Reg__[Tedx] = (rt_ui32)__Reg__[Tedx];    /* Redx<-rem */
+
+#define remwx_xm(MS, DS)    /* to be placed immediately after divwx_xm */   \
+        __Reg__[Tedx] -= __Reg__[Teax] * __Reg__[TMxx];                     \
+        __Reg__[Tedx] = (rt_ui32)__Reg__[Tedx];    /* Redx<-rem */
+
+
+#define remwn_xx()          /* to be placed immediately prior divwn_x* */   \
+        movwx_rr(Redx, Reax)         /* to prepare for rem calculation */
+
+#define remwn_xr(RS)        /* to be placed immediately after divwn_xr */   \
+        __Reg__[Tedx] -= __Reg__[Teax] * GW(RS);                            \
+        __Reg__[Tedx] = (rt_ui32)__Reg__[Tedx];    /* Redx<-rem */
+
+#define remwn_xm(MS, DS)    /* to be placed immediately after divwn_xm */   \
+        __Reg__[Tedx] -= __Reg__[Teax] * __Reg__[TMxx];                     \
+        __Reg__[Tedx] = (rt_ui32)__Reg__[Tedx];    /* Redx<-rem */
+
+/* arj (G = G op S, if cc G then jump lb)
+ * set-flags: undefined
+ * refer to individual instruction descriptions
+ * to stay within special register limitations */
+
+#define and_x   and
+#define ann_x   ann
+#define orr_x   orr
+#define orn_x   orn
+#define xor_x   xor
+#define neg_x   neg
+#define add_x   add
+#define sub_x   sub
+#define shl_x   shl
+#define shr_x   shr
+#define ror_x   ror
+
+#define EZ_x    jezxx_lb
+#define NZ_x    jnzxx_lb
+
+#define arjwx_rx(RG, op, cc, lb)                                            \
+        AR1(W(RG), op, wz_rx)                                               \
+        CMJ(cc, lb)
+
+#define arjwx_mx(MG, DG, op, cc, lb)                                        \
+        AR2(W(MG), W(DG), op, wz_mx)                                        \
+        CMJ(cc, lb)
+
+#define arjwx_ri(RG, IS, op, cc, lb)                                        \
+        AR2(W(RG), W(IS), op, wz_ri)                                        \
+        CMJ(cc, lb)
+
+#define arjwx_mi(MG, DG, IS, op, cc, lb)                                    \
+        AR3(W(MG), W(DG), W(IS), op, wz_mi)                                 \
+        CMJ(cc, lb)
+
+#define arjwx_rr(RG, RS, op, cc, lb)                                        \
+        AR2(W(RG), W(RS), op, wz_rr)                                        \
+        CMJ(cc, lb)
+
+#define arjwx_ld(RG, MS, DS, op, cc, lb)                                    \
+        AR3(W(RG), W(MS), W(DS), op, wz_ld)                                 \
+        CMJ(cc, lb)
+
+#define arjwx_st(RS, MG, DG, op, cc, lb)                                    \
+        AR3(W(RS), W(MG), W(DG), op, wz_st)                                 \
+        CMJ(cc, lb)
+
+#define arjwx_mr(MG, DG, RS, op, cc, lb)                                    \
+        arjwx_st(W(RS), W(MG), W(DG), op, cc, lb)
+
+/* cmj (flags = S ? T, if cc flags then jump lb)
+ * set-flags: undefined */
+
+#define EQ_x    jeqxx_lb
+#define NE_x    jnexx_lb
+
+#define LT_x    jltxx_lb
+#define LE_x    jlexx_lb
+#define GT_x    jgtxx_lb
+#define GE_x    jgexx_lb
+
+#define LT_n    jltxn_lb
+#define LE_n    jlexn_lb
+#define GT_n    jgtxn_lb
+#define GE_n    jgexn_lb
+
+#define cmjwx_rz(RS, cc, lb)                                                \
+        cmjwx_ri(W(RS), IC(0), cc, lb)
+
+#define cmjwx_mz(MS, DS, cc, lb)                                            \
+        cmjwx_mi(W(MS), W(DS), IC(0), cc, lb)
+
+#define cmjwx_ri(RS, IT, cc, lb)                                            \
+        cmpwx_ri(W(RS), W(IT))                                              \
+        CMJ(cc, lb)
+
+#define cmjwx_mi(MS, DS, IT, cc, lb)                                        \
+        cmpwx_mi(W(MS), W(DS), W(IT))                                       \
+        CMJ(cc, lb)
+
+#define cmjwx_rr(RS, RT, cc, lb)                                            \
+        cmpwx_rr(W(RS), W(RT))                                              \
+        CMJ(cc, lb)
+
+#define cmjwx_rm(RS, MT, DT, cc, lb)                                        \
+        cmpwx_rm(W(RS), W(MT), W(DT))                                       \
+        CMJ(cc, lb)
+
+#define cmjwx_mr(MS, DS, RT, cc, lb)                                        \
+        cmpwx_mr(W(MS), W(DS), W(RT))                                       \
+        CMJ(cc, lb)
+
+/* cmp (flags = S ? T)
+ * set-flags: yes */
+
+#define cmpwx_ri(RS, IT)                                                    \
+        CMW(GW(RS), VAL(IT))
+
+#define cmpwx_mi(MS, DS, IT)                                                \
+        CMW(MW(MS, DS), VAL(IT))
+
+#define cmpwx_rr(RS, RT)                                                    \
+        CMW(GW(RS), GW(RT))
+
+#define cmpwx_rm(RS, MT, DT)                                                \
+        CMW(GW(RS), MW(MT, DT))
+
+#define cmpwx_mr(MS, DS, RT)                                                \
+        CMW(MW(MS, DS), GW(RT))
+
+/* ver (Mebp/inf_VER = SIMD-version)
+ * set-flags: no
+ * For interpretation of SIMD build flags check compatibility layer in rtzero.h
+ * 0th byte - 128-bit version, 1st byte - 256-bit version, | plus _R8/_RX slots
+ * 2nd byte - 512-bit version, 3rd byte - 1K4-bit version, | in upper halves */
+
+#define verxx_xx()   /* only 128-bit SIMD (RT_128=1) is emulated */         \
+        movwx_mi(Mebp, inf_VER, IB(1))
+
+/************************* address-sized instructions *************************/
+
+/* adr (D = adr S)
+ * set-flags: no */
+
+#define adrxx_ld(RD, MS, DS)                                                \
+        __Reg__[REG(RD)] = (rt_uadr)(rt_uptr)ADR(MS, DS);
+
+/* prf (prefetch M into cache level hint: PF_L1, PF_L2, PF_LL, PF_NT)
+ * set-flags: no, never faults, may be issued past the end of an array
+ * hints map to __builtin_prefetch temporal locality 3/2/1/0 */
+
+#define PF_L1   0x03
+#define PF_L2   0x02
+#define PF_LL   0x01
+#define PF_NT   0x00
+
+#define prfxx_ld(MS, DS, hint)                                              \
+        __builtin_prefetch(ADR(MS, DS), 0, hint);
+
+/************************* pointer-sized instructions *************************/
+
+/* label (D = Reax = adr lb)
+ * set-flags: no */
+
+     /* label_ld(lb) is defined in rtarch.h file, loads label to Reax */
+
+     /* label_st(lb, MD, DD) is defined in rtarch.h file, destroys Reax */
+
+/* jmp (if unconditional jump S/lb, else if cc flags then jump lb)
+ * set-flags: no
+ * maximum byte-address-range for un/conditional jumps is signed 18/16-bit
+ * based on minimum natively-encoded offset across supported targets (u/c)
+ * MIPS:18-bit, POWER:26-bit, AArch32:26-bit, AArch64:28-bit, x86:32-bit /
+ * MIPS:18-bit, POWER:16-bit, AArch32:26-bit, AArch64:21-bit, x86:32-bit */
+
+#define jmpxx_xr(RS)           /* register-targeted unconditional jump */   \
+        goto *(rt_pntr)(rt_uptr)GZ(RS);
+
+#define jmpxx_xm(MS, DS)         /* memory-targeted unconditional jump */   \
+        goto **(rt_pntr *)ADR(MS, DS);
+
+#define jmpxx_lb(lb)              /* label-targeted unconditional jump */   \
+        goto lb;
+
+#define jezxx_lb(lb)               /* setting-flags-arithmetic -> jump */   \
+        if (__Cfs__ == __Cft__) goto lb;
+
+#define jnzxx_lb(lb)               /* setting-flags-arithmetic -> jump */   \
+        if (__Cfs__ != __Cft__) goto lb;
+
+#define jeqxx_lb(lb)                                /* compare -> jump */   \
+        if (__Cfs__ == __Cft__) goto lb;
+
+#define jnexx_lb(lb)                                /* compare -> jump */   \
+        if (__Cfs__ != __Cft__) goto lb;
+
+#define jltxx_lb(lb)                                /* compare -> jump */   \
+        if (__Cfs__ <  __Cft__) goto lb;
+
+#define jlexx_lb(lb)                                /* compare -> jump */   \
+        if (__Cfs__ <= __Cft__) goto lb;
+
+#define jgtxx_lb(lb)                                /* compare -> jump */   \
+        if (__Cfs__ >  __Cft__) goto lb;
+
+#define jgexx_lb(lb)                                /* compare -> jump */   \
+        if (__Cfs__ >= __Cft__) goto lb;
+
+#define jltxn_lb(lb)                                /* compare -> jump */   \
+        if ((rt_si64)__Cfs__ <  (rt_si64)__Cft__) goto lb;
+
+#define jlexn_lb(lb)                                /* compare -> jump */   \
+        if ((rt_si64)__Cfs__ <= (rt_si64)__Cft__) goto lb;
+
+#define jgtxn_lb(lb)                                /* compare -> jump */   \
+        if ((rt_si64)__Cfs__ >  (rt_si64)__Cft__) goto lb;
+
+#define jgexn_lb(lb)                                /* compare -> jump */   \
+        if ((rt_si64)__Cfs__ >= (rt_si64)__Cft__) goto lb;
+
+#define LBL(lb)                                          /* code label */   \
+        lb:;
+
+/************************* register-size instructions *************************/
+
+/* stack (push stack = S, D = pop stack)
+ * set-flags: no (sequence cmp/stack_la/jmp is not allowed on MIPS & POWER)
+ * adjust stack pointer with 8-byte (64-bit) steps on all current targets */
+
+#define stack_st(RS)                                                        \
+        __Stk__[__Stp__++] = GZ(RS);
+
+#define stack_ld(RD)                                                        \
+        __Reg__[REG(RD)] = __Stk__[--__Stp__];
+
+#define stack_sa()   /* save all, [Reax - RegE], 14 regs total */           \
+        __Stk__[__Stp__++] = __Reg__[Teax];                                 \
+        __Stk__[__Stp__++] = __Reg__[Tecx];                                 \
+        __Stk__[__Stp__++] = __Reg__[Tedx];                                 \
+        __Stk__[__Stp__++] = __Reg__[Tebx];                                 \
+        __Stk__[__Stp__++] = __Reg__[Tebp];                                 \
+        __Stk__[__Stp__++] = __Reg__[Tesi];                                 \
+        __Stk__[__Stp__++] = __Reg__[Tedi];                                 \
+        __Stk__[__Stp__++] = __Reg__[Teg8];                                 \
+        __Stk__[__Stp__++] = __Reg__[Teg9];                                 \
+        __Stk__[__Stp__++] = __Reg__[TegA];                                 \
+        __Stk__[__Stp__++] = __Reg__[TegB];                                 \
+        __Stk__[__Stp__++] = __Reg__[TegC];                                 \
+        __Stk__[__Stp__++] = __Reg__[TegD];                                 \
+        __Stk__[__Stp__++] = __Reg__[TegE];
+
+#define stack_la()   /* load all, [RegE - Reax], 14 regs total */           \
+        __Reg__[TegE] = __Stk__[--__Stp__];                                 \
+        __Reg__[TegD] = __Stk__[--__Stp__];                                 \
+        __Reg__[TegC] = __Stk__[--__Stp__];                                 \
+        __Reg__[TegB] = __Stk__[--__Stp__];                                 \
+        __Reg__[TegA] = __Stk__[--__Stp__];                                 \
+        __Reg__[Teg9] = __Stk__[--__Stp__];                                 \
+        __Reg__[Teg8] = __Stk__[--__Stp__];                                 \
+        __Reg__[Tedi] = __Stk__[--__Stp__];                                 \
+        __Reg__[Tesi] = __Stk__[--__Stp__];                                 \
+        __Reg__[Tebp] = __Stk__[--__Stp__];                                 \
+        __Reg__[Tebx] = __Stk__[--__Stp__];                                 \
+        __Reg__[Tedx] = __Stk__[--__Stp__];                                 \
+        __Reg__[Tecx] = __Stk__[--__Stp__];                                 \
+        __Reg__[Teax] = __Stk__[--__Stp__];
+
+#define stack_sm()   /* save all, RT_BASE_* masks have no effect here */    \
+        stack_sa()
+
+#define stack_lm()   /* load all, RT_BASE_* masks have no effect here */    \
+        stack_la()
+
+/******************************************************************************/
+/********************************   INTERNAL   ********************************/
+/******************************************************************************/
+
+/* internal definitions for combined-arithmetic-jump (arj) */
+
+#define AR1(P1, op, sg)                                                     \
+        op##sg(W(P1))
+
+#define AR2(P1, P2, op, sg)                                                 \
+        op##sg(W(P1), W(P2))
+
+#define AR3(P1, P2, P3, op, sg)                                             \
+        op##sg(W(P1), W(P2), W(P3))
+
+#define CMJ(cc, lb)                                                         \
+        cc(lb)
+
+#endif /* RT_RTARCH_C32_H */
+
+/******************************************************************************/
+/******************************************************************************/
+/******************************************************************************/
@@ -0,0 +1,1430 @@
+/******************************************************************************/
+/* Copyright (c) 2013-2019 VectorChief (at github, bitbucket, sourceforge)    */
+/* Distributed under the MIT software license, see the accompanying           */
+/* file COPYING or http://www.opensource.org/licenses/mit-license.php         */
+/******************************************************************************/
+
+#ifndef RT_RTARCH_C32_128X1V1_H
+#define RT_RTARCH_C32_128X1V1_H
+
+#include <fenv.h>
+
+#include "rtarch_c64.h"
+
+#define RT_SIMD_REGS_128        32
+
+/******************************************************************************/
+/*********************************   LEGEND   *********************************/
+/******************************************************************************/
+
+/*
+ * rtarch_c32_128x1v1.h: Implementation of C-reference fp32 SIMD instructions.
+ *
+ * This file is a part of the unified SIMD assembler framework (rtarch.h)
+ * designed to be compatible with different processor architectures,
+ * while maintaining strictly defined common API.
+ *
+ * SIMD registers are emulated as 128-bit slots of the rt_SIMD_REGS storage
+ * referenced from rt_SIMD_INFO (inf_REGS), each instruction is expanded into
+ * per-element C statements, while scalar instructions only change element 0.
+ *
+ * Recommended naming scheme for instructions:
+ *
+ * cmdp*_ri - applies [cmd] to [p]acked: [r]egister from [i]mmediate
+ * cmdp*_rr - applies [cmd] to [p]acked: [r]egister from [r]egister
+ *
+ * cmdp*_rm - applies [cmd] to [p]acked: [r]egister from [m]emory
+ * cmdp*_ld - applies [cmd] to [p]acked: as above
+ *
+ * cmdi*_** - applies [cmd] to 32-bit SIMD element args, packed-128-bit
+ * cmdj*_** - applies [cmd] to 64-bit SIMD element args, packed-128-bit
+ * cmdl*_** - applies [cmd] to L-size SIMD element args, packed-128-bit
+ *
+ * cmdc*_** - applies [cmd] to 32-bit SIMD element args, packed-256-bit
+ * cmdd*_** - applies [cmd] to 64-bit SIMD element args, packed-256-bit
+ * cmdf*_** - applies [cmd] to L-size SIMD element args, packed-256-bit
+ *
+ * cmdo*_** - applies [cmd] to 32-bit SIMD element args, packed-var-len
+ * cmdp*_** - applies [cmd] to L-size SIMD element args, packed-var-len
+ * cmdq*_** - applies [cmd] to 64-bit SIMD element args, packed-var-len
+ *
+ * cmd*x_** - applies [cmd] to [p]acked unsigned integer args, [x] - default
+ * cmd*n_** - applies [cmd] to [p]acked   signed integer args, [n] - negatable
+ * cmd*s_** - applies [cmd] to [p]acked floating point   args, [s] - scalable
+ *
+ * The cmdp*_** (rtconf.h) instructions are intended for SPMD programming model
+ * and can be configured to work with 32/64-bit data elements (fp+int).
+ * In this model data paths are fixed-width, BASE and SIMD data elements are
+ * width-compatible, code path divergence is handled via mkj**_** pseudo-ops.
+ * Matching element-sized BASE subset cmdy*_** is defined in rtconf.h as well.
+ *
+ * Note, when using fixed-data-size 128/256-bit SIMD subsets simultaneously
+ * upper 128-bit halves of full 256-bit SIMD registers may end up undefined.
+ * On RISC targets they remain unchanged, while on x86-AVX they are zeroed.
+ * This happens when registers written in 128-bit subset are then used/read
+ * from within 256-bit subset. The same rule applies to mixing with 512-bit
+ * and wider vectors. Use of scalars may leave respective vector registers
+ * undefined, as seen from the perspective of any particular vector subset.
+ *
+ * 256-bit vectors used with wider subsets may not be compatible with regards
+ * to memory loads/stores when mixed in the code. It means that data loaded
+ * with wider vector and stored within 256-bit subset at the same address may
+ * result in changing the initial representation in memory. The same can be
+ * said about mixing vector and scalar subsets. Scalars can be completely
+ * detached on some architectures. Use elm*x_st to store 1st vector element.
+ * 128-bit vectors should be memory-compatible with any wider vector subset.
+ *
+ * Handling of NaNs in the floating point pipeline may not be consistent
+ * across different architectures. Avoid NaNs entering the data flow by using
+ * masking or control flow instructions. Apply special care when dealing with
+ * floating point compare and min/max input/output. The result of floating point
+ * compare instructions can be considered a -QNaN, though it is also interpreted
+ * as integer -1 and is often treated as a mask. Most arithmetic instructions
+ * should propagate QNaNs unchanged, however this behavior hasn't been verified.
+ *
+ * Interpretation of instruction parameters:
+ *
+ * upper-case params have triplet structure and require W to pass-forward
+ * lower-case params are singular and can be used/passed as such directly
+ *
+ * XD - SIMD register serving as destination only, if present
+ * XG - SIMD register serving as destination and fisrt source
+ * XS - SIMD register serving as second source (first if any)
+ * XT - SIMD register serving as third source (second if any)
+ *
+ * RD - BASE register serving as destination only, if present
+ * RG - BASE register serving as destination and fisrt source
+ * RS - BASE register serving as second source (first if any)
+ * RT - BASE register serving as third source (second if any)
+ *
+ * MD - BASE addressing mode (Oeax, M***, I***) (memory-dest)
+ * MG - BASE addressing mode (Oeax, M***, I***) (memory-dsrc)
+ * MS - BASE addressing mode (Oeax, M***, I***) (memory-src2)
+ * MT - BASE addressing mode (Oeax, M***, I***) (memory-src3)
+ *
+ * DD - displacement value (DP, DF, DG, DH, DV) (memory-dest)
+ * DG - displacement value (DP, DF, DG, DH, DV) (memory-dsrc)
+ * DS - displacement value (DP, DF, DG, DH, DV) (memory-src2)
+ * DT - displacement value (DP, DF, DG, DH, DV) (memory-src3)
+ *
+ * IS - immediate value (is used as a second or first source)
+ * IT - immediate value (is used as a third or second source)
+ */
+
+/******************************************************************************/
+/********************************   INTERNAL   ********************************/
+/******************************************************************************/
+
+#if (defined RT_SIMD_CODE)
+
+#if (RT_128X1 != 0)
+
+/* structural */
+
+typedef rt_fp32 rt_af32 __attribute__((__may_alias__));
+typedef rt_fp64 rt_af64 __attribute__((__may_alias__));
+
+/* register file elements (32-bit, 64-bit) */
+
+#define VU32(xr, i)     (((rt_au32 *)__Xmm__)[(xr)*4+(i)])
+#define VS32(xr, i)     (((rt_as32 *)__Xmm__)[(xr)*4+(i)])
+#define VF32(xr, i)     (((rt_af32 *)__Xmm__)[(xr)*4+(i)])
+
+#define VU64(xr, i)     (((rt_au64 *)__Xmm__)[(xr)*2+(i)])
+#define VS64(xr, i)     (((rt_as64 *)__Xmm__)[(xr)*2+(i)])
+#define VF64(xr, i)     (((rt_af64 *)__Xmm__)[(xr)*2+(i)])
+
+/* math library functions (32-bit, 64-bit) */
+
+#define MF32(fn)        fn##f
+#define MF64(fn)        fn
+
+/* full register move, load, store */
+
+#define VMV(xd, xs)                                                         \
+        VU64(xd, 0) = VU64(xs, 0);                                          \
+        VU64(xd, 1) = VU64(xs, 1);
+
+#define VLD(xr, reg, mod, sib, val, tp1, tp2)                               \
+        VU64(xr, 0) = ((rt_au64 *)ADR(reg, mod, sib, val, tp1, tp2))[0];    \
+        VU64(xr, 1) = ((rt_au64 *)ADR(reg, mod, sib, val, tp1, tp2))[1];
+
+#define VST(xr, reg, mod, sib, val, tp1, tp2)                               \
+        ((rt_au64 *)ADR(reg, mod, sib, val, tp1, tp2))[0] = VU64(xr, 0);    \
+        ((rt_au64 *)ADR(reg, mod, sib, val, tp1, tp2))[1] = VU64(xr, 1);
+
+/* apply per-element op (packed 32-bit, packed 64-bit, scalar) */
+
+#define EI2(op, d, s)                                                       \
+        op(32, d, s, 0)                                                     \
+        op(32, d, s, 1)                                                     \
+        op(32, d, s, 2)                                                     \
+        op(32, d, s, 3)
+
+#define EI3(op, d, s, t)                                                    \
+        op(32, d, s, t, 0)                                                  \
+        op(32, d, s, t, 1)                                                  \
+        op(32, d, s, t, 2)                                                  \
+        op(32, d, s, t, 3)
+
+#define EJ2(op, d, s)                                                       \
+        op(64, d, s, 0)                                                     \
+        op(64, d, s, 1)
+
+#define EJ3(op, d, s, t)                                                    \
+        op(64, d, s, t, 0)                                                  \
+        op(64, d, s, t, 1)
+
+#define ER2(op, d, s)                                                       \
+        op(32, d, s, 0)
+
+#define ER3(op, d, s, t)                                                    \
+        op(32, d, s, t, 0)
+
+#define ET2(op, d, s)                                                       \
+        op(64, d, s, 0)
+
+#define ET3(op, d, s, t)                                                    \
+        op(64, d, s, t, 0)
+
+/* element ops (w - width, d - dest, s, t - sources, i - index) */
+
+#define LANDX(w, d, s, t, i)                                                \
+        VU##w(d, i) = VU##w(s, i) & VU##w(t, i);
+
+#define LANNX(w, d, s, t, i)                                                \
+        VU##w(d, i) = ~VU##w(s, i) & VU##w(t, i);
+
+#define LORRX(w, d, s, t, i)                                                \
+        VU##w(d, i) = VU##w(s, i) | VU##w(t, i);
+
+#define LORNX(w, d, s, t, i)                                                \
+        VU##w(d, i) = ~VU##w(s, i) | VU##w(t, i);
+
+#define LXORX(w, d, s, t, i)                                                \
+        VU##w(d, i) = VU##w(s, i) ^ VU##w(t, i);
+
+#define LADDX(w, d, s, t, i)                                                \
+        VU##w(d, i) = VU##w(s, i) + VU##w(t, i);
+
+#define LSUBX(w, d, s, t, i)                                                \
+        VU##w(d, i) = VU##w(s, i) - VU##w(t, i);
+
+#define LMULX(w, d, s, t, i)                                                \
+        VU##w(d, i) = VU##w(s, i) * VU##w(t, i);
+
+#define LMMVX(w, d, s, t, i)                                                \
+        VU##w(d, i) = (VU##w(d, i) & ~VU##w(t, i)) |                        \
+                      (VU##w(s, i) &  VU##w(t, i));
+
+#define LADDS(w, d, s, t, i)                                                \
+        VF##w(d, i) = VF##w(s, i) + VF##w(t, i);
+
+#define LSUBS(w, d, s, t, i)                                                \
+        VF##w(d, i) = VF##w(s, i) - VF##w(t, i);
+
+#define LMULS(w, d, s, t, i)                                                \
+        VF##w(d, i) = VF##w(s, i) * VF##w(t, i);
+
+#define LDIVS(w, d, s, t, i)                                                \
+        VF##w(d, i) = VF##w(s, i) / VF##w(t, i);
+
+#define LMINS(w, d, s, t, i)                                                \
+        VF##w(d, i) = VF##w(s, i) < VF##w(t, i) ?                           \
+                      VF##w(s, i) : VF##w(t, i);
+
+#define LMAXS(w, d, s, t, i)                                                \
+        VF##w(d, i) = VF##w(s, i) > VF##w(t, i) ?                           \
+                      VF##w(s, i) : VF##w(t, i);
+
+#define LCEQS(w, d, s, t, i)                                                \
+        VS##w(d, i) = -(VF##w(s, i) == VF##w(t, i));
+
+#define LCNES(w, d, s, t, i)                                                \
+        VS##w(d, i) = -(VF##w(s, i) != VF##w(t, i));
+
+#define LCLTS(w, d, s, t, i)                                                \
+        VS##w(d, i) = -(VF##w(s, i) < VF##w(t, i));
+
+#define LCLES(w, d, s, t, i)                                                \
+        VS##w(d, i) = -(VF##w(s, i) <= VF##w(t, i));
+
+#define LCGTS(w, d, s, t, i)                                                \
+        VS##w(d, i) = -(VF##w(s, i) > VF##w(t, i));
+
+#define LCGES(w, d, s, t, i)                                                \
+        VS##w(d, i) = -(VF##w(s, i) >= VF##w(t, i));
+
+#define LADPS(w, d, s, t, i)                                                \
+        VF##w(d, i) = (i) < 64 / w ?                                        \
+                      VF##w(s, 2*(i)) + VF##w(s, 2*(i)+1) :                 \
+                      VF##w(t, 2*(i)-128/w) + VF##w(t, 2*(i)-128/w+1);
+
+#define LFMAS(w, d, s, t, i)                                                \
+        VF##w(d, i) = MF##w(fma)(VF##w(s, i), VF##w(t, i), VF##w(d, i));
+
+#define LFMSS(w, d, s, t, i)                                                \
+        VF##w(d, i) = MF##w(fma)(-VF##w(s, i), VF##w(t, i), VF##w(d, i));
+
+#define LSHLX(w, d, s, c, i)                                                \
+        VU##w(d, i) = (c) >= w ? 0 : VU##w(s, i) << (c);
+
+#define LSHRX(w, d, s, c, i)                                                \
+        VU##w(d, i) = (c) >= w ? 0 : VU##w(s, i) >> (c);
+
+#define LSHRN(w, d, s, c, i)                                                \
+        VS##w(d, i) = VS##w(s, i) >> ((c) >= w ? w - 1 : (c));
+
+#define LSVLX(w, d, s, t, i)                                                \
+        VU##w(d, i) = VU##w(t, i) >= w ? 0 :                                \
+                      VU##w(s, i) << VU##w(t, i);
+
+#define LSVRX(w, d, s, t, i)                                                \
+        VU##w(d, i) = VU##w(t, i) >= w ? 0 :                                \
+                      VU##w(s, i) >> VU##w(t, i);
+
+#define LSVRN(w, d, s, t, i)                                                \
+        VS##w(d, i) = VS##w(s, i) >>                                        \
+                     (VU##w(t, i) >= w ? w - 1 : VU##w(t, i));
+
+#define LNOTX(w, d, s, i)                                                   \
+        VU##w(d, i) = ~VU##w(s, i);
+
+#define LNEGS(w, d, s, i)                                                   \
+        VF##w(d, i) = -VF##w(s, i);
+
+#define LSQRS(w, d, s, i)                                                   \
+        VF##w(d, i) = MF##w(sqrt)(VF##w(s, i));
+
+#define LRCES(w, d, s, i)                                                   \
+        VF##w(d, i) = 1 / VF##w(s, i);
+
+#define LRSES(w, d, s, i)                                                   \
+        VF##w(d, i) = 1 / MF##w(sqrt)(VF##w(s, i));
+
+#define LRCSS(w, g, s, i)                                                   \
+        VF##w(s, i) = 2 - VF##w(s, i) * VF##w(g, i);                        \
+        VF##w(g, i) = VF##w(g, i) * VF##w(s, i);
+
+#define LRSSS(w, g, s, i)                                                   \
+        VF##w(s, i) = VF##w(s, i) * VF##w(g, i);                            \
+        VF##w(s, i) = (3 - VF##w(s, i) * VF##w(g, i)) / 2;                  \
+        VF##w(g, i) = VF##w(g, i) * VF##w(s, i);
+
+#define LRNZS(w, d, s, i)                                                   \
+        VF##w(d, i) = MF##w(trunc)(VF##w(s, i));
+
+#define LRNPS(w, d, s, i)                                                   \
+        VF##w(d, i) = MF##w(ceil)(VF##w(s, i));
+
+#define LRNMS(w, d, s, i)                                                   \
+        VF##w(d, i) = MF##w(floor)(VF##w(s, i));
+
+#define LRNNS(w, d, s, i)                                                   \
+        VF##w(d, i) = MF##w(roundeven)(VF##w(s, i));
+
+#define LRNDS(w, d, s, i)                                                   \
+        VF##w(d, i) = MF##w(nearbyint)(VF##w(s, i));
+
+#define LCVZS(w, d, s, i)                                                   \
+        VS##w(d, i) = (rt_si##w)MF##w(trunc)(VF##w(s, i));
+
+#define LCVPS(w, d, s, i)                                                   \
+        VS##w(d, i) = (rt_si##w)MF##w(ceil)(VF##w(s, i));
+
+#define LCVMS(w, d, s, i)                                                   \
+        VS##w(d, i) = (rt_si##w)MF##w(floor)(VF##w(s, i));
+
+#define LCVNS(w, d, s, i)                                                   \
+        VS##w(d, i) = (rt_si##w)MF##w(roundeven)(VF##w(s, i));
+
+#define LCVTN(w, d, s, i)                                                   \
+        VF##w(d, i) = (rt_fp##w)VS##w(s, i);
+
+#define LRNRS(w, d, s, m, i)                                                \
+        VF##w(d, i) = ((m) & 3) == 0 ? MF##w(roundeven)(VF##w(s, i)) :      \
+                      ((m) & 3) == 1 ? MF##w(ceil)(VF##w(s, i)) :           \
+                      ((m) & 3) == 2 ? MF##w(floor)(VF##w(s, i)) :          \
+                                       MF##w(trunc)(VF##w(s, i));
+
+/* fenv rounding mode from RT_SIMD_MODE_* (ROUNDN, ROUNDP, ROUNDM, ROUNDZ) */
+
+#define FEM(m)                                                              \
+        ((m) == 0 ? FE_TONEAREST : (m) == 1 ? FE_UPWARD :                   \
+         (m) == 2 ? FE_DOWNWARD : FE_TOWARDZERO)
+
+/* registers    REG   (check mapping with ASM_ENTER/ASM_LEAVE in rtarch.h) */
+
+#define Tmm0    0x00  /* Xmm0, internal name for mask (in mmv) */
+#define TmmQ    0x0F  /* temp-reg name for lane-crossing ops */
+#define TmmM    0x1F  /* temp-reg name for mem-args */
+
+/******************************************************************************/
+/********************************   EXTERNAL   ********************************/
+/******************************************************************************/
+
+/* registers    REG,  MOD,  SIB */
+
+#define Xmm0    0x00, 0x00, EMPTY
+#define Xmm1    0x01, 0x00, EMPTY
+#define Xmm2    0x02, 0x00, EMPTY
+#define Xmm3    0x03, 0x00, EMPTY
+#define Xmm4    0x04, 0x00, EMPTY
+#define Xmm5    0x05, 0x00, EMPTY
+#define Xmm6    0x06, 0x00, EMPTY
+#define Xmm7    0x07, 0x00, EMPTY
+#define Xmm8    0x08, 0x00, EMPTY
+#define Xmm9    0x09, 0x00, EMPTY
+#define XmmA    0x0A, 0x00, EMPTY
+#define XmmB    0x0B, 0x00, EMPTY
+#define XmmC    0x0C, 0x00, EMPTY
+#define XmmD    0x0D, 0x00, EMPTY
+#define XmmE    0x0E, 0x00, EMPTY
+
+/* only for 128-bit instructions, provided as an extension
+ * to common baseline of 15 registers */
+
+#define XmmF    0x1E, 0x00, EMPTY
+#define XmmG    0x10, 0x00, EMPTY
+#define XmmH    0x11, 0x00, EMPTY
+#define XmmI    0x12, 0x00, EMPTY
+#define XmmJ    0x13, 0x00, EMPTY
+#define XmmK    0x14, 0x00, EMPTY
+#define XmmL    0x15, 0x00, EMPTY
+#define XmmM    0x16, 0x00, EMPTY
+#define XmmN    0x17, 0x00, EMPTY
+#define XmmO    0x18, 0x00, EMPTY
+#define XmmP    0x19, 0x00, EMPTY
+#define XmmQ    0x1A, 0x00, EMPTY
+#define XmmR    0x1B, 0x00, EMPTY
+#define XmmS    0x1C, 0x00, EMPTY
+#define XmmT    0x1D, 0x00, EMPTY
+
+/******************************************************************************/
+/**********************************   SIMD   **********************************/
+/******************************************************************************/
+
+/* elm (D = S), store first SIMD element with natural alignment
+ * allows to decouple scalar subset from SIMD where appropriate */
+
+#define elmix_st(XS, MD, DD) /* 1st elem as in mem with SIMD load/store */  \
+        movrs_st(W(XS), W(MD), W(DD))
+
+/***************   packed single-precision generic move/logic   ***************/
+
+/* mov (D = S) */
+
+#define movix_rr(XD, XS)                                                    \
+        VMV(REG(XD), REG(XS))
+
+#define movix_ld(XD, MS, DS)                                                \
+        VLD(REG(XD), MS, DS)
+
+#define movix_st(XS, MD, DD)                                                \
+        VST(REG(XS), MD, DD)
+
+/* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
+ * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
+
+#define mmvix_rr(XG, XS)                                                    \
+        EJ3(LMMVX, REG(XG), REG(XS), Tmm0)
+
+#define mmvix_ld(XG, MS, DS)                                                \
+        VLD(TmmM, MS, DS)                                                   \
+        EJ3(LMMVX, REG(XG), TmmM, Tmm0)
+
+#define mmvix_st(XS, MG, DG)                                                \
+        VLD(TmmM, MG, DG)                                                   \
+        EJ3(LMMVX, TmmM, REG(XS), Tmm0)                                     \
+        VST(TmmM, MG, DG)
+
+/* and (G = G & S), (D = S & T) if (#D != #S) */
+
+#define andix_rr(XG, XS)                                                    \
+        andix3rr(W(XG), W(XG), W(XS))
+
+#define andix_ld(XG, MS, DS)                                                \
+        andix3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define andix3rr(XD, XS, XT)                                                \
+        EI3(LANDX, REG(XD), REG(XS), REG(XT))
+
+#define andix3ld(XD, XS, MT, DT)                                            \
+        VLD(TmmM, MT, DT)                                                   \
+        EI3(LANDX, REG(XD), REG(XS), TmmM)
+
+/* ann (G = ~G & S), (D = ~S & T) if (#D != #S) */
+
+#define annix_rr(XG, XS)                                                    \
+        annix3rr(W(XG), W(XG), W(XS))
+
+#define annix_ld(XG, MS, DS)                                                \
+        annix3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define annix3rr(XD, XS, XT)                                                \
+        EI3(LANNX, REG(XD), REG(XS), REG(XT))
+
+#define annix3ld(XD, XS, MT, DT)                                            \
+        VLD(TmmM, MT, DT)                                                   \
+        EI3(LANNX, REG(XD), REG(XS), TmmM)
+
+/* orr (G = G | S), (D = S | T) if (#D != #S) */
+
+#define orrix_rr(XG, XS)                                                    \
+        orrix3rr(W(XG), W(XG), W(XS))
+
+#define orrix_ld(XG, MS, DS)                                                \
+        orrix3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define orrix3rr(XD, XS, XT)                                                \
+        EI3(LORRX, REG(XD), REG(XS), REG(XT))
+
+#define orrix3ld(XD, XS, MT, DT)                                            \
+        VLD(TmmM, MT, DT)                                                   \
+        EI3(LORRX, REG(XD), REG(XS), TmmM)
+
+/* orn (G = ~G | S), (D = ~S | T) if (#D != #S) */
+
+#define ornix_rr(XG, XS)                                                    \
+        ornix3rr(W(XG), W(XG), W(XS))
+
+#define ornix_ld(XG, MS, DS)                                                \
+        ornix3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define ornix3rr(XD, XS, XT)                                                \
+        EI3(LORNX, REG(XD), REG(XS), REG(XT))
+
+#define ornix3ld(XD, XS, MT, DT)                                            \
+        VLD(TmmM, MT, DT)                                                   \
+        EI3(LORNX, REG(XD), REG(XS), TmmM)
+
+/* xor (G = G ^ S), (D = S ^ T) if (#D != #S) */
+
+#define xorix_rr(XG, XS)                                                    \
+        xorix3rr(W(XG), W(XG), W(XS))
+
+#define xorix_ld(XG, MS, DS)                                                \
+        xorix3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define xorix3rr(XD, XS, XT)                                                \
+        EI3(LXORX, REG(XD), REG(XS), REG(XT))
+
+#define xorix3ld(XD, XS, MT, DT)                                            \
+        VLD(TmmM, MT, DT)                                                   \
+        EI3(LXORX, REG(XD), REG(XS), TmmM)
+
+/* not (G = ~G), (D = ~S) */
+
+#define notix_rx(XG)                                                        \
+        notix_rr(W(XG), W(XG))
+
+#define notix_rr(XD, XS)                                                    \
+        EI2(LNOTX, REG(XD), REG(XS))
+
+/************   packed single-precision floating-point arithmetic   ***********/
+
+/* neg (G = -G), (D = -S) */
+
+#define negis_rx(XG)                                                        \
+        negis_rr(W(XG), W(XG))
+
+#define negis_rr(XD, XS)                                                    \
+        EI2(LNEGS, REG(XD), REG(XS))
+
+/* add (G = G + S), (D = S + T) if (#D != #S) */
+
+#define addis_rr(XG, XS)                                                    \
+        addis3rr(W(XG), W(XG), W(XS))
+
+#define addis_ld(XG, MS, DS)                                                \
+        addis3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define addis3rr(XD, XS, XT)                                                \
+        EI3(LADDS, REG(XD), REG(XS), REG(XT))
+
+#define addis3ld(XD, XS, MT, DT)                                            \
+        VLD(TmmM, MT, DT)                                                   \
+        EI3(LADDS, REG(XD), REG(XS), TmmM)
+
+        /* adp, adh are defined in rtbase.h (first 15-regs only)
+         * under "COMMON SIMD INSTRUCTIONS" section */
+
+#undef  adpis3rr
+#define adpis3rr(XD, XS, XT)                                                \
+        EI3(LADPS, TmmQ, REG(XS), REG(XT))                                  \
+        VMV(REG(XD), TmmQ)
+
+#undef  adpis3ld
+#define adpis3ld(XD, XS, MT, DT)                                            \
+        VLD(TmmM, MT, DT)                                                   \
+        EI3(LADPS, TmmQ, REG(XS), TmmM)                                     \
+        VMV(REG(XD), TmmQ)
+
+/* sub (G = G - S), (D = S - T) if (#D != #S) */
+
+#define subis_rr(XG, XS)                                                    \
+        subis3rr(W(XG), W(XG), W(XS))
+
+#define subis_ld(XG, MS, DS)                                                \
+        subis3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define subis3rr(XD, XS, XT)                                                \
+        EI3(LSUBS, REG(XD), REG(XS), REG(XT))
+
+#define subis3ld(XD, XS, MT, DT)                                            \
+        VLD(TmmM, MT, DT)                                                   \
+        EI3(LSUBS, REG(XD), REG(XS), TmmM)
+
+/* mul (G = G * S), (D = S * T) if (#D != #S) */
+
+#define mulis_rr(XG, XS)                                                    \
+        mulis3rr(W(XG), W(XG), W(XS))
+
+#define mulis_ld(XG, MS, DS)                                                \
+        mulis3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define mulis3rr(XD, XS, XT)                                                \
+        EI3(LMULS, REG(XD), REG(XS), REG(XT))
+
+#define mulis3ld(XD, XS, MT, DT)                                            \
+        VLD(TmmM, MT, DT)                                                   \
+        EI3(LMULS, REG(XD), REG(XS), TmmM)
+
+        /* mlp, mlh are defined in rtbase.h
+         * under "COMMON SIMD INSTRUCTIONS" section */
+
+/* div (G = G / S), (D = S / T) if (#D != #S) */
+
+#define divis_rr(XG, XS)                                                    \
+        divis3rr(W(XG), W(XG), W(XS))
+
+#define divis_ld(XG, MS, DS)                                                \
+        divis3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define divis3rr(XD, XS, XT)                                                \
+        EI3(LDIVS, REG(XD), REG(XS), REG(XT))
+
+#define divis3ld(XD, XS, MT, DT)                                            \
+        VLD(TmmM, MT, DT)                                                   \
+        EI3(LDIVS, REG(XD), REG(XS), TmmM)
+
+/* sqr (D = sqrt S) */
+
+#define sqris_rr(XD, XS)                                                    \
+        EI2(LSQRS, REG(XD), REG(XS))
+
+#define sqris_ld(XD, MS, DS)                                                \
+        VLD(TmmM, MS, DS)                                                   \
+        EI2(LSQRS, REG(XD), TmmM)
+
+/* cbr (D = cbrt S) */
+
+        /* cbe, cbs, cbr are defined in rtbase.h
+         * under "COMMON SIMD INSTRUCTIONS" section */
+
+/* rcp (D = 1.0 / S)
+ * accuracy/behavior may vary across supported targets, use accordingly */
+
+#if RT_SIMD_COMPAT_RCP != 1
+
+#define rceis_rr(XD, XS)                                                    \
+        EI2(LRCES, REG(XD), REG(XS))
+
+#define rcsis_rr(XG, XS) /* destroys XS */                                  \
+        EI2(LRCSS, REG(XG), REG(XS))
+
+#endif /* RT_SIMD_COMPAT_RCP */
+
+        /* rce, rcs, rcp are defined in rtconf.h
+         * under "COMMON SIMD INSTRUCTIONS" section */
+
+/* rsq (D = 1.0 / sqrt S)
+ * accuracy/behavior may vary across supported targets, use accordingly */
+
+#if RT_SIMD_COMPAT_RSQ != 1
+
+#define rseis_rr(XD, XS)                                                    \
+        EI2(LRSES, REG(XD), REG(XS))
+
+#define rssis_rr(XG, XS) /* destroys XS */                                  \
+        EI2(LRSSS, REG(XG), REG(XS))
+
+#endif /* RT_SIMD_COMPAT_RSQ */
+
+        /* rse, rss, rsq are defined in rtconf.h
+         * under "COMMON SIMD INSTRUCTIONS" section */
+
+/* fma (G = G + S * T) if (#G != #S && #G != #T)
+ * NOTE: x87 fpu-fallbacks for fma/fms use round-to-nearest mode by default,
+ * enable RT_SIMD_COMPAT_FMR for current SIMD rounding mode to be honoured */
+
+#if RT_SIMD_COMPAT_FMA <= 1
+
+#define fmais_rr(XG, XS, XT)                                                \
+        EI3(LFMAS, REG(XG), REG(XS), REG(XT))
+
+#define fmais_ld(XG, XS, MT, DT)                                            \
+        VLD(TmmM, MT, DT)                                                   \
+        EI3(LFMAS, REG(XG), REG(XS), TmmM)
+
+#endif /* RT_SIMD_COMPAT_FMA */
+
+/* fms (G = G - S * T) if (#G != #S && #G != #T)
+ * NOTE: due to final negation being outside of rounding on all POWER systems
+ * only symmetric rounding modes (RN, RZ) are compatible across all targets */
+
+#if RT_SIMD_COMPAT_FMS <= 1
+
+#define fmsis_rr(XG, XS, XT)                                                \
+        EI3(LFMSS, REG(XG), REG(XS), REG(XT))
+
+#define fmsis_ld(XG, XS, MT, DT)                                            \
+        VLD(TmmM, MT, DT)                                                   \
+        EI3(LFMSS, REG(XG), REG(XS), TmmM)
+
+#endif /* RT_SIMD_COMPAT_FMS */
+
+/*************   packed single-precision floating-point compare   *************/
+
+/* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #S) */
+
+#define minis_rr(XG, XS)                                                    \
+        minis3rr(W(XG), W(XG), W(XS))
+
+#define minis_ld(XG, MS, DS)                                                \
+        minis3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define minis3rr(XD, XS, XT)                                                \
+        EI3(LMINS, REG(XD), REG(XS), REG(XT))
+
+#define minis3ld(XD, XS, MT, DT)                                            \
+        VLD(TmmM, MT, DT)                                                   \
+        EI3(LMINS, REG(XD), REG(XS), TmmM)
+
+        /* mnp, mnh are defined in rtbase.h
+         * under "COMMON SIMD INSTRUCTIONS" section */
+
+/* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #S) */
+
+#define maxis_rr(XG, XS)                                                    \
+        maxis3rr(W(XG), W(XG), W(XS))
+
+#define maxis_ld(XG, MS, DS)                                                \
+        maxis3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define maxis3rr(XD, XS, XT)                                                \
+        EI3(LMAXS, REG(XD), REG(XS), REG(XT))
+
+#define maxis3ld(XD, XS, MT, DT)                                            \
+        VLD(TmmM, MT, DT)                                                   \
+        EI3(LMAXS, REG(XD), REG(XS), TmmM)
+
+        /* mxp, mxh are defined in rtbase.h
+         * under "COMMON SIMD INSTRUCTIONS" section */
+
+/* ceq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #S) */
+
+#define ceqis_rr(XG, XS)                                                    \
+        ceqis3rr(W(XG), W(XG), W(XS))
+
+#define ceqis_ld(XG, MS, DS)                                                \
+        ceqis3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define ceqis3rr(XD, XS, XT)                                                \
+        EI3(LCEQS, REG(XD), REG(XS), REG(XT))
+
+#define ceqis3ld(XD, XS, MT, DT)                                            \
+        VLD(TmmM, MT, DT)                                                   \
+        EI3(LCEQS, REG(XD), REG(XS), TmmM)
+
+/* cne (G = G != S ? -1 : 0), (D = S != T ? -1 : 0) if (#D != #S) */
+
+#define cneis_rr(XG, XS)                                                    \
+        cneis3rr(W(XG), W(XG), W(XS))
+
+#define cneis_ld(XG, MS, DS)                                                \
+        cneis3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define cneis3rr(XD, XS, XT)                                                \
+        EI3(LCNES, REG(XD), REG(XS), REG(XT))
+
+#define cneis3ld(XD, XS, MT, DT)                                            \
+        VLD(TmmM, MT, DT)                                                   \
+        EI3(LCNES, REG(XD), REG(XS), TmmM)
+
+/* clt (G = G < S ? -1 : 0), (D = S < T ? -1 : 0) if (#D != #S) */
+
+#define cltis_rr(XG, XS)                                                    \
+        cltis3rr(W(XG), W(XG), W(XS))
+
+#define cltis_ld(XG, MS, DS)                                                \
+        cltis3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define cltis3rr(XD, XS, XT)                                                \
+        EI3(LCLTS, REG(XD), REG(XS), REG(XT))
+
+#define cltis3ld(XD, XS, MT, DT)                                            \
+        VLD(TmmM, MT, DT)                                                   \
+        EI3(LCLTS, REG(XD), REG(XS), TmmM)
+
+/* cle (G = G <= S ? -1 : 0), (D = S <= T ? -1 : 0) if (#D != #S) */
+
+#define cleis_rr(XG, XS)                                                    \
+        cleis3rr(W(XG), W(XG), W(XS))
+
+#define cleis_ld(XG, MS, DS)                                                \
+        cleis3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define cleis3rr(XD, XS, XT)                                                \
+        EI3(LCLES, REG(XD), REG(XS), REG(XT))
+
+#define cleis3ld(XD, XS, MT, DT)                                            \
+        VLD(TmmM, MT, DT)                                                   \
+        EI3(LCLES, REG(XD), REG(XS), TmmM)
+
+/* cgt (G = G > S ? -1 : 0), (D = S > T ? -1 : 0) if (#D != #S) */
+
+#define cgtis_rr(XG, XS)                                                    \
+        cgtis3rr(W(XG), W(XG), W(XS))
+
+#define cgtis_ld(XG, MS, DS)                                                \
+        cgtis3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define cgtis3rr(XD, XS, XT)                                                \
+        EI3(LCGTS, REG(XD), REG(XS), REG(XT))
+
+#define cgtis3ld(XD, XS, MT, DT)                                            \
+        VLD(TmmM, MT, DT)                                                   \
+        EI3(LCGTS, REG(XD), REG(XS), TmmM)
+
+/* cge (G = G >= S ? -1 : 0), (D = S >= T ? -1 : 0) if (#D != #S) */
+
+#define cgeis_rr(XG, XS)                                                    \
+        cgeis3rr(W(XG), W(XG), W(XS))
+
+#define cgeis_ld(XG, MS, DS)                                                \
+        cgeis3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define cgeis3rr(XD, XS, XT)                                                \
+        EI3(LCGES, REG(XD), REG(XS), REG(XT))
+
+#define cgeis3ld(XD, XS, MT, DT)                                            \
+        VLD(TmmM, MT, DT)                                                   \
+        EI3(LCGES, REG(XD), REG(XS), TmmM)
+
+/* mkj (jump to lb) if (S satisfies mask condition) */
+
+#define RT_SIMD_MASK_NONE32_128     0x00    /* none satisfy the condition */
+#define RT_SIMD_MASK_FULL32_128     0x0F    /*  all satisfy the condition */
+
+#define mkjix_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
+        __Reg__[Teax] = VU32(REG(XS), 0) >> 31 |                            \
+                        VU32(REG(XS), 1) >> 31 << 1 |                       \
+                        VU32(REG(XS), 2) >> 31 << 2 |                       \
+                        VU32(REG(XS), 3) >> 31 << 3;                        \
+        cmjwx_ri(Reax, IB(RT_SIMD_MASK_##mask##32_128), EQ_x, lb)
+
+/*************   packed single-precision floating-point convert   *************/
+
+/* cvz (D = fp-to-signed-int S)
+ * rounding mode is encoded directly (can be used in FCTRL blocks)
+ * NOTE: due to compatibility with legacy targets, fp32 SIMD fp-to-int
+ * round instructions are only accurate within 32-bit signed int range */
+
+#define rnzis_rr(XD, XS)     /* round towards zero */                       \
+        EI2(LRNZS, REG(XD), REG(XS))
+
+#define rnzis_ld(XD, MS, DS) /* round towards zero */                       \
+        VLD(TmmM, MS, DS)                                                   \
+        EI2(LRNZS, REG(XD), TmmM)
+
+#define cvzis_rr(XD, XS)     /* round towards zero */                       \
+        EI2(LCVZS, REG(XD), REG(XS))
+
+#define cvzis_ld(XD, MS, DS) /* round towards zero */                       \
+        VLD(TmmM, MS, DS)                                                   \
+        EI2(LCVZS, REG(XD), TmmM)
+
+/* cvp (D = fp-to-signed-int S)
+ * rounding mode encoded directly (cannot be used in FCTRL blocks)
+ * NOTE: due to compatibility with legacy targets, fp32 SIMD fp-to-int
+ * round instructions are only accurate within 32-bit signed int range */
+
+#define rnpis_rr(XD, XS)     /* round towards +inf */                       \
+        EI2(LRNPS, REG(XD), REG(XS))
+
+#define rnpis_ld(XD, MS, DS) /* round towards +inf */                       \
+        VLD(TmmM, MS, DS)                                                   \
+        EI2(LRNPS, REG(XD), TmmM)
+
+#define cvpis_rr(XD, XS)     /* round towards +inf */                       \
+        EI2(LCVPS, REG(XD), REG(XS))
+
+#define cvpis_ld(XD, MS, DS) /* round towards +inf */                       \
+        VLD(TmmM, MS, DS)                                                   \
+        EI2(LCVPS, REG(XD), TmmM)
+
+/* cvm (D = fp-to-signed-int S)
+ * rounding mode encoded directly (cannot be used in FCTRL blocks)
+ * NOTE: due to compatibility with legacy targets, fp32 SIMD fp-to-int
+ * round instructions are only accurate within 32-bit signed int range */
+
+#define rnmis_rr(XD, XS)     /* round towards -inf */                       \
+        EI2(LRNMS, REG(XD), REG(XS))
+
+#define rnmis_ld(XD, MS, DS) /* round towards -inf */                       \
+        VLD(TmmM, MS, DS)                                                   \
+        EI2(LRNMS, REG(XD), TmmM)
+
+#define cvmis_rr(XD, XS)     /* round towards -inf */                       \
+        EI2(LCVMS, REG(XD), REG(XS))
+
+#define cvmis_ld(XD, MS, DS) /* round towards -inf */                       \
+        VLD(TmmM, MS, DS)                                                   \
+        EI2(LCVMS, REG(XD), TmmM)
+
+/* cvn (D = fp-to-signed-int S)
+ * rounding mode encoded directly (cannot be used in FCTRL blocks)
+ * NOTE: due to compatibility with legacy targets, fp32 SIMD fp-to-int
+ * round instructions are only accurate within 32-bit signed int range */
+
+#define rnnis_rr(XD, XS)     /* round towards near */                       \
+        EI2(LRNNS, REG(XD), REG(XS))
+
+#define rnnis_ld(XD, MS, DS) /* round towards near */                       \
+        VLD(TmmM, MS, DS)                                                   \
+        EI2(LRNNS, REG(XD), TmmM)
+
+#define cvnis_rr(XD, XS)     /* round towards near */                       \
+        EI2(LCVNS, REG(XD), REG(XS))
+
+#define cvnis_ld(XD, MS, DS) /* round towards near */                       \
+        VLD(TmmM, MS, DS)                                                   \
+        EI2(LCVNS, REG(XD), TmmM)
+
+/* cvn (D = signed-int-to-fp S)
+ * rounding mode encoded directly (cannot be used in FCTRL blocks) */
+
+#define cvnin_rr(XD, XS)     /* round towards near */                       \
+        cvtin_rr(W(XD), W(XS))
+
+#define cvnin_ld(XD, MS, DS) /* round towards near */                       \
+        cvtin_ld(W(XD), W(MS), W(DS))
+
+/* cvt (D = fp-to-signed-int S)
+ * rounding mode comes from fp control register (set in FCTRL blocks)
+ * NOTE: ROUNDZ is not supported on pre-VSX POWER systems, use cvz
+ * NOTE: due to compatibility with legacy targets, fp32 SIMD fp-to-int
+ * round instructions are only accurate within 32-bit signed int range */
+
+#define rndis_rr(XD, XS)                                                    \
+        EI2(LRNDS, REG(XD), REG(XS))
+
+#define rndis_ld(XD, MS, DS)                                                \
+        VLD(TmmM, MS, DS)                                                   \
+        EI2(LRNDS, REG(XD), TmmM)
+
+#define cvtis_rr(XD, XS)                                                    \
+        rndis_rr(W(XD), W(XS))                                              \
+        cvzis_rr(W(XD), W(XD))
+
+#define cvtis_ld(XD, MS, DS)                                                \
+        rndis_ld(W(XD), W(MS), W(DS))                                       \
+        cvzis_rr(W(XD), W(XD))
+
+/* cvt (D = signed-int-to-fp S)
+ * rounding mode comes from fp control register (set in FCTRL blocks)
+ * NOTE: only default ROUNDN is supported on pre-VSX POWER systems */
+
+#define cvtin_rr(XD, XS)                                                    \
+        EI2(LCVTN, REG(XD), REG(XS))
+
+#define cvtin_ld(XD, MS, DS)                                                \
+        VLD(TmmM, MS, DS)                                                   \
+        EI2(LCVTN, REG(XD), TmmM)
+
+/* cvr (D = fp-to-signed-int S)
+ * rounding mode is encoded directly (cannot be used in FCTRL blocks)
+ * NOTE: on targets with full-IEEE SIMD fp-arithmetic the ROUND*_F mode
+ * isn't always taken into account when used within full-IEEE ASM block
+ * NOTE: due to compatibility with legacy targets, fp32 SIMD fp-to-int
+ * round instructions are only accurate within 32-bit signed int range */
+
+#define rnris_rr(XD, XS, mode)                                              \
+        EI3(LRNRS, REG(XD), REG(XS), RT_SIMD_MODE_##mode)
+
+#define cvris_rr(XD, XS, mode)                                              \
+        rnris_rr(W(XD), W(XS), mode)                                        \
+        cvzis_rr(W(XD), W(XD))
+
+/************   packed single-precision integer arithmetic/shifts   ***********/
+
+/* add (G = G + S), (D = S + T) if (#D != #S) */
+
+#define addix_rr(XG, XS)                                                    \
+        addix3rr(W(XG), W(XG), W(XS))
+
+#define addix_ld(XG, MS, DS)                                                \
+        addix3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define addix3rr(XD, XS, XT)                                                \
+        EI3(LADDX, REG(XD), REG(XS), REG(XT))
+
+#define addix3ld(XD, XS, MT, DT)                                            \
+        VLD(TmmM, MT, DT)                                                   \
+        EI3(LADDX, REG(XD), REG(XS), TmmM)
+
+/* sub (G = G - S), (D = S - T) if (#D != #S) */
+
+#define subix_rr(XG, XS)                                                    \
+        subix3rr(W(XG), W(XG), W(XS))
+
+#define subix_ld(XG, MS, DS)                                                \
+        subix3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define subix3rr(XD, XS, XT)                                                \
+        EI3(LSUBX, REG(XD), REG(XS), REG(XT))
+
+#define subix3ld(XD, XS, MT, DT)                                            \
+        VLD(TmmM, MT, DT)                                                   \
+        EI3(LSUBX, REG(XD), REG(XS), TmmM)
+
+/* mul (G = G * S), (D = S * T) if (#D != #S) */
+
+#define mulix_rr(XG, XS)                                                    \
+        mulix3rr(W(XG), W(XG), W(XS))
+
+#define mulix_ld(XG, MS, DS)                                                \
+        mulix3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define mulix3rr(XD, XS, XT)                                                \
+        EI3(LMULX, REG(XD), REG(XS), REG(XT))
+
+#define mulix3ld(XD, XS, MT, DT)                                            \
+        VLD(TmmM, MT, DT)                                                   \
+        EI3(LMULX, REG(XD), REG(XS), TmmM)
+
+/* shl (G = G << S), (D = S << T) if (#D != #S) - plain, unsigned
+ * for maximum compatibility, shift count mustn't exceed elem-size */
+
+#define shlix_ri(XG, IS)                                                    \
+        shlix3ri(W(XG), W(XG), W(IS))
+
+#define shlix_ld(XG, MS, DS) /* loads SIMD, uses first elem, rest zeroed */ \
+        shlix3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define shlix3ri(XD, XS, IT)                                                \
+        EI3(LSHLX, REG(XD), REG(XS), VAL(IT))
+
+#define shlix3ld(XD, XS, MT, DT)                                            \
+        VLD(TmmM, MT, DT)                                                   \
+        EI3(LSHLX, REG(XD), REG(XS), VU32(TmmM, 0))
+
+/* shr (G = G >> S), (D = S >> T) if (#D != #S) - plain, unsigned
+ * for maximum compatibility, shift count mustn't exceed elem-size */
+
+#define shrix_ri(XG, IS)     /* emits shift-left for zero-immediate args */ \
+        shrix3ri(W(XG), W(XG), W(IS))
+
+#define shrix_ld(XG, MS, DS) /* loads SIMD, uses first elem, rest zeroed */ \
+        shrix3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define shrix3ri(XD, XS, IT)                                                \
+        EI3(LSHRX, REG(XD), REG(XS), VAL(IT))
+
+#define shrix3ld(XD, XS, MT, DT)                                            \
+        VLD(TmmM, MT, DT)                                                   \
+        EI3(LSHRX, REG(XD), REG(XS), VU32(TmmM, 0))
+
+/* shr (G = G >> S), (D = S >> T) if (#D != #S) - plain, signed
+ * for maximum compatibility, shift count mustn't exceed elem-size */
+
+#define shrin_ri(XG, IS)     /* emits shift-left for zero-immediate args */ \
+        shrin3ri(W(XG), W(XG), W(IS))
+
+#define shrin_ld(XG, MS, DS) /* loads SIMD, uses first elem, rest zeroed */ \
+        shrin3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define shrin3ri(XD, XS, IT)                                                \
+        EI3(LSHRN, REG(XD), REG(XS), VAL(IT))
+
+#define shrin3ld(XD, XS, MT, DT)                                            \
+        VLD(TmmM, MT, DT)                                                   \
+        EI3(LSHRN, REG(XD), REG(XS), VU32(TmmM, 0))
+
+/* svl (G = G << S), (D = S << T) if (#D != #S) - variable, unsigned
+ * for maximum compatibility, shift count mustn't exceed elem-size */
+
+#define svlix_rr(XG, XS)     /* variable shift with per-elem count */       \
+        svlix3rr(W(XG), W(XG), W(XS))
+
+#define svlix_ld(XG, MS, DS) /* variable shift with per-elem count */       \
+        svlix3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define svlix3rr(XD, XS, XT)                                                \
+        EI3(LSVLX, REG(XD), REG(XS), REG(XT))
+
+#define svlix3ld(XD, XS, MT, DT)                                            \
+        VLD(TmmM, MT, DT)                                                   \
+        EI3(LSVLX, REG(XD), REG(XS), TmmM)
+
+/* svr (G = G >> S), (D = S >> T) if (#D != #S) - variable, unsigned
+ * for maximum compatibility, shift count mustn't exceed elem-size */
+
+#define svrix_rr(XG, XS)     /* variable shift with per-elem count */       \
+        svrix3rr(W(XG), W(XG), W(XS))
+
+#define svrix_ld(XG, MS, DS) /* variable shift with per-elem count */       \
+        svrix3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define svrix3rr(XD, XS, XT)                                                \
+        EI3(LSVRX, REG(XD), REG(XS), REG(XT))
+
+#define svrix3ld(XD, XS, MT, DT)                                            \
+        VLD(TmmM, MT, DT)                                                   \
+        EI3(LSVRX, REG(XD), REG(XS), TmmM)
+
+/* svr (G = G >> S), (D = S >> T) if (#D != #S) - variable, signed
+ * for maximum compatibility, shift count mustn't exceed elem-size */
+
+#define svrin_rr(XG, XS)     /* variable shift with per-elem count */       \
+        svrin3rr(W(XG), W(XG), W(XS))
+
+#define svrin_ld(XG, MS, DS) /* variable shift with per-elem count */       \
+        svrin3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define svrin3rr(XD, XS, XT)                                                \
+        EI3(LSVRN, REG(XD), REG(XS), REG(XT))
+
+#define svrin3ld(XD, XS, MT, DT)                                            \
+        VLD(TmmM, MT, DT)                                                   \
+        EI3(LSVRN, REG(XD), REG(XS), TmmM)
+
+/******************************************************************************/
+/**********************************   ELEM   **********************************/
+/******************************************************************************/
+
+/*********   scalar single-precision floating-point move/arithmetic   *********/
+
+/* mov (D = S) */
+
+#define movrs_rr(XD, XS)                                                    \
+        VU32(REG(XD), 0) = VU32(REG(XS), 0);
+
+#define movrs_ld(XD, MS, DS)                                                \
+        VU32(REG(XD), 0) = MW(MS, DS);
+
+#define movrs_st(XS, MD, DD)                                                \
+        MW(MD, DD) = VU32(REG(XS), 0);
+
+/* add (G = G + S), (D = S + T) if (#D != #S) */
+
+#define addrs_rr(XG, XS)                                                    \
+        addrs3rr(W(XG), W(XG), W(XS))
+
+#define addrs_ld(XG, MS, DS)                                                \
+        addrs3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define addrs3rr(XD, XS, XT)                                                \
+        ER3(LADDS, REG(XD), REG(XS), REG(XT))
+
+#define addrs3ld(XD, XS, MT, DT)                                            \
+        VU32(TmmM, 0) = MW(MT, DT);                                         \
+        ER3(LADDS, REG(XD), REG(XS), TmmM)
+
+/* sub (G = G - S), (D = S - T) if (#D != #S) */
+
+#define subrs_rr(XG, XS)                                                    \
+        subrs3rr(W(XG), W(XG), W(XS))
+
+#define subrs_ld(XG, MS, DS)                                                \
+        subrs3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define subrs3rr(XD, XS, XT)                                                \
+        ER3(LSUBS, REG(XD), REG(XS), REG(XT))
+
+#define subrs3ld(XD, XS, MT, DT)                                            \
+        VU32(TmmM, 0) = MW(MT, DT);                                         \
+        ER3(LSUBS, REG(XD), REG(XS), TmmM)
+
+/* mul (G = G * S), (D = S * T) if (#D != #S) */
+
+#define mulrs_rr(XG, XS)                                                    \
+        mulrs3rr(W(XG), W(XG), W(XS))
+
+#define mulrs_ld(XG, MS, DS)                                                \
+        mulrs3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define mulrs3rr(XD, XS, XT)                                                \
+        ER3(LMULS, REG(XD), REG(XS), REG(XT))
+
+#define mulrs3ld(XD, XS, MT, DT)                                            \
+        VU32(TmmM, 0) = MW(MT, DT);                                         \
+        ER3(LMULS, REG(XD), REG(XS), TmmM)
+
+/* div (G = G / S), (D = S / T) if (#D != #S) */
+
+#define divrs_rr(XG, XS)                                                    \
+        divrs3rr(W(XG), W(XG), W(XS))
+
+#define divrs_ld(XG, MS, DS)                                                \
+        divrs3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define divrs3rr(XD, XS, XT)                                                \
+        ER3(LDIVS, REG(XD), REG(XS), REG(XT))
+
+#define divrs3ld(XD, XS, MT, DT)                                            \
+        VU32(TmmM, 0) = MW(MT, DT);                                         \
+        ER3(LDIVS, REG(XD), REG(XS), TmmM)
+
+/* sqr (D = sqrt S) */
+
+#define sqrrs_rr(XD, XS)                                                    \
+        ER2(LSQRS, REG(XD), REG(XS))
+
+#define sqrrs_ld(XD, MS, DS)                                                \
+        VU32(TmmM, 0) = MW(MS, DS);                                         \
+        ER2(LSQRS, REG(XD), TmmM)
+
+/* rcp (D = 1.0 / S)
+ * accuracy/behavior may vary across supported targets, use accordingly */
+
+#if RT_SIMD_COMPAT_RCP != 1
+
+#define rcers_rr(XD, XS)                                                    \
+        ER2(LRCES, REG(XD), REG(XS))
+
+#define rcsrs_rr(XG, XS) /* destroys XS */                                  \
+        ER2(LRCSS, REG(XG), REG(XS))
+
+#endif /* RT_SIMD_COMPAT_RCP */
+
+        /* rce, rcs, rcp are defined in rtconf.h
+         * under "COMMON SIMD INSTRUCTIONS" section */
+
+/* rsq (D = 1.0 / sqrt S)
+ * accuracy/behavior may vary across supported targets, use accordingly */
+
+#if RT_SIMD_COMPAT_RSQ != 1
+
+#define rsers_rr(XD, XS)                                                    \
+        ER2(LRSES, REG(XD), REG(XS))
+
+#define rssrs_rr(XG, XS) /* destroys XS */                                  \
+        ER2(LRSSS, REG(XG), REG(XS))
+
+#endif /* RT_SIMD_COMPAT_RSQ */
+
+        /* rse, rss, rsq are defined in rtconf.h
+         * under "COMMON SIMD INSTRUCTIONS" section */
+
+/* fma (G = G + S * T) if (#G != #S && #G != #T)
+ * NOTE: x87 fpu-fallbacks for fma/fms use round-to-nearest mode by default,
+ * enable RT_SIMD_COMPAT_FMR for current SIMD rounding mode to be honoured */
+
+#if RT_SIMD_COMPAT_FMA <= 1
+
+#define fmars_rr(XG, XS, XT)                                                \
+        ER3(LFMAS, REG(XG), REG(XS), REG(XT))
+
+#define fmars_ld(XG, XS, MT, DT)                                            \
+        VU32(TmmM, 0) = MW(MT, DT);                                         \
+        ER3(LFMAS, REG(XG), REG(XS), TmmM)
+
+#endif /* RT_SIMD_COMPAT_FMA */
+
+/* fms (G = G - S * T) if (#G != #S && #G != #T)
+ * NOTE: due to final negation being outside of rounding on all POWER systems
+ * only symmetric rounding modes (RN, RZ) are compatible across all targets */
+
+#if RT_SIMD_COMPAT_FMS <= 1
+
+#define fmsrs_rr(XG, XS, XT)                                                \
+        ER3(LFMSS, REG(XG), REG(XS), REG(XT))
+
+#define fmsrs_ld(XG, XS, MT, DT)                                            \
+        VU32(TmmM, 0) = MW(MT, DT);                                         \
+        ER3(LFMSS, REG(XG), REG(XS), TmmM)
+
+#endif /* RT_SIMD_COMPAT_FMS */
+
+/*************   scalar single-precision floating-point compare   *************/
+
+/* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #S) */
+
+#define minrs_rr(XG, XS)                                                    \
+        minrs3rr(W(XG), W(XG), W(XS))
+
+#define minrs_ld(XG, MS, DS)                                                \
+        minrs3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define minrs3rr(XD, XS, XT)                                                \
+        ER3(LMINS, REG(XD), REG(XS), REG(XT))
+
+#define minrs3ld(XD, XS, MT, DT)                                            \
+        VU32(TmmM, 0) = MW(MT, DT);                                         \
+        ER3(LMINS, REG(XD), REG(XS), TmmM)
+
+/* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #S) */
+
+#define maxrs_rr(XG, XS)                                                    \
+        maxrs3rr(W(XG), W(XG), W(XS))
+
+#define maxrs_ld(XG, MS, DS)                                                \
+        maxrs3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define maxrs3rr(XD, XS, XT)                                                \
+        ER3(LMAXS, REG(XD), REG(XS), REG(XT))
+
+#define maxrs3ld(XD, XS, MT, DT)                                            \
+        VU32(TmmM, 0) = MW(MT, DT);                                         \
+        ER3(LMAXS, REG(XD), REG(XS), TmmM)
+
+/* ceq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #S) */
+
+#define ceqrs_rr(XG, XS)                                                    \
+        ceqrs3rr(W(XG), W(XG), W(XS))
+
+#define ceqrs_ld(XG, MS, DS)                                                \
+        ceqrs3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define ceqrs3rr(XD, XS, XT)                                                \
+        ER3(LCEQS, REG(XD), REG(XS), REG(XT))
+
+#define ceqrs3ld(XD, XS, MT, DT)                                            \
+        VU32(TmmM, 0) = MW(MT, DT);                                         \
+        ER3(LCEQS, REG(XD), REG(XS), TmmM)
+
+/* cne (G = G != S ? -1 : 0), (D = S != T ? -1 : 0) if (#D != #S) */
+
+#define cners_rr(XG, XS)                                                    \
+        cners3rr(W(XG), W(XG), W(XS))
+
+#define cners_ld(XG, MS, DS)                                                \
+        cners3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define cners3rr(XD, XS, XT)                                                \
+        ER3(LCNES, REG(XD), REG(XS), REG(XT))
+
+#define cners3ld(XD, XS, MT, DT)                                            \
+        VU32(TmmM, 0) = MW(MT, DT);                                         \
+        ER3(LCNES, REG(XD), REG(XS), TmmM)
+
+/* clt (G = G < S ? -1 : 0), (D = S < T ? -1 : 0) if (#D != #S) */
+
+#define cltrs_rr(XG, XS)                                                    \
+        cltrs3rr(W(XG), W(XG), W(XS))
+
+#define cltrs_ld(XG, MS, DS)                                                \
+        cltrs3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define cltrs3rr(XD, XS, XT)                                                \
+        ER3(LCLTS, REG(XD), REG(XS), REG(XT))
+
+#define cltrs3ld(XD, XS, MT, DT)                                            \
+        VU32(TmmM, 0) = MW(MT, DT);                                         \
+        ER3(LCLTS, REG(XD), REG(XS), TmmM)
+
+/* cle (G = G <= S ? -1 : 0), (D = S <= T ? -1 : 0) if (#D != #S) */
+
+#define clers_rr(XG, XS)                                                    \
+        clers3rr(W(XG), W(XG), W(XS))
+
+#define clers_ld(XG, MS, DS)                                                \
+        clers3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define clers3rr(XD, XS, XT)                                                \
+        ER3(LCLES, REG(XD), REG(XS), REG(XT))
+
+#define clers3ld(XD, XS, MT, DT)                                            \
+        VU32(TmmM, 0) = MW(MT, DT);                                         \
+        ER3(LCLES, REG(XD), REG(XS), TmmM)
+
+/* cgt (G = G > S ? -1 : 0), (D = S > T ? -1 : 0) if (#D != #S) */
+
+#define cgtrs_rr(XG, XS)                                                    \
+        cgtrs3rr(W(XG), W(XG), W(XS))
+
+#define cgtrs_ld(XG, MS, DS)                                                \
+        cgtrs3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define cgtrs3rr(XD, XS, XT)                                                \
+        ER3(LCGTS, REG(XD), REG(XS), REG(XT))
+
+#define cgtrs3ld(XD, XS, MT, DT)                                            \
+        VU32(TmmM, 0) = MW(MT, DT);                                         \
+        ER3(LCGTS, REG(XD), REG(XS), TmmM)
+
+/* cge (G = G >= S ? -1 : 0), (D = S >= T ? -1 : 0) if (#D != #S) */
+
+#define cgers_rr(XG, XS)                                                    \
+        cgers3rr(W(XG), W(XG), W(XS))
+
+#define cgers_ld(XG, MS, DS)                                                \
+        cgers3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define cgers3rr(XD, XS, XT)                                                \
+        ER3(LCGES, REG(XD), REG(XS), REG(XT))
+
+#define cgers3ld(XD, XS, MT, DT)                                            \
+        VU32(TmmM, 0) = MW(MT, DT);                                         \
+        ER3(LCGES, REG(XD), REG(XS), TmmM)
+
+/******************************************************************************/
+/**********************************   MODE   **********************************/
+/******************************************************************************/
+
+/************************   helper macros (FPU mode)   ************************/
+
+/* simd mode
+ * set via FCTRL macros, *_F for faster non-IEEE mode (optional on MIPS/POWER),
+ * original FCTRL blocks (FCTRL_ENTER/FCTRL_LEAVE) are defined in rtbase.h
+ * NOTE: C reference target sets rounding modes via fesetround (fenv.h),
+ * while denormal results are not flushed to zero in *_F modes */
+
+#if RT_SIMD_FLUSH_ZERO == 0
+
+#define RT_SIMD_MODE_ROUNDN     0x00    /* round towards near */
+#define RT_SIMD_MODE_ROUNDM     0x02    /* round towards -inf */
+#define RT_SIMD_MODE_ROUNDP     0x01    /* round towards +inf */
+#define RT_SIMD_MODE_ROUNDZ     0x03    /* round towards zero */
+
+#else /* RT_SIMD_FLUSH_ZERO */
+
+#define RT_SIMD_MODE_ROUNDN     0x04    /* round towards near */
+#define RT_SIMD_MODE_ROUNDM     0x06    /* round towards -inf */
+#define RT_SIMD_MODE_ROUNDP     0x05    /* round towards +inf */
+#define RT_SIMD_MODE_ROUNDZ     0x07    /* round towards zero */
+
+#endif /* RT_SIMD_FLUSH_ZERO */
+
+#define RT_SIMD_MODE_ROUNDN_F   0x04    /* round towards near */
+#define RT_SIMD_MODE_ROUNDM_F   0x06    /* round towards -inf */
+#define RT_SIMD_MODE_ROUNDP_F   0x05    /* round towards +inf */
+#define RT_SIMD_MODE_ROUNDZ_F   0x07    /* round towards zero */
+
+#define FCTRL_SET(mode)   /* sets given mode into fp control register */    \
+        fesetround(FEM(RT_SIMD_MODE_##mode&3));
+
+#define FCTRL_RESET()     /* resumes default mode (ROUNDN) upon leave */    \
+        fesetround(FE_TONEAREST);
+
+/******************************************************************************/
+/********************************   INTERNAL   ********************************/
+/******************************************************************************/
+
+/* SIMD registers reside in rt_SIMD_REGS for the whole ASM block,
+ * thus no save/restore is required on ASM_ENTER/ASM_LEAVE */
+
+#define sregs_sa()
+#define sregs_la()
+
+#endif /* RT_128X1 */
+
+#endif /* RT_SIMD_CODE */
+
+#endif /* RT_RTARCH_C32_128X1V1_H */
+
+/******************************************************************************/
+/******************************************************************************/
+/******************************************************************************/
@@ -0,0 +1,1004 @@
+/******************************************************************************/
+/* Copyright (c) 2013-2019 VectorChief (at github, bitbucket, sourceforge)    */
+/* Distributed under the MIT software license, see the accompanying           */
+/* file COPYING or http://www.opensource.org/licenses/mit-license.php         */
+/******************************************************************************/
+
+#ifndef RT_RTARCH_C64_H
+#define RT_RTARCH_C64_H
+
+#define RT_BASE_REGS        16
+
+/******************************************************************************/
+/*********************************   LEGEND   *********************************/
+/******************************************************************************/
+
+/*
+ * rtarch_c64.h: Implementation of portable C reference 64-bit BASE ops.
+ *
+ * This file is a part of the unified SIMD assembler framework (rtarch.h)
+ * designed to be compatible with different processor architectures,
+ * while maintaining strictly defined common API.
+ *
+ * Recommended naming scheme for instructions:
+ *
+ * cmdxx_ri - applies [cmd] to [r]egister from [i]mmediate
+ * cmdxx_mi - applies [cmd] to [m]emory   from [i]mmediate
+ * cmdxx_rz - applies [cmd] to [r]egister from [z]ero-arg
+ * cmdxx_mz - applies [cmd] to [m]emory   from [z]ero-arg
+ *
+ * cmdxx_rm - applies [cmd] to [r]egister from [m]emory
+ * cmdxx_ld - applies [cmd] as above
+ * cmdxx_mr - applies [cmd] to [m]emory   from [r]egister
+ * cmdxx_st - applies [cmd] as above (arg list as cmdxx_ld)
+ *
+ * cmdxx_rr - applies [cmd] to [r]egister from [r]egister
+ * cmdxx_mm - applies [cmd] to [m]emory   from [m]emory
+ * cmdxx_rx - applies [cmd] to [r]egister (one-operand cmd)
+ * cmdxx_mx - applies [cmd] to [m]emory   (one-operand cmd)
+ *
+ * cmdxx_rx - applies [cmd] to [r]egister from x-register
+ * cmdxx_mx - applies [cmd] to [m]emory   from x-register
+ * cmdxx_xr - applies [cmd] to x-register from [r]egister
+ * cmdxx_xm - applies [cmd] to x-register from [m]emory
+ *
+ * cmdxx_rl - applies [cmd] to [r]egister from [l]abel
+ * cmdxx_xl - applies [cmd] to x-register from [l]abel
+ * cmdxx_lb - applies [cmd] as above
+ * label_ld - applies [adr] as above
+ *
+ * stack_st - applies [mov] to stack from register (push)
+ * stack_ld - applies [mov] to register from stack (pop)
+ * stack_sa - applies [mov] to stack from all registers
+ * stack_la - applies [mov] to all registers from stack
+ *
+ * cmdw*_** - applies [cmd] to 32-bit BASE register/memory/immediate args
+ * cmdx*_** - applies [cmd] to A-size BASE register/memory/immediate args
+ * cmdy*_** - applies [cmd] to L-size BASE register/memory/immediate args
+ * cmdz*_** - applies [cmd] to 64-bit BASE register/memory/immediate args
+ *
+ * cmd*x_** - applies [cmd] to unsigned integer args, [x] - default
+ * cmd*n_** - applies [cmd] to   signed integer args, [n] - negatable
+ * cmd*p_** - applies [cmd] to   signed integer args, [p] - part-range
+ *
+ * cmd*z_** - applies [cmd] while setting condition flags, [z] - zero flag.
+ * Regular cmd*x_**, cmd*n_** instructions may or may not set flags depending
+ * on the target architecture, thus no assumptions can be made for jezxx/jnzxx.
+ *
+ * Interpretation of instruction parameters:
+ *
+ * upper-case params have triplet structure and require W to pass-forward
+ * lower-case params are singular and can be used/passed as such directly
+ *
+ * RD - BASE register serving as destination only, if present
+ * RG - BASE register serving as destination and fisrt source
+ * RS - BASE register serving as second source (first if any)
+ * RT - BASE register serving as third source (second if any)
+ *
+ * MD - BASE addressing mode (Oeax, M***, I***) (memory-dest)
+ * MG - BASE addressing mode (Oeax, M***, I***) (memory-dsrc)
+ * MS - BASE addressing mode (Oeax, M***, I***) (memory-src2)
+ * MT - BASE addressing mode (Oeax, M***, I***) (memory-src3)
+ *
+ * DD - displacement value (DP, DF, DG, DH, DV) (memory-dest)
+ * DG - displacement value (DP, DF, DG, DH, DV) (memory-dsrc)
+ * DS - displacement value (DP, DF, DG, DH, DV) (memory-src2)
+ * DT - displacement value (DP, DF, DG, DH, DV) (memory-src3)
+ *
+ * IS - immediate value (is used as a second or first source)
+ * IT - immediate value (is used as a third or second source)
+ *
+ * Alphabetical view of current/future instruction namespaces is in rtzero.h.
+ * Configurable BASE/SIMD subsets (cmdx*, cmdy*, cmdp*) are defined in rtconf.h.
+ * Mixing of 64/32-bit fields in backend structures may lead to misalignment
+ * of 64-bit fields to 4-byte boundary, which is not supported on some targets.
+ * Place fields carefully to ensure natural alignment for all data types.
+ * Note that within cmdx*_** subset most of the instructions follow in-heap
+ * address size (RT_ADDRESS or A) and only label_ld/st, jmpxx_xr/xm follow
+ * pointer size (RT_POINTER or P) as code/data/stack segments are fixed.
+ * Stack ops always work with full registers regardless of the mode chosen.
+ *
+ * 32-bit and 64-bit BASE subsets are not easily compatible on all targets,
+ * thus any register modified with 32-bit op cannot be used in 64-bit subset.
+ * Alternatively, data flow must not exceed 31-bit range for 32-bit operations
+ * to produce consistent results usable in 64-bit subsets across all targets.
+ * Registers written with 64-bit op aren't always compatible with 32-bit either,
+ * as m64 requires the upper half to be all 0s or all 1s for m32 arithmetic.
+ * Only a64 and x64 have a complete 32-bit support in 64-bit mode both zeroing
+ * the upper half of the result, while m64 sign-extending all 32-bit operations
+ * and p64 overflowing 32-bit arithmetic into the upper half. Similar reasons
+ * of inconsistency prohibit use of IW immediate type within 64-bit subsets,
+ * where a64 and p64 zero-extend, while x64 and m64 sign-extend 32-bit value.
+ *
+ * Note that offset correction for endianness E is only applicable for addresses
+ * within pointer fields, when (in-heap) address and pointer sizes don't match.
+ * Working with 32-bit data in 64-bit fields in any other circumstances must be
+ * done consistently within a subset of one size (32-bit, 64-bit or C/C++).
+ * Alternatively, data written natively in C/C++ can be worked on from within
+ * a given (one) subset if appropriate offset correction is used from rtbase.h.
+ *
+ * Setting-flags instruction naming scheme may change again in the future for
+ * better orthogonality with operand size, type and args-list. It is therefore
+ * recommended to use combined-arithmetic-jump (arj) for better API stability
+ * and maximum efficiency across all supported targets. For similar reasons
+ * of higher performance on MIPS and POWER use combined-compare-jump (cmj).
+ * Not all canonical forms of BASE instructions have efficient implementation.
+ * For example, some forms of shifts and division use stack ops on x86 targets,
+ * while standalone remainder operations can only be done natively on MIPS.
+ * Consider using special fixed-register forms for maximum performance.
+ *
+ * Argument x-register (implied) is fixed by the implementation.
+ * Some formal definitions are not given below to encourage
+ * use of friendly aliases for better code readability.
+ */
+
+/******************************************************************************/
+/********************************   INTERNAL   ********************************/
+/******************************************************************************/
+
+/* 64x64-bit multiply into Redx:Reax (high:low), sn - signed (1) or not (0) */
+
+#define MHZ(sv, sn)                                                         \
+        {                                                                   \
+            rt_ui64 __Ma__ = __Reg__[Teax], __Mb__ = (sv);                  \
+            rt_ui64 __Al__ = (rt_ui32)__Ma__, __Ah__ = __Ma__ >> 32;        \
+            rt_ui64 __Bl__ = (rt_ui32)__Mb__, __Bh__ = __Mb__ >> 32;        \
+            rt_ui64 __Mm__ = __Ah__ * __Bl__ + (__Al__ * __Bl__ >> 32);     \
+            rt_ui64 __Mn__ = __Al__ * __Bh__ + (rt_ui32)__Mm__;             \
+            __Reg__[Tedx] = __Ah__ * __Bh__ + (__Mm__ >> 32);               \
+            __Reg__[Tedx] += __Mn__ >> 32;                                  \
+            __Reg__[Tedx] -= (sn) && (rt_si64)__Ma__ < 0 ? __Mb__ : 0;      \
+            __Reg__[Tedx] -= (sn) && (rt_si64)__Mb__ < 0 ? __Ma__ : 0;      \
+            __Reg__[Teax] = __Ma__ * __Mb__;                                \
+        }
+
+/******************************************************************************/
+/********************************   EXTERNAL   ********************************/
+/******************************************************************************/
+
+#include "rtarch_c32.h"
+
+/******************************************************************************/
+/**********************************   BASE   **********************************/
+/******************************************************************************/
+
+/* mov (D = S)
+ * set-flags: no */
+
+#define movzx_ri(RD, IS)                                                    \
+        __Reg__[REG(RD)] = (rt_ui64)VAL(IS);
+
+#define movzx_mi(MD, DD, IS)                                                \
+        MZ(MD, DD) = VAL(IS);
+
+#define movzx_rr(RD, RS)                                                    \
+        __Reg__[REG(RD)] = GZ(RS);
+
+#define movzx_ld(RD, MS, DS)                                                \
+        __Reg__[REG(RD)] = MZ(MS, DS);
+
+#define movzx_st(RS, MD, DD)                                                \
+        MZ(MD, DD) = GZ(RS);
+
+
+#define movzx_rj(RD, IT, IS)     /* IT - upper 32-bit, IS - lower 32-bit */ \
+        __Reg__[REG(RD)] = (rt_ui64)VAL(IT) << 32 | (rt_ui32)VAL(IS);
+
+#define movzx_mj(MD, DD, IT, IS) /* IT - upper 32-bit, IS - lower 32-bit */ \
+        MZ(MD, DD) = (rt_ui64)VAL(IT) << 32 | (rt_ui32)VAL(IS);
+
+/* and (G = G & S)
+ * set-flags: undefined (*x), yes (*z) */
+
+#define andzx_ri(RG, IS)                                                    \
+        __Reg__[REG(RG)] = GZ(RG) & VAL(IS);
+
+#define andzx_mi(MG, DG, IS)                                                \
+        MZ(MG, DG) &= VAL(IS);
+
+#define andzx_rr(RG, RS)                                                    \
+        __Reg__[REG(RG)] = GZ(RG) & GZ(RS);
+
+#define andzx_ld(RG, MS, DS)                                                \
+        __Reg__[REG(RG)] = GZ(RG) & MZ(MS, DS);
+
+#define andzx_st(RS, MG, DG)                                                \
+        MZ(MG, DG) &= GZ(RS);
+
+#define andzx_mr(MG, DG, RS)                                                \
+        andzx_st(W(RS), W(MG), W(DG))
+
+
+#define andzz_ri(RG, IS)                                                    \
+        andzx_ri(W(RG), W(IS))                                              \
+        CMZ(GZ(RG), 0)
+
+#define andzz_mi(MG, DG, IS)                                                \
+        andzx_mi(W(MG), W(DG), W(IS))                                       \
+        CMZ(MZ(MG, DG), 0)
+
+#define andzz_rr(RG, RS)                                                    \
+        andzx_rr(W(RG), W(RS))                                              \
+        CMZ(GZ(RG), 0)
+
+#define andzz_ld(RG, MS, DS)                                                \
+        andzx_ld(W(RG), W(MS), W(DS))                                       \
+        CMZ(GZ(RG), 0)
+
+#define andzz_st(RS, MG, DG)                                                \
+        andzx_st(W(RS), W(MG), W(DG))                                       \
+        CMZ(MZ(MG, DG), 0)
+
+#define andzz_mr(MG, DG, RS)                                                \
+        andzz_st(W(RS), W(MG), W(DG))
+
+/* ann (G = ~G & S)
+ * set-flags: undefined (*x), yes (*z) */
+
+#define annzx_ri(RG, IS)                                                    \
+        __Reg__[REG(RG)] = ~GZ(RG) & VAL(IS);
+
+#define annzx_mi(MG, DG, IS)                                                \
+        MZ(MG, DG) = ~MZ(MG, DG) & VAL(IS);
+
+#define annzx_rr(RG, RS)                                                    \
+        __Reg__[REG(RG)] = ~GZ(RG) & GZ(RS);
+
+#define annzx_ld(RG, MS, DS)                                                \
+        __Reg__[REG(RG)] = ~GZ(RG) & MZ(MS, DS);
+
+#define annzx_st(RS, MG, DG)                                                \
+        MZ(MG, DG) = ~MZ(MG, DG) & GZ(RS);
+
+#define annzx_mr(MG, DG, RS)                                                \
+        annzx_st(W(RS), W(MG), W(DG))
+
+
+#define annzz_ri(RG, IS)                                                    \
+        annzx_ri(W(RG), W(IS))                                              \
+        CMZ(GZ(RG), 0)
+
+#define annzz_mi(MG, DG, IS)                                                \
+        annzx_mi(W(MG), W(DG), W(IS))                                       \
+        CMZ(MZ(MG, DG), 0)
+
+#define annzz_rr(RG, RS)                                                    \
+        annzx_rr(W(RG), W(RS))                                              \
+        CMZ(GZ(RG), 0)
+
+#define annzz_ld(RG, MS, DS)                                                \
+        annzx_ld(W(RG), W(MS), W(DS))                                       \
+        CMZ(GZ(RG), 0)
+
+#define annzz_st(RS, MG, DG)                                                \
+        annzx_st(W(RS), W(MG), W(DG))                                       \
+        CMZ(MZ(MG, DG), 0)
+
+#define annzz_mr(MG, DG, RS)                                                \
+        annzz_st(W(RS), W(MG), W(DG))
+
+/* orr (G = G | S)
+ * set-flags: undefined (*x), yes (*z) */
+
+#define orrzx_ri(RG, IS)                                                    \
+        __Reg__[REG(RG)] = GZ(RG) | VAL(IS);
+
+#define orrzx_mi(MG, DG, IS)                                                \
+        MZ(MG, DG) |= VAL(IS);
+
+#define orrzx_rr(RG, RS)                                                    \
+        __Reg__[REG(RG)] = GZ(RG) | GZ(RS);
+
+#define orrzx_ld(RG, MS, DS)                                                \
+        __Reg__[REG(RG)] = GZ(RG) | MZ(MS, DS);
+
+#define orrzx_st(RS, MG, DG)                                                \
+        MZ(MG, DG) |= GZ(RS);
+
+#define orrzx_mr(MG, DG, RS)                                                \
+        orrzx_st(W(RS), W(MG), W(DG))
+
+
+#define orrzz_ri(RG, IS)                                                    \
+        orrzx_ri(W(RG), W(IS))                                              \
+        CMZ(GZ(RG), 0)
+
+#define orrzz_mi(MG, DG, IS)                                                \
+        orrzx_mi(W(MG), W(DG), W(IS))                                       \
+        CMZ(MZ(MG, DG), 0)
+
+#define orrzz_rr(RG, RS)                                                    \
+        orrzx_rr(W(RG), W(RS))                                              \
+        CMZ(GZ(RG), 0)
+
+#define orrzz_ld(RG, MS, DS)                                                \
+        orrzx_ld(W(RG), W(MS), W(DS))                                       \
+        CMZ(GZ(RG), 0)
+
+#define orrzz_st(RS, MG, DG)                                                \
+        orrzx_st(W(RS), W(MG), W(DG))                                       \
+        CMZ(MZ(MG, DG), 0)
+
+#define orrzz_mr(MG, DG, RS)                                                \
+        orrzz_st(W(RS), W(MG), W(DG))
+
+/* orn (G = ~G | S)
+ * set-flags: undefined (*x), yes (*z) */
+
+#define ornzx_ri(RG, IS)                                                    \
+        __Reg__[REG(RG)] = ~GZ(RG) | VAL(IS);
+
+#define ornzx_mi(MG, DG, IS)                                                \
+        MZ(MG, DG) = ~MZ(MG, DG) | VAL(IS);
+
+#define ornzx_rr(RG, RS)                                                    \
+        __Reg__[REG(RG)] = ~GZ(RG) | GZ(RS);
+
+#define ornzx_ld(RG, MS, DS)                                                \
+        __Reg__[REG(RG)] = ~GZ(RG) | MZ(MS, DS);
+
+#define ornzx_st(RS, MG, DG)                                                \
+        MZ(MG, DG) = ~MZ(MG, DG) | GZ(RS);
+
+#define ornzx_mr(MG, DG, RS)                                                \
+        ornzx_st(W(RS), W(MG), W(DG))
+
+
+#define ornzz_ri(RG, IS)                                                    \
+        ornzx_ri(W(RG), W(IS))                                              \
+        CMZ(GZ(RG), 0)
+
+#define ornzz_mi(MG, DG, IS)                                                \
+        ornzx_mi(W(MG), W(DG), W(IS))                                       \
+        CMZ(MZ(MG, DG), 0)
+
+#define ornzz_rr(RG, RS)                                                    \
+        ornzx_rr(W(RG), W(RS))                                              \
+        CMZ(GZ(RG), 0)
+
+#define ornzz_ld(RG, MS, DS)                                                \
+        ornzx_ld(W(RG), W(MS), W(DS))                                       \
+        CMZ(GZ(RG), 0)
+
+#define ornzz_st(RS, MG, DG)                                                \
+        ornzx_st(W(RS), W(MG), W(DG))                                       \
+        CMZ(MZ(MG, DG), 0)
+
+#define ornzz_mr(MG, DG, RS)                                                \
+        ornzz_st(W(RS), W(MG), W(DG))
+
+/* xor (G = G ^ S)
+ * set-flags: undefined (*x), yes (*z) */
+
+#define xorzx_ri(RG, IS)                                                    \
+        __Reg__[REG(RG)] = GZ(RG) ^ VAL(IS);
+
+#define xorzx_mi(MG, DG, IS)                                                \
+        MZ(MG, DG) ^= VAL(IS);
+
+#define xorzx_rr(RG, RS)                                                    \
+        __Reg__[REG(RG)] = GZ(RG) ^ GZ(RS);
+
+#define xorzx_ld(RG, MS, DS)                                                \
+        __Reg__[REG(RG)] = GZ(RG) ^ MZ(MS, DS);
+
+#define xorzx_st(RS, MG, DG)                                                \
+        MZ(MG, DG) ^= GZ(RS);
+
+#define xorzx_mr(MG, DG, RS)                                                \
+        xorzx_st(W(RS), W(MG), W(DG))
+
+
+#define xorzz_ri(RG, IS)                                                    \
+        xorzx_ri(W(RG), W(IS))                                              \
+        CMZ(GZ(RG), 0)
+
+#define xorzz_mi(MG, DG, IS)                                                \
+        xorzx_mi(W(MG), W(DG), W(IS))                                       \
+        CMZ(MZ(MG, DG), 0)
+
+#define xorzz_rr(RG, RS)                                                    \
+        xorzx_rr(W(RG), W(RS))                                              \
+        CMZ(GZ(RG), 0)
+
+#define xorzz_ld(RG, MS, DS)                                                \
+        xorzx_ld(W(RG), W(MS), W(DS))                                       \
+        CMZ(GZ(RG), 0)
+
+#define xorzz_st(RS, MG, DG)                                                \
+        xorzx_st(W(RS), W(MG), W(DG))                                       \
+        CMZ(MZ(MG, DG), 0)
+
+#define xorzz_mr(MG, DG, RS)                                                \
+        xorzz_st(W(RS), W(MG), W(DG))
+
+/* not (G = ~G)
+ * set-flags: no */
+
+#define notzx_rx(RG)                                                        \
+        __Reg__[REG(RG)] = ~GZ(RG);
+
+#define notzx_mx(MG, DG)                                                    \
+        MZ(MG, DG) = ~MZ(MG, DG);
+
+/* neg (G = -G)
+ * set-flags: undefined (*x), yes (*z) */
+
+#define negzx_rx(RG)                                                        \
+        __Reg__[REG(RG)] = -GZ(RG);
+
+#define negzx_mx(MG, DG)                                                    \
+        MZ(MG, DG) = -MZ(MG, DG);
+
+
+#define negzz_rx(RG)                                                        \
+        negzx_rx(W(RG))                                                     \
+        CMZ(GZ(RG), 0)
+
+#define negzz_mx(MG, DG)                                                    \
+        negzx_mx(W(MG), W(DG))                                              \
+        CMZ(MZ(MG, DG), 0)
+
+/* add (G = G + S)
+ * set-flags: undefined (*x), yes (*z) */
+
+#define addzx_ri(RG, IS)                                                    \
+        __Reg__[REG(RG)] = GZ(RG) + VAL(IS);
+
+#define addzx_mi(MG, DG, IS)                                                \
+        MZ(MG, DG) += VAL(IS);
+
+#define addzx_rr(RG, RS)                                                    \
+        __Reg__[REG(RG)] = GZ(RG) + GZ(RS);
+
+#define addzx_ld(RG, MS, DS)                                                \
+        __Reg__[REG(RG)] = GZ(RG) + MZ(MS, DS);
+
+#define addzx_st(RS, MG, DG)                                                \
+        MZ(MG, DG) += GZ(RS);
+
+#define addzx_mr(MG, DG, RS)                                                \
+        addzx_st(W(RS), W(MG), W(DG))
+
+
+#define addzz_ri(RG, IS)                                                    \
+        addzx_ri(W(RG), W(IS))                                              \
+        CMZ(GZ(RG), 0)
+
+#define addzz_mi(MG, DG, IS)                                                \
+        addzx_mi(W(MG), W(DG), W(IS))                                       \
+        CMZ(MZ(MG, DG), 0)
+
+#define addzz_rr(RG, RS)                                                    \
+        addzx_rr(W(RG), W(RS))                                              \
+        CMZ(GZ(RG), 0)
+
+#define addzz_ld(RG, MS, DS)                                                \
+        addzx_ld(W(RG), W(MS), W(DS))                                       \
+        CMZ(GZ(RG), 0)
+
+#define addzz_st(RS, MG, DG)                                                \
+        addzx_st(W(RS), W(MG), W(DG))                                       \
+        CMZ(MZ(MG, DG), 0)
+
+#define addzz_mr(MG, DG, RS)                                                \
+        addzz_st(W(RS), W(MG), W(DG))
+
+/* sub (G = G - S)
+ * set-flags: undefined (*x), yes (*z) */
+
+#define subzx_ri(RG, IS)                                                    \
+        __Reg__[REG(RG)] = GZ(RG) - VAL(IS);
+
+#define subzx_mi(MG, DG, IS)                                                \
+        MZ(MG, DG) -= VAL(IS);
+
+#define subzx_rr(RG, RS)                                                    \
+        __Reg__[REG(RG)] = GZ(RG) - GZ(RS);
+
+#define subzx_ld(RG, MS, DS)                                                \
+        __Reg__[REG(RG)] = GZ(RG) - MZ(MS, DS);
+
+#define subzx_st(RS, MG, DG)                                                \
+        MZ(MG, DG) -= GZ(RS);
+
+#define subzx_mr(MG, DG, RS)                                                \
+        subzx_st(W(RS), W(MG), W(DG))
+
+
+#define subzz_ri(RG, IS)                                                    \
+        subzx_ri(W(RG), W(IS))                                              \
+        CMZ(GZ(RG), 0)
+
+#define subzz_mi(MG, DG, IS)                                                \
+        subzx_mi(W(MG), W(DG), W(IS))                                       \
+        CMZ(MZ(MG, DG), 0)
+
+#define subzz_rr(RG, RS)                                                    \
+        subzx_rr(W(RG), W(RS))                                              \
+        CMZ(GZ(RG), 0)
+
+#define subzz_ld(RG, MS, DS)                                                \
+        subzx_ld(W(RG), W(MS), W(DS))                                       \
+        CMZ(GZ(RG), 0)
+
+#define subzz_st(RS, MG, DG)                                                \
+        subzx_st(W(RS), W(MG), W(DG))                                       \
+        CMZ(MZ(MG, DG), 0)
+
+#define subzz_mr(MG, DG, RS)                                                \
+        subzz_st(W(RS), W(MG), W(DG))
+
+/* shl (G = G << S)
+ * set-flags: undefined (*x), yes (*z) */
+
+#define shlzx_rx(RG)                     /* reads Recx for shift count */   \
+        __Reg__[REG(RG)] = GZ(RG) << (__Reg__[Tecx] & 0x3F);
+
+#define shlzx_mx(MG, DG)                 /* reads Recx for shift count */   \
+        MZ(MG, DG) <<= __Reg__[Tecx] & 0x3F;
+
+#define shlzx_ri(RG, IS)                                                    \
+        __Reg__[REG(RG)] = GZ(RG) << (VAL(IS) & 0x3F);
+
+#define shlzx_mi(MG, DG, IS)                                                \
+        MZ(MG, DG) <<= VAL(IS) & 0x3F;
+
+#define shlzx_rr(RG, RS)       /* Recx cannot be used as first operand */   \
+        __Reg__[REG(RG)] = GZ(RG) << (GZ(RS) & 0x3F);
+
+#define shlzx_ld(RG, MS, DS)   /* Recx cannot be used as first operand */   \
+        __Reg__[REG(RG)] = GZ(RG) << (MZ(MS, DS) & 0x3F);
+
+#define shlzx_st(RS, MG, DG)                                                \
+        MZ(MG, DG) <<= GZ(RS) & 0x3F;
+
+#define shlzx_mr(MG, DG, RS)                                                \
+        shlzx_st(W(RS), W(MG), W(DG))
+
+
+#define shlzz_rx(RG)                     /* reads Recx for shift count */   \
+        shlzx_rx(W(RG))                                                     \
+        CMZ(GZ(RG), 0)
+
+#define shlzz_mx(MG, DG)                 /* reads Recx for shift count */   \
+        shlzx_mx(W(MG), W(DG))                                              \
+        CMZ(MZ(MG, DG), 0)
+
+#define shlzz_ri(RG, IS)                                                    \
+        shlzx_ri(W(RG), W(IS))                                              \
+        CMZ(GZ(RG), 0)
+
+#define shlzz_mi(MG, DG, IS)                                                \
+        shlzx_mi(W(MG), W(DG), W(IS))                                       \
+        CMZ(MZ(MG, DG), 0)
+
+#define shlzz_rr(RG, RS)       /* Recx cannot be used as first operand */   \
+        shlzx_rr(W(RG), W(RS))                                              \
+        CMZ(GZ(RG), 0)
+
+#define shlzz_ld(RG, MS, DS)   /* Recx cannot be used as first operand */   \
+        shlzx_ld(W(RG), W(MS), W(DS))                                       \
+        CMZ(GZ(RG), 0)
+
+#define shlzz_st(RS, MG, DG)                                                \
+        shlzx_st(W(RS), W(MG), W(DG))                                       \
+        CMZ(MZ(MG, DG), 0)
+
+#define shlzz_mr(MG, DG, RS)                                                \
+        shlzz_st(W(RS), W(MG), W(DG))
+
+/* shr (G = G >> S)
+ * set-flags: undefined (*x), yes (*z) */
+
+#define shrzx_rx(RG)                     /* reads Recx for shift count */   \
+        __Reg__[REG(RG)] = GZ(RG) >> (__Reg__[Tecx] & 0x3F);
+
+#define shrzx_mx(MG, DG)                 /* reads Recx for shift count */   \
+        MZ(MG, DG) >>= __Reg__[Tecx] & 0x3F;
+
+#define shrzx_ri(RG, IS)                                                    \
+        __Reg__[REG(RG)] = GZ(RG) >> (VAL(IS) & 0x3F);
+
+#define shrzx_mi(MG, DG, IS)                                                \
+        MZ(MG, DG) >>= VAL(IS) & 0x3F;
+
+#define shrzx_rr(RG, RS)       /* Recx cannot be used as first operand */   \
+        __Reg__[REG(RG)] = GZ(RG) >> (GZ(RS) & 0x3F);
+
+#define shrzx_ld(RG, MS, DS)   /* Recx cannot be used as first operand */   \
+        __Reg__[REG(RG)] = GZ(RG) >> (MZ(MS, DS) & 0x3F);
+
+#define shrzx_st(RS, MG, DG)                                                \
+        MZ(MG, DG) >>= GZ(RS) & 0x3F;
+
+#define shrzx_mr(MG, DG, RS)                                                \
+        shrzx_st(W(RS), W(MG), W(DG))
+
+
+#define shrzz_rx(RG)                     /* reads Recx for shift count */   \
+        shrzx_rx(W(RG))                                                     \
+        CMZ(GZ(RG), 0)
+
+#define shrzz_mx(MG, DG)                 /* reads Recx for shift count */   \
+        shrzx_mx(W(MG), W(DG))                                              \
+        CMZ(MZ(MG, DG), 0)
+
+#define shrzz_ri(RG, IS)                                                    \
+        shrzx_ri(W(RG), W(IS))                                              \
+        CMZ(GZ(RG), 0)
+
+#define shrzz_mi(MG, DG, IS)                                                \
+        shrzx_mi(W(MG), W(DG), W(IS))                                       \
+        CMZ(MZ(MG, DG), 0)
+
+#define shrzz_rr(RG, RS)       /* Recx cannot be used as first operand */   \
+        shrzx_rr(W(RG), W(RS))                                              \
+        CMZ(GZ(RG), 0)
+
+#define shrzz_ld(RG, MS, DS)   /* Recx cannot be used as first operand */   \
+        shrzx_ld(W(RG), W(MS), W(DS))                                       \
+        CMZ(GZ(RG), 0)
+
+#define shrzz_st(RS, MG, DG)                                                \
+        shrzx_st(W(RS), W(MG), W(DG))                                       \
+        CMZ(MZ(MG, DG), 0)
+
+#define shrzz_mr(MG, DG, RS)                                                \
+        shrzz_st(W(RS), W(MG), W(DG))
+
+
+#define shrzn_rx(RG)                     /* reads Recx for shift count */   \
+        __Reg__[REG(RG)] = (rt_ui64)(GM(RG) >> (__Reg__[Tecx] & 0x3F));
+
+#define shrzn_mx(MG, DG)                 /* reads Recx for shift count */   \
+        MM(MG, DG) >>= __Reg__[Tecx] & 0x3F;
+
+#define shrzn_ri(RG, IS)                                                    \
+        __Reg__[REG(RG)] = (rt_ui64)(GM(RG) >> (VAL(IS) & 0x3F));
+
+#define shrzn_mi(MG, DG, IS)                                                \
+        MM(MG, DG) >>= VAL(IS) & 0x3F;
+
+#define shrzn_rr(RG, RS)       /* Recx cannot be used as first operand */   \
+        __Reg__[REG(RG)] = (rt_ui64)(GM(RG) >> (GZ(RS) & 0x3F));
+
+#define shrzn_ld(RG, MS, DS)   /* Recx cannot be used as first operand */   \
+        __Reg__[REG(RG)] = (rt_ui64)(GM(RG) >> (MZ(MS, DS) & 0x3F));
+
+#define shrzn_st(RS, MG, DG)                                                \
+        MM(MG, DG) >>= GZ(RS) & 0x3F;
+
+#define shrzn_mr(MG, DG, RS)                                                \
+        shrzn_st(W(RS), W(MG), W(DG))
+
+/* ror (G = G >> S | G << 64 - S)
+ * set-flags: undefined (*x), yes (*z) */
+
+#define rorzx_rx(RG)                     /* reads Recx for shift count */   \
+        __Reg__[REG(RG)] = RRZ(GZ(RG), __Reg__[Tecx]);
+
+#define rorzx_mx(MG, DG)                 /* reads Recx for shift count */   \
+        MZ(MG, DG) = RRZ(MZ(MG, DG), __Reg__[Tecx]);
+
+#define rorzx_ri(RG, IS)                                                    \
+        __Reg__[REG(RG)] = RRZ(GZ(RG), VAL(IS));
+
+#define rorzx_mi(MG, DG, IS)                                                \
+        MZ(MG, DG) = RRZ(MZ(MG, DG), VAL(IS));
+
+#define rorzx_rr(RG, RS)       /* Recx cannot be used as first operand */   \
+        __Reg__[REG(RG)] = RRZ(GZ(RG), GZ(RS));
+
+#define rorzx_ld(RG, MS, DS)   /* Recx cannot be used as first operand */   \
+        __Reg__[REG(RG)] = RRZ(GZ(RG), MZ(MS, DS));
+
+#define rorzx_st(RS, MG, DG)                                                \
+        MZ(MG, DG) = RRZ(MZ(MG, DG), GZ(RS));
+
+#define rorzx_mr(MG, DG, RS)                                                \
+        rorzx_st(W(RS), W(MG), W(DG))
+
+
+#define rorzz_rx(RG)                     /* reads Recx for shift count */   \
+        rorzx_rx(W(RG))                                                     \
+        CMZ(GZ(RG), 0)
+
+#define rorzz_mx(MG, DG)                 /* reads Recx for shift count */   \
+        rorzx_mx(W(MG), W(DG))                                              \
+        CMZ(MZ(MG, DG), 0)
+
+#define rorzz_ri(RG, IS)                                                    \
+        rorzx_ri(W(RG), W(IS))                                              \
+        CMZ(GZ(RG), 0)
+
+#define rorzz_mi(MG, DG, IS)                                                \
+        rorzx_mi(W(MG), W(DG), W(IS))                                       \
+        CMZ(MZ(MG, DG), 0)
+
+#define rorzz_rr(RG, RS)       /* Recx cannot be used as first operand */   \
+        rorzx_rr(W(RG), W(RS))                                              \
+        CMZ(GZ(RG), 0)
+
+#define rorzz_ld(RG, MS, DS)   /* Recx cannot be used as first operand */   \
+        rorzx_ld(W(RG), W(MS), W(DS))                                       \
+        CMZ(GZ(RG), 0)
+
+#define rorzz_st(RS, MG, DG)                                                \
+        rorzx_st(W(RS), W(MG), W(DG))                                       \
+        CMZ(MZ(MG, DG), 0)
+
+#define rorzz_mr(MG, DG, RS)                                                \
+        rorzz_st(W(RS), W(MG), W(DG))
+
+/* mul (G = G * S)
+ * set-flags: undefined */
+
+#define mulzx_ri(RG, IS)                                                    \
+        __Reg__[REG(RG)] = GZ(RG) * VAL(IS);
+
+#define mulzx_rr(RG, RS)                                                    \
+        __Reg__[REG(RG)] = GZ(RG) * GZ(RS);
+
+#define mulzx_ld(RG, MS, DS)                                                \
+        __Reg__[REG(RG)] = GZ(RG) * MZ(MS, DS);
+
+
+#define mulzx_xr(RS)     /* Reax is in/out, Redx is out(high)-zero-ext */   \
+        MHZ(GZ(RS), 0)
+
+#define mulzx_xm(MS, DS) /* Reax is in/out, Redx is out(high)-zero-ext */   \
+        MHZ(MZ(MS, DS), 0)
+
+
+#define mulzn_xr(RS)     /* Reax is in/out, Redx is out(high)-sign-ext */   \
+        MHZ(GZ(RS), 1)
+
+#define mulzn_xm(MS, DS) /* Reax is in/out, Redx is out(high)-sign-ext */   \
+        MHZ(MZ(MS, DS), 1)
+
+
+#define mulzp_xr(RS)     /* Reax is in/out, prepares Redx for divzn_x* */   \
+        mulzx_rr(Reax, W(RS)) /* product must not exceed operands size */
+
+#define mulzp_xm(MS, DS) /* Reax is in/out, prepares Redx for divzn_x* */   \
+        mulzx_ld(Reax, W(MS), W(DS))  /* must not exceed operands size */
+
+/* div (G = G / S)
+ * set-flags: undefined */
+
+#define divzx_ri(RG, IS)       /* Reax cannot be used as first operand */   \
+        __Reg__[REG(RG)] = GZ(RG) / VAL(IS);
+
+#define divzx_rr(RG, RS)                /* RG no Reax, RS no Reax/Redx */   \
+        __Reg__[REG(RG)] = GZ(RG) / GZ(RS);
+
+#define divzx_ld(RG, MS, DS)            /* RG no Reax, MS no Oeax/Medx */   \
+        __Reg__[REG(RG)] = GZ(RG) / MZ(MS, DS);
+
+
+#define divzn_ri(RG, IS)       /* Reax cannot be used as first operand */   \
+        __Reg__[REG(RG)] = (rt_ui64)(GM(RG) / VAL(IS));
+
+#define divzn_rr(RG, RS)                /* RG no Reax, RS no Reax/Redx */   \
+        __Reg__[REG(RG)] = (rt_ui64)(GM(RG) / GM(RS));
+
+#define divzn_ld(RG, MS, DS)            /* RG no Reax, MS no Oeax/Medx */   \
+        __Reg__[REG(RG)] = (rt_ui64)(GM(RG) / MM(MS, DS));
+
+
+#define prezx_xx()          /* to be placed immediately prior divzx_x* */   \
+                                     /* to prepare Redx for int-divide */
+
+#define prezn_xx()          /* to be placed immediately prior divzn_x* */   \
+                                     /* to prepare Redx for int-divide */
+
+
+#define divzx_xr(RS)     /* Reax is in/out, Redx is in(zero)/out(junk) */   \
+        __Reg__[Teax] = __Reg__[Teax] / GZ(RS);
+
+#define divzx_xm(MS, DS) /* Reax is in/out, Redx is in(zero)/out(junk) */   \
+        __Reg__[TMxx] = MZ(MS, DS);                                         \
+        __Reg__[Teax] = __Reg__[Teax] / (rt_ui64)__Reg__[TMxx];
+
+
+#define divzn_xr(RS)     /* Reax is in/out, Redx is in-sign-ext-(Reax) */   \
+        __Reg__[Teax] = (rt_ui64)((rt_si64)__Reg__[Teax] / GM(RS));
+
+#define divzn_xm(MS, DS) /* Reax is in/out, Redx is in-sign-ext-(Reax) */   \
+        __Reg__[TMxx] = MZ(MS, DS);                                         \
+        __Reg__[Teax] = (rt_ui64)((rt_si64)__Reg__[Teax] /                  \
+                                  (rt_si64)__Reg__[TMxx]);
+
+
+#define divzp_xr(RS)     /* Reax is in/out, Redx is in-sign-ext-(Reax) */   \
+        divzn_xr(W(RS))
+
+#define divzp_xm(MS, DS) /* Reax is in/out, Redx is in-sign-ext-(Reax) */   \
+        divzn_xm(W(MS), W(DS))
+
+/* rem (G = G % S)
+ * set-flags: undefined */
+
+#define remzx_ri(RG, IS)       /* Redx cannot be used as first operand */   \
+        __Reg__[REG(RG)] = GZ(RG) % VAL(IS);
+
+#define remzx_rr(RG, RS)                /* RG no Redx, RS no Reax/Redx */   \
+        __Reg__[REG(RG)] = GZ(RG) % GZ(RS);
+
+#define remzx_ld(RG, MS, DS)            /* RG no Redx, MS no Oeax/Medx */   \
+        __Reg__[REG(RG)] = GZ(RG) % MZ(MS, DS);
+
+
+#define remzn_ri(RG, IS)       /* Redx cannot be used as first operand */   \
+        __Reg__[REG(RG)] = (rt_ui64)(GM(RG) % VAL(IS));
+
+#define remzn_rr(RG, RS)                /* RG no Redx, RS no Reax/Redx */   \
+        __Reg__[REG(RG)] = (rt_ui64)(GM(RG) % GM(RS));
+
+#define remzn_ld(RG, MS, DS)            /* RG no Redx, MS no Oeax/Medx */   \
+        __Reg__[REG(RG)] = (rt_ui64)(GM(RG) % MM(MS, DS));
+
+
+#define remzx_xx()          /* to be placed immediately prior divzx_x* */   \
+        movzx_rr(Redx, Reax)         /* to prepare for rem calculation */
+
+#define remzx_xr(RS)        /* to be placed immediately after divzx_xr */   \
+        __Reg__[Tedx] -= __Reg__[Teax] * GZ(RS);                            \
+                                                          /* Redx<-rem */
+
+#define remzx_xm(MS, DS)    /* to be placed immediately after divzx_xm */   \
+        __Reg__[Tedx] -= __Reg__[Teax] * __Reg__[TMxx];                     \
+                                                          /* Redx<-rem */
+
+
+#define remzn_xx()          /* to be placed immediately prior divzn_x* */   \
+        movzx_rr(Redx, Reax)         /* to prepare for rem calculation */
+
+#define remzn_xr(RS)        /* to be placed immediately after divzn_xr */   \
+        __Reg__[Tedx] -= __Reg__[Teax] * GZ(RS);                            \
+                                                          /* Redx<-rem */
+
+#define remzn_xm(MS, DS)    /* to be placed immediately after divzn_xm */   \
+        __Reg__[Tedx] -= __Reg__[Teax] * __Reg__[TMxx];                     \
+                                                          /* Redx<-rem */
+
+/* arj (G = G op S, if cc G then jump lb)
+ * set-flags: undefined
+ * refer to individual instruction descriptions
+ * to stay within special register limitations */
+
+     /* Definitions for arj's "op" and "cc" parameters
+      * are provided in 32-bit rtarch_***.h files. */
+
+#define arjzx_rx(RG, op, cc, lb)                                            \
+        AR1(W(RG), op, zz_rx)                                               \
+        CMJ(cc, lb)
+
+#define arjzx_mx(MG, DG, op, cc, lb)                                        \
+        AR2(W(MG), W(DG), op, zz_mx)                                        \
+        CMJ(cc, lb)
+
+#define arjzx_ri(RG, IS, op, cc, lb)                                        \
+        AR2(W(RG), W(IS), op, zz_ri)                                        \
+        CMJ(cc, lb)
+
+#define arjzx_mi(MG, DG, IS, op, cc, lb)                                    \
+        AR3(W(MG), W(DG), W(IS), op, zz_mi)                                 \
+        CMJ(cc, lb)
+
+#define arjzx_rr(RG, RS, op, cc, lb)                                        \
+        AR2(W(RG), W(RS), op, zz_rr)                                        \
+        CMJ(cc, lb)
+
+#define arjzx_ld(RG, MS, DS, op, cc, lb)                                    \
+        AR3(W(RG), W(MS), W(DS), op, zz_ld)                                 \
+        CMJ(cc, lb)
+
+#define arjzx_st(RS, MG, DG, op, cc, lb)                                    \
+        AR3(W(RS), W(MG), W(DG), op, zz_st)                                 \
+        CMJ(cc, lb)
+
+#define arjzx_mr(MG, DG, RS, op, cc, lb)                                    \
+        arjzx_st(W(RS), W(MG), W(DG), op, cc, lb)
+
+/* cmj (flags = S ? T, if cc flags then jump lb)
+ * set-flags: undefined */
+
+     /* Definitions for cmj's "cc" parameter
+      * are provided in 32-bit rtarch_***.h files. */
+
+#define cmjzx_rz(RS, cc, lb)                                                \
+        cmjzx_ri(W(RS), IC(0), cc, lb)
+
+#define cmjzx_mz(MS, DS, cc, lb)                                            \
+        cmjzx_mi(W(MS), W(DS), IC(0), cc, lb)
+
+#define cmjzx_ri(RS, IT, cc, lb)                                            \
+        cmpzx_ri(W(RS), W(IT))                                              \
+        CMJ(cc, lb)
+
+#define cmjzx_mi(MS, DS, IT, cc, lb)                                        \
+        cmpzx_mi(W(MS), W(DS), W(IT))                                       \
+        CMJ(cc, lb)
+
+#define cmjzx_rr(RS, RT, cc, lb)                                            \
+        cmpzx_rr(W(RS), W(RT))                                              \
+        CMJ(cc, lb)
+
+#define cmjzx_rm(RS, MT, DT, cc, lb)                                        \
+        cmpzx_rm(W(RS), W(MT), W(DT))                                       \
+        CMJ(cc, lb)
+
+#define cmjzx_mr(MS, DS, RT, cc, lb)                                        \
+        cmpzx_mr(W(MS), W(DS), W(RT))                                       \
+        CMJ(cc, lb)
+
+/* cmp (flags = S ? T)
+ * set-flags: yes */
+
+#define cmpzx_ri(RS, IT)                                                    \
+        CMZ(GZ(RS), VAL(IT))
+
+#define cmpzx_mi(MS, DS, IT)                                                \
+        CMZ(MZ(MS, DS), VAL(IT))
+
+#define cmpzx_rr(RS, RT)                                                    \
+        CMZ(GZ(RS), GZ(RT))
+
+#define cmpzx_rm(RS, MT, DT)                                                \
+        CMZ(GZ(RS), MZ(MT, DT))
+
+#define cmpzx_mr(MS, DS, RT)                                                \
+        CMZ(MZ(MS, DS), GZ(RT))
+
+/* ver (Mebp/inf_VER = SIMD-version)
+ * set-flags: no
+ * For interpretation of SIMD build flags check compatibility layer in rtzero.h
+ * 0th byte - 128-bit version, 1st byte - 256-bit version, | plus _R8/_RX slots
+ * 2nd byte - 512-bit version, 3rd byte - 1K4-bit version, | in upper halves */
+
+     /* verxx_xx() in 32-bit rtarch_***.h files, destroys Reax, ... , Redi */
+
+/************************* address-sized instructions *************************/
+
+/* adr (D = adr S)
+ * set-flags: no */
+
+     /* adrxx_ld(RD, MS, DS) is defined in 32-bit rtarch_***.h files */
+
+/************************* pointer-sized instructions *************************/
+
+/* label (D = Reax = adr lb)
+ * set-flags: no */
+
+     /* label_ld(lb) is defined in rtarch.h file, loads label to Reax */
+
+     /* label_st(lb, MD, DD) is defined in rtarch.h file, destroys Reax */
+
+/* jmp (if unconditional jump S/lb, else if cc flags then jump lb)
+ * set-flags: no
+ * maximum byte-address-range for un/conditional jumps is signed 18/16-bit
+ * based on minimum natively-encoded offset across supported targets (u/c)
+ * MIPS:18-bit, POWER:26-bit, AArch32:26-bit, AArch64:28-bit, x86:32-bit /
+ * MIPS:18-bit, POWER:16-bit, AArch32:26-bit, AArch64:21-bit, x86:32-bit */
+
+     /* jccxx_** is defined in 32-bit rtarch_***.h files */
+
+/************************* register-size instructions *************************/
+
+/* stack (push stack = S, D = pop stack)
+ * set-flags: no (sequence cmp/stack_la/jmp is not allowed on MIPS & POWER)
+ * adjust stack pointer with 8-byte (64-bit) steps on all current targets */
+
+     /* stack_** is defined in 32-bit rtarch_***.h files */
+
+/******************************************************************************/
+/********************************   INTERNAL   ********************************/
+/******************************************************************************/
+
+#endif /* RT_RTARCH_C64_H */
+
+/******************************************************************************/
+/******************************************************************************/
+/******************************************************************************/
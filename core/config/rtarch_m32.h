@@ -1652,6 +1652,31 @@
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C3(DS), EMPTY2)   \
         EMITW(0x00000021 | MRM(REG(RD), MOD(MS), TDxx) | ADR)
 
+/* prf (prefetch M into cache level hint: PF_L1, PF_L2, PF_LL, PF_NT)
+ * set-flags: no, never faults, may be issued past the end of an array
+ * hints map to pref load/load/retained/streamed */
+
+#define PF_L1   0x00
+#define PF_L2   0x00
+#define PF_LL   0x06
+#define PF_NT   0x04
+
+#if (RT_BASE_COMPAT_REV < 6) /* pre-r6 */
+
+#define prfxx_ld(MS, DS, hint)                                              \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C3(DS), EMPTY2)   \
+        EMITW(0x00000021 | MRM(TPxx,    MOD(MS), TDxx) | ADR)               \
+        EMITW(0xCC000000 | MRM(0x00,    TPxx,    (hint)))
+
+#else /* RT_BASE_COMPAT_REV >= 6 : r6 */
+
+#define prfxx_ld(MS, DS, hint)                                              \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C3(DS), EMPTY2)   \
+        EMITW(0x00000021 | MRM(TPxx,    MOD(MS), TDxx) | ADR)               \
+        EMITW(0x7C000035 | MRM(0x00,    TPxx,    (hint)))
+
+#endif /* RT_BASE_COMPAT_REV >= 6 : r6 */
+
 /************************* pointer-sized instructions *************************/
 
 /* label (D = Reax = adr lb)
@@ -1883,6 +1908,108 @@
         EMITW(0x8C000000 | MRM(0x00,    SPxx,    Teax) | (+0x00 & 0xFFFF))  \
         EMITW(0x24000000 | MRM(0x00,    SPxx,    SPxx) | (+0x60 & 0xFFFF))
 
+#define stack_sm()   /* save listed [Reax - RegE] + 8 temps */              \
+        EMITW(0x24000000 | MRM(0x00,    SPxx,    SPxx) | (-0x60 & 0xFFFF))  \
+        ASM_IFB(RT_BASE_Reax)                                               \
+        EMITW(0xAC000000 | MRM(0x00,    SPxx,    Teax) | (+0x00 & 0xFFFF))  \
+        ASM_FI                                                              \
+        ASM_IFB(RT_BASE_Recx)                                               \
+        EMITW(0xAC000000 | MRM(0x00,    SPxx,    Tecx) | (+0x04 & 0xFFFF))  \
+        ASM_FI                                                              \
+        ASM_IFB(RT_BASE_Redx)                                               \
+        EMITW(0xAC000000 | MRM(0x00,    SPxx,    Tedx) | (+0x08 & 0xFFFF))  \
+        ASM_FI                                                              \
+        ASM_IFB(RT_BASE_Rebx)                                               \
+        EMITW(0xAC000000 | MRM(0x00,    SPxx,    Tebx) | (+0x0C & 0xFFFF))  \
+        ASM_FI                                                              \
+        EMITW(0xAC000000 | MRM(0x00,    SPxx,    Tebp) | (+0x10 & 0xFFFF))  \
+        ASM_IFB(RT_BASE_Resi)                                               \
+        EMITW(0xAC000000 | MRM(0x00,    SPxx,    Tesi) | (+0x14 & 0xFFFF))  \
+        ASM_FI                                                              \
+        ASM_IFB(RT_BASE_Redi)                                               \
+        EMITW(0xAC000000 | MRM(0x00,    SPxx,    Tedi) | (+0x18 & 0xFFFF))  \
+        ASM_FI                                                              \
+        ASM_IFB(RT_BASE_Reg8)                                               \
+        EMITW(0xAC000000 | MRM(0x00,    SPxx,    Teg8) | (+0x1C & 0xFFFF))  \
+        ASM_FI                                                              \
+        ASM_IFB(RT_BASE_Reg9)                                               \
+        EMITW(0xAC000000 | MRM(0x00,    SPxx,    Teg9) | (+0x20 & 0xFFFF))  \
+        ASM_FI                                                              \
+        ASM_IFB(RT_BASE_RegA)                                               \
+        EMITW(0xAC000000 | MRM(0x00,    SPxx,    TegA) | (+0x24 & 0xFFFF))  \
+        ASM_FI                                                              \
+        ASM_IFB(RT_BASE_RegB)                                               \
+        EMITW(0xAC000000 | MRM(0x00,    SPxx,    TegB) | (+0x28 & 0xFFFF))  \
+        ASM_FI                                                              \
+        ASM_IFB(RT_BASE_RegC)                                               \
+        EMITW(0xAC000000 | MRM(0x00,    SPxx,    TegC) | (+0x2C & 0xFFFF))  \
+        ASM_FI                                                              \
+        ASM_IFB(RT_BASE_RegD)                                               \
+        EMITW(0xAC000000 | MRM(0x00,    SPxx,    TegD) | (+0x30 & 0xFFFF))  \
+        ASM_FI                                                              \
+        ASM_IFB(RT_BASE_RegE)                                               \
+        EMITW(0xAC000000 | MRM(0x00,    SPxx,    TegE) | (+0x34 & 0xFFFF))  \
+        ASM_FI                                                              \
+        EMITW(0xAC000000 | MRM(0x00,    SPxx,    TMxx) | (+0x38 & 0xFFFF))  \
+        EMITW(0xAC000000 | MRM(0x00,    SPxx,    TIxx) | (+0x3C & 0xFFFF))  \
+        EMITW(0xAC000000 | MRM(0x00,    SPxx,    TDxx) | (+0x40 & 0xFFFF))  \
+        EMITW(0xAC000000 | MRM(0x00,    SPxx,    TPxx) | (+0x44 & 0xFFFF))  \
+        EMITW(0xAC000000 | MRM(0x00,    SPxx,    TNxx) | (+0x48 & 0xFFFF))  \
+        EMITW(0xAC000000 | MRM(0x00,    SPxx,    TAxx) | (+0x4C & 0xFFFF))  \
+        EMITW(0xAC000000 | MRM(0x00,    SPxx,    TCxx) | (+0x50 & 0xFFFF))  \
+        EMITW(0xAC000000 | MRM(0x00,    SPxx,    TExx) | (+0x54 & 0xFFFF))
+
+#define stack_lm()   /* load listed 8 temps + [RegE - Reax] */              \
+        EMITW(0x8C000000 | MRM(0x00,    SPxx,    TExx) | (+0x54 & 0xFFFF))  \
+        EMITW(0x8C000000 | MRM(0x00,    SPxx,    TCxx) | (+0x50 & 0xFFFF))  \
+        EMITW(0x8C000000 | MRM(0x00,    SPxx,    TAxx) | (+0x4C & 0xFFFF))  \
+        EMITW(0x8C000000 | MRM(0x00,    SPxx,    TNxx) | (+0x48 & 0xFFFF))  \
+        EMITW(0x8C000000 | MRM(0x00,    SPxx,    TPxx) | (+0x44 & 0xFFFF))  \
+        EMITW(0x8C000000 | MRM(0x00,    SPxx,    TDxx) | (+0x40 & 0xFFFF))  \
+        EMITW(0x8C000000 | MRM(0x00,    SPxx,    TIxx) | (+0x3C & 0xFFFF))  \
+        EMITW(0x8C000000 | MRM(0x00,    SPxx,    TMxx) | (+0x38 & 0xFFFF))  \
+        ASM_IFB(RT_BASE_RegE)                                               \
+        EMITW(0x8C000000 | MRM(0x00,    SPxx,    TegE) | (+0x34 & 0xFFFF))  \
+        ASM_FI                                                              \
+        ASM_IFB(RT_BASE_RegD)                                               \
+        EMITW(0x8C000000 | MRM(0x00,    SPxx,    TegD) | (+0x30 & 0xFFFF))  \
+        ASM_FI                                                              \
+        ASM_IFB(RT_BASE_RegC)                                               \
+        EMITW(0x8C000000 | MRM(0x00,    SPxx,    TegC) | (+0x2C & 0xFFFF))  \
+        ASM_FI                                                              \
+        ASM_IFB(RT_BASE_RegB)                                               \
+        EMITW(0x8C000000 | MRM(0x00,    SPxx,    TegB) | (+0x28 & 0xFFFF))  \
+        ASM_FI                                                              \
+        ASM_IFB(RT_BASE_RegA)                                               \
+        EMITW(0x8C000000 | MRM(0x00,    SPxx,    TegA) | (+0x24 & 0xFFFF))  \
+        ASM_FI                                                              \
+        ASM_IFB(RT_BASE_Reg9)                                               \
+        EMITW(0x8C000000 | MRM(0x00,    SPxx,    Teg9) | (+0x20 & 0xFFFF))  \
+        ASM_FI                                                              \
+        ASM_IFB(RT_BASE_Reg8)                                               \
+        EMITW(0x8C000000 | MRM(0x00,    SPxx,    Teg8) | (+0x1C & 0xFFFF))  \
+        ASM_FI                                                              \
+        ASM_IFB(RT_BASE_Redi)                                               \
+        EMITW(0x8C000000 | MRM(0x00,    SPxx,    Tedi) | (+0x18 & 0xFFFF))  \
+        ASM_FI                                                              \
+        ASM_IFB(RT_BASE_Resi)                                               \
+        EMITW(0x8C000000 | MRM(0x00,    SPxx,    Tesi) | (+0x14 & 0xFFFF))  \
+        ASM_FI                                                              \
+        EMITW(0x8C000000 | MRM(0x00,    SPxx,    Tebp) | (+0x10 & 0xFFFF))  \
+        ASM_IFB(RT_BASE_Rebx)                                               \
+        EMITW(0x8C000000 | MRM(0x00,    SPxx,    Tebx) | (+0x0C & 0xFFFF))  \
+        ASM_FI                                                              \
+        ASM_IFB(RT_BASE_Redx)                                               \
+        EMITW(0x8C000000 | MRM(0x00,    SPxx,    Tedx) | (+0x08 & 0xFFFF))  \
+        ASM_FI                                                              \
+        ASM_IFB(RT_BASE_Recx)                                               \
+        EMITW(0x8C000000 | MRM(0x00,    SPxx,    Tecx) | (+0x04 & 0xFFFF))  \
+        ASM_FI                                                              \
+        ASM_IFB(RT_BASE_Reax)                                               \
+        EMITW(0x8C000000 | MRM(0x00,    SPxx,    Teax) | (+0x00 & 0xFFFF))  \
+        ASM_FI                                                              \
+        EMITW(0x24000000 | MRM(0x00,    SPxx,    SPxx) | (+0x60 & 0xFFFF))
+
 #endif /* (defined RT_M32) */
 
 /******************************************************************************/
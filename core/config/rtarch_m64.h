@@ -1527,6 +1527,108 @@
         EMITW(0xDC000000 | MRM(0x00,    SPxx,    Teax) | (+0x00 & 0xFFFF))  \
         EMITW(0x64000000 | MRM(0x00,    SPxx,    SPxx) | (+0xB0 & 0xFFFF))
 
+#define stack_sm()   /* save listed [Reax - RegE] + 8 temps */              \
+        EMITW(0x64000000 | MRM(0x00,    SPxx,    SPxx) | (-0xB0 & 0xFFFF))  \
+        ASM_IFB(RT_BASE_Reax)                                               \
+        EMITW(0xFC000000 | MRM(0x00,    SPxx,    Teax) | (+0x00 & 0xFFFF))  \
+        ASM_FI                                                              \
+        ASM_IFB(RT_BASE_Recx)                                               \
+        EMITW(0xFC000000 | MRM(0x00,    SPxx,    Tecx) | (+0x08 & 0xFFFF))  \
+        ASM_FI                                                              \
+        ASM_IFB(RT_BASE_Redx)                                               \
+        EMITW(0xFC000000 | MRM(0x00,    SPxx,    Tedx) | (+0x10 & 0xFFFF))  \
+        ASM_FI                                                              \
+        ASM_IFB(RT_BASE_Rebx)                                               \
+        EMITW(0xFC000000 | MRM(0x00,    SPxx,    Tebx) | (+0x18 & 0xFFFF))  \
+        ASM_FI                                                              \
+        EMITW(0xFC000000 | MRM(0x00,    SPxx,    Tebp) | (+0x20 & 0xFFFF))  \
+        ASM_IFB(RT_BASE_Resi)                                               \
+        EMITW(0xFC000000 | MRM(0x00,    SPxx,    Tesi) | (+0x28 & 0xFFFF))  \
+        ASM_FI                                                              \
+        ASM_IFB(RT_BASE_Redi)                                               \
+        EMITW(0xFC000000 | MRM(0x00,    SPxx,    Tedi) | (+0x30 & 0xFFFF))  \
+        ASM_FI                                                              \
+        ASM_IFB(RT_BASE_Reg8)                                               \
+        EMITW(0xFC000000 | MRM(0x00,    SPxx,    Teg8) | (+0x38 & 0xFFFF))  \
+        ASM_FI                                                              \
+        ASM_IFB(RT_BASE_Reg9)                                               \
+        EMITW(0xFC000000 | MRM(0x00,    SPxx,    Teg9) | (+0x40 & 0xFFFF))  \
+        ASM_FI                                                              \
+        ASM_IFB(RT_BASE_RegA)                                               \
+        EMITW(0xFC000000 | MRM(0x00,    SPxx,    TegA) | (+0x48 & 0xFFFF))  \
+        ASM_FI                                                              \
+        ASM_IFB(RT_BASE_RegB)                                               \
+        EMITW(0xFC000000 | MRM(0x00,    SPxx,    TegB) | (+0x50 & 0xFFFF))  \
+        ASM_FI                                                              \
+        ASM_IFB(RT_BASE_RegC)                                               \
+        EMITW(0xFC000000 | MRM(0x00,    SPxx,    TegC) | (+0x58 & 0xFFFF))  \
+        ASM_FI                                                              \
+        ASM_IFB(RT_BASE_RegD)                                               \
+        EMITW(0xFC000000 | MRM(0x00,    SPxx,    TegD) | (+0x60 & 0xFFFF))  \
+        ASM_FI                                                              \
+        ASM_IFB(RT_BASE_RegE)                                               \
+        EMITW(0xFC000000 | MRM(0x00,    SPxx,    TegE) | (+0x68 & 0xFFFF))  \
+        ASM_FI                                                              \
+        EMITW(0xFC000000 | MRM(0x00,    SPxx,    TMxx) | (+0x70 & 0xFFFF))  \
+        EMITW(0xFC000000 | MRM(0x00,    SPxx,    TIxx) | (+0x78 & 0xFFFF))  \
+        EMITW(0xFC000000 | MRM(0x00,    SPxx,    TDxx) | (+0x80 & 0xFFFF))  \
+        EMITW(0xFC000000 | MRM(0x00,    SPxx,    TPxx) | (+0x88 & 0xFFFF))  \
+        EMITW(0xFC000000 | MRM(0x00,    SPxx,    TNxx) | (+0x90 & 0xFFFF))  \
+        EMITW(0xFC000000 | MRM(0x00,    SPxx,    TAxx) | (+0x98 & 0xFFFF))  \
+        EMITW(0xFC000000 | MRM(0x00,    SPxx,    TCxx) | (+0xA0 & 0xFFFF))  \
+        EMITW(0xFC000000 | MRM(0x00,    SPxx,    TExx) | (+0xA8 & 0xFFFF))
+
+#define stack_lm()   /* load listed 8 temps + [RegE - Reax] */              \
+        EMITW(0xDC000000 | MRM(0x00,    SPxx,    TExx) | (+0xA8 & 0xFFFF))  \
+        EMITW(0xDC000000 | MRM(0x00,    SPxx,    TCxx) | (+0xA0 & 0xFFFF))  \
+        EMITW(0xDC000000 | MRM(0x00,    SPxx,    TAxx) | (+0x98 & 0xFFFF))  \
+        EMITW(0xDC000000 | MRM(0x00,    SPxx,    TNxx) | (+0x90 & 0xFFFF))  \
+        EMITW(0xDC000000 | MRM(0x00,    SPxx,    TPxx) | (+0x88 & 0xFFFF))  \
+        EMITW(0xDC000000 | MRM(0x00,    SPxx,    TDxx) | (+0x80 & 0xFFFF))  \
+        EMITW(0xDC000000 | MRM(0x00,    SPxx,    TIxx) | (+0x78 & 0xFFFF))  \
+        EMITW(0xDC000000 | MRM(0x00,    SPxx,    TMxx) | (+0x70 & 0xFFFF))  \
+        ASM_IFB(RT_BASE_RegE)                                               \
+        EMITW(0xDC000000 | MRM(0x00,    SPxx,    TegE) | (+0x68 & 0xFFFF))  \
+        ASM_FI                                                              \
+        ASM_IFB(RT_BASE_RegD)                                               \
+        EMITW(0xDC000000 | MRM(0x00,    SPxx,    TegD) | (+0x60 & 0xFFFF))  \
+        ASM_FI                                                              \
+        ASM_IFB(RT_BASE_RegC)                                               \
+        EMITW(0xDC000000 | MRM(0x00,    SPxx,    TegC) | (+0x58 & 0xFFFF))  \
+        ASM_FI                                                              \
+        ASM_IFB(RT_BASE_RegB)                                               \
+        EMITW(0xDC000000 | MRM(0x00,    SPxx,    TegB) | (+0x50 & 0xFFFF))  \
+        ASM_FI                                                              \
+        ASM_IFB(RT_BASE_RegA)                                               \
+        EMITW(0xDC000000 | MRM(0x00,    SPxx,    TegA) | (+0x48 & 0xFFFF))  \
+        ASM_FI                                                              \
+        ASM_IFB(RT_BASE_Reg9)                                               \
+        EMITW(0xDC000000 | MRM(0x00,    SPxx,    Teg9) | (+0x40 & 0xFFFF))  \
+        ASM_FI                                                              \
+        ASM_IFB(RT_BASE_Reg8)                                               \
+        EMITW(0xDC000000 | MRM(0x00,    SPxx,    Teg8) | (+0x38 & 0xFFFF))  \
+        ASM_FI                                                              \
+        ASM_IFB(RT_BASE_Redi)                                               \
+        EMITW(0xDC000000 | MRM(0x00,    SPxx,    Tedi) | (+0x30 & 0xFFFF))  \
+        ASM_FI                                                              \
+        ASM_IFB(RT_BASE_Resi)                                               \
+        EMITW(0xDC000000 | MRM(0x00,    SPxx,    Tesi) | (+0x28 & 0xFFFF))  \
+        ASM_FI                                                              \
+        EMITW(0xDC000000 | MRM(0x00,    SPxx,    Tebp) | (+0x20 & 0xFFFF))  \
+        ASM_IFB(RT_BASE_Rebx)                                               \
+        EMITW(0xDC000000 | MRM(0x00,    SPxx,    Tebx) | (+0x18 & 0xFFFF))  \
+        ASM_FI                                                              \
+        ASM_IFB(RT_BASE_Redx)                                               \
+        EMITW(0xDC000000 | MRM(0x00,    SPxx,    Tedx) | (+0x10 & 0xFFFF))  \
+        ASM_FI                                                              \
+        ASM_IFB(RT_BASE_Recx)                                               \
+        EMITW(0xDC000000 | MRM(0x00,    SPxx,    Tecx) | (+0x08 & 0xFFFF))  \
+        ASM_FI                                                              \
+        ASM_IFB(RT_BASE_Reax)                                               \
+        EMITW(0xDC000000 | MRM(0x00,    SPxx,    Teax) | (+0x00 & 0xFFFF))  \
+        ASM_FI                                                              \
+        EMITW(0x64000000 | MRM(0x00,    SPxx,    SPxx) | (+0xB0 & 0xFFFF))
+
 /******************************************************************************/
 /********************************   INTERNAL   ********************************/
 /******************************************************************************/
@@ -1730,6 +1730,19 @@
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C3(DS), EMPTY2)   \
         EMITW(0x7C000214 | MRM(REG(RD), MOD(MS), TDxx))
 
+/* prf (prefetch M into cache level hint: PF_L1, PF_L2, PF_LL, PF_NT)
+ * set-flags: no, never faults, may be issued past the end of an array
+ * hints are ignored here, plain dcbt is issued */
+
+#define PF_L1   0x00
+#define PF_L2   0x00
+#define PF_LL   0x00
+#define PF_NT   0x00
+
+#define prfxx_ld(MS, DS, hint)                                              \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C3(DS), EMPTY2)   \
+        EMITW(0x7C00022C | MRM((hint),  MOD(MS), TDxx))
+
 /************************* pointer-sized instructions *************************/
 
 /* label (D = Reax = adr lb)
@@ -1882,6 +1895,116 @@
         EMITW(0x80000000 | MTM(Teax,    SPxx,    0x00) | (+0x00 & 0xFFFF))  \
         EMITW(0x38000000 | MTM(SPxx,    SPxx,    0x00) | (+0x70 & 0xFFFF))
 
+#define stack_sm()  /* save listed [Reax - RegE] + 12 temps */              \
+        EMITW(0x38000000 | MTM(SPxx,    SPxx,    0x00) | (-0x70 & 0xFFFF))  \
+        ASM_IFB(RT_BASE_Reax)                                               \
+        EMITW(0x90000000 | MTM(Teax,    SPxx,    0x00) | (+0x00 & 0xFFFF))  \
+        ASM_FI                                                              \
+        ASM_IFB(RT_BASE_Recx)                                               \
+        EMITW(0x90000000 | MTM(Tecx,    SPxx,    0x00) | (+0x04 & 0xFFFF))  \
+        ASM_FI                                                              \
+        ASM_IFB(RT_BASE_Redx)                                               \
+        EMITW(0x90000000 | MTM(Tedx,    SPxx,    0x00) | (+0x08 & 0xFFFF))  \
+        ASM_FI                                                              \
+        ASM_IFB(RT_BASE_Rebx)                                               \
+        EMITW(0x90000000 | MTM(Tebx,    SPxx,    0x00) | (+0x0C & 0xFFFF))  \
+        ASM_FI                                                              \
+        EMITW(0x90000000 | MTM(Tebp,    SPxx,    0x00) | (+0x10 & 0xFFFF))  \
+        ASM_IFB(RT_BASE_Resi)                                               \
+        EMITW(0x90000000 | MTM(Tesi,    SPxx,    0x00) | (+0x14 & 0xFFFF))  \
+        ASM_FI                                                              \
+        ASM_IFB(RT_BASE_Redi)                                               \
+        EMITW(0x90000000 | MTM(Tedi,    SPxx,    0x00) | (+0x18 & 0xFFFF))  \
+        ASM_FI                                                              \
+        ASM_IFB(RT_BASE_Reg8)                                               \
+        EMITW(0x90000000 | MTM(Teg8,    SPxx,    0x00) | (+0x1C & 0xFFFF))  \
+        ASM_FI                                                              \
+        ASM_IFB(RT_BASE_Reg9)                                               \
+        EMITW(0x90000000 | MTM(Teg9,    SPxx,    0x00) | (+0x20 & 0xFFFF))  \
+        ASM_FI                                                              \
+        ASM_IFB(RT_BASE_RegA)                                               \
+        EMITW(0x90000000 | MTM(TegA,    SPxx,    0x00) | (+0x24 & 0xFFFF))  \
+        ASM_FI                                                              \
+        ASM_IFB(RT_BASE_RegB)                                               \
+        EMITW(0x90000000 | MTM(TegB,    SPxx,    0x00) | (+0x28 & 0xFFFF))  \
+        ASM_FI                                                              \
+        ASM_IFB(RT_BASE_RegC)                                               \
+        EMITW(0x90000000 | MTM(TegC,    SPxx,    0x00) | (+0x2C & 0xFFFF))  \
+        ASM_FI                                                              \
+        ASM_IFB(RT_BASE_RegD)                                               \
+        EMITW(0x90000000 | MTM(TegD,    SPxx,    0x00) | (+0x30 & 0xFFFF))  \
+        ASM_FI                                                              \
+        ASM_IFB(RT_BASE_RegE)                                               \
+        EMITW(0x90000000 | MTM(TegE,    SPxx,    0x00) | (+0x34 & 0xFFFF))  \
+        ASM_FI                                                              \
+        EMITW(0x90000000 | MTM(TMxx,    SPxx,    0x00) | (+0x38 & 0xFFFF))  \
+        EMITW(0x90000000 | MTM(TIxx,    SPxx,    0x00) | (+0x3C & 0xFFFF))  \
+        EMITW(0x90000000 | MTM(TDxx,    SPxx,    0x00) | (+0x40 & 0xFFFF))  \
+        EMITW(0x90000000 | MTM(TPxx,    SPxx,    0x00) | (+0x44 & 0xFFFF))  \
+        EMITW(0x90000000 | MTM(TCxx,    SPxx,    0x00) | (+0x48 & 0xFFFF))  \
+        EMITW(0x90000000 | MTM(TVxx,    SPxx,    0x00) | (+0x4C & 0xFFFF))  \
+        EMITW(0x90000000 | MTM(T0xx,    SPxx,    0x00) | (+0x50 & 0xFFFF))  \
+        EMITW(0x90000000 | MTM(T1xx,    SPxx,    0x00) | (+0x54 & 0xFFFF))  \
+        EMITW(0x90000000 | MTM(T2xx,    SPxx,    0x00) | (+0x58 & 0xFFFF))  \
+        EMITW(0x90000000 | MTM(T3xx,    SPxx,    0x00) | (+0x5C & 0xFFFF))  \
+        EMITW(0x90000000 | MTM(TZxx,    SPxx,    0x00) | (+0x60 & 0xFFFF))  \
+        EMITW(0x90000000 | MTM(TWxx,    SPxx,    0x00) | (+0x64 & 0xFFFF))
+
+#define stack_lm()  /* load listed 12 temps + [RegE - Reax] */              \
+        EMITW(0x80000000 | MTM(TWxx,    SPxx,    0x00) | (+0x64 & 0xFFFF))  \
+        EMITW(0x80000000 | MTM(TZxx,    SPxx,    0x00) | (+0x60 & 0xFFFF))  \
+        EMITW(0x80000000 | MTM(T3xx,    SPxx,    0x00) | (+0x5C & 0xFFFF))  \
+        EMITW(0x80000000 | MTM(T2xx,    SPxx,    0x00) | (+0x58 & 0xFFFF))  \
+        EMITW(0x80000000 | MTM(T1xx,    SPxx,    0x00) | (+0x54 & 0xFFFF))  \
+        EMITW(0x80000000 | MTM(T0xx,    SPxx,    0x00) | (+0x50 & 0xFFFF))  \
+        EMITW(0x80000000 | MTM(TVxx,    SPxx,    0x00) | (+0x4C & 0xFFFF))  \
+        EMITW(0x80000000 | MTM(TCxx,    SPxx,    0x00) | (+0x48 & 0xFFFF))  \
+        EMITW(0x80000000 | MTM(TPxx,    SPxx,    0x00) | (+0x44 & 0xFFFF))  \
+        EMITW(0x80000000 | MTM(TDxx,    SPxx,    0x00) | (+0x40 & 0xFFFF))  \
+        EMITW(0x80000000 | MTM(TIxx,    SPxx,    0x00) | (+0x3C & 0xFFFF))  \
+        EMITW(0x80000000 | MTM(TMxx,    SPxx,    0x00) | (+0x38 & 0xFFFF))  \
+        ASM_IFB(RT_BASE_RegE)                                               \
+        EMITW(0x80000000 | MTM(TegE,    SPxx,    0x00) | (+0x34 & 0xFFFF))  \
+        ASM_FI                                                              \
+        ASM_IFB(RT_BASE_RegD)                                               \
+        EMITW(0x80000000 | MTM(TegD,    SPxx,    0x00) | (+0x30 & 0xFFFF))  \
+        ASM_FI                                                              \
+        ASM_IFB(RT_BASE_RegC)                                               \
+        EMITW(0x80000000 | MTM(TegC,    SPxx,    0x00) | (+0x2C & 0xFFFF))  \
+        ASM_FI                                                              \
+        ASM_IFB(RT_BASE_RegB)                                               \
+        EMITW(0x80000000 | MTM(TegB,    SPxx,    0x00) | (+0x28 & 0xFFFF))  \
+        ASM_FI                                                              \
+        ASM_IFB(RT_BASE_RegA)                                               \
+        EMITW(0x80000000 | MTM(TegA,    SPxx,    0x00) | (+0x24 & 0xFFFF))  \
+        ASM_FI                                                              \
+        ASM_IFB(RT_BASE_Reg9)                                               \
+        EMITW(0x80000000 | MTM(Teg9,    SPxx,    0x00) | (+0x20 & 0xFFFF))  \
+        ASM_FI                                                              \
+        ASM_IFB(RT_BASE_Reg8)                                               \
+        EMITW(0x80000000 | MTM(Teg8,    SPxx,    0x00) | (+0x1C & 0xFFFF))  \
+        ASM_FI                                                              \
+        ASM_IFB(RT_BASE_Redi)                                               \
+        EMITW(0x80000000 | MTM(Tedi,    SPxx,    0x00) | (+0x18 & 0xFFFF))  \
+        ASM_FI                                                              \
+        ASM_IFB(RT_BASE_Resi)                                               \
+        EMITW(0x80000000 | MTM(Tesi,    SPxx,    0x00) | (+0x14 & 0xFFFF))  \
+        ASM_FI                                                              \
+        EMITW(0x80000000 | MTM(Tebp,    SPxx,    0x00) | (+0x10 & 0xFFFF))  \
+        ASM_IFB(RT_BASE_Rebx)                                               \
+        EMITW(0x80000000 | MTM(Tebx,    SPxx,    0x00) | (+0x0C & 0xFFFF))  \
+        ASM_FI                                                              \
+        ASM_IFB(RT_BASE_Redx)                                               \
+        EMITW(0x80000000 | MTM(Tedx,    SPxx,    0x00) | (+0x08 & 0xFFFF))  \
+        ASM_FI                                                              \
+        ASM_IFB(RT_BASE_Recx)                                               \
+        EMITW(0x80000000 | MTM(Tecx,    SPxx,    0x00) | (+0x04 & 0xFFFF))  \
+        ASM_FI                                                              \
+        ASM_IFB(RT_BASE_Reax)                                               \
+        EMITW(0x80000000 | MTM(Teax,    SPxx,    0x00) | (+0x00 & 0xFFFF))  \
+        ASM_FI                                                              \
+        EMITW(0x38000000 | MTM(SPxx,    SPxx,    0x00) | (+0x70 & 0xFFFF))
+
 #endif /* (defined RT_P32) */
 
 /******************************************************************************/
@@ -1171,35 +1171,35 @@
 #undef  sregs_sa
 #define sregs_sa() /* save all SIMD regs, destroys Reax */                  \
         movxx_ld(Reax, Mebp, inf_REGS)                                      \
-        movox2st(Xmm0, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFF8001) movox2st(Xmm0, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        movox2st(Xmm1, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFF8002) movox2st(Xmm1, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        movox2st(Xmm2, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFF8004) movox2st(Xmm2, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        movox2st(Xmm3, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFF8008) movox2st(Xmm3, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        movox2st(Xmm4, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFF8010) movox2st(Xmm4, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        movox2st(Xmm5, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFF8020) movox2st(Xmm5, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        movox2st(Xmm6, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFF8040) movox2st(Xmm6, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        movox2st(Xmm7, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFF8080) movox2st(Xmm7, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        movox2st(Xmm8, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFF8100) movox2st(Xmm8, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        movox2st(Xmm9, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFF8200) movox2st(Xmm9, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        movox2st(XmmA, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFF8400) movox2st(XmmA, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        movox2st(XmmB, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFF8800) movox2st(XmmB, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        movox2st(XmmC, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFF9000) movox2st(XmmC, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        movox2st(XmmD, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFFA000) movox2st(XmmD, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        movox2st(XmmE, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFFC000) movox2st(XmmE, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
         EMITW(0x7C000719 | MXM(TmmQ,    0x00,    Teax))                     \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_128*4))                           \
@@ -1212,35 +1212,35 @@
 #undef  sregs_la
 #define sregs_la() /* load all SIMD regs, destroys Reax */                  \
         movxx_ld(Reax, Mebp, inf_REGS)                                      \
-        movox2ld(Xmm0, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFF8001) movox2ld(Xmm0, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        movox2ld(Xmm1, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFF8002) movox2ld(Xmm1, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        movox2ld(Xmm2, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFF8004) movox2ld(Xmm2, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        movox2ld(Xmm3, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFF8008) movox2ld(Xmm3, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        movox2ld(Xmm4, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFF8010) movox2ld(Xmm4, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        movox2ld(Xmm5, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFF8020) movox2ld(Xmm5, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        movox2ld(Xmm6, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFF8040) movox2ld(Xmm6, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        movox2ld(Xmm7, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFF8080) movox2ld(Xmm7, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        movox2ld(Xmm8, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFF8100) movox2ld(Xmm8, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        movox2ld(Xmm9, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFF8200) movox2ld(Xmm9, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        movox2ld(XmmA, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFF8400) movox2ld(XmmA, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        movox2ld(XmmB, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFF8800) movox2ld(XmmB, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        movox2ld(XmmC, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFF9000) movox2ld(XmmC, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        movox2ld(XmmD, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFFA000) movox2ld(XmmD, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        movox2ld(XmmE, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFFC000) movox2ld(XmmE, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
         EMITW(0x7C000619 | MXM(TmmQ,    0x00,    Teax))                     \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_128*4))                           \
@@ -1199,65 +1199,65 @@
 #undef  sregs_sa
 #define sregs_sa() /* save all SIMD regs, destroys Reax */                  \
         movxx_ld(Reax, Mebp, inf_REGS)                                      \
-        movcx_st(Xmm0, Oeax, PLAIN)                                         \
+        ASM_IFS(0xC0000001) movcx_st(Xmm0, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(Xmm1, Oeax, PLAIN)                                         \
+        ASM_IFS(0xC0000002) movcx_st(Xmm1, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(Xmm2, Oeax, PLAIN)                                         \
+        ASM_IFS(0xC0000004) movcx_st(Xmm2, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(Xmm3, Oeax, PLAIN)                                         \
+        ASM_IFS(0xC0000008) movcx_st(Xmm3, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(Xmm4, Oeax, PLAIN)                                         \
+        ASM_IFS(0xC0000010) movcx_st(Xmm4, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(Xmm5, Oeax, PLAIN)                                         \
+        ASM_IFS(0xC0000020) movcx_st(Xmm5, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(Xmm6, Oeax, PLAIN)                                         \
+        ASM_IFS(0xC0000040) movcx_st(Xmm6, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(Xmm7, Oeax, PLAIN)                                         \
+        ASM_IFS(0xC0000080) movcx_st(Xmm7, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(Xmm8, Oeax, PLAIN)                                         \
+        ASM_IFS(0xC0000100) movcx_st(Xmm8, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(Xmm9, Oeax, PLAIN)                                         \
+        ASM_IFS(0xC0000200) movcx_st(Xmm9, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(XmmA, Oeax, PLAIN)                                         \
+        ASM_IFS(0xC0000400) movcx_st(XmmA, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(XmmB, Oeax, PLAIN)                                         \
+        ASM_IFS(0xC0000800) movcx_st(XmmB, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(XmmC, Oeax, PLAIN)                                         \
+        ASM_IFS(0xC0001000) movcx_st(XmmC, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(XmmD, Oeax, PLAIN)                                         \
+        ASM_IFS(0xC0002000) movcx_st(XmmD, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(XmmE, Oeax, PLAIN)                                         \
+        ASM_IFS(0xC0004000) movcx_st(XmmE, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(XmmF, Oeax, PLAIN)                                         \
+        ASM_IFS(0xC0008000) movcx_st(XmmF, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(XmmG, Oeax, PLAIN)                                         \
+        ASM_IFS(0xC0010000) movcx_st(XmmG, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(XmmH, Oeax, PLAIN)                                         \
+        ASM_IFS(0xC0020000) movcx_st(XmmH, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(XmmI, Oeax, PLAIN)                                         \
+        ASM_IFS(0xC0040000) movcx_st(XmmI, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(XmmJ, Oeax, PLAIN)                                         \
+        ASM_IFS(0xC0080000) movcx_st(XmmJ, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(XmmK, Oeax, PLAIN)                                         \
+        ASM_IFS(0xC0100000) movcx_st(XmmK, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(XmmL, Oeax, PLAIN)                                         \
+        ASM_IFS(0xC0200000) movcx_st(XmmL, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(XmmM, Oeax, PLAIN)                                         \
+        ASM_IFS(0xC0400000) movcx_st(XmmM, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(XmmN, Oeax, PLAIN)                                         \
+        ASM_IFS(0xC0800000) movcx_st(XmmN, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(XmmO, Oeax, PLAIN)                                         \
+        ASM_IFS(0xC1000000) movcx_st(XmmO, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(XmmP, Oeax, PLAIN)                                         \
+        ASM_IFS(0xC2000000) movcx_st(XmmP, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(XmmQ, Oeax, PLAIN)                                         \
+        ASM_IFS(0xC4000000) movcx_st(XmmQ, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(XmmR, Oeax, PLAIN)                                         \
+        ASM_IFS(0xC8000000) movcx_st(XmmR, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(XmmS, Oeax, PLAIN)                                         \
+        ASM_IFS(0xD0000000) movcx_st(XmmS, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(XmmT, Oeax, PLAIN)                                         \
+        ASM_IFS(0xE0000000) movcx_st(XmmT, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
         EMITW(0x7C000719 | MXM(TmmQ,    0x00,    Teax))                     \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_128*4))                           \
@@ -1270,65 +1270,65 @@
 #undef  sregs_la
 #define sregs_la() /* load all SIMD regs, destroys Reax */                  \
         movxx_ld(Reax, Mebp, inf_REGS)                                      \
-        movcx_ld(Xmm0, Oeax, PLAIN)                                         \
+        ASM_IFS(0xC0000001) movcx_ld(Xmm0, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(Xmm1, Oeax, PLAIN)                                         \
+        ASM_IFS(0xC0000002) movcx_ld(Xmm1, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(Xmm2, Oeax, PLAIN)                                         \
+        ASM_IFS(0xC0000004) movcx_ld(Xmm2, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(Xmm3, Oeax, PLAIN)                                         \
+        ASM_IFS(0xC0000008) movcx_ld(Xmm3, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(Xmm4, Oeax, PLAIN)                                         \
+        ASM_IFS(0xC0000010) movcx_ld(Xmm4, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(Xmm5, Oeax, PLAIN)                                         \
+        ASM_IFS(0xC0000020) movcx_ld(Xmm5, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(Xmm6, Oeax, PLAIN)                                         \
+        ASM_IFS(0xC0000040) movcx_ld(Xmm6, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(Xmm7, Oeax, PLAIN)                                         \
+        ASM_IFS(0xC0000080) movcx_ld(Xmm7, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(Xmm8, Oeax, PLAIN)                                         \
+        ASM_IFS(0xC0000100) movcx_ld(Xmm8, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(Xmm9, Oeax, PLAIN)                                         \
+        ASM_IFS(0xC0000200) movcx_ld(Xmm9, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(XmmA, Oeax, PLAIN)                                         \
+        ASM_IFS(0xC0000400) movcx_ld(XmmA, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(XmmB, Oeax, PLAIN)                                         \
+        ASM_IFS(0xC0000800) movcx_ld(XmmB, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(XmmC, Oeax, PLAIN)                                         \
+        ASM_IFS(0xC0001000) movcx_ld(XmmC, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(XmmD, Oeax, PLAIN)                                         \
+        ASM_IFS(0xC0002000) movcx_ld(XmmD, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(XmmE, Oeax, PLAIN)                                         \
+        ASM_IFS(0xC0004000) movcx_ld(XmmE, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(XmmF, Oeax, PLAIN)                                         \
+        ASM_IFS(0xC0008000) movcx_ld(XmmF, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(XmmG, Oeax, PLAIN)                                         \
+        ASM_IFS(0xC0010000) movcx_ld(XmmG, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(XmmH, Oeax, PLAIN)                                         \
+        ASM_IFS(0xC0020000) movcx_ld(XmmH, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(XmmI, Oeax, PLAIN)                                         \
+        ASM_IFS(0xC0040000) movcx_ld(XmmI, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(XmmJ, Oeax, PLAIN)                                         \
+        ASM_IFS(0xC0080000) movcx_ld(XmmJ, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(XmmK, Oeax, PLAIN)                                         \
+        ASM_IFS(0xC0100000) movcx_ld(XmmK, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(XmmL, Oeax, PLAIN)                                         \
+        ASM_IFS(0xC0200000) movcx_ld(XmmL, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(XmmM, Oeax, PLAIN)                                         \
+        ASM_IFS(0xC0400000) movcx_ld(XmmM, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(XmmN, Oeax, PLAIN)                                         \
+        ASM_IFS(0xC0800000) movcx_ld(XmmN, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(XmmO, Oeax, PLAIN)                                         \
+        ASM_IFS(0xC1000000) movcx_ld(XmmO, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(XmmP, Oeax, PLAIN)                                         \
+        ASM_IFS(0xC2000000) movcx_ld(XmmP, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(XmmQ, Oeax, PLAIN)                                         \
+        ASM_IFS(0xC4000000) movcx_ld(XmmQ, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(XmmR, Oeax, PLAIN)                                         \
+        ASM_IFS(0xC8000000) movcx_ld(XmmR, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(XmmS, Oeax, PLAIN)                                         \
+        ASM_IFS(0xD0000000) movcx_ld(XmmS, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(XmmT, Oeax, PLAIN)                                         \
+        ASM_IFS(0xE0000000) movcx_ld(XmmT, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
         EMITW(0x7C000619 | MXM(TmmQ,    0x00,    Teax))                     \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_128*4))                           \
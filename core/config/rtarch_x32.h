@@ -1586,6 +1586,20 @@
         MRM(REG(RD), MOD(MS), REG(MS))                                      \
         AUX(SIB(MS), CMD(DS), EMPTY)
 
+/* prf (prefetch M into cache level hint: PF_L1, PF_L2, PF_LL, PF_NT)
+ * set-flags: no, never faults, may be issued past the end of an array
+ * hints map to prefetcht0/t1/t2/nta */
+
+#define PF_L1   0x01
+#define PF_L2   0x02
+#define PF_LL   0x03
+#define PF_NT   0x00
+
+#define prfxx_ld(MS, DS, hint)                                              \
+    ADR REX(0,       RXB(MS)) EMITB(0x0F) EMITB(0x18)                       \
+        MRM((hint),  MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
 /************************* pointer-sized instructions *************************/
 
 /* label (D = Reax = adr lb)
@@ -1624,6 +1638,52 @@
 
 #endif /* defined (RT_X32, RT_X64) */
 
+#if   (defined RT_JIT)
+
+#define jmpxx_lb(lb)              /* label-targeted unconditional jump */   \
+        ASM_JMP(lb)
+
+#define jezxx_lb(lb)               /* setting-flags-arithmetic -> jump */   \
+        ASM_JCC(0x04, lb)
+
+#define jnzxx_lb(lb)               /* setting-flags-arithmetic -> jump */   \
+        ASM_JCC(0x05, lb)
+
+#define jeqxx_lb(lb)                                /* compare -> jump */   \
+        ASM_JCC(0x04, lb)
+
+#define jnexx_lb(lb)                                /* compare -> jump */   \
+        ASM_JCC(0x05, lb)
+
+#define jltxx_lb(lb)                                /* compare -> jump */   \
+        ASM_JCC(0x02, lb)
+
+#define jlexx_lb(lb)                                /* compare -> jump */   \
+        ASM_JCC(0x06, lb)
+
+#define jgtxx_lb(lb)                                /* compare -> jump */   \
+        ASM_JCC(0x07, lb)
+
+#define jgexx_lb(lb)                                /* compare -> jump */   \
+        ASM_JCC(0x03, lb)
+
+#define jltxn_lb(lb)                                /* compare -> jump */   \
+        ASM_JCC(0x0C, lb)
+
+#define jlexn_lb(lb)                                /* compare -> jump */   \
+        ASM_JCC(0x0E, lb)
+
+#define jgtxn_lb(lb)                                /* compare -> jump */   \
+        ASM_JCC(0x0F, lb)
+
+#define jgexn_lb(lb)                                /* compare -> jump */   \
+        ASM_JCC(0x0D, lb)
+
+#define LBL(lb)                                          /* code label */   \
+        ASM_LBL(lb)
+
+#else  /* RT_JIT */
+
 #define jmpxx_lb(lb)              /* label-targeted unconditional jump */   \
         ASM_BEG ASM_OP1(jmp, lb) ASM_END
 
@@ -1665,6 +1725,8 @@
 
 #define LBL(lb)                                          /* code label */   \
         ASM_BEG ASM_OP0(lb:) ASM_END
+#endif /* RT_JIT */
+
 
 /************************* register-size instructions *************************/
 
@@ -1716,6 +1778,48 @@
         stack_ld(Recx)                                                      \
         stack_ld(Reax)
 
+#define stack_sm()   /* save listed [Reax - RegE], Rebp + RegF always */    \
+        REW(0,             0) EMITB(0x8D)     /* <- skip red zone, 128 */   \
+        MRM(0x04,       0x01, 0x04)                                         \
+        AUX(EMITB(0x24), EMITB(0x80), EMPTY)                                \
+        ASM_IFB(RT_BASE_Reax) stack_st(Reax) ASM_FI                         \
+        ASM_IFB(RT_BASE_Recx) stack_st(Recx) ASM_FI                         \
+        ASM_IFB(RT_BASE_Redx) stack_st(Redx) ASM_FI                         \
+        ASM_IFB(RT_BASE_Rebx) stack_st(Rebx) ASM_FI                         \
+        stack_st(Rebp)                                                      \
+        ASM_IFB(RT_BASE_Resi) stack_st(Resi) ASM_FI                         \
+        ASM_IFB(RT_BASE_Redi) stack_st(Redi) ASM_FI                         \
+        ASM_IFB(RT_BASE_Reg8) stack_st(Reg8) ASM_FI                         \
+        ASM_IFB(RT_BASE_Reg9) stack_st(Reg9) ASM_FI                         \
+        ASM_IFB(RT_BASE_RegA) stack_st(RegA) ASM_FI                         \
+        ASM_IFB(RT_BASE_RegB) stack_st(RegB) ASM_FI                         \
+        ASM_IFB(RT_BASE_RegC) stack_st(RegC) ASM_FI                         \
+        ASM_IFB(RT_BASE_RegD) stack_st(RegD) ASM_FI                         \
+        ASM_IFB(RT_BASE_RegE) stack_st(RegE) ASM_FI                         \
+        REX(0,             1) EMITB(0xFF)     /* <- save r15 or [RegF] */   \
+        MRM(0x06,       0x03, 0x07)
+
+#define stack_lm()   /* load listed [RegE - Reax], Rebp + RegF always */    \
+        REX(0,             1) EMITB(0x8F)     /* <- load r15 or [RegF] */   \
+        MRM(0x00,       0x03, 0x07)                                         \
+        ASM_IFB(RT_BASE_RegE) stack_ld(RegE) ASM_FI                         \
+        ASM_IFB(RT_BASE_RegD) stack_ld(RegD) ASM_FI                         \
+        ASM_IFB(RT_BASE_RegC) stack_ld(RegC) ASM_FI                         \
+        ASM_IFB(RT_BASE_RegB) stack_ld(RegB) ASM_FI                         \
+        ASM_IFB(RT_BASE_RegA) stack_ld(RegA) ASM_FI                         \
+        ASM_IFB(RT_BASE_Reg9) stack_ld(Reg9) ASM_FI                         \
+        ASM_IFB(RT_BASE_Reg8) stack_ld(Reg8) ASM_FI                         \
+        ASM_IFB(RT_BASE_Redi) stack_ld(Redi) ASM_FI                         \
+        ASM_IFB(RT_BASE_Resi) stack_ld(Resi) ASM_FI                         \
+        stack_ld(Rebp)                                                      \
+        ASM_IFB(RT_BASE_Rebx) stack_ld(Rebx) ASM_FI                         \
+        ASM_IFB(RT_BASE_Redx) stack_ld(Redx) ASM_FI                         \
+        ASM_IFB(RT_BASE_Recx) stack_ld(Recx) ASM_FI                         \
+        ASM_IFB(RT_BASE_Reax) stack_ld(Reax) ASM_FI                         \
+        REW(0,             0) EMITB(0x8D)     /* <- skip red zone, 128 */   \
+        MRM(0x04,       0x02, 0x04)                                         \
+        AUX(EMITB(0x24), EMITW(0x00000080), EMPTY)
+
 /******************************************************************************/
 /**************************   extended double (x87)   *************************/
 /******************************************************************************/
@@ -186,6 +186,14 @@
         MRM(REG(XS), MOD(MD), REG(MD))                                      \
         AUX(SIB(MD), CMD(DD), EMPTY)
 
+/* stn (M = S) streams to aligned M bypassing caches (non-temporal) */
+
+#undef  stnix_st
+#define stnix_st(XS, MD, DD)                                                \
+    ADR EVX(RXB(XS), RXB(MD),    0x00, 0, 0, 1) EMITB(0x2B)                 \
+        MRM(REG(XS), MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMPTY)
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -184,6 +184,14 @@
         MRM(REG(XS), MOD(MD), REG(MD))                                      \
         AUX(SIB(MD), CMD(DD), EMPTY)
 
+/* stn (M = S) streams to aligned M bypassing caches (non-temporal) */
+
+#undef  stnix_st
+#define stnix_st(XS, MD, DD)                                                \
+    ADR REX(RXB(XS), RXB(MD)) EMITB(0x0F) EMITB(0x2B)                       \
+        MRM(REG(XS), MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMPTY)
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -220,6 +228,30 @@ ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0x38) EMITB(0x14)           \
         orrix_rr(Xmm0, W(XS))                                               \
         movix_st(Xmm0, W(MG), W(DG))
 
+/* spl, rev, rot use pshufd, unl, unh use unpcklps/unpckhps, tbl is generic */
+
+#undef  splix_ri
+#define splix_ri(XD, XS, IS)                                                \
+        shfix_rr(W(XD), W(XS), IB((VAL(IS) & 3) * 0x55))
+
+#undef  revix_rr
+#define revix_rr(XD, XS)                                                    \
+        shfix_rr(W(XD), W(XS), IB(0x1B))
+
+#undef  rotix_ri
+#define rotix_ri(XD, XS, IS)                                                \
+        shfix_rr(W(XD), W(XS), IB((0xE4E4 >> ((VAL(IS) & 3) * 2)) & 0xFF))
+
+#undef  unlix_rr
+#define unlix_rr(XG, XS)                                                    \
+        REX(RXB(XG), RXB(XS)) EMITB(0x0F) EMITB(0x14)                       \
+        MRM(REG(XG), MOD(XS), REG(XS))
+
+#undef  unhix_rr
+#define unhix_rr(XG, XS)                                                    \
+        REX(RXB(XG), RXB(XS)) EMITB(0x0F) EMITB(0x15)                       \
+        MRM(REG(XG), MOD(XS), REG(XS))
+
 /* and (G = G & S), (D = S & T) if (#D != #S) */
 
 #define andix_rr(XG, XS)                                                    \
@@ -699,9 +731,36 @@ ADR xF2 REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0x7C)                       \
         movix_rr(W(XD), W(XS))                                              \
         minis_ld(W(XD), W(MT), W(DT))
 
-        /* mnp, mnh are defined in rtbase.h
+        /* mnp is defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#define shfix_rr(XD, XS, IT) /* not portable, do not use outside */         \
+    ESC REX(RXB(XD), RXB(XS)) EMITB(0x0F) EMITB(0x70)                       \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(VAL(IT)))
+
+#define shfix_ld(XD, MS, DS, IT) /* not portable, do not use outside */     \
+ADR ESC REX(RXB(XD), RXB(MS)) EMITB(0x0F) EMITB(0x70)                       \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMITB(VAL(IT)))
+
+/* horizontal min/max rotate elements by one (shfix) and combine with source,
+ * source is passed through memory in case XD is the same register as XS */
+
+#undef  mnhis_rr
+#define mnhis_rr(XD, XS) /* horizontal reductive min */                     \
+        movix_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        mnhis_ld(W(XD), Mebp, inf_SCR01(0))
+
+#undef  mnhis_ld
+#define mnhis_ld(XD, MS, DS)                                                \
+        shfix_ld(W(XD), W(MS), W(DS), IB(0x39))                             \
+        minis_ld(W(XD), W(MS), W(DS))                                       \
+        shfix_rr(W(XD), W(XD), IB(0x39))                                    \
+        minis_ld(W(XD), W(MS), W(DS))                                       \
+        shfix_rr(W(XD), W(XD), IB(0x39))                                    \
+        minis_ld(W(XD), W(MS), W(DS))
+
 /* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #S) */
 
 #define maxis_rr(XG, XS)                                                    \
@@ -721,9 +780,23 @@ ADR xF2 REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0x7C)                       \
         movix_rr(W(XD), W(XS))                                              \
         maxis_ld(W(XD), W(MT), W(DT))
 
-        /* mxp, mxh are defined in rtbase.h
+        /* mxp is defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mxhis_rr
+#define mxhis_rr(XD, XS) /* horizontal reductive max */                     \
+        movix_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        mxhis_ld(W(XD), Mebp, inf_SCR01(0))
+
+#undef  mxhis_ld
+#define mxhis_ld(XD, MS, DS)                                                \
+        shfix_ld(W(XD), W(MS), W(DS), IB(0x39))                             \
+        maxis_ld(W(XD), W(MS), W(DS))                                       \
+        shfix_rr(W(XD), W(XD), IB(0x39))                                    \
+        maxis_ld(W(XD), W(MS), W(DS))                                       \
+        shfix_rr(W(XD), W(XD), IB(0x39))                                    \
+        maxis_ld(W(XD), W(MS), W(DS))
+
 /* ceq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #S) */
 
 #define ceqis_rr(XG, XS)                                                    \
@@ -1409,6 +1482,630 @@ ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0xE2)                       \
         stack_ld(Recx)                                                      \
         movix_ld(W(XD), Mebp, inf_SCR01(0))
 
+/****************   packed single-precision integer compare   *****************/
+/* native SSE forms override generic forms from rtbase.h, signed (n)
+ * compares use pcmpgtd, unsigned (x) compares require SSE4.1 min/max */
+
+/* ceq (G = G == S ? -1 : 0), cne (G = G != S ? -1 : 0) */
+
+#undef  ceqix_rr
+#define ceqix_rr(XG, XS)                                                    \
+    ESC REX(RXB(XG), RXB(XS)) EMITB(0x0F) EMITB(0x76)                       \
+        MRM(REG(XG), MOD(XS), REG(XS))
+
+#undef  ceqix_ld
+#define ceqix_ld(XG, MS, DS)                                                \
+ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0x76)                       \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#undef  cneix_rr
+#define cneix_rr(XG, XS)                                                    \
+        ceqix_rr(W(XG), W(XS))                                              \
+        notix_rx(W(XG))
+
+#undef  cneix_ld
+#define cneix_ld(XG, MS, DS)                                                \
+        ceqix_ld(W(XG), W(MS), W(DS))                                       \
+        notix_rx(W(XG))
+
+/* cgt, clt, cle, cge (G = G ? S ? -1 : 0) - signed (n) */
+
+#undef  cgtin_rr
+#define cgtin_rr(XG, XS)                                                    \
+    ESC REX(RXB(XG), RXB(XS)) EMITB(0x0F) EMITB(0x66)                       \
+        MRM(REG(XG), MOD(XS), REG(XS))
+
+#undef  cgtin_ld
+#define cgtin_ld(XG, MS, DS)                                                \
+ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0x66)                       \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#undef  cltin_rr
+#define cltin_rr(XG, XS)                                                    \
+        movix_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        movix_rr(W(XG), W(XS))                                              \
+        cgtin_ld(W(XG), Mebp, inf_SCR01(0))
+
+#undef  cltin_ld
+#define cltin_ld(XG, MS, DS)                                                \
+        movix_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        movix_ld(W(XG), W(MS), W(DS))                                       \
+        cgtin_ld(W(XG), Mebp, inf_SCR01(0))
+
+#undef  clein_rr
+#define clein_rr(XG, XS)                                                    \
+        cgtin_rr(W(XG), W(XS))                                              \
+        notix_rx(W(XG))
+
+#undef  clein_ld
+#define clein_ld(XG, MS, DS)                                                \
+        cgtin_ld(W(XG), W(MS), W(DS))                                       \
+        notix_rx(W(XG))
+
+#undef  cgein_rr
+#define cgein_rr(XG, XS)                                                    \
+        cltin_rr(W(XG), W(XS))                                              \
+        notix_rx(W(XG))
+
+#undef  cgein_ld
+#define cgein_ld(XG, MS, DS)                                                \
+        cltin_ld(W(XG), W(MS), W(DS))                                       \
+        notix_rx(W(XG))
+
+#if (RT_SIMD_COMPAT_SSE >= 4)
+
+/* cgt, clt, cle, cge (G = G ? S ? -1 : 0) - unsigned (x) */
+
+#undef  cgeix_rr
+#define cgeix_rr(XG, XS)                                                    \
+        mnuix_rr(W(XG), W(XS))                                              \
+        ceqix_rr(W(XG), W(XS))
+
+#undef  cgeix_ld
+#define cgeix_ld(XG, MS, DS)                                                \
+        mnuix_ld(W(XG), W(MS), W(DS))                                       \
+        ceqix_ld(W(XG), W(MS), W(DS))
+
+#undef  cleix_rr
+#define cleix_rr(XG, XS)                                                    \
+        mxuix_rr(W(XG), W(XS))                                              \
+        ceqix_rr(W(XG), W(XS))
+
+#undef  cleix_ld
+#define cleix_ld(XG, MS, DS)                                                \
+        mxuix_ld(W(XG), W(MS), W(DS))                                       \
+        ceqix_ld(W(XG), W(MS), W(DS))
+
+#undef  cltix_rr
+#define cltix_rr(XG, XS)                                                    \
+        cgeix_rr(W(XG), W(XS))                                              \
+        notix_rx(W(XG))
+
+#undef  cltix_ld
+#define cltix_ld(XG, MS, DS)                                                \
+        cgeix_ld(W(XG), W(MS), W(DS))                                       \
+        notix_rx(W(XG))
+
+#undef  cgtix_rr
+#define cgtix_rr(XG, XS)                                                    \
+        cleix_rr(W(XG), W(XS))                                              \
+        notix_rx(W(XG))
+
+#undef  cgtix_ld
+#define cgtix_ld(XG, MS, DS)                                                \
+        cleix_ld(W(XG), W(MS), W(DS))                                       \
+        notix_rx(W(XG))
+
+#define mnuix_rr(XG, XS) /* not portable, do not use outside */             \
+    ESC REX(RXB(XG), RXB(XS)) EMITB(0x0F) EMITB(0x38) EMITB(0x3B)           \
+        MRM(REG(XG), MOD(XS), REG(XS))
+
+#define mnuix_ld(XG, MS, DS) /* not portable, do not use outside */         \
+ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0x38) EMITB(0x3B)           \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define mxuix_rr(XG, XS) /* not portable, do not use outside */             \
+    ESC REX(RXB(XG), RXB(XS)) EMITB(0x0F) EMITB(0x38) EMITB(0x3F)           \
+        MRM(REG(XG), MOD(XS), REG(XS))
+
+#define mxuix_ld(XG, MS, DS) /* not portable, do not use outside */         \
+ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0x38) EMITB(0x3F)           \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#endif /* RT_SIMD_COMPAT_SSE >= 4 */
+
+/***********   packed byte/half integer arithmetic/compare/shifts   ***********/
+/* native SSE2 forms override generic SWAR forms from rtbase.h for the
+ * 128-bit (cmdib_, cmdih_, cmdic_, cmdii_) subsets, byte shifts and
+ * converters keep generic forms, min/max (c, h) require SSE4.1 */
+
+/* add (G = G + S), sub (G = G - S) */
+
+#undef  addib_rr
+#define addib_rr(XG, XS)                                                    \
+    ESC REX(RXB(XG), RXB(XS)) EMITB(0x0F) EMITB(0xFC)                       \
+        MRM(REG(XG), MOD(XS), REG(XS))
+
+#undef  addib_ld
+#define addib_ld(XG, MS, DS)                                                \
+ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0xFC)                       \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#undef  addih_rr
+#define addih_rr(XG, XS)                                                    \
+    ESC REX(RXB(XG), RXB(XS)) EMITB(0x0F) EMITB(0xFD)                       \
+        MRM(REG(XG), MOD(XS), REG(XS))
+
+#undef  addih_ld
+#define addih_ld(XG, MS, DS)                                                \
+ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0xFD)                       \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#undef  subib_rr
+#define subib_rr(XG, XS)                                                    \
+    ESC REX(RXB(XG), RXB(XS)) EMITB(0x0F) EMITB(0xF8)                       \
+        MRM(REG(XG), MOD(XS), REG(XS))
+
+#undef  subib_ld
+#define subib_ld(XG, MS, DS)                                                \
+ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0xF8)                       \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#undef  subih_rr
+#define subih_rr(XG, XS)                                                    \
+    ESC REX(RXB(XG), RXB(XS)) EMITB(0x0F) EMITB(0xF9)                       \
+        MRM(REG(XG), MOD(XS), REG(XS))
+
+#undef  subih_ld
+#define subih_ld(XG, MS, DS)                                                \
+ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0xF9)                       \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+/* ads (G = G + S), sbs (G = G - S) - saturate,
+ * unsigned (b, h), signed (c, i) */
+
+#undef  adsib_rr
+#define adsib_rr(XG, XS)                                                    \
+    ESC REX(RXB(XG), RXB(XS)) EMITB(0x0F) EMITB(0xDC)                       \
+        MRM(REG(XG), MOD(XS), REG(XS))
+
+#undef  adsib_ld
+#define adsib_ld(XG, MS, DS)                                                \
+ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0xDC)                       \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#undef  adsih_rr
+#define adsih_rr(XG, XS)                                                    \
+    ESC REX(RXB(XG), RXB(XS)) EMITB(0x0F) EMITB(0xDD)                       \
+        MRM(REG(XG), MOD(XS), REG(XS))
+
+#undef  adsih_ld
+#define adsih_ld(XG, MS, DS)                                                \
+ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0xDD)                       \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#undef  adsic_rr
+#define adsic_rr(XG, XS)                                                    \
+    ESC REX(RXB(XG), RXB(XS)) EMITB(0x0F) EMITB(0xEC)                       \
+        MRM(REG(XG), MOD(XS), REG(XS))
+
+#undef  adsic_ld
+#define adsic_ld(XG, MS, DS)                                                \
+ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0xEC)                       \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#undef  adsii_rr
+#define adsii_rr(XG, XS)                                                    \
+    ESC REX(RXB(XG), RXB(XS)) EMITB(0x0F) EMITB(0xED)                       \
+        MRM(REG(XG), MOD(XS), REG(XS))
+
+#undef  adsii_ld
+#define adsii_ld(XG, MS, DS)                                                \
+ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0xED)                       \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#undef  sbsib_rr
+#define sbsib_rr(XG, XS)                                                    \
+    ESC REX(RXB(XG), RXB(XS)) EMITB(0x0F) EMITB(0xD8)                       \
+        MRM(REG(XG), MOD(XS), REG(XS))
+
+#undef  sbsib_ld
+#define sbsib_ld(XG, MS, DS)                                                \
+ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0xD8)                       \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#undef  sbsih_rr
+#define sbsih_rr(XG, XS)                                                    \
+    ESC REX(RXB(XG), RXB(XS)) EMITB(0x0F) EMITB(0xD9)                       \
+        MRM(REG(XG), MOD(XS), REG(XS))
+
+#undef  sbsih_ld
+#define sbsih_ld(XG, MS, DS)                                                \
+ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0xD9)                       \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#undef  sbsic_rr
+#define sbsic_rr(XG, XS)                                                    \
+    ESC REX(RXB(XG), RXB(XS)) EMITB(0x0F) EMITB(0xE8)                       \
+        MRM(REG(XG), MOD(XS), REG(XS))
+
+#undef  sbsic_ld
+#define sbsic_ld(XG, MS, DS)                                                \
+ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0xE8)                       \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#undef  sbsii_rr
+#define sbsii_rr(XG, XS)                                                    \
+    ESC REX(RXB(XG), RXB(XS)) EMITB(0x0F) EMITB(0xE9)                       \
+        MRM(REG(XG), MOD(XS), REG(XS))
+
+#undef  sbsii_ld
+#define sbsii_ld(XG, MS, DS)                                                \
+ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0xE9)                       \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+/* min (G = G < S ? G : S), max (G = G > S ? G : S) */
+
+#undef  minib_rr
+#define minib_rr(XG, XS)                                                    \
+    ESC REX(RXB(XG), RXB(XS)) EMITB(0x0F) EMITB(0xDA)                       \
+        MRM(REG(XG), MOD(XS), REG(XS))
+
+#undef  minib_ld
+#define minib_ld(XG, MS, DS)                                                \
+ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0xDA)                       \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#undef  maxib_rr
+#define maxib_rr(XG, XS)                                                    \
+    ESC REX(RXB(XG), RXB(XS)) EMITB(0x0F) EMITB(0xDE)                       \
+        MRM(REG(XG), MOD(XS), REG(XS))
+
+#undef  maxib_ld
+#define maxib_ld(XG, MS, DS)                                                \
+ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0xDE)                       \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#undef  minii_rr
+#define minii_rr(XG, XS)                                                    \
+    ESC REX(RXB(XG), RXB(XS)) EMITB(0x0F) EMITB(0xEA)                       \
+        MRM(REG(XG), MOD(XS), REG(XS))
+
+#undef  minii_ld
+#define minii_ld(XG, MS, DS)                                                \
+ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0xEA)                       \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#undef  maxii_rr
+#define maxii_rr(XG, XS)                                                    \
+    ESC REX(RXB(XG), RXB(XS)) EMITB(0x0F) EMITB(0xEE)                       \
+        MRM(REG(XG), MOD(XS), REG(XS))
+
+#undef  maxii_ld
+#define maxii_ld(XG, MS, DS)                                                \
+ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0xEE)                       \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+/* ceq (G = G == S ? -1 : 0), cne (G = G != S ? -1 : 0) */
+
+#undef  ceqib_rr
+#define ceqib_rr(XG, XS)                                                    \
+    ESC REX(RXB(XG), RXB(XS)) EMITB(0x0F) EMITB(0x74)                       \
+        MRM(REG(XG), MOD(XS), REG(XS))
+
+#undef  ceqib_ld
+#define ceqib_ld(XG, MS, DS)                                                \
+ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0x74)                       \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#undef  ceqih_rr
+#define ceqih_rr(XG, XS)                                                    \
+    ESC REX(RXB(XG), RXB(XS)) EMITB(0x0F) EMITB(0x75)                       \
+        MRM(REG(XG), MOD(XS), REG(XS))
+
+#undef  ceqih_ld
+#define ceqih_ld(XG, MS, DS)                                                \
+ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0x75)                       \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#undef  cneib_rr
+#define cneib_rr(XG, XS)                                                    \
+        ceqib_rr(W(XG), W(XS))                                              \
+        notix_rx(W(XG))
+
+#undef  cneib_ld
+#define cneib_ld(XG, MS, DS)                                                \
+        ceqib_ld(W(XG), W(MS), W(DS))                                       \
+        notix_rx(W(XG))
+
+#undef  cneih_rr
+#define cneih_rr(XG, XS)                                                    \
+        ceqih_rr(W(XG), W(XS))                                              \
+        notix_rx(W(XG))
+
+#undef  cneih_ld
+#define cneih_ld(XG, MS, DS)                                                \
+        ceqih_ld(W(XG), W(MS), W(DS))                                       \
+        notix_rx(W(XG))
+
+/* cgt, clt, cle, cge (G = G ? S ? -1 : 0) - signed via pcmpgt,
+ * unsigned bytes via min/max round-trip */
+
+#undef  cgtic_rr
+#define cgtic_rr(XG, XS)                                                    \
+    ESC REX(RXB(XG), RXB(XS)) EMITB(0x0F) EMITB(0x64)                       \
+        MRM(REG(XG), MOD(XS), REG(XS))
+
+#undef  cgtic_ld
+#define cgtic_ld(XG, MS, DS)                                                \
+ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0x64)                       \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#undef  cgtii_rr
+#define cgtii_rr(XG, XS)                                                    \
+    ESC REX(RXB(XG), RXB(XS)) EMITB(0x0F) EMITB(0x65)                       \
+        MRM(REG(XG), MOD(XS), REG(XS))
+
+#undef  cgtii_ld
+#define cgtii_ld(XG, MS, DS)                                                \
+ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0x65)                       \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#undef  cltic_rr
+#define cltic_rr(XG, XS)                                                    \
+        movix_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        movix_rr(W(XG), W(XS))                                              \
+        cgtic_ld(W(XG), Mebp, inf_SCR01(0))
+
+#undef  cltic_ld
+#define cltic_ld(XG, MS, DS)                                                \
+        movix_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        movix_ld(W(XG), W(MS), W(DS))                                       \
+        cgtic_ld(W(XG), Mebp, inf_SCR01(0))
+
+#undef  cltii_rr
+#define cltii_rr(XG, XS)                                                    \
+        movix_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        movix_rr(W(XG), W(XS))                                              \
+        cgtii_ld(W(XG), Mebp, inf_SCR01(0))
+
+#undef  cltii_ld
+#define cltii_ld(XG, MS, DS)                                                \
+        movix_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        movix_ld(W(XG), W(MS), W(DS))                                       \
+        cgtii_ld(W(XG), Mebp, inf_SCR01(0))
+
+#undef  cleic_rr
+#define cleic_rr(XG, XS)                                                    \
+        cgtic_rr(W(XG), W(XS))                                              \
+        notix_rx(W(XG))
+
+#undef  cleic_ld
+#define cleic_ld(XG, MS, DS)                                                \
+        cgtic_ld(W(XG), W(MS), W(DS))                                       \
+        notix_rx(W(XG))
+
+#undef  cleii_rr
+#define cleii_rr(XG, XS)                                                    \
+        cgtii_rr(W(XG), W(XS))                                              \
+        notix_rx(W(XG))
+
+#undef  cleii_ld
+#define cleii_ld(XG, MS, DS)                                                \
+        cgtii_ld(W(XG), W(MS), W(DS))                                       \
+        notix_rx(W(XG))
+
+#undef  cgeic_rr
+#define cgeic_rr(XG, XS)                                                    \
+        cltic_rr(W(XG), W(XS))                                              \
+        notix_rx(W(XG))
+
+#undef  cgeic_ld
+#define cgeic_ld(XG, MS, DS)                                                \
+        cltic_ld(W(XG), W(MS), W(DS))                                       \
+        notix_rx(W(XG))
+
+#undef  cgeii_rr
+#define cgeii_rr(XG, XS)                                                    \
+        cltii_rr(W(XG), W(XS))                                              \
+        notix_rx(W(XG))
+
+#undef  cgeii_ld
+#define cgeii_ld(XG, MS, DS)                                                \
+        cltii_ld(W(XG), W(MS), W(DS))                                       \
+        notix_rx(W(XG))
+
+#undef  cgeib_rr
+#define cgeib_rr(XG, XS)                                                    \
+        minib_rr(W(XG), W(XS))                                              \
+        ceqib_rr(W(XG), W(XS))
+
+#undef  cgeib_ld
+#define cgeib_ld(XG, MS, DS)                                                \
+        minib_ld(W(XG), W(MS), W(DS))                                       \
+        ceqib_ld(W(XG), W(MS), W(DS))
+
+#undef  cleib_rr
+#define cleib_rr(XG, XS)                                                    \
+        maxib_rr(W(XG), W(XS))                                              \
+        ceqib_rr(W(XG), W(XS))
+
+#undef  cleib_ld
+#define cleib_ld(XG, MS, DS)                                                \
+        maxib_ld(W(XG), W(MS), W(DS))                                       \
+        ceqib_ld(W(XG), W(MS), W(DS))
+
+#undef  cltib_rr
+#define cltib_rr(XG, XS)                                                    \
+        cgeib_rr(W(XG), W(XS))                                              \
+        notix_rx(W(XG))
+
+#undef  cltib_ld
+#define cltib_ld(XG, MS, DS)                                                \
+        cgeib_ld(W(XG), W(MS), W(DS))                                       \
+        notix_rx(W(XG))
+
+#undef  cgtib_rr
+#define cgtib_rr(XG, XS)                                                    \
+        cleib_rr(W(XG), W(XS))                                              \
+        notix_rx(W(XG))
+
+#undef  cgtib_ld
+#define cgtib_ld(XG, MS, DS)                                                \
+        cleib_ld(W(XG), W(MS), W(DS))                                       \
+        notix_rx(W(XG))
+
+/* shl (G = G << S), shr (G = G >> S) - half, unsigned (h), signed (i)
+ * for maximum compatibility, shift count mustn't exceed elem-size */
+
+#undef  shlih_ri
+#define shlih_ri(XG, IS)                                                    \
+    ESC REX(0,       RXB(XG)) EMITB(0x0F) EMITB(0x71)                       \
+        MRM(0x06,    MOD(XG), REG(XG))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(VAL(IS) & 0x1F))
+
+#undef  shlih_ld
+#define shlih_ld(XG, MS, DS) /* loads SIMD, uses first elem, rest zeroed */ \
+ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0xF1)                       \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#undef  shrih_ri
+#define shrih_ri(XG, IS)                                                    \
+    ESC REX(0,       RXB(XG)) EMITB(0x0F) EMITB(0x71)                       \
+        MRM(0x02,    MOD(XG), REG(XG))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(VAL(IS) & 0x1F))
+
+#undef  shrih_ld
+#define shrih_ld(XG, MS, DS) /* loads SIMD, uses first elem, rest zeroed */ \
+ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0xD1)                       \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#undef  shrii_ri
+#define shrii_ri(XG, IS)                                                    \
+    ESC REX(0,       RXB(XG)) EMITB(0x0F) EMITB(0x71)                       \
+        MRM(0x04,    MOD(XG), REG(XG))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(VAL(IS) & 0x1F))
+
+#undef  shrii_ld
+#define shrii_ld(XG, MS, DS) /* loads SIMD, uses first elem, rest zeroed */ \
+ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0xE1)                       \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#if (RT_SIMD_COMPAT_SSE >= 4)
+
+#undef  minic_rr
+#define minic_rr(XG, XS)                                                    \
+    ESC REX(RXB(XG), RXB(XS)) EMITB(0x0F) EMITB(0x38) EMITB(0x38)           \
+        MRM(REG(XG), MOD(XS), REG(XS))
+
+#undef  minic_ld
+#define minic_ld(XG, MS, DS)                                                \
+ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0x38) EMITB(0x38)           \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#undef  maxic_rr
+#define maxic_rr(XG, XS)                                                    \
+    ESC REX(RXB(XG), RXB(XS)) EMITB(0x0F) EMITB(0x38) EMITB(0x3C)           \
+        MRM(REG(XG), MOD(XS), REG(XS))
+
+#undef  maxic_ld
+#define maxic_ld(XG, MS, DS)                                                \
+ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0x38) EMITB(0x3C)           \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#undef  minih_rr
+#define minih_rr(XG, XS)                                                    \
+    ESC REX(RXB(XG), RXB(XS)) EMITB(0x0F) EMITB(0x38) EMITB(0x3A)           \
+        MRM(REG(XG), MOD(XS), REG(XS))
+
+#undef  minih_ld
+#define minih_ld(XG, MS, DS)                                                \
+ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0x38) EMITB(0x3A)           \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#undef  maxih_rr
+#define maxih_rr(XG, XS)                                                    \
+    ESC REX(RXB(XG), RXB(XS)) EMITB(0x0F) EMITB(0x38) EMITB(0x3E)           \
+        MRM(REG(XG), MOD(XS), REG(XS))
+
+#undef  maxih_ld
+#define maxih_ld(XG, MS, DS)                                                \
+ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0x38) EMITB(0x3E)           \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#undef  cgeih_rr
+#define cgeih_rr(XG, XS)                                                    \
+        minih_rr(W(XG), W(XS))                                              \
+        ceqih_rr(W(XG), W(XS))
+
+#undef  cgeih_ld
+#define cgeih_ld(XG, MS, DS)                                                \
+        minih_ld(W(XG), W(MS), W(DS))                                       \
+        ceqih_ld(W(XG), W(MS), W(DS))
+
+#undef  cleih_rr
+#define cleih_rr(XG, XS)                                                    \
+        maxih_rr(W(XG), W(XS))                                              \
+        ceqih_rr(W(XG), W(XS))
+
+#undef  cleih_ld
+#define cleih_ld(XG, MS, DS)                                                \
+        maxih_ld(W(XG), W(MS), W(DS))                                       \
+        ceqih_ld(W(XG), W(MS), W(DS))
+
+#undef  cltih_rr
+#define cltih_rr(XG, XS)                                                    \
+        cgeih_rr(W(XG), W(XS))                                              \
+        notix_rx(W(XG))
+
+#undef  cltih_ld
+#define cltih_ld(XG, MS, DS)                                                \
+        cgeih_ld(W(XG), W(MS), W(DS))                                       \
+        notix_rx(W(XG))
+
+#undef  cgtih_rr
+#define cgtih_rr(XG, XS)                                                    \
+        cleih_rr(W(XG), W(XS))                                              \
+        notix_rx(W(XG))
+
+#undef  cgtih_ld
+#define cgtih_ld(XG, MS, DS)                                                \
+        cleih_ld(W(XG), W(MS), W(DS))                                       \
+        notix_rx(W(XG))
+
+#endif /* RT_SIMD_COMPAT_SSE >= 4 */
+
 /******************************************************************************/
 /**********************************   ELEM   **********************************/
 /******************************************************************************/
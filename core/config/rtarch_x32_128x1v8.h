@@ -186,6 +186,14 @@
         MRM(REG(XS), MOD(MD), REG(MD))                                      \
         AUX(SIB(MD), CMD(DD), EMPTY)
 
+/* stn (M = S) streams to aligned M bypassing caches (non-temporal) */
+
+#undef  stnix_st
+#define stnix_st(XS, MD, DD)                                                \
+    ADR VEX(RXB(XS), RXB(MD),    0x00, 0, 0, 1) EMITB(0x2B)                 \
+        MRM(REG(XS), MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMPTY)
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -204,6 +212,49 @@
         MRM(REG(XS), MOD(MG), REG(MG))                                      \
         AUX(SIB(MG), CMD(DG), EMPTY)
 
+#if (RT_128X1 >= 16)
+
+/* cvx, cux, cvy, cuy use F16C (rounding follows MXCSR), upper-half forms
+ * go through SCR01 with vmovhps (cux) or memory-operand convert (cuy) */
+
+#undef  cvxis_rr
+#define cvxis_rr(XD, XS)                                                    \
+        VEX(RXB(XS), RXB(XD),    0x00, 0, 1, 3) EMITB(0x1D)                 \
+        MRM(REG(XS), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x04))
+
+#undef  cuxis_rr
+#define cuxis_rr(XG, XS)                                                    \
+        cvhis_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        inhix_ld(W(XG), Mebp, inf_SCR01(0))
+
+#undef  cvygs_rr
+#define cvygs_rr(XD, XS)                                                    \
+        VEX(RXB(XD), RXB(XS),    0x00, 0, 1, 2) EMITB(0x13)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+#undef  cuygs_rr
+#define cuygs_rr(XD, XS)                                                    \
+        movix_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        cvhgs_ld(W(XD), Mebp, inf_SCR01(0x08))
+
+#define cvhis_st(XS, MD, DD) /* not portable, do not use outside */         \
+    ADR VEX(RXB(XS), RXB(MD),    0x00, 0, 1, 3) EMITB(0x1D)                 \
+        MRM(REG(XS), MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMITB(0x04))
+
+#define cvhgs_ld(XD, MS, DS) /* not portable, do not use outside */         \
+    ADR VEX(RXB(XD), RXB(MS),    0x00, 0, 1, 2) EMITB(0x13)                 \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define inhix_ld(XG, MS, DS) /* not portable, do not use outside */         \
+    ADR VEX(RXB(XG), RXB(MS), REN(XG), 0, 0, 1) EMITB(0x16)                 \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#endif /* RT_128X1 >= 16, FMA3 or AVX2 */
+
 /* and (G = G & S), (D = S & T) if (#D != #S) */
 
 #define andix_rr(XG, XS)                                                    \
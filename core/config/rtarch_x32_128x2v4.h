@@ -171,6 +171,17 @@
         MRM(REG(XS),    0x02, REG(MD))                                      \
         AUX(SIB(MD), EMITW(VYL(DD)), EMPTY)
 
+/* stn (M = S) streams to aligned M bypassing caches (non-temporal) */
+
+#undef  stncx_st
+#define stncx_st(XS, MD, DD)                                                \
+    ADR REX(0,       RXB(MD)) EMITB(0x0F) EMITB(0x2B)                       \
+        MRM(REG(XS),    0x02, REG(MD))                                      \
+        AUX(SIB(MD), EMITW(VAL(DD)), EMPTY)                                 \
+    ADR REX(1,       RXB(MD)) EMITB(0x0F) EMITB(0x2B)                       \
+        MRM(REG(XS),    0x02, REG(MD))                                      \
+        AUX(SIB(MD), EMITW(VYL(DD)), EMPTY)
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -350,9 +361,40 @@
         movcx_rr(W(XD), W(XS))                                              \
         addcs_ld(W(XD), W(MT), W(DT))
 
-        /* adp, adh are defined in rtbase.h (first 15-regs only)
+        /* adp is defined in rtbase.h (first 15-regs only)
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#define shlcx_rx(XD, IT) /* not portable, do not use outside */             \
+    ESC REX(1,             0) EMITB(0x0F) EMITB(0x70)                       \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(VAL(IT)))
+
+#define mvlcx_rx(XD) /* not portable, do not use outside */                 \
+        REX(1,             0) EMITB(0x0F) EMITB(0x28)                       \
+        MRM(REG(XD), MOD(XD), REG(XD))
+
+/* horizontal reductions fold the upper half of the pair into the lower one,
+ * then reduce the lower half using the upper half as a temporary register */
+
+#undef  adhcs_rr
+#define adhcs_rr(XD, XS) /* horizontal reductive add */                     \
+        REX(0,             0) EMITB(0x0F) EMITB(0x28)                       \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        REX(0,             1) EMITB(0x0F) EMITB(0x58)                       \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        shlcx_rx(W(XD), IB(0xB1))                                           \
+        REX(0,             1) EMITB(0x0F) EMITB(0x58)                       \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        shlcx_rx(W(XD), IB(0x4E))                                           \
+        REX(0,             1) EMITB(0x0F) EMITB(0x58)                       \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        mvlcx_rx(W(XD))
+
+#undef  adhcs_ld
+#define adhcs_ld(XD, MS, DS)                                                \
+        movcx_ld(W(XD), W(MS), W(DS))                                       \
+        adhcs_rr(W(XD), W(XD))
+
 #if (RT_SIMD_COMPAT_SSE < 4)
 
 #undef  adpcs_rx
@@ -763,9 +805,28 @@
         movcx_rr(W(XD), W(XS))                                              \
         mincs_ld(W(XD), W(MT), W(DT))
 
-        /* mnp, mnh are defined in rtbase.h
+        /* mnp is defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mnhcs_rr
+#define mnhcs_rr(XD, XS) /* horizontal reductive min */                     \
+        REX(0,             0) EMITB(0x0F) EMITB(0x28)                       \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        REX(0,             1) EMITB(0x0F) EMITB(0x5D)                       \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        shlcx_rx(W(XD), IB(0xB1))                                           \
+        REX(0,             1) EMITB(0x0F) EMITB(0x5D)                       \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        shlcx_rx(W(XD), IB(0x4E))                                           \
+        REX(0,             1) EMITB(0x0F) EMITB(0x5D)                       \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        mvlcx_rx(W(XD))
+
+#undef  mnhcs_ld
+#define mnhcs_ld(XD, MS, DS)                                                \
+        movcx_ld(W(XD), W(MS), W(DS))                                       \
+        mnhcs_rr(W(XD), W(XD))
+
 /* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #S) */
 
 #define maxcs_rr(XG, XS)                                                    \
@@ -790,9 +851,28 @@
         movcx_rr(W(XD), W(XS))                                              \
         maxcs_ld(W(XD), W(MT), W(DT))
 
-        /* mxp, mxh are defined in rtbase.h
+        /* mxp is defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mxhcs_rr
+#define mxhcs_rr(XD, XS) /* horizontal reductive max */                     \
+        REX(0,             0) EMITB(0x0F) EMITB(0x28)                       \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        REX(0,             1) EMITB(0x0F) EMITB(0x5F)                       \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        shlcx_rx(W(XD), IB(0xB1))                                           \
+        REX(0,             1) EMITB(0x0F) EMITB(0x5F)                       \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        shlcx_rx(W(XD), IB(0x4E))                                           \
+        REX(0,             1) EMITB(0x0F) EMITB(0x5F)                       \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        mvlcx_rx(W(XD))
+
+#undef  mxhcs_ld
+#define mxhcs_ld(XD, MS, DS)                                                \
+        movcx_ld(W(XD), W(MS), W(DS))                                       \
+        mxhcs_rr(W(XD), W(XD))
+
 /* ceq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #S) */
 
 #define ceqcs_rr(XG, XS)                                                    \
@@ -1683,40 +1763,40 @@ ADR ESC REX(1,       RXB(MS)) EMITB(0x0F) EMITB(0xE2)                       \
 #undef  sregs_sa
 #define sregs_sa() /* save all SIMD regs, destroys Reax */                  \
         movxx_ld(Reax, Mebp, inf_REGS)                                      \
-        movcx_st(Xmm0, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFFFF01) movcx_st(Xmm0, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(Xmm1, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFFFF02) movcx_st(Xmm1, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(Xmm2, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFFFF04) movcx_st(Xmm2, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(Xmm3, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFFFF08) movcx_st(Xmm3, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(Xmm4, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFFFF10) movcx_st(Xmm4, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(Xmm5, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFFFF20) movcx_st(Xmm5, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(Xmm6, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFFFF40) movcx_st(Xmm6, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_st(Xmm7, Oeax, PLAIN)
+        ASM_IFS(0xFFFFFF80) movcx_st(Xmm7, Oeax, PLAIN) ASM_FI
 
 #undef  sregs_la
 #define sregs_la() /* load all SIMD regs, destroys Reax */                  \
         movxx_ld(Reax, Mebp, inf_REGS)                                      \
-        movcx_ld(Xmm0, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFFFF01) movcx_ld(Xmm0, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(Xmm1, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFFFF02) movcx_ld(Xmm1, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(Xmm2, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFFFF04) movcx_ld(Xmm2, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(Xmm3, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFFFF08) movcx_ld(Xmm3, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(Xmm4, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFFFF10) movcx_ld(Xmm4, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(Xmm5, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFFFF20) movcx_ld(Xmm5, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(Xmm6, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFFFF40) movcx_ld(Xmm6, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        movcx_ld(Xmm7, Oeax, PLAIN)
+        ASM_IFS(0xFFFFFF80) movcx_ld(Xmm7, Oeax, PLAIN) ASM_FI
 
 #endif /* RT_128X2 */
 
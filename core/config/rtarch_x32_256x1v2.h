@@ -151,6 +151,14 @@
         MRM(REG(XS), MOD(MD), REG(MD))                                      \
         AUX(SIB(MD), CMD(DD), EMPTY)
 
+/* stn (M = S) streams to aligned M bypassing caches (non-temporal) */
+
+#undef  stncx_st
+#define stncx_st(XS, MD, DD)                                                \
+    ADR VEX(RXB(XS), RXB(MD),    0x00, 1, 0, 1) EMITB(0x2B)                 \
+        MRM(REG(XS), MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMPTY)
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -169,6 +177,120 @@
         MRM(REG(XS), MOD(MG), REG(MG))                                      \
         AUX(SIB(MG), CMD(DG), EMPTY)
 
+#if (RT_256X1 >= 2)
+
+/* gth (D = [M + S]), sct ([M + T] = S) are defined in rtbase.h
+ * under "COMMON SIMD INSTRUCTIONS" section, AVX2 gather is used below,
+ * its index and mask must differ from XD, so two low-bank registers
+ * next to XD are borrowed for them and restored from scratchpads after */
+
+#undef  gthcx_ld
+#define gthcx_ld(XD, XS, MT, DT) /* M: Oeax, M*** only */                   \
+        movcx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        mvtcx_st(REG(XD)^1, Mebp, inf_SCR02(0))                             \
+        mvtcx_ld(REG(XD)^1, Mebp, inf_SCR01(0))                             \
+        mvtcx_st(REG(XD)^2, Mebp, inf_SCR01(0))                             \
+        VEX(0,             0, REG(XD)^2, 1, 1, 1) EMITB(0x76)               \
+        MRM(REG(XD)^2,  0x03, REG(XD)^2)                                    \
+    ADR VEX(RXB(XD), RXB(MT), REG(XD)^2, 1, 1, 2) EMITB(0x92)               \
+        MRM(REG(XD), MOD(MT),    0x04)                                      \
+        AUX(EMITB(0x80 | (REG(XD)^1) << 3 | REG(MT)), CMD(DT), EMPTY)       \
+        mvtcx_ld(REG(XD)^2, Mebp, inf_SCR01(0))                             \
+        mvtcx_ld(REG(XD)^1, Mebp, inf_SCR02(0))
+
+#define mvtcx_ld(RD, MS, DS) /* not portable, do not use outside */         \
+    ADR VEX(0,       RXB(MS),    0x00, 1, 0, 1) EMITB(0x28)                 \
+        MRM((RD),    MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define mvtcx_st(RS, MD, DD) /* not portable, do not use outside */         \
+    ADR VEX(0,       RXB(MD),    0x00, 1, 0, 1) EMITB(0x29)                 \
+        MRM((RS),    MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMPTY)
+
+#endif /* RT_256X1 >= 2, AVX2 */
+
+/* spl, rev broadcast or swap 128-bit halves (prlcx) and shuffle within them,
+ * AVX2 tbl uses vpermd with indices from XT, other forms are generic */
+
+#undef  splcx_ri
+#define splcx_ri(XD, XS, IS)                                                \
+        prlcx_rr(W(XD), W(XS), IB(((VAL(IS) >> 2) & 1) * 0x11))             \
+        shfcx_rr(W(XD), W(XD), IB((VAL(IS) & 3) * 0x55))
+
+#undef  revcx_rr
+#define revcx_rr(XD, XS)                                                    \
+        prlcx_rr(W(XD), W(XS), IB(0x01))                                    \
+        shfcx_rr(W(XD), W(XD), IB(0x1B))
+
+#define prlcx_rr(XD, XS, IT) /* not portable, do not use outside */         \
+        VEX(RXB(XD), RXB(XS), REN(XS), 1, 1, 3) EMITB(0x06)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(VAL(IT)))
+
+#if (RT_256X1 >= 2)
+
+#undef  tblcx_rr
+#define tblcx_rr(XD, XS, XT)                                                \
+        VEX(RXB(XD), RXB(XS), REN(XT), 1, 1, 2) EMITB(0x36)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+#undef  tblcx_ld
+#define tblcx_ld(XD, XS, MT, DT)                                            \
+        movcx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movcx_ld(W(XD), W(MT), W(DT))                                       \
+        prdcx_ld(W(XD), Mebp, inf_SCR01(0))
+
+#define prdcx_ld(XG, MS, DS) /* not portable, do not use outside */         \
+    ADR VEX(RXB(XG), RXB(MS), REN(XG), 1, 1, 2) EMITB(0x36)                 \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#endif /* RT_256X1 >= 2, AVX2 */
+
+#if (RT_256X1 >= 2)
+
+/* cvx, cux, cvy, cuy use F16C (rounding follows MXCSR), upper-half forms
+ * go through SCR01 with vinsertf128 (cux) or memory-operand convert (cuy) */
+
+#undef  cvxcs_rr
+#define cvxcs_rr(XD, XS)                                                    \
+        VEX(RXB(XS), RXB(XD),    0x00, 1, 1, 3) EMITB(0x1D)                 \
+        MRM(REG(XS), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x04))
+
+#undef  cuxcs_rr
+#define cuxcs_rr(XG, XS)                                                    \
+        cvhcs_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        inhcx_ld(W(XG), Mebp, inf_SCR01(0))
+
+#undef  cvyas_rr
+#define cvyas_rr(XD, XS)                                                    \
+        VEX(RXB(XD), RXB(XS),    0x00, 1, 1, 2) EMITB(0x13)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+#undef  cuyas_rr
+#define cuyas_rr(XD, XS)                                                    \
+        movcx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        cvhas_ld(W(XD), Mebp, inf_SCR01(0x10))
+
+#define cvhcs_st(XS, MD, DD) /* not portable, do not use outside */         \
+    ADR VEX(RXB(XS), RXB(MD),    0x00, 1, 1, 3) EMITB(0x1D)                 \
+        MRM(REG(XS), MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMITB(0x04))
+
+#define cvhas_ld(XD, MS, DS) /* not portable, do not use outside */         \
+    ADR VEX(RXB(XD), RXB(MS),    0x00, 1, 1, 2) EMITB(0x13)                 \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define inhcx_ld(XG, MS, DS) /* not portable, do not use outside */         \
+    ADR VEX(RXB(XG), RXB(MS), REN(XG), 1, 1, 3) EMITB(0x18)                 \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMITB(0x01))
+
+#endif /* RT_256X1 >= 2, AVX2 */
+
 /* and (G = G & S), (D = S & T) if (#D != #S) */
 
 #define andcx_rr(XG, XS)                                                    \
@@ -290,9 +412,40 @@
         MRM(REG(XD), MOD(MT), REG(MT))                                      \
         AUX(SIB(MT), CMD(DT), EMPTY)
 
-        /* adp, adh are defined in rtbase.h (first 15-regs only)
+        /* adp is defined in rtbase.h (first 15-regs only)
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+/* horizontal add/min/max swap 128-bit halves of the source (prmcx_ld)
+ * and combine, then finish within 128-bit lanes: add with pairwise hadcs,
+ * min/max rotating elements by one (shfcx) against a single spill,
+ * source is passed through memory in case XD is the same register as XS */
+
+#define prmcx_ld(XD, MS, DS, IT) /* not portable, do not use outside */     \
+    ADR VEX(RXB(XD), RXB(MS), REN(XD), 1, 1, 3) EMITB(0x06)                 \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMITB(VAL(IT)))
+
+#define shfcx_rr(XD, XS, IT) /* not portable, do not use outside */         \
+        VEX(RXB(XD), RXB(XS),    0x00, 1, 1, 3) EMITB(0x04)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(VAL(IT)))
+
+#define hadcs_rr(XG, XS)     /* not portable, do not use outside */         \
+        VEX(RXB(XG), RXB(XS), REN(XG), 1, 3, 1) EMITB(0x7C)                 \
+        MRM(REG(XG), MOD(XS), REG(XS))
+
+#undef  adhcs_rr
+#define adhcs_rr(XD, XS) /* horizontal reductive add, first 15-regs only */ \
+        movcx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        adhcs_ld(W(XD), Mebp, inf_SCR01(0))
+
+#undef  adhcs_ld
+#define adhcs_ld(XD, MS, DS)                                                \
+        prmcx_ld(W(XD), W(MS), W(DS), IB(0x23))                             \
+        addcs_ld(W(XD), W(MS), W(DS))                                       \
+        hadcs_rr(W(XD), W(XD))                                              \
+        hadcs_rr(W(XD), W(XD))
+
 /* sub (G = G - S), (D = S - T) if (#D != #S) */
 
 #define subcs_rr(XG, XS)                                                    \
@@ -422,16 +575,16 @@
         AUX(EMPTY,   EMPTY,   CMD(IS))
 
 
-#define cvycs_rr(XD, XS)     /* not portable, do not use outside */         \
+#define cvwcs_rr(XD, XS)     /* not portable, do not use outside */         \
         VEX(RXB(XD), RXB(XS),    0x00, 1, 0, 1) EMITB(0x5A)                 \
         MRM(REG(XD), MOD(XS), REG(XS))
 
-#define cvycs_ld(XD, MS, DS) /* not portable, do not use outside */         \
+#define cvwcs_ld(XD, MS, DS) /* not portable, do not use outside */         \
     ADR VEX(RXB(XD), RXB(MS),    0x00, 1, 0, 1) EMITB(0x5A)                 \
         MRM(REG(XD), MOD(MS), REG(MS))                                      \
         AUX(SIB(MS), CMD(DS), EMPTY)
 
-#define cvxds_rr(XD, XS)     /* not portable, do not use outside */         \
+#define cvsds_rr(XD, XS)     /* not portable, do not use outside */         \
         VEX(RXB(XD), RXB(XS),    0x00, 1, 1, 1) EMITB(0x5A)                 \
         MRM(REG(XD), MOD(XS), REG(XS))
 
@@ -462,21 +615,21 @@
 #define fmacs_rr(XG, XS, XT)                                                \
         movcx_st(W(XS), Mebp, inf_SCR01(0))                                 \
         movcx_st(W(XG), Mebp, inf_SCR02(0))                                 \
-        cvycs_rr(W(XG), W(XS))                     /* 1st-pass -> */        \
-        cvycs_rr(W(XS), W(XT))                                              \
+        cvwcs_rr(W(XG), W(XS))                     /* 1st-pass -> */        \
+        cvwcs_rr(W(XS), W(XT))                                              \
         mulds_rr(W(XS), W(XG))                                              \
-        cvycs_ld(W(XG), Mebp, inf_SCR02(0x00))                              \
+        cvwcs_ld(W(XG), Mebp, inf_SCR02(0x00))                              \
         addds_rr(W(XG), W(XS))                                              \
-        cvxds_rr(W(XG), W(XG))                                              \
+        cvsds_rr(W(XG), W(XG))                                              \
         movix_st(W(XG), Mebp, inf_SCR02(0x00))                              \
         movcx_ld(W(XS), Mebp, inf_SCR01(0))                                 \
         prmcx_rr(W(XT), W(XT), IB(1))              /* 1st-pass <- */        \
-        cvycs_ld(W(XG), Mebp, inf_SCR01(0x10))     /* 2nd-pass -> */        \
-        cvycs_rr(W(XS), W(XT))                                              \
+        cvwcs_ld(W(XG), Mebp, inf_SCR01(0x10))     /* 2nd-pass -> */        \
+        cvwcs_rr(W(XS), W(XT))                                              \
         mulds_rr(W(XS), W(XG))                                              \
-        cvycs_ld(W(XG), Mebp, inf_SCR02(0x10))                              \
+        cvwcs_ld(W(XG), Mebp, inf_SCR02(0x10))                              \
         addds_rr(W(XG), W(XS))                                              \
-        cvxds_rr(W(XG), W(XG))                                              \
+        cvsds_rr(W(XG), W(XG))                                              \
         movix_st(W(XG), Mebp, inf_SCR02(0x10))                              \
         prmcx_rr(W(XT), W(XT), IB(1))              /* 2nd-pass <- */        \
         movcx_ld(W(XG), Mebp, inf_SCR02(0))                                 \
@@ -485,20 +638,20 @@
 #define fmacs_ld(XG, XS, MT, DT)                                            \
         movcx_st(W(XS), Mebp, inf_SCR01(0))                                 \
         movcx_st(W(XG), Mebp, inf_SCR02(0))                                 \
-        cvycs_rr(W(XG), W(XS))                     /* 1st-pass -> */        \
-        cvycs_ld(W(XS), W(MT), W(DT))                                       \
+        cvwcs_rr(W(XG), W(XS))                     /* 1st-pass -> */        \
+        cvwcs_ld(W(XS), W(MT), W(DT))                                       \
         mulds_rr(W(XS), W(XG))                                              \
-        cvycs_ld(W(XG), Mebp, inf_SCR02(0x00))                              \
+        cvwcs_ld(W(XG), Mebp, inf_SCR02(0x00))                              \
         addds_rr(W(XG), W(XS))                                              \
-        cvxds_rr(W(XG), W(XG))                                              \
+        cvsds_rr(W(XG), W(XG))                                              \
         movix_st(W(XG), Mebp, inf_SCR02(0x00))                              \
         addzm_ri(W(MT), IC(0x10))                  /* 1st-pass <- */        \
-        cvycs_ld(W(XG), Mebp, inf_SCR01(0x10))     /* 2nd-pass -> */        \
-        cvycs_ld(W(XS), W(MT), W(DT))                                       \
+        cvwcs_ld(W(XG), Mebp, inf_SCR01(0x10))     /* 2nd-pass -> */        \
+        cvwcs_ld(W(XS), W(MT), W(DT))                                       \
         mulds_rr(W(XS), W(XG))                                              \
-        cvycs_ld(W(XG), Mebp, inf_SCR02(0x10))                              \
+        cvwcs_ld(W(XG), Mebp, inf_SCR02(0x10))                              \
         addds_rr(W(XG), W(XS))                                              \
-        cvxds_rr(W(XG), W(XG))                                              \
+        cvsds_rr(W(XG), W(XG))                                              \
         movix_st(W(XG), Mebp, inf_SCR02(0x10))                              \
         subzm_ri(W(MT), IC(0x10))                  /* 2nd-pass <- */        \
         movcx_ld(W(XG), Mebp, inf_SCR02(0))                                 \
@@ -533,21 +686,21 @@
 #define fmscs_rr(XG, XS, XT)                                                \
         movcx_st(W(XS), Mebp, inf_SCR01(0))                                 \
         movcx_st(W(XG), Mebp, inf_SCR02(0))                                 \
-        cvycs_rr(W(XG), W(XS))                     /* 1st-pass -> */        \
-        cvycs_rr(W(XS), W(XT))                                              \
+        cvwcs_rr(W(XG), W(XS))                     /* 1st-pass -> */        \
+        cvwcs_rr(W(XS), W(XT))                                              \
         mulds_rr(W(XS), W(XG))                                              \
-        cvycs_ld(W(XG), Mebp, inf_SCR02(0x00))                              \
+        cvwcs_ld(W(XG), Mebp, inf_SCR02(0x00))                              \
         subds_rr(W(XG), W(XS))                                              \
-        cvxds_rr(W(XG), W(XG))                                              \
+        cvsds_rr(W(XG), W(XG))                                              \
         movix_st(W(XG), Mebp, inf_SCR02(0x00))                              \
         movcx_ld(W(XS), Mebp, inf_SCR01(0))                                 \
         prmcx_rr(W(XT), W(XT), IB(1))              /* 1st-pass <- */        \
-        cvycs_ld(W(XG), Mebp, inf_SCR01(0x10))     /* 2nd-pass -> */        \
-        cvycs_rr(W(XS), W(XT))                                              \
+        cvwcs_ld(W(XG), Mebp, inf_SCR01(0x10))     /* 2nd-pass -> */        \
+        cvwcs_rr(W(XS), W(XT))                                              \
         mulds_rr(W(XS), W(XG))                                              \
-        cvycs_ld(W(XG), Mebp, inf_SCR02(0x10))                              \
+        cvwcs_ld(W(XG), Mebp, inf_SCR02(0x10))                              \
         subds_rr(W(XG), W(XS))                                              \
-        cvxds_rr(W(XG), W(XG))                                              \
+        cvsds_rr(W(XG), W(XG))                                              \
         movix_st(W(XG), Mebp, inf_SCR02(0x10))                              \
         prmcx_rr(W(XT), W(XT), IB(1))              /* 2nd-pass <- */        \
         movcx_ld(W(XG), Mebp, inf_SCR02(0))                                 \
@@ -556,20 +709,20 @@
 #define fmscs_ld(XG, XS, MT, DT)                                            \
         movcx_st(W(XS), Mebp, inf_SCR01(0))                                 \
         movcx_st(W(XG), Mebp, inf_SCR02(0))                                 \
-        cvycs_rr(W(XG), W(XS))                     /* 1st-pass -> */        \
-        cvycs_ld(W(XS), W(MT), W(DT))                                       \
+        cvwcs_rr(W(XG), W(XS))                     /* 1st-pass -> */        \
+        cvwcs_ld(W(XS), W(MT), W(DT))                                       \
         mulds_rr(W(XS), W(XG))                                              \
-        cvycs_ld(W(XG), Mebp, inf_SCR02(0x00))                              \
+        cvwcs_ld(W(XG), Mebp, inf_SCR02(0x00))                              \
         subds_rr(W(XG), W(XS))                                              \
-        cvxds_rr(W(XG), W(XG))                                              \
+        cvsds_rr(W(XG), W(XG))                                              \
         movix_st(W(XG), Mebp, inf_SCR02(0x00))                              \
         addzm_ri(W(MT), IC(0x10))                  /* 1st-pass <- */        \
-        cvycs_ld(W(XG), Mebp, inf_SCR01(0x10))     /* 2nd-pass -> */        \
-        cvycs_ld(W(XS), W(MT), W(DT))                                       \
+        cvwcs_ld(W(XG), Mebp, inf_SCR01(0x10))     /* 2nd-pass -> */        \
+        cvwcs_ld(W(XS), W(MT), W(DT))                                       \
         mulds_rr(W(XS), W(XG))                                              \
-        cvycs_ld(W(XG), Mebp, inf_SCR02(0x10))                              \
+        cvwcs_ld(W(XG), Mebp, inf_SCR02(0x10))                              \
         subds_rr(W(XG), W(XS))                                              \
-        cvxds_rr(W(XG), W(XG))                                              \
+        cvsds_rr(W(XG), W(XG))                                              \
         movix_st(W(XG), Mebp, inf_SCR02(0x10))                              \
         subzm_ri(W(MT), IC(0x10))                  /* 2nd-pass <- */        \
         movcx_ld(W(XG), Mebp, inf_SCR02(0))                                 \
@@ -634,9 +787,26 @@
         MRM(REG(XD), MOD(MT), REG(MT))                                      \
         AUX(SIB(MT), CMD(DT), EMPTY)
 
-        /* mnp, mnh are defined in rtbase.h
+        /* mnp is defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mnhcs_rr
+#define mnhcs_rr(XD, XS) /* horizontal reductive min */                     \
+        movcx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        mnhcs_ld(W(XD), Mebp, inf_SCR01(0))
+
+#undef  mnhcs_ld
+#define mnhcs_ld(XD, MS, DS)                                                \
+        prmcx_ld(W(XD), W(MS), W(DS), IB(0x23))                             \
+        mincs_ld(W(XD), W(MS), W(DS))                                       \
+        movcx_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        shfcx_rr(W(XD), W(XD), IB(0x39))                                    \
+        mincs_ld(W(XD), Mebp, inf_SCR02(0))                                 \
+        shfcx_rr(W(XD), W(XD), IB(0x39))                                    \
+        mincs_ld(W(XD), Mebp, inf_SCR02(0))                                 \
+        shfcx_rr(W(XD), W(XD), IB(0x39))                                    \
+        mincs_ld(W(XD), Mebp, inf_SCR02(0))
+
 /* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #S) */
 
 #define maxcs_rr(XG, XS)                                                    \
@@ -654,9 +824,26 @@
         MRM(REG(XD), MOD(MT), REG(MT))                                      \
         AUX(SIB(MT), CMD(DT), EMPTY)
 
-        /* mxp, mxh are defined in rtbase.h
+        /* mxp is defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mxhcs_rr
+#define mxhcs_rr(XD, XS) /* horizontal reductive max */                     \
+        movcx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        mxhcs_ld(W(XD), Mebp, inf_SCR01(0))
+
+#undef  mxhcs_ld
+#define mxhcs_ld(XD, MS, DS)                                                \
+        prmcx_ld(W(XD), W(MS), W(DS), IB(0x23))                             \
+        maxcs_ld(W(XD), W(MS), W(DS))                                       \
+        movcx_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        shfcx_rr(W(XD), W(XD), IB(0x39))                                    \
+        maxcs_ld(W(XD), Mebp, inf_SCR02(0))                                 \
+        shfcx_rr(W(XD), W(XD), IB(0x39))                                    \
+        maxcs_ld(W(XD), Mebp, inf_SCR02(0))                                 \
+        shfcx_rr(W(XD), W(XD), IB(0x39))                                    \
+        maxcs_ld(W(XD), Mebp, inf_SCR02(0))
+
 /* ceq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #S) */
 
 #define ceqcs_rr(XG, XS)                                                    \
@@ -1479,72 +1666,72 @@
 #undef  sregs_sa
 #define sregs_sa() /* save all SIMD regs, destroys Reax */                  \
         movxx_ld(Reax, Mebp, inf_REGS)                                      \
-        muvcx_st(Xmm0, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000001) muvcx_st(Xmm0, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_st(Xmm1, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000002) muvcx_st(Xmm1, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_st(Xmm2, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000004) muvcx_st(Xmm2, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_st(Xmm3, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000008) muvcx_st(Xmm3, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_st(Xmm4, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000010) muvcx_st(Xmm4, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_st(Xmm5, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000020) muvcx_st(Xmm5, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_st(Xmm6, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000040) muvcx_st(Xmm6, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_st(Xmm7, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000080) muvcx_st(Xmm7, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_st(Xmm8, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000100) muvcx_st(Xmm8, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_st(Xmm9, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000200) muvcx_st(Xmm9, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_st(XmmA, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000400) muvcx_st(XmmA, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_st(XmmB, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000800) muvcx_st(XmmB, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_st(XmmC, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00001000) muvcx_st(XmmC, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_st(XmmD, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00002000) muvcx_st(XmmD, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_st(XmmE, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00004000) muvcx_st(XmmE, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_st(XmmF, Oeax, PLAIN)
+        ASM_IFS(0x00008000) muvcx_st(XmmF, Oeax, PLAIN) ASM_FI
 
 #undef  sregs_la
 #define sregs_la() /* load all SIMD regs, destroys Reax */                  \
         movxx_ld(Reax, Mebp, inf_REGS)                                      \
-        muvcx_ld(Xmm0, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000001) muvcx_ld(Xmm0, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_ld(Xmm1, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000002) muvcx_ld(Xmm1, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_ld(Xmm2, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000004) muvcx_ld(Xmm2, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_ld(Xmm3, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000008) muvcx_ld(Xmm3, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_ld(Xmm4, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000010) muvcx_ld(Xmm4, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_ld(Xmm5, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000020) muvcx_ld(Xmm5, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_ld(Xmm6, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000040) muvcx_ld(Xmm6, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_ld(Xmm7, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000080) muvcx_ld(Xmm7, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_ld(Xmm8, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000100) muvcx_ld(Xmm8, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_ld(Xmm9, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000200) muvcx_ld(Xmm9, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_ld(XmmA, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000400) muvcx_ld(XmmA, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_ld(XmmB, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000800) muvcx_ld(XmmB, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_ld(XmmC, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00001000) muvcx_ld(XmmC, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_ld(XmmD, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00002000) muvcx_ld(XmmD, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_ld(XmmE, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00004000) muvcx_ld(XmmE, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_ld(XmmF, Oeax, PLAIN)
+        ASM_IFS(0x00008000) muvcx_ld(XmmF, Oeax, PLAIN) ASM_FI
 
 #endif /* RT_256X1 */
 
@@ -151,6 +151,14 @@
         MRM(REG(XS), MOD(MD), REG(MD))                                      \
         AUX(SIB(MD), CMD(DD), EMPTY)
 
+/* stn (M = S) streams to aligned M bypassing caches (non-temporal) */
+
+#undef  stncx_st
+#define stncx_st(XS, MD, DD)                                                \
+    ADR EVX(RXB(XS), RXB(MD),    0x00, 1, 0, 1) EMITB(0x2B)                 \
+        MRM(REG(XS), MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMPTY)
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -985,65 +993,65 @@
 #undef  sregs_sa
 #define sregs_sa() /* save all SIMD regs, destroys Reax */                  \
         movxx_ld(Reax, Mebp, inf_REGS)                                      \
-        muvox_st(Xmm0, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000001) muvox_st(Xmm0, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(Xmm1, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000002) muvox_st(Xmm1, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(Xmm2, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000004) muvox_st(Xmm2, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(Xmm3, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000008) muvox_st(Xmm3, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(Xmm4, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000010) muvox_st(Xmm4, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(Xmm5, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000020) muvox_st(Xmm5, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(Xmm6, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000040) muvox_st(Xmm6, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(Xmm7, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000080) muvox_st(Xmm7, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(Xmm8, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000100) muvox_st(Xmm8, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(Xmm9, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000200) muvox_st(Xmm9, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(XmmA, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000400) muvox_st(XmmA, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(XmmB, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000800) muvox_st(XmmB, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(XmmC, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00001000) muvox_st(XmmC, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(XmmD, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00002000) muvox_st(XmmD, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(XmmE, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00004000) muvox_st(XmmE, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(XmmF, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00008000) muvox_st(XmmF, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(XmmG, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00010000) muvox_st(XmmG, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(XmmH, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00020000) muvox_st(XmmH, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(XmmI, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00040000) muvox_st(XmmI, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(XmmJ, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00080000) muvox_st(XmmJ, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(XmmK, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00100000) muvox_st(XmmK, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(XmmL, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00200000) muvox_st(XmmL, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(XmmM, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00400000) muvox_st(XmmM, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(XmmN, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00800000) muvox_st(XmmN, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(XmmO, Oeax, PLAIN)                                         \
+        ASM_IFS(0x01000000) muvox_st(XmmO, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(XmmP, Oeax, PLAIN)                                         \
+        ASM_IFS(0x02000000) muvox_st(XmmP, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(XmmQ, Oeax, PLAIN)                                         \
+        ASM_IFS(0x04000000) muvox_st(XmmQ, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(XmmR, Oeax, PLAIN)                                         \
+        ASM_IFS(0x08000000) muvox_st(XmmR, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(XmmS, Oeax, PLAIN)                                         \
+        ASM_IFS(0x10000000) muvox_st(XmmS, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(XmmT, Oeax, PLAIN)                                         \
+        ASM_IFS(0x20000000) muvox_st(XmmT, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
         VEX(0,             0,    0x00, 0, 0, 1) EMITB(0x91)                 \
         MRM(0x01,       0x00,    0x00)                                      \
@@ -1066,65 +1074,65 @@
 #undef  sregs_la
 #define sregs_la() /* load all SIMD regs, destroys Reax */                  \
         movxx_ld(Reax, Mebp, inf_REGS)                                      \
-        muvox_ld(Xmm0, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000001) muvox_ld(Xmm0, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(Xmm1, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000002) muvox_ld(Xmm1, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(Xmm2, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000004) muvox_ld(Xmm2, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(Xmm3, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000008) muvox_ld(Xmm3, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(Xmm4, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000010) muvox_ld(Xmm4, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(Xmm5, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000020) muvox_ld(Xmm5, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(Xmm6, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000040) muvox_ld(Xmm6, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(Xmm7, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000080) muvox_ld(Xmm7, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(Xmm8, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000100) muvox_ld(Xmm8, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(Xmm9, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000200) muvox_ld(Xmm9, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(XmmA, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000400) muvox_ld(XmmA, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(XmmB, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000800) muvox_ld(XmmB, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(XmmC, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00001000) muvox_ld(XmmC, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(XmmD, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00002000) muvox_ld(XmmD, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(XmmE, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00004000) muvox_ld(XmmE, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(XmmF, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00008000) muvox_ld(XmmF, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(XmmG, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00010000) muvox_ld(XmmG, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(XmmH, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00020000) muvox_ld(XmmH, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(XmmI, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00040000) muvox_ld(XmmI, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(XmmJ, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00080000) muvox_ld(XmmJ, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(XmmK, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00100000) muvox_ld(XmmK, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(XmmL, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00200000) muvox_ld(XmmL, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(XmmM, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00400000) muvox_ld(XmmM, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(XmmN, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00800000) muvox_ld(XmmN, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(XmmO, Oeax, PLAIN)                                         \
+        ASM_IFS(0x01000000) muvox_ld(XmmO, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(XmmP, Oeax, PLAIN)                                         \
+        ASM_IFS(0x02000000) muvox_ld(XmmP, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(XmmQ, Oeax, PLAIN)                                         \
+        ASM_IFS(0x04000000) muvox_ld(XmmQ, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(XmmR, Oeax, PLAIN)                                         \
+        ASM_IFS(0x08000000) muvox_ld(XmmR, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(XmmS, Oeax, PLAIN)                                         \
+        ASM_IFS(0x10000000) muvox_ld(XmmS, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(XmmT, Oeax, PLAIN)                                         \
+        ASM_IFS(0x20000000) muvox_ld(XmmT, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
         VEX(0,             0,    0x00, 0, 0, 1) EMITB(0x90)                 \
         MRM(0x01,       0x00,    0x00)                                      \
@@ -159,6 +159,17 @@
         MRM(REG(XS),    0x02, REG(MD))                                      \
         AUX(SIB(MD), EMITW(VXL(DD)), EMPTY)
 
+/* stn (M = S) streams to aligned M bypassing caches (non-temporal) */
+
+#undef  stnox_st
+#define stnox_st(XS, MD, DD)                                                \
+    ADR VEX(0,       RXB(MD),    0x00, 1, 0, 1) EMITB(0x2B)                 \
+        MRM(REG(XS),    0x02, REG(MD))                                      \
+        AUX(SIB(MD), EMITW(VAL(DD)), EMPTY)                                 \
+    ADR VEX(1,       RXB(MD),    0x00, 1, 0, 1) EMITB(0x2B)                 \
+        MRM(REG(XS),    0x02, REG(MD))                                      \
+        AUX(SIB(MD), EMITW(VXL(DD)), EMPTY)
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -499,13 +510,13 @@
         MRM(REG(XS), MOD(MD), REG(MD))                                      \
         AUX(SIB(MD), EMITW(VXL(DD)), EMPTY)
 
-#define cvyos_rr(XD, XS)     /* not portable, do not use outside */         \
+#define cvwos_rr(XD, XS)     /* not portable, do not use outside */         \
         VEX(0,             0,    0x00, 1, 0, 1) EMITB(0x5A)                 \
         MRM(REG(XD), MOD(XS), REG(XS))                                      \
         VEX(1,             1,    0x00, 1, 0, 1) EMITB(0x5A)                 \
         MRM(REG(XD), MOD(XS), REG(XS))
 
-#define cvyos_ld(XD, MS, DS) /* not portable, do not use outside */         \
+#define cvwos_ld(XD, MS, DS) /* not portable, do not use outside */         \
     ADR VEX(0,       RXB(MS),    0x00, 1, 0, 1) EMITB(0x5A)                 \
         MRM(REG(XD),    0x02, REG(MS))                                      \
         AUX(SIB(MS), EMITW(VAL(DS)), EMPTY)                                 \
@@ -513,7 +524,7 @@
         MRM(REG(XD),    0x02, REG(MS))                                      \
         AUX(SIB(MS), EMITW(VXL(DS)), EMPTY)
 
-#define cvxqs_rr(XD, XS)     /* not portable, do not use outside */         \
+#define cvsqs_rr(XD, XS)     /* not portable, do not use outside */         \
         VEX(0,             0,    0x00, 1, 1, 1) EMITB(0x5A)                 \
         MRM(REG(XD), MOD(XS), REG(XS))                                      \
         VEX(1,             1,    0x00, 1, 1, 1) EMITB(0x5A)                 \
@@ -546,21 +557,21 @@
 #define fmaos_rr(XG, XS, XT)                                                \
         movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
         movox_st(W(XG), Mebp, inf_SCR02(0))                                 \
-        cvyos_rr(W(XG), W(XS))                     /* 1st-pass -> */        \
-        cvyos_rr(W(XS), W(XT))                                              \
+        cvwos_rr(W(XG), W(XS))                     /* 1st-pass -> */        \
+        cvwos_rr(W(XS), W(XT))                                              \
         mulqs_rr(W(XS), W(XG))                                              \
-        cvyos_ld(W(XG), Mebp, inf_SCR02(0x00))                              \
+        cvwos_ld(W(XG), Mebp, inf_SCR02(0x00))                              \
         addqs_rr(W(XG), W(XS))                                              \
-        cvxqs_rr(W(XG), W(XG))                                              \
+        cvsqs_rr(W(XG), W(XG))                                              \
         mivox_st(W(XG), Mebp, inf_SCR02(0x00))                              \
         movox_ld(W(XS), Mebp, inf_SCR01(0))                                 \
         prmox_rr(W(XT), W(XT), IB(1))              /* 1st-pass <- */        \
-        cvyos_ld(W(XG), Mebp, inf_SCR01(0x10))     /* 2nd-pass -> */        \
-        cvyos_rr(W(XS), W(XT))                                              \
+        cvwos_ld(W(XG), Mebp, inf_SCR01(0x10))     /* 2nd-pass -> */        \
+        cvwos_rr(W(XS), W(XT))                                              \
         mulqs_rr(W(XS), W(XG))                                              \
-        cvyos_ld(W(XG), Mebp, inf_SCR02(0x10))                              \
+        cvwos_ld(W(XG), Mebp, inf_SCR02(0x10))                              \
         addqs_rr(W(XG), W(XS))                                              \
-        cvxqs_rr(W(XG), W(XG))                                              \
+        cvsqs_rr(W(XG), W(XG))                                              \
         mivox_st(W(XG), Mebp, inf_SCR02(0x10))                              \
         prmox_rr(W(XT), W(XT), IB(1))              /* 2nd-pass <- */        \
         movox_ld(W(XG), Mebp, inf_SCR02(0))                                 \
@@ -569,20 +580,20 @@
 #define fmaos_ld(XG, XS, MT, DT)                                            \
         movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
         movox_st(W(XG), Mebp, inf_SCR02(0))                                 \
-        cvyos_rr(W(XG), W(XS))                     /* 1st-pass -> */        \
-        cvyos_ld(W(XS), W(MT), W(DT))                                       \
+        cvwos_rr(W(XG), W(XS))                     /* 1st-pass -> */        \
+        cvwos_ld(W(XS), W(MT), W(DT))                                       \
         mulqs_rr(W(XS), W(XG))                                              \
-        cvyos_ld(W(XG), Mebp, inf_SCR02(0x00))                              \
+        cvwos_ld(W(XG), Mebp, inf_SCR02(0x00))                              \
         addqs_rr(W(XG), W(XS))                                              \
-        cvxqs_rr(W(XG), W(XG))                                              \
+        cvsqs_rr(W(XG), W(XG))                                              \
         mivox_st(W(XG), Mebp, inf_SCR02(0x00))                              \
         addzm_ri(W(MT), IC(0x10))                  /* 1st-pass <- */        \
-        cvyos_ld(W(XG), Mebp, inf_SCR01(0x10))     /* 2nd-pass -> */        \
-        cvyos_ld(W(XS), W(MT), W(DT))                                       \
+        cvwos_ld(W(XG), Mebp, inf_SCR01(0x10))     /* 2nd-pass -> */        \
+        cvwos_ld(W(XS), W(MT), W(DT))                                       \
         mulqs_rr(W(XS), W(XG))                                              \
-        cvyos_ld(W(XG), Mebp, inf_SCR02(0x10))                              \
+        cvwos_ld(W(XG), Mebp, inf_SCR02(0x10))                              \
         addqs_rr(W(XG), W(XS))                                              \
-        cvxqs_rr(W(XG), W(XG))                                              \
+        cvsqs_rr(W(XG), W(XG))                                              \
         mivox_st(W(XG), Mebp, inf_SCR02(0x10))                              \
         subzm_ri(W(MT), IC(0x10))                  /* 2nd-pass <- */        \
         movox_ld(W(XG), Mebp, inf_SCR02(0))                                 \
@@ -617,21 +628,21 @@
 #define fmsos_rr(XG, XS, XT)                                                \
         movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
         movox_st(W(XG), Mebp, inf_SCR02(0))                                 \
-        cvyos_rr(W(XG), W(XS))                     /* 1st-pass -> */        \
-        cvyos_rr(W(XS), W(XT))                                              \
+        cvwos_rr(W(XG), W(XS))                     /* 1st-pass -> */        \
+        cvwos_rr(W(XS), W(XT))                                              \
         mulqs_rr(W(XS), W(XG))                                              \
-        cvyos_ld(W(XG), Mebp, inf_SCR02(0x00))                              \
+        cvwos_ld(W(XG), Mebp, inf_SCR02(0x00))                              \
         subqs_rr(W(XG), W(XS))                                              \
-        cvxqs_rr(W(XG), W(XG))                                              \
+        cvsqs_rr(W(XG), W(XG))                                              \
         mivox_st(W(XG), Mebp, inf_SCR02(0x00))                              \
         movox_ld(W(XS), Mebp, inf_SCR01(0))                                 \
         prmox_rr(W(XT), W(XT), IB(1))              /* 1st-pass <- */        \
-        cvyos_ld(W(XG), Mebp, inf_SCR01(0x10))     /* 2nd-pass -> */        \
-        cvyos_rr(W(XS), W(XT))                                              \
+        cvwos_ld(W(XG), Mebp, inf_SCR01(0x10))     /* 2nd-pass -> */        \
+        cvwos_rr(W(XS), W(XT))                                              \
         mulqs_rr(W(XS), W(XG))                                              \
-        cvyos_ld(W(XG), Mebp, inf_SCR02(0x10))                              \
+        cvwos_ld(W(XG), Mebp, inf_SCR02(0x10))                              \
         subqs_rr(W(XG), W(XS))                                              \
-        cvxqs_rr(W(XG), W(XG))                                              \
+        cvsqs_rr(W(XG), W(XG))                                              \
         mivox_st(W(XG), Mebp, inf_SCR02(0x10))                              \
         prmox_rr(W(XT), W(XT), IB(1))              /* 2nd-pass <- */        \
         movox_ld(W(XG), Mebp, inf_SCR02(0))                                 \
@@ -640,20 +651,20 @@
 #define fmsos_ld(XG, XS, MT, DT)                                            \
         movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
         movox_st(W(XG), Mebp, inf_SCR02(0))                                 \
-        cvyos_rr(W(XG), W(XS))                     /* 1st-pass -> */        \
-        cvyos_ld(W(XS), W(MT), W(DT))                                       \
+        cvwos_rr(W(XG), W(XS))                     /* 1st-pass -> */        \
+        cvwos_ld(W(XS), W(MT), W(DT))                                       \
         mulqs_rr(W(XS), W(XG))                                              \
-        cvyos_ld(W(XG), Mebp, inf_SCR02(0x00))                              \
+        cvwos_ld(W(XG), Mebp, inf_SCR02(0x00))                              \
         subqs_rr(W(XG), W(XS))                                              \
-        cvxqs_rr(W(XG), W(XG))                                              \
+        cvsqs_rr(W(XG), W(XG))                                              \
         mivox_st(W(XG), Mebp, inf_SCR02(0x00))                              \
         addzm_ri(W(MT), IC(0x10))                  /* 1st-pass <- */        \
-        cvyos_ld(W(XG), Mebp, inf_SCR01(0x10))     /* 2nd-pass -> */        \
-        cvyos_ld(W(XS), W(MT), W(DT))                                       \
+        cvwos_ld(W(XG), Mebp, inf_SCR01(0x10))     /* 2nd-pass -> */        \
+        cvwos_ld(W(XS), W(MT), W(DT))                                       \
         mulqs_rr(W(XS), W(XG))                                              \
-        cvyos_ld(W(XG), Mebp, inf_SCR02(0x10))                              \
+        cvwos_ld(W(XG), Mebp, inf_SCR02(0x10))                              \
         subqs_rr(W(XG), W(XS))                                              \
-        cvxqs_rr(W(XG), W(XG))                                              \
+        cvsqs_rr(W(XG), W(XG))                                              \
         mivox_st(W(XG), Mebp, inf_SCR02(0x10))                              \
         subzm_ri(W(MT), IC(0x10))                  /* 2nd-pass <- */        \
         movox_ld(W(XG), Mebp, inf_SCR02(0))                                 \
@@ -1864,40 +1875,40 @@
 #undef  sregs_sa
 #define sregs_sa() /* save all SIMD regs, destroys Reax */                  \
         movxx_ld(Reax, Mebp, inf_REGS)                                      \
-        movox_st(Xmm0, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFFFF01) movox_st(Xmm0, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(Xmm1, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFFFF02) movox_st(Xmm1, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(Xmm2, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFFFF04) movox_st(Xmm2, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(Xmm3, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFFFF08) movox_st(Xmm3, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(Xmm4, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFFFF10) movox_st(Xmm4, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(Xmm5, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFFFF20) movox_st(Xmm5, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(Xmm6, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFFFF40) movox_st(Xmm6, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(Xmm7, Oeax, PLAIN)
+        ASM_IFS(0xFFFFFF80) movox_st(Xmm7, Oeax, PLAIN) ASM_FI
 
 #undef  sregs_la
 #define sregs_la() /* load all SIMD regs, destroys Reax */                  \
         movxx_ld(Reax, Mebp, inf_REGS)                                      \
-        movox_ld(Xmm0, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFFFF01) movox_ld(Xmm0, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(Xmm1, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFFFF02) movox_ld(Xmm1, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(Xmm2, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFFFF04) movox_ld(Xmm2, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(Xmm3, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFFFF08) movox_ld(Xmm3, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(Xmm4, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFFFF10) movox_ld(Xmm4, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(Xmm5, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFFFF20) movox_ld(Xmm5, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(Xmm6, Oeax, PLAIN)                                         \
+        ASM_IFS(0xFFFFFF40) movox_ld(Xmm6, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(Xmm7, Oeax, PLAIN)
+        ASM_IFS(0xFFFFFF80) movox_ld(Xmm7, Oeax, PLAIN) ASM_FI
 
 #endif /* RT_256X2 */
 
@@ -122,6 +122,10 @@
 #undef  K
 #define K 2
 
+/* registers    REG,  MOD,  SIB */
+
+#define TmmM    0x1F, 0x03, EMPTY  /* zmm31, temp-reg for horizontal ops */
+
 /******************************************************************************/
 /********************************   EXTERNAL   ********************************/
 /******************************************************************************/
@@ -154,6 +158,14 @@
         MRM(REG(XS), MOD(MD), REG(MD))                                      \
         AUX(SIB(MD), CMD(DD), EMPTY)
 
+/* stn (M = S) streams to aligned M bypassing caches (non-temporal) */
+
+#undef  stnox_st
+#define stnox_st(XS, MD, DD)                                                \
+    ADR EVX(RXB(XS), RXB(MD),    0x00, K, 0, 1) EMITB(0x2B)                 \
+        MRM(REG(XS), MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMPTY)
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -174,6 +186,127 @@
         MRM(REG(XS), MOD(MG), REG(MG))                                      \
         AUX(SIB(MG), CMD(DG), EMPTY)
 
+/* gth (D = [M + S]), sct ([M + T] = S) use TmmM for indices and k1 as mask,
+ * as TmmM is zmm31 both index bank-bits (X, V') are set in EVEX prefix */
+
+#undef  gthox_ld
+#define gthox_ld(XD, XS, MT, DT) /* M: Oeax, M*** only */                   \
+        movox_rr(TmmM, W(XS))                                               \
+        VEX(0,             0,    0x00, 1, 0, 1) EMITB(0x46)                 \
+        MRM(0x01,       0x03,    0x00)                                      \
+    ADR EKX(RXB(XD), RXB(MT)|2,  0x10, K, 1, 2) EMITB(0x92)                 \
+        MRM(REG(XD), MOD(MT),    0x04)                                      \
+        AUX(EMITB(0xB8 | REG(MT)), CMD(DT), EMPTY)
+
+#undef  sctox_st
+#define sctox_st(XS, XT, MD, DD) /* M: Oeax, M*** only */                   \
+        movox_rr(TmmM, W(XT))                                               \
+        VEX(0,             0,    0x00, 1, 0, 1) EMITB(0x46)                 \
+        MRM(0x01,       0x03,    0x00)                                      \
+    ADR EKX(RXB(XS), RXB(MD)|2,  0x10, K, 1, 2) EMITB(0xA2)                 \
+        MRM(REG(XS), MOD(MD),    0x04)                                      \
+        AUX(EMITB(0xB8 | REG(MD)), CMD(DD), EMPTY)
+
+/* spl, rev shuffle 128-bit lanes (prmox) and elements within them (shfox),
+ * rot uses valignd, tbl uses vpermd on XT or TmmM, unl, unh are generic */
+
+#undef  splox_ri
+#define splox_ri(XD, XS, IS)                                                \
+        prmox_rr(W(XD), W(XS), IB(((VAL(IS) >> 2) & 3) * 0x55))             \
+        shfox_rr(W(XD), W(XD), IB((VAL(IS) & 3) * 0x55))
+
+#undef  revox_rr
+#define revox_rr(XD, XS)                                                    \
+        prmox_rr(W(XD), W(XS), IB(0x1B))                                    \
+        shfox_rr(W(XD), W(XD), IB(0x1B))
+
+#undef  rotox_ri
+#define rotox_ri(XD, XS, IS)                                                \
+        EVX(RXB(XD), RXB(XS), REN(XS), K, 1, 3) EMITB(0x03)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(VAL(IS) & 0x0F))
+
+#undef  tblox_rr
+#define tblox_rr(XD, XS, XT)                                                \
+        EVX(RXB(XD), RXB(XS), REN(XT), K, 1, 2) EMITB(0x36)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+#undef  tblox_ld
+#define tblox_ld(XD, XS, MT, DT)                                            \
+        movox_ld(TmmM, W(MT), W(DT))                                        \
+        tblox_rr(W(XD), W(XS), TmmM)
+
+/* cvx, cux, cvy, cuy use AVX-512F converts (rounding follows MXCSR),
+ * upper-half forms move 256-bit halves via TmmM (vinsertf64x4/vextract) */
+
+#undef  cvxos_rr
+#define cvxos_rr(XD, XS)                                                    \
+        EVX(RXB(XS), RXB(XD),    0x00, K, 1, 3) EMITB(0x1D)                 \
+        MRM(REG(XS), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x04))
+
+#undef  cuxos_rr
+#define cuxos_rr(XG, XS)                                                    \
+        cvxos_rr(TmmM, W(XS))                                               \
+        inhox_rr(W(XG), TmmM)
+
+#undef  cvyms_rr
+#define cvyms_rr(XD, XS)                                                    \
+        EVX(RXB(XD), RXB(XS),    0x00, K, 1, 2) EMITB(0x13)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+#undef  cuyms_rr
+#define cuyms_rr(XD, XS)                                                    \
+        exhox_rr(TmmM, W(XS))                                               \
+        cvyms_rr(W(XD), TmmM)
+
+#define inhox_rr(XG, XS) /* not portable, do not use outside */             \
+        EVW(RXB(XG), RXB(XS), REN(XG), K, 1, 3) EMITB(0x1A)                 \
+        MRM(REG(XG), MOD(XS), REG(XS))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x01))
+
+#define exhox_rr(XD, XS) /* not portable, do not use outside */             \
+        EVW(RXB(XS), RXB(XD),    0x00, K, 1, 3) EMITB(0x1B)                 \
+        MRM(REG(XS), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x01))
+
+/* mtl (D = first RS elements from M), see rtbase.h for notes, k1 is set
+ * from the count clamped to lane-count via cmova and BMI2 bzhi (mk1ox) */
+
+#undef  mtlox_ld
+#define mtlox_ld(XD, RS, MT, DT)                                            \
+        movwx_st(W(RS), Mebp, inf_SCR02(0))                                 \
+        mk1ox_ld(Mebp, inf_SCR02(0))                                        \
+    ADR EZX(RXB(XD), RXB(MT),    0x00, K, 0, 1) EMITB(0x10)                 \
+        MRM(REG(XD), MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMPTY)
+
+#undef  mtlox_st
+#define mtlox_st(XS, RT, MD, DD)                                            \
+        movwx_st(W(RT), Mebp, inf_SCR02(0))                                 \
+        mk1ox_ld(Mebp, inf_SCR02(0))                                        \
+    ADR EKX(RXB(XS), RXB(MD),    0x00, K, 0, 1) EMITB(0x11)                 \
+        MRM(REG(XS), MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMPTY)
+
+#define mk1ox_ld(MS, DS) /* not portable, do not use outside */             \
+        stack_st(Recx)                                                      \
+        stack_st(Reax)                                                      \
+        movwx_ri(Reax, IB(16))                                              \
+        movwx_ri(Recx, IV(0xFFFFFFFF))                                      \
+    ADR REX(0,       RXB(MS)) EMITB(0x3B)                                   \
+        MRM(0x00,    MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)                                        \
+    ADR REX(0,       RXB(MS)) EMITB(0x0F) EMITB(0x47)                       \
+        MRM(0x00,    MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)                                        \
+        VEX(0,             0,    0x00, 0, 0, 2) EMITB(0xF5)                 \
+        MRM(0x00,       0x03,    0x01)                                      \
+        VEX(0,             0,    0x00, 0, 0, 1) EMITB(0x92)                 \
+        MRM(0x01,       0x03,    0x00)                                      \
+        stack_ld(Reax)                                                      \
+        stack_ld(Recx)
+
 #define ck1ox_rm(XS, MT, DT) /* not portable, do not use outside */         \
     ADR EVX(0,       RXB(MT), REN(XS), K, 1, 1) EMITB(0x76)                 \
         MRM(0x01,    MOD(MT), REG(MT))                                      \
@@ -392,9 +525,39 @@
         MRM(REG(XD), MOD(MT), REG(MT))                                      \
         AUX(SIB(MT), CMD(DT), EMPTY)
 
-        /* adp, adh are defined in rtbase.h (first 15-regs only)
+        /* adp is defined in rtbase.h (first 15-regs only)
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+/* horizontal add/min/max combine the source with its 128-bit lanes (prmox)
+ * and then with its elements within 128-bit lanes (shfox) swapped in pairs,
+ * zmm31 is not exposed to apps on this target and serves as TmmM */
+
+#define prmox_rr(XD, XS, IT) /* not portable, do not use outside */         \
+        EVX(RXB(XD), RXB(XS), REN(XS), K, 1, 3) EMITB(0x23)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(VAL(IT)))
+
+#define shfox_rr(XD, XS, IT) /* not portable, do not use outside */         \
+        EVX(RXB(XD), RXB(XS),    0x00, K, 1, 3) EMITB(0x04)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(VAL(IT)))
+
+#undef  adhos_rr
+#define adhos_rr(XD, XS) /* horizontal reductive add, first 15-regs only */ \
+        prmox_rr(TmmM,  W(XS), IB(0x4E))                                    \
+        addos3rr(W(XD), W(XS), TmmM)                                        \
+        prmox_rr(TmmM,  W(XD), IB(0xB1))                                    \
+        addos_rr(W(XD), TmmM)                                               \
+        shfox_rr(TmmM,  W(XD), IB(0x4E))                                    \
+        addos_rr(W(XD), TmmM)                                               \
+        shfox_rr(TmmM,  W(XD), IB(0xB1))                                    \
+        addos_rr(W(XD), TmmM)
+
+#undef  adhos_ld
+#define adhos_ld(XD, MS, DS)                                                \
+        movox_ld(W(XD), W(MS), W(DS))                                       \
+        adhos_rr(W(XD), W(XD))
+
 /* sub (G = G - S), (D = S - T) if (#D != #S) */
 
 #define subos_rr(XG, XS)                                                    \
@@ -575,9 +738,25 @@
         MRM(REG(XD), MOD(MT), REG(MT))                                      \
         AUX(SIB(MT), CMD(DT), EMPTY)
 
-        /* mnp, mnh are defined in rtbase.h
+        /* mnp is defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mnhos_rr
+#define mnhos_rr(XD, XS) /* horizontal reductive min */                     \
+        prmox_rr(TmmM,  W(XS), IB(0x4E))                                    \
+        minos3rr(W(XD), W(XS), TmmM)                                        \
+        prmox_rr(TmmM,  W(XD), IB(0xB1))                                    \
+        minos_rr(W(XD), TmmM)                                               \
+        shfox_rr(TmmM,  W(XD), IB(0x4E))                                    \
+        minos_rr(W(XD), TmmM)                                               \
+        shfox_rr(TmmM,  W(XD), IB(0xB1))                                    \
+        minos_rr(W(XD), TmmM)
+
+#undef  mnhos_ld
+#define mnhos_ld(XD, MS, DS)                                                \
+        movox_ld(W(XD), W(MS), W(DS))                                       \
+        mnhos_rr(W(XD), W(XD))
+
 /* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #S) */
 
 #define maxos_rr(XG, XS)                                                    \
@@ -595,9 +774,25 @@
         MRM(REG(XD), MOD(MT), REG(MT))                                      \
         AUX(SIB(MT), CMD(DT), EMPTY)
 
-        /* mxp, mxh are defined in rtbase.h
+        /* mxp is defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mxhos_rr
+#define mxhos_rr(XD, XS) /* horizontal reductive max */                     \
+        prmox_rr(TmmM,  W(XS), IB(0x4E))                                    \
+        maxos3rr(W(XD), W(XS), TmmM)                                        \
+        prmox_rr(TmmM,  W(XD), IB(0xB1))                                    \
+        maxos_rr(W(XD), TmmM)                                               \
+        shfox_rr(TmmM,  W(XD), IB(0x4E))                                    \
+        maxos_rr(W(XD), TmmM)                                               \
+        shfox_rr(TmmM,  W(XD), IB(0xB1))                                    \
+        maxos_rr(W(XD), TmmM)
+
+#undef  mxhos_ld
+#define mxhos_ld(XD, MS, DS)                                                \
+        movox_ld(W(XD), W(MS), W(DS))                                       \
+        mxhos_rr(W(XD), W(XD))
+
 /* ceq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #S) */
 
 #define ceqos_rr(XG, XS)                                                    \
@@ -1068,65 +1263,65 @@
 #undef  sregs_sa
 #define sregs_sa() /* save all SIMD regs, destroys Reax */                  \
         movxx_ld(Reax, Mebp, inf_REGS)                                      \
-        movox_st(Xmm0, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000001) movox_st(Xmm0, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(Xmm1, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000002) movox_st(Xmm1, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(Xmm2, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000004) movox_st(Xmm2, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(Xmm3, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000008) movox_st(Xmm3, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(Xmm4, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000010) movox_st(Xmm4, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(Xmm5, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000020) movox_st(Xmm5, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(Xmm6, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000040) movox_st(Xmm6, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(Xmm7, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000080) movox_st(Xmm7, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(Xmm8, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000100) movox_st(Xmm8, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(Xmm9, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000200) movox_st(Xmm9, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(XmmA, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000400) movox_st(XmmA, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(XmmB, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000800) movox_st(XmmB, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(XmmC, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00001000) movox_st(XmmC, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(XmmD, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00002000) movox_st(XmmD, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(XmmE, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00004000) movox_st(XmmE, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(XmmF, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00008000) movox_st(XmmF, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(XmmG, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00010000) movox_st(XmmG, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(XmmH, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00020000) movox_st(XmmH, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(XmmI, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00040000) movox_st(XmmI, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(XmmJ, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00080000) movox_st(XmmJ, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(XmmK, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00100000) movox_st(XmmK, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(XmmL, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00200000) movox_st(XmmL, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(XmmM, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00400000) movox_st(XmmM, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(XmmN, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00800000) movox_st(XmmN, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(XmmO, Oeax, PLAIN)                                         \
+        ASM_IFS(0x01000000) movox_st(XmmO, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(XmmP, Oeax, PLAIN)                                         \
+        ASM_IFS(0x02000000) movox_st(XmmP, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(XmmQ, Oeax, PLAIN)                                         \
+        ASM_IFS(0x04000000) movox_st(XmmQ, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(XmmR, Oeax, PLAIN)                                         \
+        ASM_IFS(0x08000000) movox_st(XmmR, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(XmmS, Oeax, PLAIN)                                         \
+        ASM_IFS(0x10000000) movox_st(XmmS, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_st(XmmT, Oeax, PLAIN)                                         \
+        ASM_IFS(0x20000000) movox_st(XmmT, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
         VEX(0,             0,    0x00, 0, 0, 1) EMITB(0x91)                 \
         MRM(0x01,       0x00,    0x00)                                      \
@@ -1149,65 +1344,65 @@
 #undef  sregs_la
 #define sregs_la() /* load all SIMD regs, destroys Reax */                  \
         movxx_ld(Reax, Mebp, inf_REGS)                                      \
-        movox_ld(Xmm0, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000001) movox_ld(Xmm0, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(Xmm1, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000002) movox_ld(Xmm1, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(Xmm2, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000004) movox_ld(Xmm2, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(Xmm3, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000008) movox_ld(Xmm3, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(Xmm4, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000010) movox_ld(Xmm4, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(Xmm5, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000020) movox_ld(Xmm5, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(Xmm6, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000040) movox_ld(Xmm6, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(Xmm7, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000080) movox_ld(Xmm7, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(Xmm8, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000100) movox_ld(Xmm8, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(Xmm9, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000200) movox_ld(Xmm9, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(XmmA, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000400) movox_ld(XmmA, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(XmmB, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000800) movox_ld(XmmB, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(XmmC, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00001000) movox_ld(XmmC, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(XmmD, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00002000) movox_ld(XmmD, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(XmmE, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00004000) movox_ld(XmmE, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(XmmF, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00008000) movox_ld(XmmF, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(XmmG, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00010000) movox_ld(XmmG, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(XmmH, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00020000) movox_ld(XmmH, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(XmmI, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00040000) movox_ld(XmmI, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(XmmJ, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00080000) movox_ld(XmmJ, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(XmmK, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00100000) movox_ld(XmmK, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(XmmL, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00200000) movox_ld(XmmL, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(XmmM, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00400000) movox_ld(XmmM, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(XmmN, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00800000) movox_ld(XmmN, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(XmmO, Oeax, PLAIN)                                         \
+        ASM_IFS(0x01000000) movox_ld(XmmO, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(XmmP, Oeax, PLAIN)                                         \
+        ASM_IFS(0x02000000) movox_ld(XmmP, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(XmmQ, Oeax, PLAIN)                                         \
+        ASM_IFS(0x04000000) movox_ld(XmmQ, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(XmmR, Oeax, PLAIN)                                         \
+        ASM_IFS(0x08000000) movox_ld(XmmR, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(XmmS, Oeax, PLAIN)                                         \
+        ASM_IFS(0x10000000) movox_ld(XmmS, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
-        movox_ld(XmmT, Oeax, PLAIN)                                         \
+        ASM_IFS(0x20000000) movox_ld(XmmT, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32*4))                               \
         VEX(0,             0,    0x00, 0, 0, 1) EMITB(0x90)                 \
         MRM(0x01,       0x00,    0x00)                                      \
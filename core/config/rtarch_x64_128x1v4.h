@@ -147,6 +147,14 @@ ADR ESC REX(RXB(XS), RXB(MD)) EMITB(0x0F) EMITB(0x29)                       \
         MRM(REG(XS), MOD(MD), REG(MD))                                      \
         AUX(SIB(MD), CMD(DD), EMPTY)
 
+/* stn (M = S) streams to aligned M bypassing caches (non-temporal) */
+
+#undef  stnjx_st
+#define stnjx_st(XS, MD, DD)                                                \
+ADR ESC REX(RXB(XS), RXB(MD)) EMITB(0x0F) EMITB(0x2B)                       \
+        MRM(REG(XS), MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMPTY)
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -183,6 +191,30 @@ ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0x38) EMITB(0x15)           \
         orrjx_rr(Xmm0, W(XS))                                               \
         movjx_st(Xmm0, W(MG), W(DG))
 
+/* spl, rev, rot use pshufd, unl, unh use unpcklpd/unpckhpd, tbl is generic */
+
+#undef  spljx_ri
+#define spljx_ri(XD, XS, IS)                                                \
+        shfix_rr(W(XD), W(XS), IB(0x44 + (VAL(IS) & 1) * 0xAA))
+
+#undef  revjx_rr
+#define revjx_rr(XD, XS)                                                    \
+        shfix_rr(W(XD), W(XS), IB(0x4E))
+
+#undef  rotjx_ri
+#define rotjx_ri(XD, XS, IS)                                                \
+        shfix_rr(W(XD), W(XS), IB((0x4EE4 >> ((VAL(IS) & 1) * 8)) & 0xFF))
+
+#undef  unljx_rr
+#define unljx_rr(XG, XS)                                                    \
+    ESC REX(RXB(XG), RXB(XS)) EMITB(0x0F) EMITB(0x14)                       \
+        MRM(REG(XG), MOD(XS), REG(XS))
+
+#undef  unhjx_rr
+#define unhjx_rr(XG, XS)                                                    \
+    ESC REX(RXB(XG), RXB(XS)) EMITB(0x0F) EMITB(0x15)                       \
+        MRM(REG(XG), MOD(XS), REG(XS))
+
 /* and (G = G & S), (D = S & T) if (#D != #S) */
 
 #define andjx_rr(XG, XS)                                                    \
@@ -640,9 +672,22 @@ ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0x5D)                       \
         movjx_rr(W(XD), W(XS))                                              \
         minjs_ld(W(XD), W(MT), W(DT))
 
-        /* mnp, mnh are defined in rtbase.h
+        /* mnp is defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+/* horizontal min/max swap elements (shfix) and combine with the source,
+ * source is passed through memory in case XD is the same register as XS */
+
+#undef  mnhjs_rr
+#define mnhjs_rr(XD, XS) /* horizontal reductive min */                     \
+        movjx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        mnhjs_ld(W(XD), Mebp, inf_SCR01(0))
+
+#undef  mnhjs_ld
+#define mnhjs_ld(XD, MS, DS)                                                \
+        shfix_ld(W(XD), W(MS), W(DS), IB(0x4E))                             \
+        minjs_ld(W(XD), W(MS), W(DS))
+
 /* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #S) */
 
 #define maxjs_rr(XG, XS)                                                    \
@@ -662,9 +707,19 @@ ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0x5F)                       \
         movjx_rr(W(XD), W(XS))                                              \
         maxjs_ld(W(XD), W(MT), W(DT))
 
-        /* mxp, mxh are defined in rtbase.h
+        /* mxp is defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mxhjs_rr
+#define mxhjs_rr(XD, XS) /* horizontal reductive max */                     \
+        movjx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        mxhjs_ld(W(XD), Mebp, inf_SCR01(0))
+
+#undef  mxhjs_ld
+#define mxhjs_ld(XD, MS, DS)                                                \
+        shfix_ld(W(XD), W(MS), W(DS), IB(0x4E))                             \
+        maxjs_ld(W(XD), W(MS), W(DS))
+
 /* ceq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #S) */
 
 #define ceqjs_rr(XG, XS)                                                    \
@@ -1096,6 +1151,46 @@ ADR ESC REX(RXB(XD), RXB(MS)) EMITB(0x0F) EMITB(0x3A) EMITB(0x09)           \
 
 #endif /* RT_SIMD_COMPAT_SSE >= 4 */
 
+/* cvx (D = fp32 S), cux (G = fp32 S), cvy (D = fp64 S), cuy (D = fp64 S)
+ * narrow fp64 to fp32 halves and widen back (rounding follows MXCSR),
+ * upper-half forms go through SCR01/SCR02, see notes in rtbase.h */
+
+#undef  cvxjs_rr
+#define cvxjs_rr(XD, XS)                                                    \
+    ESC REX(RXB(XD), RXB(XS)) EMITB(0x0F) EMITB(0x5A)                       \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+#undef  cuxjs_rr
+#define cuxjs_rr(XG, XS)                                                    \
+        movjx_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        cvxjs_rr(W(XG), W(XS))                                              \
+        dupjx_rr(W(XG), W(XG))                                              \
+        inljx_ld(W(XG), Mebp, inf_SCR02(0))
+
+#undef  cvyis_rr
+#define cvyis_rr(XD, XS)                                                    \
+        REX(RXB(XD), RXB(XS)) EMITB(0x0F) EMITB(0x5A)                       \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+#undef  cuyis_rr
+#define cuyis_rr(XD, XS)                                                    \
+        movix_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        cvyis_ld(W(XD), Mebp, inf_SCR01(0x08))
+
+#define cvyis_ld(XD, MS, DS) /* not portable, do not use outside */         \
+    ADR REX(RXB(XD), RXB(MS)) EMITB(0x0F) EMITB(0x5A)                       \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define dupjx_rr(XD, XS)     /* not portable, do not use outside */         \
+    ESC REX(RXB(XD), RXB(XS)) EMITB(0x0F) EMITB(0x14)                       \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+#define inljx_ld(XG, MS, DS) /* not portable, do not use outside */         \
+ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0x12)                       \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
 /************   packed double-precision integer arithmetic/shifts   ***********/
 
 /* add (G = G + S), (D = S + T) if (#D != #S) */
@@ -1334,6 +1429,37 @@ ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0xD3)                       \
         movjx_ld(W(XD), Mebp, inf_SCR01(0))
 
 /******************************************************************************/
+/****************   packed double-precision integer compare   *****************/
+/* native SSE4.1 pcmpeqq overrides generic forms from rtbase.h,
+ * other compares keep generic forms (pcmpgtq requires SSE4.2) */
+
+#if (RT_SIMD_COMPAT_SSE >= 4)
+
+/* ceq (G = G == S ? -1 : 0), cne (G = G != S ? -1 : 0) */
+
+#undef  ceqjx_rr
+#define ceqjx_rr(XG, XS)                                                    \
+    ESC REX(RXB(XG), RXB(XS)) EMITB(0x0F) EMITB(0x38) EMITB(0x29)           \
+        MRM(REG(XG), MOD(XS), REG(XS))
+
+#undef  ceqjx_ld
+#define ceqjx_ld(XG, MS, DS)                                                \
+ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0x38) EMITB(0x29)           \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#undef  cnejx_rr
+#define cnejx_rr(XG, XS)                                                    \
+        ceqjx_rr(W(XG), W(XS))                                              \
+        notjx_rx(W(XG))
+
+#undef  cnejx_ld
+#define cnejx_ld(XG, MS, DS)                                                \
+        ceqjx_ld(W(XG), W(MS), W(DS))                                       \
+        notjx_rx(W(XG))
+
+#endif /* RT_SIMD_COMPAT_SSE >= 4 */
+
 /**********************************   ELEM   **********************************/
 /******************************************************************************/
 
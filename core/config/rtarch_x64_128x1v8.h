@@ -143,6 +143,14 @@
         MRM(REG(XS), MOD(MD), REG(MD))                                      \
         AUX(SIB(MD), CMD(DD), EMPTY)
 
+/* stn (M = S) streams to aligned M bypassing caches (non-temporal) */
+
+#undef  stnjx_st
+#define stnjx_st(XS, MD, DD)                                                \
+    ADR VEX(RXB(XS), RXB(MD),    0x00, 0, 1, 1) EMITB(0x2B)                 \
+        MRM(REG(XS), MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMPTY)
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -953,6 +961,46 @@
         rnrjs_rr(W(XD), W(XS), mode)                                        \
         cvzjs_rr(W(XD), W(XD))
 
+/* cvx (D = fp32 S), cux (G = fp32 S), cvy (D = fp64 S), cuy (D = fp64 S)
+ * narrow fp64 to fp32 halves and widen back (rounding follows MXCSR),
+ * upper-half forms go through SCR01/SCR02, see notes in rtbase.h */
+
+#undef  cvxjs_rr
+#define cvxjs_rr(XD, XS)                                                    \
+        VEX(RXB(XD), RXB(XS),    0x00, 0, 1, 1) EMITB(0x5A)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+#undef  cuxjs_rr
+#define cuxjs_rr(XG, XS)                                                    \
+        movjx_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        cvxjs_rr(W(XG), W(XS))                                              \
+        dupjx_rr(W(XG), W(XG))                                              \
+        inljx_ld(W(XG), Mebp, inf_SCR02(0))
+
+#undef  cvyis_rr
+#define cvyis_rr(XD, XS)                                                    \
+        VEX(RXB(XD), RXB(XS),    0x00, 0, 0, 1) EMITB(0x5A)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+#undef  cuyis_rr
+#define cuyis_rr(XD, XS)                                                    \
+        movix_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        cvyis_ld(W(XD), Mebp, inf_SCR01(0x08))
+
+#define cvyis_ld(XD, MS, DS) /* not portable, do not use outside */         \
+    ADR VEX(RXB(XD), RXB(MS),    0x00, 0, 0, 1) EMITB(0x5A)                 \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define dupjx_rr(XD, XS)     /* not portable, do not use outside */         \
+        VEX(RXB(XD), RXB(XS), REN(XS), 0, 1, 1) EMITB(0x14)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+#define inljx_ld(XG, MS, DS) /* not portable, do not use outside */         \
+    ADR VEX(RXB(XG), RXB(MS), REN(XG), 0, 1, 1) EMITB(0x12)                 \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
 /************   packed double-precision integer arithmetic/shifts   ***********/
 
 /* add (G = G + S), (D = S + T) if (#D != #S) */
@@ -155,6 +155,17 @@ ADR ESC REX(1,       RXB(MD)) EMITB(0x0F) EMITB(0x29)                       \
         MRM(REG(XS),    0x02, REG(MD))                                      \
         AUX(SIB(MD), EMITW(VYL(DD)), EMPTY)
 
+/* stn (M = S) streams to aligned M bypassing caches (non-temporal) */
+
+#undef  stndx_st
+#define stndx_st(XS, MD, DD)                                                \
+ADR ESC REX(0,       RXB(MD)) EMITB(0x0F) EMITB(0x2B)                       \
+        MRM(REG(XS),    0x02, REG(MD))                                      \
+        AUX(SIB(MD), EMITW(VAL(DD)), EMPTY)                                 \
+ADR ESC REX(1,       RXB(MD)) EMITB(0x0F) EMITB(0x2B)                       \
+        MRM(REG(XS),    0x02, REG(MD))                                      \
+        AUX(SIB(MD), EMITW(VYL(DD)), EMPTY)
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -334,9 +345,28 @@ ADR ESC REX(1,       RXB(MS)) EMITB(0x0F) EMITB(0x58)                       \
         movdx_rr(W(XD), W(XS))                                              \
         addds_ld(W(XD), W(MT), W(DT))
 
-        /* adp, adh are defined in rtbase.h (first 15-regs only)
+        /* adp is defined in rtbase.h (first 15-regs only)
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+/* horizontal reductions fold the upper half of the pair into the lower one,
+ * then reduce the lower half using the upper half as a temporary register */
+
+#undef  adhds_rr
+#define adhds_rr(XD, XS) /* horizontal reductive add */                     \
+        REX(0,             0) EMITB(0x0F) EMITB(0x28)                       \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+    ESC REX(0,             1) EMITB(0x0F) EMITB(0x58)                       \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        shlcx_rx(W(XD), IB(0x4E))                                           \
+    ESC REX(0,             1) EMITB(0x0F) EMITB(0x58)                       \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        mvlcx_rx(W(XD))
+
+#undef  adhds_ld
+#define adhds_ld(XD, MS, DS)                                                \
+        movdx_ld(W(XD), W(MS), W(DS))                                       \
+        adhds_rr(W(XD), W(XD))
+
 #if (RT_SIMD_COMPAT_SSE < 4)
 
 #undef  adpds_rx
@@ -693,9 +723,25 @@ ADR ESC REX(1,       RXB(MS)) EMITB(0x0F) EMITB(0x5D)                       \
         movdx_rr(W(XD), W(XS))                                              \
         minds_ld(W(XD), W(MT), W(DT))
 
-        /* mnp, mnh are defined in rtbase.h
+        /* mnp is defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mnhds_rr
+#define mnhds_rr(XD, XS) /* horizontal reductive min */                     \
+        REX(0,             0) EMITB(0x0F) EMITB(0x28)                       \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+    ESC REX(0,             1) EMITB(0x0F) EMITB(0x5D)                       \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        shlcx_rx(W(XD), IB(0x4E))                                           \
+    ESC REX(0,             1) EMITB(0x0F) EMITB(0x5D)                       \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        mvlcx_rx(W(XD))
+
+#undef  mnhds_ld
+#define mnhds_ld(XD, MS, DS)                                                \
+        movdx_ld(W(XD), W(MS), W(DS))                                       \
+        mnhds_rr(W(XD), W(XD))
+
 /* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #S) */
 
 #define maxds_rr(XG, XS)                                                    \
@@ -720,9 +766,25 @@ ADR ESC REX(1,       RXB(MS)) EMITB(0x0F) EMITB(0x5F)                       \
         movdx_rr(W(XD), W(XS))                                              \
         maxds_ld(W(XD), W(MT), W(DT))
 
-        /* mxp, mxh are defined in rtbase.h
+        /* mxp is defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mxhds_rr
+#define mxhds_rr(XD, XS) /* horizontal reductive max */                     \
+        REX(0,             0) EMITB(0x0F) EMITB(0x28)                       \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+    ESC REX(0,             1) EMITB(0x0F) EMITB(0x5F)                       \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        shlcx_rx(W(XD), IB(0x4E))                                           \
+    ESC REX(0,             1) EMITB(0x0F) EMITB(0x5F)                       \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        mvlcx_rx(W(XD))
+
+#undef  mxhds_ld
+#define mxhds_ld(XD, MS, DS)                                                \
+        movdx_ld(W(XD), W(MS), W(DS))                                       \
+        mxhds_rr(W(XD), W(XD))
+
 /* ceq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #S) */
 
 #define ceqds_rr(XG, XS)                                                    \
@@ -143,6 +143,14 @@
         MRM(REG(XS), MOD(MD), REG(MD))                                      \
         AUX(SIB(MD), CMD(DD), EMPTY)
 
+/* stn (M = S) streams to aligned M bypassing caches (non-temporal) */
+
+#undef  stndx_st
+#define stndx_st(XS, MD, DD)                                                \
+    ADR VEX(RXB(XS), RXB(MD),    0x00, 1, 1, 1) EMITB(0x2B)                 \
+        MRM(REG(XS), MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMPTY)
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -161,6 +169,40 @@
         MRM(REG(XS), MOD(MG), REG(MG))                                      \
         AUX(SIB(MG), CMD(DG), EMPTY)
 
+#if (RT_256X1 >= 2)
+
+/* gth (D = [M + S]), sct ([M + T] = S) are defined in rtbase.h
+ * under "COMMON SIMD INSTRUCTIONS" section, AVX2 gather as in fp32 */
+
+#undef  gthdx_ld
+#define gthdx_ld(XD, XS, MT, DT) /* M: Oeax, M*** only */                   \
+        movdx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        mvtcx_st(REG(XD)^1, Mebp, inf_SCR02(0))                             \
+        mvtcx_ld(REG(XD)^1, Mebp, inf_SCR01(0))                             \
+        mvtcx_st(REG(XD)^2, Mebp, inf_SCR01(0))                             \
+        VEX(0,             0, REG(XD)^2, 1, 1, 1) EMITB(0x76)               \
+        MRM(REG(XD)^2,  0x03, REG(XD)^2)                                    \
+    ADR VEW(RXB(XD), RXB(MT), REG(XD)^2, 1, 1, 2) EMITB(0x93)               \
+        MRM(REG(XD), MOD(MT),    0x04)                                      \
+        AUX(EMITB(0xC0 | (REG(XD)^1) << 3 | REG(MT)), CMD(DT), EMPTY)       \
+        mvtcx_ld(REG(XD)^2, Mebp, inf_SCR01(0))                             \
+        mvtcx_ld(REG(XD)^1, Mebp, inf_SCR02(0))
+
+#endif /* RT_256X1 >= 2, AVX2 */
+
+/* spl, rev broadcast or swap 128-bit halves (prlcx) and shuffle within them,
+ * other forms are generic */
+
+#undef  spldx_ri
+#define spldx_ri(XD, XS, IS)                                                \
+        prlcx_rr(W(XD), W(XS), IB(((VAL(IS) >> 1) & 1) * 0x11))             \
+        shfdx_rr(W(XD), W(XD), IB((VAL(IS) & 1) * 0x0F))
+
+#undef  revdx_rr
+#define revdx_rr(XD, XS)                                                    \
+        prlcx_rr(W(XD), W(XS), IB(0x01))                                    \
+        shfdx_rr(W(XD), W(XD), IB(0x05))
+
 /* and (G = G & S), (D = S & T) if (#D != #S) */
 
 #define anddx_rr(XG, XS)                                                    \
@@ -282,9 +324,34 @@
         MRM(REG(XD), MOD(MT), REG(MT))                                      \
         AUX(SIB(MT), CMD(DT), EMPTY)
 
-        /* adp, adh are defined in rtbase.h (first 15-regs only)
+        /* adp is defined in rtbase.h (first 15-regs only)
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+/* horizontal add/min/max swap 128-bit halves of the source (prmcx_ld)
+ * and combine, then finish within 128-bit lanes: add with pairwise hadds,
+ * min/max swapping elements (shfdx) against a single spill,
+ * source is passed through memory in case XD is the same register as XS */
+
+#define shfdx_rr(XD, XS, IT) /* not portable, do not use outside */         \
+        VEX(RXB(XD), RXB(XS),    0x00, 1, 1, 3) EMITB(0x05)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(VAL(IT)))
+
+#define hadds_rr(XG, XS)     /* not portable, do not use outside */         \
+        VEX(RXB(XG), RXB(XS), REN(XG), 1, 1, 1) EMITB(0x7C)                 \
+        MRM(REG(XG), MOD(XS), REG(XS))
+
+#undef  adhds_rr
+#define adhds_rr(XD, XS) /* horizontal reductive add, first 15-regs only */ \
+        movdx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        adhds_ld(W(XD), Mebp, inf_SCR01(0))
+
+#undef  adhds_ld
+#define adhds_ld(XD, MS, DS)                                                \
+        prmcx_ld(W(XD), W(MS), W(DS), IB(0x23))                             \
+        addds_ld(W(XD), W(MS), W(DS))                                       \
+        hadds_rr(W(XD), W(XD))
+
 /* sub (G = G - S), (D = S - T) if (#D != #S) */
 
 #define subds_rr(XG, XS)                                                    \
@@ -629,9 +696,22 @@
         MRM(REG(XD), MOD(MT), REG(MT))                                      \
         AUX(SIB(MT), CMD(DT), EMPTY)
 
-        /* mnp, mnh are defined in rtbase.h
+        /* mnp is defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mnhds_rr
+#define mnhds_rr(XD, XS) /* horizontal reductive min */                     \
+        movdx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        mnhds_ld(W(XD), Mebp, inf_SCR01(0))
+
+#undef  mnhds_ld
+#define mnhds_ld(XD, MS, DS)                                                \
+        prmcx_ld(W(XD), W(MS), W(DS), IB(0x23))                             \
+        minds_ld(W(XD), W(MS), W(DS))                                       \
+        movdx_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        shfdx_rr(W(XD), W(XD), IB(0x05))                                    \
+        minds_ld(W(XD), Mebp, inf_SCR02(0))
+
 /* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #S) */
 
 #define maxds_rr(XG, XS)                                                    \
@@ -649,9 +729,22 @@
         MRM(REG(XD), MOD(MT), REG(MT))                                      \
         AUX(SIB(MT), CMD(DT), EMPTY)
 
-        /* mxp, mxh are defined in rtbase.h
+        /* mxp is defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mxhds_rr
+#define mxhds_rr(XD, XS) /* horizontal reductive max */                     \
+        movdx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        mxhds_ld(W(XD), Mebp, inf_SCR01(0))
+
+#undef  mxhds_ld
+#define mxhds_ld(XD, MS, DS)                                                \
+        prmcx_ld(W(XD), W(MS), W(DS), IB(0x23))                             \
+        maxds_ld(W(XD), W(MS), W(DS))                                       \
+        movdx_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        shfdx_rr(W(XD), W(XD), IB(0x05))                                    \
+        maxds_ld(W(XD), Mebp, inf_SCR02(0))
+
 /* ceq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #S) */
 
 #define ceqds_rr(XG, XS)                                                    \
@@ -958,6 +1051,41 @@
         rnrds_rr(W(XD), W(XS), mode)                                        \
         cvzds_rr(W(XD), W(XD))
 
+/* cvx (D = fp32 S), cux (G = fp32 S), cvy (D = fp64 S), cuy (D = fp64 S)
+ * narrow fp64 to fp32 halves and widen back (rounding follows MXCSR),
+ * upper-half forms go through SCR01/SCR02, see notes in rtbase.h */
+
+#undef  cvxds_rr
+#define cvxds_rr(XD, XS)                                                    \
+        VEX(RXB(XD), RXB(XS),    0x00, 1, 1, 1) EMITB(0x5A)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+#undef  cuxds_rr
+#define cuxds_rr(XG, XS)                                                    \
+        movdx_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        cvxds_rr(W(XG), W(XS))                                              \
+        inldx_ld(W(XG), Mebp, inf_SCR02(0))
+
+#undef  cvycs_rr
+#define cvycs_rr(XD, XS)                                                    \
+        VEX(RXB(XD), RXB(XS),    0x00, 1, 0, 1) EMITB(0x5A)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+#undef  cuycs_rr
+#define cuycs_rr(XD, XS)                                                    \
+        movcx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        cvycs_ld(W(XD), Mebp, inf_SCR01(0x10))
+
+#define cvycs_ld(XD, MS, DS) /* not portable, do not use outside */         \
+    ADR VEX(RXB(XD), RXB(MS),    0x00, 1, 0, 1) EMITB(0x5A)                 \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define inldx_ld(XG, MS, DS) /* not portable, do not use outside */         \
+    ADR VEX(RXB(XG), RXB(MS), REN(XG), 1, 1, 3) EMITB(0x06)                 \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMITB(0x02))
+
 /************   packed double-precision integer arithmetic/shifts   ***********/
 
 #if (RT_256X1 < 2)
@@ -143,6 +143,14 @@
         MRM(REG(XS), MOD(MD), REG(MD))                                      \
         AUX(SIB(MD), CMD(DD), EMPTY)
 
+/* stn (M = S) streams to aligned M bypassing caches (non-temporal) */
+
+#undef  stnqx_st
+#define stnqx_st(XS, MD, DD)                                                \
+    ADR EVW(RXB(XS), RXB(MD),    0x00, K, 1, 1) EMITB(0x2B)                 \
+        MRM(REG(XS), MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMPTY)
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -163,6 +171,92 @@
         MRM(REG(XS), MOD(MG), REG(MG))                                      \
         AUX(SIB(MG), CMD(DG), EMPTY)
 
+/* gth (D = [M + S]), sct ([M + T] = S) use TmmM for indices and k1 as mask */
+
+#undef  gthqx_ld
+#define gthqx_ld(XD, XS, MT, DT) /* M: Oeax, M*** only */                   \
+        movox_rr(TmmM, W(XS))                                               \
+        VEX(0,             0,    0x00, 1, 0, 1) EMITB(0x46)                 \
+        MRM(0x01,       0x03,    0x00)                                      \
+    ADR EKW(RXB(XD), RXB(MT)|2,  0x10, K, 1, 2) EMITB(0x93)                 \
+        MRM(REG(XD), MOD(MT),    0x04)                                      \
+        AUX(EMITB(0xF8 | REG(MT)), CMD(DT), EMPTY)
+
+#undef  sctqx_st
+#define sctqx_st(XS, XT, MD, DD) /* M: Oeax, M*** only */                   \
+        movox_rr(TmmM, W(XT))                                               \
+        VEX(0,             0,    0x00, 1, 0, 1) EMITB(0x46)                 \
+        MRM(0x01,       0x03,    0x00)                                      \
+    ADR EKW(RXB(XS), RXB(MD)|2,  0x10, K, 1, 2) EMITB(0xA3)                 \
+        MRM(REG(XS), MOD(MD),    0x04)                                      \
+        AUX(EMITB(0xF8 | REG(MD)), CMD(DD), EMPTY)
+
+/* spl, rev shuffle 128-bit lanes (prmqx) and elements within them (shfqx),
+ * rot uses valignq, tbl uses vpermq on XT or TmmM, unl, unh are generic */
+
+#undef  splqx_ri
+#define splqx_ri(XD, XS, IS)                                                \
+        prmqx_rr(W(XD), W(XS), IB(((VAL(IS) >> 1) & 3) * 0x55))             \
+        shfqx_rr(W(XD), W(XD), IB((VAL(IS) & 1) * 0xFF))
+
+#undef  revqx_rr
+#define revqx_rr(XD, XS)                                                    \
+        prmqx_rr(W(XD), W(XS), IB(0x1B))                                    \
+        shfqx_rr(W(XD), W(XD), IB(0x55))
+
+#undef  rotqx_ri
+#define rotqx_ri(XD, XS, IS)                                                \
+        EVW(RXB(XD), RXB(XS), REN(XS), K, 1, 3) EMITB(0x03)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(VAL(IS) & 0x07))
+
+#undef  tblqx_rr
+#define tblqx_rr(XD, XS, XT)                                                \
+        EVW(RXB(XD), RXB(XS), REN(XT), K, 1, 2) EMITB(0x36)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+#undef  tblqx_ld
+#define tblqx_ld(XD, XS, MT, DT)                                            \
+        movqx_ld(TmmM, W(MT), W(DT))                                        \
+        tblqx_rr(W(XD), W(XS), TmmM)
+
+/* mtl (D = first RS elements from M), see rtbase.h for notes, k1 is set
+ * from the count clamped to lane-count via cmova and BMI2 bzhi (mk1qx) */
+
+#undef  mtlqx_ld
+#define mtlqx_ld(XD, RS, MT, DT)                                            \
+        movwx_st(W(RS), Mebp, inf_SCR02(0))                                 \
+        mk1qx_ld(Mebp, inf_SCR02(0))                                        \
+    ADR EZW(RXB(XD), RXB(MT),    0x00, K, 1, 1) EMITB(0x10)                 \
+        MRM(REG(XD), MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMPTY)
+
+#undef  mtlqx_st
+#define mtlqx_st(XS, RT, MD, DD)                                            \
+        movwx_st(W(RT), Mebp, inf_SCR02(0))                                 \
+        mk1qx_ld(Mebp, inf_SCR02(0))                                        \
+    ADR EKW(RXB(XS), RXB(MD),    0x00, K, 1, 1) EMITB(0x11)                 \
+        MRM(REG(XS), MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMPTY)
+
+#define mk1qx_ld(MS, DS) /* not portable, do not use outside */             \
+        stack_st(Recx)                                                      \
+        stack_st(Reax)                                                      \
+        movwx_ri(Reax, IB(8))                                               \
+        movwx_ri(Recx, IV(0xFFFFFFFF))                                      \
+    ADR REX(0,       RXB(MS)) EMITB(0x3B)                                   \
+        MRM(0x00,    MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)                                        \
+    ADR REX(0,       RXB(MS)) EMITB(0x0F) EMITB(0x47)                       \
+        MRM(0x00,    MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)                                        \
+        VEX(0,             0,    0x00, 0, 0, 2) EMITB(0xF5)                 \
+        MRM(0x00,       0x03,    0x01)                                      \
+        VEX(0,             0,    0x00, 0, 0, 1) EMITB(0x92)                 \
+        MRM(0x01,       0x03,    0x00)                                      \
+        stack_ld(Reax)                                                      \
+        stack_ld(Recx)
+
 #define ck1qx_rm(XS, MT, DT) /* not portable, do not use outside */         \
     ADR EVW(0,       RXB(MT), REN(XS), K, 1, 2) EMITB(0x29)                 \
         MRM(0x01,    MOD(MT), REG(MT))                                      \
@@ -381,9 +475,37 @@
         MRM(REG(XD), MOD(MT), REG(MT))                                      \
         AUX(SIB(MT), CMD(DT), EMPTY)
 
-        /* adp, adh are defined in rtbase.h (first 15-regs only)
+        /* adp is defined in rtbase.h (first 15-regs only)
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+/* horizontal add/min/max combine the source with its 128-bit lanes (prmqx)
+ * and then with its elements within 128-bit lanes (shfqx) swapped in pairs,
+ * zmm31 is not exposed to apps on this target and serves as TmmM */
+
+#define prmqx_rr(XD, XS, IT) /* not portable, do not use outside */         \
+        EVW(RXB(XD), RXB(XS), REN(XS), K, 1, 3) EMITB(0x23)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(VAL(IT)))
+
+#define shfqx_rr(XD, XS, IT) /* not portable, do not use outside */         \
+        EVW(RXB(XD), RXB(XS),    0x00, K, 1, 3) EMITB(0x05)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(VAL(IT)))
+
+#undef  adhqs_rr
+#define adhqs_rr(XD, XS) /* horizontal reductive add, first 15-regs only */ \
+        prmqx_rr(TmmM,  W(XS), IB(0x4E))                                    \
+        addqs3rr(W(XD), W(XS), TmmM)                                        \
+        prmqx_rr(TmmM,  W(XD), IB(0xB1))                                    \
+        addqs_rr(W(XD), TmmM)                                               \
+        shfqx_rr(TmmM,  W(XD), IB(0x55))                                    \
+        addqs_rr(W(XD), TmmM)
+
+#undef  adhqs_ld
+#define adhqs_ld(XD, MS, DS)                                                \
+        movqx_ld(W(XD), W(MS), W(DS))                                       \
+        adhqs_rr(W(XD), W(XD))
+
 /* sub (G = G - S), (D = S - T) if (#D != #S) */
 
 #define subqs_rr(XG, XS)                                                    \
@@ -564,9 +686,23 @@
         MRM(REG(XD), MOD(MT), REG(MT))                                      \
         AUX(SIB(MT), CMD(DT), EMPTY)
 
-        /* mnp, mnh are defined in rtbase.h
+        /* mnp is defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mnhqs_rr
+#define mnhqs_rr(XD, XS) /* horizontal reductive min */                     \
+        prmqx_rr(TmmM,  W(XS), IB(0x4E))                                    \
+        minqs3rr(W(XD), W(XS), TmmM)                                        \
+        prmqx_rr(TmmM,  W(XD), IB(0xB1))                                    \
+        minqs_rr(W(XD), TmmM)                                               \
+        shfqx_rr(TmmM,  W(XD), IB(0x55))                                    \
+        minqs_rr(W(XD), TmmM)
+
+#undef  mnhqs_ld
+#define mnhqs_ld(XD, MS, DS)                                                \
+        movqx_ld(W(XD), W(MS), W(DS))                                       \
+        mnhqs_rr(W(XD), W(XD))
+
 /* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #S) */
 
 #define maxqs_rr(XG, XS)                                                    \
@@ -584,9 +720,23 @@
         MRM(REG(XD), MOD(MT), REG(MT))                                      \
         AUX(SIB(MT), CMD(DT), EMPTY)
 
-        /* mxp, mxh are defined in rtbase.h
+        /* mxp is defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mxhqs_rr
+#define mxhqs_rr(XD, XS) /* horizontal reductive max */                     \
+        prmqx_rr(TmmM,  W(XS), IB(0x4E))                                    \
+        maxqs3rr(W(XD), W(XS), TmmM)                                        \
+        prmqx_rr(TmmM,  W(XD), IB(0xB1))                                    \
+        maxqs_rr(W(XD), TmmM)                                               \
+        shfqx_rr(TmmM,  W(XD), IB(0x55))                                    \
+        maxqs_rr(W(XD), TmmM)
+
+#undef  mxhqs_ld
+#define mxhqs_ld(XD, MS, DS)                                                \
+        movqx_ld(W(XD), W(MS), W(DS))                                       \
+        mxhqs_rr(W(XD), W(XD))
+
 /* ceq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #S) */
 
 #define ceqqs_rr(XG, XS)                                                    \
@@ -1051,6 +1201,30 @@
 
 #endif /* RT_512X1 == 2, 8 */
 
+/* cvx (D = fp32 S), cux (G = fp32 S), cvy (D = fp64 S), cuy (D = fp64 S)
+ * narrow fp64 to fp32 halves and widen back (rounding follows MXCSR),
+ * upper-half forms use 256-bit insert/extract, see notes in rtbase.h */
+
+#undef  cvxqs_rr
+#define cvxqs_rr(XD, XS)                                                    \
+        EVW(RXB(XD), RXB(XS),    0x00, K, 1, 1) EMITB(0x5A)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+#undef  cuxqs_rr
+#define cuxqs_rr(XG, XS)                                                    \
+        cvxqs_rr(TmmM, W(XS))                                               \
+        inhox_rr(W(XG), TmmM)
+
+#undef  cvyos_rr
+#define cvyos_rr(XD, XS)                                                    \
+        EVX(RXB(XD), RXB(XS),    0x00, K, 0, 1) EMITB(0x5A)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+#undef  cuyos_rr
+#define cuyos_rr(XD, XS)                                                    \
+        exhox_rr(TmmM, W(XS))                                               \
+        cvyos_rr(W(XD), TmmM)
+
 /************   packed double-precision integer arithmetic/shifts   ***********/
 
 /* add (G = G + S), (D = S + T) if (#D != #S) */
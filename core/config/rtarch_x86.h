@@ -1399,6 +1399,20 @@
         MRM(REG(RD), MOD(MS), REG(MS))                                      \
         AUX(SIB(MS), CMD(DS), EMPTY)
 
+/* prf (prefetch M into cache level hint: PF_L1, PF_L2, PF_LL, PF_NT)
+ * set-flags: no, never faults, may be issued past the end of an array
+ * hints map to prefetcht0/t1/t2/nta */
+
+#define PF_L1   0x01
+#define PF_L2   0x02
+#define PF_LL   0x03
+#define PF_NT   0x00
+
+#define prfxx_ld(MS, DS, hint)                                              \
+        EMITB(0x0F) EMITB(0x18)                                             \
+        MRM((hint),  MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
 /************************* pointer-sized instructions *************************/
 
 /* label (D = Reax = adr lb)
@@ -1486,6 +1500,12 @@
 #define stack_la()   /* load all [Redi - Reax], 8 regs in total */          \
         EMITB(0x61)
 
+#define stack_sm()   /* save listed, same as stack_sa on legacy target */   \
+        stack_sa()
+
+#define stack_lm()   /* load listed, same as stack_la on legacy target */   \
+        stack_la()
+
 /******************************************************************************/
 /**************************   extended double (x87)   *************************/
 /******************************************************************************/
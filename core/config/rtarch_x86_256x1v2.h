@@ -151,6 +151,14 @@
         MRM(REG(XS), MOD(MD), REG(MD))                                      \
         AUX(SIB(MD), CMD(DD), EMPTY)
 
+/* stn (M = S) streams to aligned M bypassing caches (non-temporal) */
+
+#undef  stncx_st
+#define stncx_st(XS, MD, DD)                                                \
+        V2X(0x00,    1, 0) EMITB(0x2B)                                      \
+        MRM(REG(XS), MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMPTY)
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -431,16 +439,16 @@
         AUX(EMPTY,   EMPTY,   CMD(IS))
 
 
-#define cvycs_rr(XD, XS)     /* not portable, do not use outside */         \
+#define cvwcs_rr(XD, XS)     /* not portable, do not use outside */         \
         V2X(0x00,    1, 0) EMITB(0x5A)                                      \
         MRM(REG(XD), MOD(XS), REG(XS))
 
-#define cvycs_ld(XD, MS, DS) /* not portable, do not use outside */         \
+#define cvwcs_ld(XD, MS, DS) /* not portable, do not use outside */         \
         V2X(0x00,    1, 0) EMITB(0x5A)                                      \
         MRM(REG(XD), MOD(MS), REG(MS))                                      \
         AUX(SIB(MS), CMD(DS), EMPTY)
 
-#define cvxds_rr(XD, XS)     /* not portable, do not use outside */         \
+#define cvsds_rr(XD, XS)     /* not portable, do not use outside */         \
         V2X(0x00,    1, 1) EMITB(0x5A)                                      \
         MRM(REG(XD), MOD(XS), REG(XS))
 
@@ -487,21 +495,21 @@
 #define fmacs_rr(XG, XS, XT)                                                \
         movcx_st(W(XS), Mebp, inf_SCR01(0))                                 \
         movcx_st(W(XG), Mebp, inf_SCR02(0))                                 \
-        cvycs_rr(W(XG), W(XS))                     /* 1st-pass -> */        \
-        cvycs_rr(W(XS), W(XT))                                              \
+        cvwcs_rr(W(XG), W(XS))                     /* 1st-pass -> */        \
+        cvwcs_rr(W(XS), W(XT))                                              \
         mulds_rr(W(XS), W(XG))                                              \
-        cvycs_ld(W(XG), Mebp, inf_SCR02(0x00))                              \
+        cvwcs_ld(W(XG), Mebp, inf_SCR02(0x00))                              \
         addds_rr(W(XG), W(XS))                                              \
-        cvxds_rr(W(XG), W(XG))                                              \
+        cvsds_rr(W(XG), W(XG))                                              \
         movix_st(W(XG), Mebp, inf_SCR02(0x00))                              \
         movcx_ld(W(XS), Mebp, inf_SCR01(0))                                 \
         prmcx_rr(W(XT), W(XT), IB(1))              /* 1st-pass <- */        \
-        cvycs_ld(W(XG), Mebp, inf_SCR01(0x10))     /* 2nd-pass -> */        \
-        cvycs_rr(W(XS), W(XT))                                              \
+        cvwcs_ld(W(XG), Mebp, inf_SCR01(0x10))     /* 2nd-pass -> */        \
+        cvwcs_rr(W(XS), W(XT))                                              \
         mulds_rr(W(XS), W(XG))                                              \
-        cvycs_ld(W(XG), Mebp, inf_SCR02(0x10))                              \
+        cvwcs_ld(W(XG), Mebp, inf_SCR02(0x10))                              \
         addds_rr(W(XG), W(XS))                                              \
-        cvxds_rr(W(XG), W(XG))                                              \
+        cvsds_rr(W(XG), W(XG))                                              \
         movix_st(W(XG), Mebp, inf_SCR02(0x10))                              \
         prmcx_rr(W(XT), W(XT), IB(1))              /* 2nd-pass <- */        \
         movcx_ld(W(XG), Mebp, inf_SCR02(0))                                 \
@@ -510,20 +518,20 @@
 #define fmacs_ld(XG, XS, MT, DT)                                            \
         movcx_st(W(XS), Mebp, inf_SCR01(0))                                 \
         movcx_st(W(XG), Mebp, inf_SCR02(0))                                 \
-        cvycs_rr(W(XG), W(XS))                     /* 1st-pass -> */        \
-        cvycs_ld(W(XS), W(MT), W(DT))                                       \
+        cvwcs_rr(W(XG), W(XS))                     /* 1st-pass -> */        \
+        cvwcs_ld(W(XS), W(MT), W(DT))                                       \
         mulds_rr(W(XS), W(XG))                                              \
-        cvycs_ld(W(XG), Mebp, inf_SCR02(0x00))                              \
+        cvwcs_ld(W(XG), Mebp, inf_SCR02(0x00))                              \
         addds_rr(W(XG), W(XS))                                              \
-        cvxds_rr(W(XG), W(XG))                                              \
+        cvsds_rr(W(XG), W(XG))                                              \
         movix_st(W(XG), Mebp, inf_SCR02(0x00))                              \
         addwm_ri(W(MT), IC(0x10))                  /* 1st-pass <- */        \
-        cvycs_ld(W(XG), Mebp, inf_SCR01(0x10))     /* 2nd-pass -> */        \
-        cvycs_ld(W(XS), W(MT), W(DT))                                       \
+        cvwcs_ld(W(XG), Mebp, inf_SCR01(0x10))     /* 2nd-pass -> */        \
+        cvwcs_ld(W(XS), W(MT), W(DT))                                       \
         mulds_rr(W(XS), W(XG))                                              \
-        cvycs_ld(W(XG), Mebp, inf_SCR02(0x10))                              \
+        cvwcs_ld(W(XG), Mebp, inf_SCR02(0x10))                              \
         addds_rr(W(XG), W(XS))                                              \
-        cvxds_rr(W(XG), W(XG))                                              \
+        cvsds_rr(W(XG), W(XG))                                              \
         movix_st(W(XG), Mebp, inf_SCR02(0x10))                              \
         subwm_ri(W(MT), IC(0x10))                  /* 2nd-pass <- */        \
         movcx_ld(W(XG), Mebp, inf_SCR02(0))                                 \
@@ -558,21 +566,21 @@
 #define fmscs_rr(XG, XS, XT)                                                \
         movcx_st(W(XS), Mebp, inf_SCR01(0))                                 \
         movcx_st(W(XG), Mebp, inf_SCR02(0))                                 \
-        cvycs_rr(W(XG), W(XS))                     /* 1st-pass -> */        \
-        cvycs_rr(W(XS), W(XT))                                              \
+        cvwcs_rr(W(XG), W(XS))                     /* 1st-pass -> */        \
+        cvwcs_rr(W(XS), W(XT))                                              \
         mulds_rr(W(XS), W(XG))                                              \
-        cvycs_ld(W(XG), Mebp, inf_SCR02(0x00))                              \
+        cvwcs_ld(W(XG), Mebp, inf_SCR02(0x00))                              \
         subds_rr(W(XG), W(XS))                                              \
-        cvxds_rr(W(XG), W(XG))                                              \
+        cvsds_rr(W(XG), W(XG))                                              \
         movix_st(W(XG), Mebp, inf_SCR02(0x00))                              \
         movcx_ld(W(XS), Mebp, inf_SCR01(0))                                 \
         prmcx_rr(W(XT), W(XT), IB(1))              /* 1st-pass <- */        \
-        cvycs_ld(W(XG), Mebp, inf_SCR01(0x10))     /* 2nd-pass -> */        \
-        cvycs_rr(W(XS), W(XT))                                              \
+        cvwcs_ld(W(XG), Mebp, inf_SCR01(0x10))     /* 2nd-pass -> */        \
+        cvwcs_rr(W(XS), W(XT))                                              \
         mulds_rr(W(XS), W(XG))                                              \
-        cvycs_ld(W(XG), Mebp, inf_SCR02(0x10))                              \
+        cvwcs_ld(W(XG), Mebp, inf_SCR02(0x10))                              \
         subds_rr(W(XG), W(XS))                                              \
-        cvxds_rr(W(XG), W(XG))                                              \
+        cvsds_rr(W(XG), W(XG))                                              \
         movix_st(W(XG), Mebp, inf_SCR02(0x10))                              \
         prmcx_rr(W(XT), W(XT), IB(1))              /* 2nd-pass <- */        \
         movcx_ld(W(XG), Mebp, inf_SCR02(0))                                 \
@@ -581,20 +589,20 @@
 #define fmscs_ld(XG, XS, MT, DT)                                            \
         movcx_st(W(XS), Mebp, inf_SCR01(0))                                 \
         movcx_st(W(XG), Mebp, inf_SCR02(0))                                 \
-        cvycs_rr(W(XG), W(XS))                     /* 1st-pass -> */        \
-        cvycs_ld(W(XS), W(MT), W(DT))                                       \
+        cvwcs_rr(W(XG), W(XS))                     /* 1st-pass -> */        \
+        cvwcs_ld(W(XS), W(MT), W(DT))                                       \
         mulds_rr(W(XS), W(XG))                                              \
-        cvycs_ld(W(XG), Mebp, inf_SCR02(0x00))                              \
+        cvwcs_ld(W(XG), Mebp, inf_SCR02(0x00))                              \
         subds_rr(W(XG), W(XS))                                              \
-        cvxds_rr(W(XG), W(XG))                                              \
+        cvsds_rr(W(XG), W(XG))                                              \
         movix_st(W(XG), Mebp, inf_SCR02(0x00))                              \
         addwm_ri(W(MT), IC(0x10))                  /* 1st-pass <- */        \
-        cvycs_ld(W(XG), Mebp, inf_SCR01(0x10))     /* 2nd-pass -> */        \
-        cvycs_ld(W(XS), W(MT), W(DT))                                       \
+        cvwcs_ld(W(XG), Mebp, inf_SCR01(0x10))     /* 2nd-pass -> */        \
+        cvwcs_ld(W(XS), W(MT), W(DT))                                       \
         mulds_rr(W(XS), W(XG))                                              \
-        cvycs_ld(W(XG), Mebp, inf_SCR02(0x10))                              \
+        cvwcs_ld(W(XG), Mebp, inf_SCR02(0x10))                              \
         subds_rr(W(XG), W(XS))                                              \
-        cvxds_rr(W(XG), W(XG))                                              \
+        cvsds_rr(W(XG), W(XG))                                              \
         movix_st(W(XG), Mebp, inf_SCR02(0x10))                              \
         subwm_ri(W(MT), IC(0x10))                  /* 2nd-pass <- */        \
         movcx_ld(W(XG), Mebp, inf_SCR02(0))                                 \
@@ -1504,40 +1512,40 @@
 #undef  sregs_sa
 #define sregs_sa() /* save all SIMD regs, destroys Reax */                  \
         movxx_ld(Reax, Mebp, inf_REGS)                                      \
-        muvcx_st(Xmm0, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000001) muvcx_st(Xmm0, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_st(Xmm1, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000002) muvcx_st(Xmm1, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_st(Xmm2, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000004) muvcx_st(Xmm2, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_st(Xmm3, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000008) muvcx_st(Xmm3, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_st(Xmm4, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000010) muvcx_st(Xmm4, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_st(Xmm5, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000020) muvcx_st(Xmm5, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_st(Xmm6, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000040) muvcx_st(Xmm6, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_st(Xmm7, Oeax, PLAIN)
+        ASM_IFS(0x00000080) muvcx_st(Xmm7, Oeax, PLAIN) ASM_FI
 
 #undef  sregs_la
 #define sregs_la() /* load all SIMD regs, destroys Reax */                  \
         movxx_ld(Reax, Mebp, inf_REGS)                                      \
-        muvcx_ld(Xmm0, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000001) muvcx_ld(Xmm0, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_ld(Xmm1, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000002) muvcx_ld(Xmm1, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_ld(Xmm2, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000004) muvcx_ld(Xmm2, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_ld(Xmm3, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000008) muvcx_ld(Xmm3, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_ld(Xmm4, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000010) muvcx_ld(Xmm4, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_ld(Xmm5, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000020) muvcx_ld(Xmm5, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_ld(Xmm6, Oeax, PLAIN)                                         \
+        ASM_IFS(0x00000040) muvcx_ld(Xmm6, Oeax, PLAIN) ASM_FI              \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_ld(Xmm7, Oeax, PLAIN)
+        ASM_IFS(0x00000080) muvcx_ld(Xmm7, Oeax, PLAIN) ASM_FI
 
 #endif /* RT_256X1 */
 
@@ -35,6 +35,8 @@
 /**** var-len **** SIMD instructions with fixed-64-bit element **** 256-bit ***/
 /**** var-len **** SIMD instructions with fixed-64-bit element **** 128-bit ***/
 
+/**** var-len **** SIMD instructions with packed byte/half element ************/
+
 /**** var-len **** SIMD instructions with configurable element **** 32-bit ****/
 /**** 256-bit **** SIMD instructions with configurable element **** 32-bit ****/
 /**** 128-bit **** SIMD instructions with configurable element **** 32-bit ****/
@@ -941,6 +943,55 @@
 #define mmvox_st(XS, MG, DG)                                                \
         mmvcx_st(W(XS), W(MG), W(DG))
 
+/* gth (D = [M + S]) gathers elements at M + S * element-size, M: Oeax, M***
+ * sct ([M + T] = S) scatters elements at M + T * element-size, M: Oeax, M*** */
+
+#define gthox_ld(XD, XS, MT, DT)                                            \
+        gthcx_ld(W(XD), W(XS), W(MT), W(DT))
+
+#define sctox_st(XS, XT, MD, DD)                                            \
+        sctcx_st(W(XS), W(XT), W(MD), W(DD))
+
+/* spl (D = S[i]) broadcasts lane i, rev (D = S reversed) reverses lanes
+ * rot (D[k] = S[(k + i) mod n]) rotates lanes down by i (immediate)
+ * unl/unh (G = G, S interleaved) from lower/upper halves of G and S
+ * tbl (D[k] = S[T[k] mod n]) permutes lanes with lane-indices in T */
+
+#define splox_ri(XD, XS, IS)                                                \
+        splcx_ri(W(XD), W(XS), W(IS))
+
+#define revox_rr(XD, XS)                                                    \
+        revcx_rr(W(XD), W(XS))
+
+#define rotox_ri(XD, XS, IS)                                                \
+        rotcx_ri(W(XD), W(XS), W(IS))
+
+#define unlox_rr(XG, XS)                                                    \
+        unlcx_rr(W(XG), W(XS))
+
+#define unhox_rr(XG, XS)                                                    \
+        unhcx_rr(W(XG), W(XS))
+
+#define tblox_rr(XD, XS, XT)                                                \
+        tblcx_rr(W(XD), W(XS), W(XT))
+
+#define tblox_ld(XD, XS, MT, DT)                                            \
+        tblcx_ld(W(XD), W(XS), W(MT), W(DT))
+
+/* mtl (D = first RS elements from M, 0 above), count in BASE register
+ * mtl (first RT elements at M = S), lanes above the count untouched */
+
+#define mtlox_ld(XD, RS, MT, DT)                                            \
+        mtlcx_ld(W(XD), W(RS), W(MT), W(DT))
+
+#define mtlox_st(XS, RT, MD, DD)                                            \
+        mtlcx_st(W(XS), W(RT), W(MD), W(DD))
+
+/* stn (M = S) streams to aligned M bypassing caches where supported */
+
+#define stnox_st(XS, MD, DD)                                                \
+        stncx_st(W(XS), W(MD), W(DD))
+
 /* and (G = G & S), (D = S & T) if (#D != #S) */
 
 #define andox_rr(XG, XS)                                                    \
@@ -1140,6 +1191,481 @@
 #define cbsos_rr(XG, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
         cbscs_rr(W(XG), W(X1), W(X2), W(XS))
 
+/* exp (D = exp S) */
+
+#define expos_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        expcs_rr(W(XD), W(X1), W(X2), W(XS))
+
+/* log (D = log S) */
+
+#define logos_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        logcs_rr(W(XD), W(X1), W(X2), W(XS))
+
+/* sin (D = sin S) */
+
+#define sinos_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        sincs_rr(W(XD), W(X1), W(X2), W(XS))
+
+/* cos (D = cos S) */
+
+#define cosos_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        coscs_rr(W(XD), W(X1), W(X2), W(XS))
+
+/* tan (D = tan S) */
+
+#define tanos_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        tancs_rr(W(XD), W(X1), W(X2), W(XS))
+
+/* snc (D = sin S, C = cos S) */
+
+#define sncos_rr(XD, XC, X1, X2, XS) /* destroys X1, X2 (temp regs) */      \
+        snccs_rr(W(XD), W(XC), W(X1), W(X2), W(XS))
+
+/* at2 (D = atan2(S, T)) */
+
+#define at2os_rr(XD, X1, X2, XS, XT) /* destroys X1, X2 (temp regs) */      \
+        at2cs_rr(W(XD), W(X1), W(X2), W(XS), W(XT))
+
+/* rng (D = random bits), advances per-lane generator state */
+
+#define rngox_rr(XD, X1) /* destroys X1 (temp reg) */                       \
+        rngcx_rr(W(XD), W(X1))
+
+/* rng (D = random fp in [0, 1)), advances generator state */
+
+#define rngos_rr(XD, X1) /* destroys X1 (temp reg) */                       \
+        rngcs_rr(W(XD), W(X1))
+
+/* mov (D = S) for packed fp16 storage subset */
+
+#define movmx_rr(XD, XS)                                                    \
+        movax_rr(W(XD), W(XS))
+
+#define movmx_ld(XD, MS, DS)                                                \
+        movax_ld(W(XD), W(MS), W(DS))
+
+#define movmx_st(XS, MD, DD)                                                \
+        movax_st(W(XS), W(MD), W(DD))
+
+/* cvx (D = fp16 S), narrows onto lower half, upper half is zeroed */
+
+#define cvxos_rr(XD, XS)                                                    \
+        cvxcs_rr(W(XD), W(XS))
+
+/* cux (G = fp16 S), narrows onto upper half, lower half is kept */
+
+#define cuxos_rr(XG, XS)                                                    \
+        cuxcs_rr(W(XG), W(XS))
+
+/* cvy (D = fp32 S), widens from lower half of S */
+
+#define cvyms_rr(XD, XS)                                                    \
+        cvyas_rr(W(XD), W(XS))
+
+/* cuy (D = fp32 S), widens from upper half of S */
+
+#define cuyms_rr(XD, XS)                                                    \
+        cuyas_rr(W(XD), W(XS))
+
+/* cvy (D = fp64 S), widens from lower half of S */
+
+#define cvyos_rr(XD, XS)                                                    \
+        cvycs_rr(W(XD), W(XS))
+
+/* cuy (D = fp64 S), widens from upper half of S */
+
+#define cuyos_rr(XD, XS)                                                    \
+        cuycs_rr(W(XD), W(XS))
+
+/* add (G = G + S) */
+
+#define addob_rr(XG, XS)                                                    \
+        addcb_rr(W(XG), W(XS))
+
+#define addob_ld(XG, MS, DS)                                                \
+        addcb_ld(W(XG), W(MS), W(DS))
+
+#define addoh_rr(XG, XS)                                                    \
+        addch_rr(W(XG), W(XS))
+
+#define addoh_ld(XG, MS, DS)                                                \
+        addch_ld(W(XG), W(MS), W(DS))
+
+/* sub (G = G - S) */
+
+#define subob_rr(XG, XS)                                                    \
+        subcb_rr(W(XG), W(XS))
+
+#define subob_ld(XG, MS, DS)                                                \
+        subcb_ld(W(XG), W(MS), W(DS))
+
+#define suboh_rr(XG, XS)                                                    \
+        subch_rr(W(XG), W(XS))
+
+#define suboh_ld(XG, MS, DS)                                                \
+        subch_ld(W(XG), W(MS), W(DS))
+
+/* ads (G = G + S), saturating */
+
+#define adsob_rr(XG, XS)                                                    \
+        adscb_rr(W(XG), W(XS))
+
+#define adsob_ld(XG, MS, DS)                                                \
+        adscb_ld(W(XG), W(MS), W(DS))
+
+#define adsoh_rr(XG, XS)                                                    \
+        adsch_rr(W(XG), W(XS))
+
+#define adsoh_ld(XG, MS, DS)                                                \
+        adsch_ld(W(XG), W(MS), W(DS))
+
+#define adsoc_rr(XG, XS)                                                    \
+        adscc_rr(W(XG), W(XS))
+
+#define adsoc_ld(XG, MS, DS)                                                \
+        adscc_ld(W(XG), W(MS), W(DS))
+
+#define adsoi_rr(XG, XS)                                                    \
+        adsci_rr(W(XG), W(XS))
+
+#define adsoi_ld(XG, MS, DS)                                                \
+        adsci_ld(W(XG), W(MS), W(DS))
+
+/* sbs (G = G - S), saturating */
+
+#define sbsob_rr(XG, XS)                                                    \
+        sbscb_rr(W(XG), W(XS))
+
+#define sbsob_ld(XG, MS, DS)                                                \
+        sbscb_ld(W(XG), W(MS), W(DS))
+
+#define sbsoh_rr(XG, XS)                                                    \
+        sbsch_rr(W(XG), W(XS))
+
+#define sbsoh_ld(XG, MS, DS)                                                \
+        sbsch_ld(W(XG), W(MS), W(DS))
+
+#define sbsoc_rr(XG, XS)                                                    \
+        sbscc_rr(W(XG), W(XS))
+
+#define sbsoc_ld(XG, MS, DS)                                                \
+        sbscc_ld(W(XG), W(MS), W(DS))
+
+#define sbsoi_rr(XG, XS)                                                    \
+        sbsci_rr(W(XG), W(XS))
+
+#define sbsoi_ld(XG, MS, DS)                                                \
+        sbsci_ld(W(XG), W(MS), W(DS))
+
+/* min (G = G < S ? G : S) */
+
+#define minob_rr(XG, XS)                                                    \
+        mincb_rr(W(XG), W(XS))
+
+#define minob_ld(XG, MS, DS)                                                \
+        mincb_ld(W(XG), W(MS), W(DS))
+
+#define minoh_rr(XG, XS)                                                    \
+        minch_rr(W(XG), W(XS))
+
+#define minoh_ld(XG, MS, DS)                                                \
+        minch_ld(W(XG), W(MS), W(DS))
+
+#define minoc_rr(XG, XS)                                                    \
+        mincc_rr(W(XG), W(XS))
+
+#define minoc_ld(XG, MS, DS)                                                \
+        mincc_ld(W(XG), W(MS), W(DS))
+
+#define minoi_rr(XG, XS)                                                    \
+        minci_rr(W(XG), W(XS))
+
+#define minoi_ld(XG, MS, DS)                                                \
+        minci_ld(W(XG), W(MS), W(DS))
+
+/* max (G = G > S ? G : S) */
+
+#define maxob_rr(XG, XS)                                                    \
+        maxcb_rr(W(XG), W(XS))
+
+#define maxob_ld(XG, MS, DS)                                                \
+        maxcb_ld(W(XG), W(MS), W(DS))
+
+#define maxoh_rr(XG, XS)                                                    \
+        maxch_rr(W(XG), W(XS))
+
+#define maxoh_ld(XG, MS, DS)                                                \
+        maxch_ld(W(XG), W(MS), W(DS))
+
+#define maxoc_rr(XG, XS)                                                    \
+        maxcc_rr(W(XG), W(XS))
+
+#define maxoc_ld(XG, MS, DS)                                                \
+        maxcc_ld(W(XG), W(MS), W(DS))
+
+#define maxoi_rr(XG, XS)                                                    \
+        maxci_rr(W(XG), W(XS))
+
+#define maxoi_ld(XG, MS, DS)                                                \
+        maxci_ld(W(XG), W(MS), W(DS))
+
+/* ceq (G = G == S ? -1 : 0) */
+
+#define ceqob_rr(XG, XS)                                                    \
+        ceqcb_rr(W(XG), W(XS))
+
+#define ceqob_ld(XG, MS, DS)                                                \
+        ceqcb_ld(W(XG), W(MS), W(DS))
+
+#define ceqoh_rr(XG, XS)                                                    \
+        ceqch_rr(W(XG), W(XS))
+
+#define ceqoh_ld(XG, MS, DS)                                                \
+        ceqch_ld(W(XG), W(MS), W(DS))
+
+/* cne (G = G != S ? -1 : 0) */
+
+#define cneob_rr(XG, XS)                                                    \
+        cnecb_rr(W(XG), W(XS))
+
+#define cneob_ld(XG, MS, DS)                                                \
+        cnecb_ld(W(XG), W(MS), W(DS))
+
+#define cneoh_rr(XG, XS)                                                    \
+        cnech_rr(W(XG), W(XS))
+
+#define cneoh_ld(XG, MS, DS)                                                \
+        cnech_ld(W(XG), W(MS), W(DS))
+
+/* clt (G = G < S ? -1 : 0) */
+
+#define cltob_rr(XG, XS)                                                    \
+        cltcb_rr(W(XG), W(XS))
+
+#define cltob_ld(XG, MS, DS)                                                \
+        cltcb_ld(W(XG), W(MS), W(DS))
+
+#define cltoh_rr(XG, XS)                                                    \
+        cltch_rr(W(XG), W(XS))
+
+#define cltoh_ld(XG, MS, DS)                                                \
+        cltch_ld(W(XG), W(MS), W(DS))
+
+#define cltoc_rr(XG, XS)                                                    \
+        cltcc_rr(W(XG), W(XS))
+
+#define cltoc_ld(XG, MS, DS)                                                \
+        cltcc_ld(W(XG), W(MS), W(DS))
+
+#define cltoi_rr(XG, XS)                                                    \
+        cltci_rr(W(XG), W(XS))
+
+#define cltoi_ld(XG, MS, DS)                                                \
+        cltci_ld(W(XG), W(MS), W(DS))
+
+/* cle (G = G <= S ? -1 : 0) */
+
+#define cleob_rr(XG, XS)                                                    \
+        clecb_rr(W(XG), W(XS))
+
+#define cleob_ld(XG, MS, DS)                                                \
+        clecb_ld(W(XG), W(MS), W(DS))
+
+#define cleoh_rr(XG, XS)                                                    \
+        clech_rr(W(XG), W(XS))
+
+#define cleoh_ld(XG, MS, DS)                                                \
+        clech_ld(W(XG), W(MS), W(DS))
+
+#define cleoc_rr(XG, XS)                                                    \
+        clecc_rr(W(XG), W(XS))
+
+#define cleoc_ld(XG, MS, DS)                                                \
+        clecc_ld(W(XG), W(MS), W(DS))
+
+#define cleoi_rr(XG, XS)                                                    \
+        cleci_rr(W(XG), W(XS))
+
+#define cleoi_ld(XG, MS, DS)                                                \
+        cleci_ld(W(XG), W(MS), W(DS))
+
+/* cgt (G = G > S ? -1 : 0) */
+
+#define cgtob_rr(XG, XS)                                                    \
+        cgtcb_rr(W(XG), W(XS))
+
+#define cgtob_ld(XG, MS, DS)                                                \
+        cgtcb_ld(W(XG), W(MS), W(DS))
+
+#define cgtoh_rr(XG, XS)                                                    \
+        cgtch_rr(W(XG), W(XS))
+
+#define cgtoh_ld(XG, MS, DS)                                                \
+        cgtch_ld(W(XG), W(MS), W(DS))
+
+#define cgtoc_rr(XG, XS)                                                    \
+        cgtcc_rr(W(XG), W(XS))
+
+#define cgtoc_ld(XG, MS, DS)                                                \
+        cgtcc_ld(W(XG), W(MS), W(DS))
+
+#define cgtoi_rr(XG, XS)                                                    \
+        cgtci_rr(W(XG), W(XS))
+
+#define cgtoi_ld(XG, MS, DS)                                                \
+        cgtci_ld(W(XG), W(MS), W(DS))
+
+/* cge (G = G >= S ? -1 : 0) */
+
+#define cgeob_rr(XG, XS)                                                    \
+        cgecb_rr(W(XG), W(XS))
+
+#define cgeob_ld(XG, MS, DS)                                                \
+        cgecb_ld(W(XG), W(MS), W(DS))
+
+#define cgeoh_rr(XG, XS)                                                    \
+        cgech_rr(W(XG), W(XS))
+
+#define cgeoh_ld(XG, MS, DS)                                                \
+        cgech_ld(W(XG), W(MS), W(DS))
+
+#define cgeoc_rr(XG, XS)                                                    \
+        cgecc_rr(W(XG), W(XS))
+
+#define cgeoc_ld(XG, MS, DS)                                                \
+        cgecc_ld(W(XG), W(MS), W(DS))
+
+#define cgeoi_rr(XG, XS)                                                    \
+        cgeci_rr(W(XG), W(XS))
+
+#define cgeoi_ld(XG, MS, DS)                                                \
+        cgeci_ld(W(XG), W(MS), W(DS))
+
+/* shl (G = G << S) - plain, unsigned
+ * for maximum compatibility, shift count mustn't exceed elem-size */
+
+#define shlob_ri(XG, IS)                                                    \
+        shlcb_ri(W(XG), W(IS))
+
+#define shlob_ld(XG, MS, DS) /* loads SIMD, uses first elem, rest zeroed */ \
+        shlcb_ld(W(XG), W(MS), W(DS))
+
+#define shloh_ri(XG, IS)                                                    \
+        shlch_ri(W(XG), W(IS))
+
+#define shloh_ld(XG, MS, DS) /* loads SIMD, uses first elem, rest zeroed */ \
+        shlch_ld(W(XG), W(MS), W(DS))
+
+/* shr (G = G >> S) - plain, unsigned
+ * for maximum compatibility, shift count mustn't exceed elem-size */
+
+#define shrob_ri(XG, IS)                                                    \
+        shrcb_ri(W(XG), W(IS))
+
+#define shrob_ld(XG, MS, DS) /* loads SIMD, uses first elem, rest zeroed */ \
+        shrcb_ld(W(XG), W(MS), W(DS))
+
+#define shroh_ri(XG, IS)                                                    \
+        shrch_ri(W(XG), W(IS))
+
+#define shroh_ld(XG, MS, DS) /* loads SIMD, uses first elem, rest zeroed */ \
+        shrch_ld(W(XG), W(MS), W(DS))
+
+/* shr (G = G >> S) - plain, signed
+ * for maximum compatibility, shift count mustn't exceed elem-size */
+
+#define shroc_ri(XG, IS)                                                    \
+        shrcc_ri(W(XG), W(IS))
+
+#define shroc_ld(XG, MS, DS) /* loads SIMD, uses first elem, rest zeroed */ \
+        shrcc_ld(W(XG), W(MS), W(DS))
+
+#define shroi_ri(XG, IS)                                                    \
+        shrci_ri(W(XG), W(IS))
+
+#define shroi_ld(XG, MS, DS) /* loads SIMD, uses first elem, rest zeroed */ \
+        shrci_ld(W(XG), W(MS), W(DS))
+
+/* cvx (D = bytes S), unsigned saturation, upper half of D is zeroed */
+
+#define cvxoh_rr(XD, XS)                                                    \
+        cvxch_rr(W(XD), W(XS))
+
+/* cux (G = bytes S), unsigned saturation, lower half of G is kept */
+
+#define cuxoh_rr(XG, XS)                                                    \
+        cuxch_rr(W(XG), W(XS))
+
+/* cvx (D = bytes S), signed saturation, upper half of D is zeroed */
+
+#define cvxoi_rr(XD, XS)                                                    \
+        cvxci_rr(W(XD), W(XS))
+
+/* cux (G = bytes S), signed saturation, lower half of G is kept */
+
+#define cuxoi_rr(XG, XS)                                                    \
+        cuxci_rr(W(XG), W(XS))
+
+/* cvx (D = halves S), unsigned saturation, upper half of D is zeroed */
+
+#define cvxox_rr(XD, XS)                                                    \
+        cvxcx_rr(W(XD), W(XS))
+
+/* cux (G = halves S), unsigned saturation, lower half of G is kept */
+
+#define cuxox_rr(XG, XS)                                                    \
+        cuxcx_rr(W(XG), W(XS))
+
+/* cvx (D = halves S), signed saturation, upper half of D is zeroed */
+
+#define cvxon_rr(XD, XS)                                                    \
+        cvxcn_rr(W(XD), W(XS))
+
+/* cux (G = halves S), signed saturation, lower half of G is kept */
+
+#define cuxon_rr(XG, XS)                                                    \
+        cuxcn_rr(W(XG), W(XS))
+
+/* cvy (D = halves S), zero-extends lower half of S */
+
+#define cvyob_rr(XD, XS)                                                    \
+        cvycb_rr(W(XD), W(XS))
+
+/* cuy (D = halves S), zero-extends upper half of S */
+
+#define cuyob_rr(XD, XS)                                                    \
+        cuycb_rr(W(XD), W(XS))
+
+/* cvy (D = halves S), sign-extends lower half of S */
+
+#define cvyoc_rr(XD, XS)                                                    \
+        cvycc_rr(W(XD), W(XS))
+
+/* cuy (D = halves S), sign-extends upper half of S */
+
+#define cuyoc_rr(XD, XS)                                                    \
+        cuycc_rr(W(XD), W(XS))
+
+/* cvy (D = 32-bit S), zero-extends lower half of S */
+
+#define cvyoh_rr(XD, XS)                                                    \
+        cvych_rr(W(XD), W(XS))
+
+/* cuy (D = 32-bit S), zero-extends upper half of S */
+
+#define cuyoh_rr(XD, XS)                                                    \
+        cuych_rr(W(XD), W(XS))
+
+/* cvy (D = 32-bit S), sign-extends lower half of S */
+
+#define cvyoi_rr(XD, XS)                                                    \
+        cvyci_rr(W(XD), W(XS))
+
+/* cuy (D = 32-bit S), sign-extends upper half of S */
+
+#define cuyoi_rr(XD, XS)                                                    \
+        cuyci_rr(W(XD), W(XS))
+
 /* rcp (D = 1.0 / S)
  * accuracy/behavior may vary across supported targets, use accordingly */
 
@@ -1593,6 +2119,80 @@
 #define svron3ld(XD, XS, MT, DT)                                            \
         svrcn3ld(W(XD), W(XS), W(MT), W(DT))
 
+/****************   packed single-precision integer compare   *****************/
+
+/* ceq (G = G == S ? -1 : 0) */
+
+#define ceqox_rr(XG, XS)                                                    \
+        ceqcx_rr(W(XG), W(XS))
+
+#define ceqox_ld(XG, MS, DS)                                                \
+        ceqcx_ld(W(XG), W(MS), W(DS))
+
+/* cne (G = G != S ? -1 : 0) */
+
+#define cneox_rr(XG, XS)                                                    \
+        cnecx_rr(W(XG), W(XS))
+
+#define cneox_ld(XG, MS, DS)                                                \
+        cnecx_ld(W(XG), W(MS), W(DS))
+
+/* clt (G = G < S ? -1 : 0) - unsigned (x), signed (n) */
+
+#define cltox_rr(XG, XS)                                                    \
+        cltcx_rr(W(XG), W(XS))
+
+#define cltox_ld(XG, MS, DS)                                                \
+        cltcx_ld(W(XG), W(MS), W(DS))
+
+#define clton_rr(XG, XS)                                                    \
+        cltcn_rr(W(XG), W(XS))
+
+#define clton_ld(XG, MS, DS)                                                \
+        cltcn_ld(W(XG), W(MS), W(DS))
+
+/* cle (G = G <= S ? -1 : 0) - unsigned (x), signed (n) */
+
+#define cleox_rr(XG, XS)                                                    \
+        clecx_rr(W(XG), W(XS))
+
+#define cleox_ld(XG, MS, DS)                                                \
+        clecx_ld(W(XG), W(MS), W(DS))
+
+#define cleon_rr(XG, XS)                                                    \
+        clecn_rr(W(XG), W(XS))
+
+#define cleon_ld(XG, MS, DS)                                                \
+        clecn_ld(W(XG), W(MS), W(DS))
+
+/* cgt (G = G > S ? -1 : 0) - unsigned (x), signed (n) */
+
+#define cgtox_rr(XG, XS)                                                    \
+        cgtcx_rr(W(XG), W(XS))
+
+#define cgtox_ld(XG, MS, DS)                                                \
+        cgtcx_ld(W(XG), W(MS), W(DS))
+
+#define cgton_rr(XG, XS)                                                    \
+        cgtcn_rr(W(XG), W(XS))
+
+#define cgton_ld(XG, MS, DS)                                                \
+        cgtcn_ld(W(XG), W(MS), W(DS))
+
+/* cge (G = G >= S ? -1 : 0) - unsigned (x), signed (n) */
+
+#define cgeox_rr(XG, XS)                                                    \
+        cgecx_rr(W(XG), W(XS))
+
+#define cgeox_ld(XG, MS, DS)                                                \
+        cgecx_ld(W(XG), W(MS), W(DS))
+
+#define cgeon_rr(XG, XS)                                                    \
+        cgecn_rr(W(XG), W(XS))
+
+#define cgeon_ld(XG, MS, DS)                                                \
+        cgecn_ld(W(XG), W(MS), W(DS))
+
 /******************************************************************************/
 /**** var-len **** SIMD instructions with fixed-32-bit element **** 128-bit ***/
 /******************************************************************************/
@@ -1630,6 +2230,55 @@
 #define mmvox_st(XS, MG, DG)                                                \
         mmvix_st(W(XS), W(MG), W(DG))
 
+/* gth (D = [M + S]) gathers elements at M + S * element-size, M: Oeax, M***
+ * sct ([M + T] = S) scatters elements at M + T * element-size, M: Oeax, M*** */
+
+#define gthox_ld(XD, XS, MT, DT)                                            \
+        gthix_ld(W(XD), W(XS), W(MT), W(DT))
+
+#define sctox_st(XS, XT, MD, DD)                                            \
+        sctix_st(W(XS), W(XT), W(MD), W(DD))
+
+/* spl (D = S[i]) broadcasts lane i, rev (D = S reversed) reverses lanes
+ * rot (D[k] = S[(k + i) mod n]) rotates lanes down by i (immediate)
+ * unl/unh (G = G, S interleaved) from lower/upper halves of G and S
+ * tbl (D[k] = S[T[k] mod n]) permutes lanes with lane-indices in T */
+
+#define splox_ri(XD, XS, IS)                                                \
+        splix_ri(W(XD), W(XS), W(IS))
+
+#define revox_rr(XD, XS)                                                    \
+        revix_rr(W(XD), W(XS))
+
+#define rotox_ri(XD, XS, IS)                                                \
+        rotix_ri(W(XD), W(XS), W(IS))
+
+#define unlox_rr(XG, XS)                                                    \
+        unlix_rr(W(XG), W(XS))
+
+#define unhox_rr(XG, XS)                                                    \
+        unhix_rr(W(XG), W(XS))
+
+#define tblox_rr(XD, XS, XT)                                                \
+        tblix_rr(W(XD), W(XS), W(XT))
+
+#define tblox_ld(XD, XS, MT, DT)                                            \
+        tblix_ld(W(XD), W(XS), W(MT), W(DT))
+
+/* mtl (D = first RS elements from M, 0 above), count in BASE register
+ * mtl (first RT elements at M = S), lanes above the count untouched */
+
+#define mtlox_ld(XD, RS, MT, DT)                                            \
+        mtlix_ld(W(XD), W(RS), W(MT), W(DT))
+
+#define mtlox_st(XS, RT, MD, DD)                                            \
+        mtlix_st(W(XS), W(RT), W(MD), W(DD))
+
+/* stn (M = S) streams to aligned M bypassing caches where supported */
+
+#define stnox_st(XS, MD, DD)                                                \
+        stnix_st(W(XS), W(MD), W(DD))
+
 /* and (G = G & S), (D = S & T) if (#D != #S) */
 
 #define andox_rr(XG, XS)                                                    \
@@ -1829,35 +2478,510 @@
 #define cbsos_rr(XG, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
         cbsis_rr(W(XG), W(X1), W(X2), W(XS))
 
-/* rcp (D = 1.0 / S)
- * accuracy/behavior may vary across supported targets, use accordingly */
+/* exp (D = exp S) */
 
-#define rcpos_rr(XD, XS) /* destroys XS */                                  \
-        rcpis_rr(W(XD), W(XS))
+#define expos_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        expis_rr(W(XD), W(X1), W(X2), W(XS))
 
-#define rceos_rr(XD, XS)                                                    \
-        rceis_rr(W(XD), W(XS))
+/* log (D = log S) */
 
-#define rcsos_rr(XG, XS) /* destroys XS */                                  \
-        rcsis_rr(W(XG), W(XS))
+#define logos_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        logis_rr(W(XD), W(X1), W(X2), W(XS))
 
-/* rsq (D = 1.0 / sqrt S)
- * accuracy/behavior may vary across supported targets, use accordingly */
+/* sin (D = sin S) */
 
-#define rsqos_rr(XD, XS) /* destroys XS */                                  \
-        rsqis_rr(W(XD), W(XS))
+#define sinos_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        sinis_rr(W(XD), W(X1), W(X2), W(XS))
 
-#define rseos_rr(XD, XS)                                                    \
-        rseis_rr(W(XD), W(XS))
+/* cos (D = cos S) */
 
-#define rssos_rr(XG, XS) /* destroys XS */                                  \
-        rssis_rr(W(XG), W(XS))
+#define cosos_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        cosis_rr(W(XD), W(X1), W(X2), W(XS))
 
-/* fma (G = G + S * T) if (#G != #S && #G != #T)
- * NOTE: x87 fpu-fallbacks for fma/fms use round-to-nearest mode by default,
- * enable RT_SIMD_COMPAT_FMR for current SIMD rounding mode to be honoured */
+/* tan (D = tan S) */
 
-#define fmaos_rr(XG, XS, XT)                                                \
+#define tanos_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        tanis_rr(W(XD), W(X1), W(X2), W(XS))
+
+/* snc (D = sin S, C = cos S) */
+
+#define sncos_rr(XD, XC, X1, X2, XS) /* destroys X1, X2 (temp regs) */      \
+        sncis_rr(W(XD), W(XC), W(X1), W(X2), W(XS))
+
+/* at2 (D = atan2(S, T)) */
+
+#define at2os_rr(XD, X1, X2, XS, XT) /* destroys X1, X2 (temp regs) */      \
+        at2is_rr(W(XD), W(X1), W(X2), W(XS), W(XT))
+
+/* rng (D = random bits), advances per-lane generator state */
+
+#define rngox_rr(XD, X1) /* destroys X1 (temp reg) */                       \
+        rngix_rr(W(XD), W(X1))
+
+/* rng (D = random fp in [0, 1)), advances generator state */
+
+#define rngos_rr(XD, X1) /* destroys X1 (temp reg) */                       \
+        rngis_rr(W(XD), W(X1))
+
+/* mov (D = S) for packed fp16 storage subset */
+
+#define movmx_rr(XD, XS)                                                    \
+        movgx_rr(W(XD), W(XS))
+
+#define movmx_ld(XD, MS, DS)                                                \
+        movgx_ld(W(XD), W(MS), W(DS))
+
+#define movmx_st(XS, MD, DD)                                                \
+        movgx_st(W(XS), W(MD), W(DD))
+
+/* cvx (D = fp16 S), narrows onto lower half, upper half is zeroed */
+
+#define cvxos_rr(XD, XS)                                                    \
+        cvxis_rr(W(XD), W(XS))
+
+/* cux (G = fp16 S), narrows onto upper half, lower half is kept */
+
+#define cuxos_rr(XG, XS)                                                    \
+        cuxis_rr(W(XG), W(XS))
+
+/* cvy (D = fp32 S), widens from lower half of S */
+
+#define cvyms_rr(XD, XS)                                                    \
+        cvygs_rr(W(XD), W(XS))
+
+/* cuy (D = fp32 S), widens from upper half of S */
+
+#define cuyms_rr(XD, XS)                                                    \
+        cuygs_rr(W(XD), W(XS))
+
+/* cvy (D = fp64 S), widens from lower half of S */
+
+#define cvyos_rr(XD, XS)                                                    \
+        cvyis_rr(W(XD), W(XS))
+
+/* cuy (D = fp64 S), widens from upper half of S */
+
+#define cuyos_rr(XD, XS)                                                    \
+        cuyis_rr(W(XD), W(XS))
+
+/* add (G = G + S) */
+
+#define addob_rr(XG, XS)                                                    \
+        addib_rr(W(XG), W(XS))
+
+#define addob_ld(XG, MS, DS)                                                \
+        addib_ld(W(XG), W(MS), W(DS))
+
+#define addoh_rr(XG, XS)                                                    \
+        addih_rr(W(XG), W(XS))
+
+#define addoh_ld(XG, MS, DS)                                                \
+        addih_ld(W(XG), W(MS), W(DS))
+
+/* sub (G = G - S) */
+
+#define subob_rr(XG, XS)                                                    \
+        subib_rr(W(XG), W(XS))
+
+#define subob_ld(XG, MS, DS)                                                \
+        subib_ld(W(XG), W(MS), W(DS))
+
+#define suboh_rr(XG, XS)                                                    \
+        subih_rr(W(XG), W(XS))
+
+#define suboh_ld(XG, MS, DS)                                                \
+        subih_ld(W(XG), W(MS), W(DS))
+
+/* ads (G = G + S), saturating */
+
+#define adsob_rr(XG, XS)                                                    \
+        adsib_rr(W(XG), W(XS))
+
+#define adsob_ld(XG, MS, DS)                                                \
+        adsib_ld(W(XG), W(MS), W(DS))
+
+#define adsoh_rr(XG, XS)                                                    \
+        adsih_rr(W(XG), W(XS))
+
+#define adsoh_ld(XG, MS, DS)                                                \
+        adsih_ld(W(XG), W(MS), W(DS))
+
+#define adsoc_rr(XG, XS)                                                    \
+        adsic_rr(W(XG), W(XS))
+
+#define adsoc_ld(XG, MS, DS)                                                \
+        adsic_ld(W(XG), W(MS), W(DS))
+
+#define adsoi_rr(XG, XS)                                                    \
+        adsii_rr(W(XG), W(XS))
+
+#define adsoi_ld(XG, MS, DS)                                                \
+        adsii_ld(W(XG), W(MS), W(DS))
+
+/* sbs (G = G - S), saturating */
+
+#define sbsob_rr(XG, XS)                                                    \
+        sbsib_rr(W(XG), W(XS))
+
+#define sbsob_ld(XG, MS, DS)                                                \
+        sbsib_ld(W(XG), W(MS), W(DS))
+
+#define sbsoh_rr(XG, XS)                                                    \
+        sbsih_rr(W(XG), W(XS))
+
+#define sbsoh_ld(XG, MS, DS)                                                \
+        sbsih_ld(W(XG), W(MS), W(DS))
+
+#define sbsoc_rr(XG, XS)                                                    \
+        sbsic_rr(W(XG), W(XS))
+
+#define sbsoc_ld(XG, MS, DS)                                                \
+        sbsic_ld(W(XG), W(MS), W(DS))
+
+#define sbsoi_rr(XG, XS)                                                    \
+        sbsii_rr(W(XG), W(XS))
+
+#define sbsoi_ld(XG, MS, DS)                                                \
+        sbsii_ld(W(XG), W(MS), W(DS))
+
+/* min (G = G < S ? G : S) */
+
+#define minob_rr(XG, XS)                                                    \
+        minib_rr(W(XG), W(XS))
+
+#define minob_ld(XG, MS, DS)                                                \
+        minib_ld(W(XG), W(MS), W(DS))
+
+#define minoh_rr(XG, XS)                                                    \
+        minih_rr(W(XG), W(XS))
+
+#define minoh_ld(XG, MS, DS)                                                \
+        minih_ld(W(XG), W(MS), W(DS))
+
+#define minoc_rr(XG, XS)                                                    \
+        minic_rr(W(XG), W(XS))
+
+#define minoc_ld(XG, MS, DS)                                                \
+        minic_ld(W(XG), W(MS), W(DS))
+
+#define minoi_rr(XG, XS)                                                    \
+        minii_rr(W(XG), W(XS))
+
+#define minoi_ld(XG, MS, DS)                                                \
+        minii_ld(W(XG), W(MS), W(DS))
+
+/* max (G = G > S ? G : S) */
+
+#define maxob_rr(XG, XS)                                                    \
+        maxib_rr(W(XG), W(XS))
+
+#define maxob_ld(XG, MS, DS)                                                \
+        maxib_ld(W(XG), W(MS), W(DS))
+
+#define maxoh_rr(XG, XS)                                                    \
+        maxih_rr(W(XG), W(XS))
+
+#define maxoh_ld(XG, MS, DS)                                                \
+        maxih_ld(W(XG), W(MS), W(DS))
+
+#define maxoc_rr(XG, XS)                                                    \
+        maxic_rr(W(XG), W(XS))
+
+#define maxoc_ld(XG, MS, DS)                                                \
+        maxic_ld(W(XG), W(MS), W(DS))
+
+#define maxoi_rr(XG, XS)                                                    \
+        maxii_rr(W(XG), W(XS))
+
+#define maxoi_ld(XG, MS, DS)                                                \
+        maxii_ld(W(XG), W(MS), W(DS))
+
+/* ceq (G = G == S ? -1 : 0) */
+
+#define ceqob_rr(XG, XS)                                                    \
+        ceqib_rr(W(XG), W(XS))
+
+#define ceqob_ld(XG, MS, DS)                                                \
+        ceqib_ld(W(XG), W(MS), W(DS))
+
+#define ceqoh_rr(XG, XS)                                                    \
+        ceqih_rr(W(XG), W(XS))
+
+#define ceqoh_ld(XG, MS, DS)                                                \
+        ceqih_ld(W(XG), W(MS), W(DS))
+
+/* cne (G = G != S ? -1 : 0) */
+
+#define cneob_rr(XG, XS)                                                    \
+        cneib_rr(W(XG), W(XS))
+
+#define cneob_ld(XG, MS, DS)                                                \
+        cneib_ld(W(XG), W(MS), W(DS))
+
+#define cneoh_rr(XG, XS)                                                    \
+        cneih_rr(W(XG), W(XS))
+
+#define cneoh_ld(XG, MS, DS)                                                \
+        cneih_ld(W(XG), W(MS), W(DS))
+
+/* clt (G = G < S ? -1 : 0) */
+
+#define cltob_rr(XG, XS)                                                    \
+        cltib_rr(W(XG), W(XS))
+
+#define cltob_ld(XG, MS, DS)                                                \
+        cltib_ld(W(XG), W(MS), W(DS))
+
+#define cltoh_rr(XG, XS)                                                    \
+        cltih_rr(W(XG), W(XS))
+
+#define cltoh_ld(XG, MS, DS)                                                \
+        cltih_ld(W(XG), W(MS), W(DS))
+
+#define cltoc_rr(XG, XS)                                                    \
+        cltic_rr(W(XG), W(XS))
+
+#define cltoc_ld(XG, MS, DS)                                                \
+        cltic_ld(W(XG), W(MS), W(DS))
+
+#define cltoi_rr(XG, XS)                                                    \
+        cltii_rr(W(XG), W(XS))
+
+#define cltoi_ld(XG, MS, DS)                                                \
+        cltii_ld(W(XG), W(MS), W(DS))
+
+/* cle (G = G <= S ? -1 : 0) */
+
+#define cleob_rr(XG, XS)                                                    \
+        cleib_rr(W(XG), W(XS))
+
+#define cleob_ld(XG, MS, DS)                                                \
+        cleib_ld(W(XG), W(MS), W(DS))
+
+#define cleoh_rr(XG, XS)                                                    \
+        cleih_rr(W(XG), W(XS))
+
+#define cleoh_ld(XG, MS, DS)                                                \
+        cleih_ld(W(XG), W(MS), W(DS))
+
+#define cleoc_rr(XG, XS)                                                    \
+        cleic_rr(W(XG), W(XS))
+
+#define cleoc_ld(XG, MS, DS)                                                \
+        cleic_ld(W(XG), W(MS), W(DS))
+
+#define cleoi_rr(XG, XS)                                                    \
+        cleii_rr(W(XG), W(XS))
+
+#define cleoi_ld(XG, MS, DS)                                                \
+        cleii_ld(W(XG), W(MS), W(DS))
+
+/* cgt (G = G > S ? -1 : 0) */
+
+#define cgtob_rr(XG, XS)                                                    \
+        cgtib_rr(W(XG), W(XS))
+
+#define cgtob_ld(XG, MS, DS)                                                \
+        cgtib_ld(W(XG), W(MS), W(DS))
+
+#define cgtoh_rr(XG, XS)                                                    \
+        cgtih_rr(W(XG), W(XS))
+
+#define cgtoh_ld(XG, MS, DS)                                                \
+        cgtih_ld(W(XG), W(MS), W(DS))
+
+#define cgtoc_rr(XG, XS)                                                    \
+        cgtic_rr(W(XG), W(XS))
+
+#define cgtoc_ld(XG, MS, DS)                                                \
+        cgtic_ld(W(XG), W(MS), W(DS))
+
+#define cgtoi_rr(XG, XS)                                                    \
+        cgtii_rr(W(XG), W(XS))
+
+#define cgtoi_ld(XG, MS, DS)                                                \
+        cgtii_ld(W(XG), W(MS), W(DS))
+
+/* cge (G = G >= S ? -1 : 0) */
+
+#define cgeob_rr(XG, XS)                                                    \
+        cgeib_rr(W(XG), W(XS))
+
+#define cgeob_ld(XG, MS, DS)                                                \
+        cgeib_ld(W(XG), W(MS), W(DS))
+
+#define cgeoh_rr(XG, XS)                                                    \
+        cgeih_rr(W(XG), W(XS))
+
+#define cgeoh_ld(XG, MS, DS)                                                \
+        cgeih_ld(W(XG), W(MS), W(DS))
+
+#define cgeoc_rr(XG, XS)                                                    \
+        cgeic_rr(W(XG), W(XS))
+
+#define cgeoc_ld(XG, MS, DS)                                                \
+        cgeic_ld(W(XG), W(MS), W(DS))
+
+#define cgeoi_rr(XG, XS)                                                    \
+        cgeii_rr(W(XG), W(XS))
+
+#define cgeoi_ld(XG, MS, DS)                                                \
+        cgeii_ld(W(XG), W(MS), W(DS))
+
+/* shl (G = G << S) - plain, unsigned
+ * for maximum compatibility, shift count mustn't exceed elem-size */
+
+#define shlob_ri(XG, IS)                                                    \
+        shlib_ri(W(XG), W(IS))
+
+#define shlob_ld(XG, MS, DS) /* loads SIMD, uses first elem, rest zeroed */ \
+        shlib_ld(W(XG), W(MS), W(DS))
+
+#define shloh_ri(XG, IS)                                                    \
+        shlih_ri(W(XG), W(IS))
+
+#define shloh_ld(XG, MS, DS) /* loads SIMD, uses first elem, rest zeroed */ \
+        shlih_ld(W(XG), W(MS), W(DS))
+
+/* shr (G = G >> S) - plain, unsigned
+ * for maximum compatibility, shift count mustn't exceed elem-size */
+
+#define shrob_ri(XG, IS)                                                    \
+        shrib_ri(W(XG), W(IS))
+
+#define shrob_ld(XG, MS, DS) /* loads SIMD, uses first elem, rest zeroed */ \
+        shrib_ld(W(XG), W(MS), W(DS))
+
+#define shroh_ri(XG, IS)                                                    \
+        shrih_ri(W(XG), W(IS))
+
+#define shroh_ld(XG, MS, DS) /* loads SIMD, uses first elem, rest zeroed */ \
+        shrih_ld(W(XG), W(MS), W(DS))
+
+/* shr (G = G >> S) - plain, signed
+ * for maximum compatibility, shift count mustn't exceed elem-size */
+
+#define shroc_ri(XG, IS)                                                    \
+        shric_ri(W(XG), W(IS))
+
+#define shroc_ld(XG, MS, DS) /* loads SIMD, uses first elem, rest zeroed */ \
+        shric_ld(W(XG), W(MS), W(DS))
+
+#define shroi_ri(XG, IS)                                                    \
+        shrii_ri(W(XG), W(IS))
+
+#define shroi_ld(XG, MS, DS) /* loads SIMD, uses first elem, rest zeroed */ \
+        shrii_ld(W(XG), W(MS), W(DS))
+
+/* cvx (D = bytes S), unsigned saturation, upper half of D is zeroed */
+
+#define cvxoh_rr(XD, XS)                                                    \
+        cvxih_rr(W(XD), W(XS))
+
+/* cux (G = bytes S), unsigned saturation, lower half of G is kept */
+
+#define cuxoh_rr(XG, XS)                                                    \
+        cuxih_rr(W(XG), W(XS))
+
+/* cvx (D = bytes S), signed saturation, upper half of D is zeroed */
+
+#define cvxoi_rr(XD, XS)                                                    \
+        cvxii_rr(W(XD), W(XS))
+
+/* cux (G = bytes S), signed saturation, lower half of G is kept */
+
+#define cuxoi_rr(XG, XS)                                                    \
+        cuxii_rr(W(XG), W(XS))
+
+/* cvx (D = halves S), unsigned saturation, upper half of D is zeroed */
+
+#define cvxox_rr(XD, XS)                                                    \
+        cvxix_rr(W(XD), W(XS))
+
+/* cux (G = halves S), unsigned saturation, lower half of G is kept */
+
+#define cuxox_rr(XG, XS)                                                    \
+        cuxix_rr(W(XG), W(XS))
+
+/* cvx (D = halves S), signed saturation, upper half of D is zeroed */
+
+#define cvxon_rr(XD, XS)                                                    \
+        cvxin_rr(W(XD), W(XS))
+
+/* cux (G = halves S), signed saturation, lower half of G is kept */
+
+#define cuxon_rr(XG, XS)                                                    \
+        cuxin_rr(W(XG), W(XS))
+
+/* cvy (D = halves S), zero-extends lower half of S */
+
+#define cvyob_rr(XD, XS)                                                    \
+        cvyib_rr(W(XD), W(XS))
+
+/* cuy (D = halves S), zero-extends upper half of S */
+
+#define cuyob_rr(XD, XS)                                                    \
+        cuyib_rr(W(XD), W(XS))
+
+/* cvy (D = halves S), sign-extends lower half of S */
+
+#define cvyoc_rr(XD, XS)                                                    \
+        cvyic_rr(W(XD), W(XS))
+
+/* cuy (D = halves S), sign-extends upper half of S */
+
+#define cuyoc_rr(XD, XS)                                                    \
+        cuyic_rr(W(XD), W(XS))
+
+/* cvy (D = 32-bit S), zero-extends lower half of S */
+
+#define cvyoh_rr(XD, XS)                                                    \
+        cvyih_rr(W(XD), W(XS))
+
+/* cuy (D = 32-bit S), zero-extends upper half of S */
+
+#define cuyoh_rr(XD, XS)                                                    \
+        cuyih_rr(W(XD), W(XS))
+
+/* cvy (D = 32-bit S), sign-extends lower half of S */
+
+#define cvyoi_rr(XD, XS)                                                    \
+        cvyii_rr(W(XD), W(XS))
+
+/* cuy (D = 32-bit S), sign-extends upper half of S */
+
+#define cuyoi_rr(XD, XS)                                                    \
+        cuyii_rr(W(XD), W(XS))
+
+/* rcp (D = 1.0 / S)
+ * accuracy/behavior may vary across supported targets, use accordingly */
+
+#define rcpos_rr(XD, XS) /* destroys XS */                                  \
+        rcpis_rr(W(XD), W(XS))
+
+#define rceos_rr(XD, XS)                                                    \
+        rceis_rr(W(XD), W(XS))
+
+#define rcsos_rr(XG, XS) /* destroys XS */                                  \
+        rcsis_rr(W(XG), W(XS))
+
+/* rsq (D = 1.0 / sqrt S)
+ * accuracy/behavior may vary across supported targets, use accordingly */
+
+#define rsqos_rr(XD, XS) /* destroys XS */                                  \
+        rsqis_rr(W(XD), W(XS))
+
+#define rseos_rr(XD, XS)                                                    \
+        rseis_rr(W(XD), W(XS))
+
+#define rssos_rr(XG, XS) /* destroys XS */                                  \
+        rssis_rr(W(XG), W(XS))
+
+/* fma (G = G + S * T) if (#G != #S && #G != #T)
+ * NOTE: x87 fpu-fallbacks for fma/fms use round-to-nearest mode by default,
+ * enable RT_SIMD_COMPAT_FMR for current SIMD rounding mode to be honoured */
+
+#define fmaos_rr(XG, XS, XT)                                                \
         fmais_rr(W(XG), W(XS), W(XT))
 
 #define fmaos_ld(XG, XS, MT, DT)                                            \
@@ -2282,6 +3406,80 @@
 #define svron3ld(XD, XS, MT, DT)                                            \
         svrin3ld(W(XD), W(XS), W(MT), W(DT))
 
+/****************   packed single-precision integer compare   *****************/
+
+/* ceq (G = G == S ? -1 : 0) */
+
+#define ceqox_rr(XG, XS)                                                    \
+        ceqix_rr(W(XG), W(XS))
+
+#define ceqox_ld(XG, MS, DS)                                                \
+        ceqix_ld(W(XG), W(MS), W(DS))
+
+/* cne (G = G != S ? -1 : 0) */
+
+#define cneox_rr(XG, XS)                                                    \
+        cneix_rr(W(XG), W(XS))
+
+#define cneox_ld(XG, MS, DS)                                                \
+        cneix_ld(W(XG), W(MS), W(DS))
+
+/* clt (G = G < S ? -1 : 0) - unsigned (x), signed (n) */
+
+#define cltox_rr(XG, XS)                                                    \
+        cltix_rr(W(XG), W(XS))
+
+#define cltox_ld(XG, MS, DS)                                                \
+        cltix_ld(W(XG), W(MS), W(DS))
+
+#define clton_rr(XG, XS)                                                    \
+        cltin_rr(W(XG), W(XS))
+
+#define clton_ld(XG, MS, DS)                                                \
+        cltin_ld(W(XG), W(MS), W(DS))
+
+/* cle (G = G <= S ? -1 : 0) - unsigned (x), signed (n) */
+
+#define cleox_rr(XG, XS)                                                    \
+        cleix_rr(W(XG), W(XS))
+
+#define cleox_ld(XG, MS, DS)                                                \
+        cleix_ld(W(XG), W(MS), W(DS))
+
+#define cleon_rr(XG, XS)                                                    \
+        clein_rr(W(XG), W(XS))
+
+#define cleon_ld(XG, MS, DS)                                                \
+        clein_ld(W(XG), W(MS), W(DS))
+
+/* cgt (G = G > S ? -1 : 0) - unsigned (x), signed (n) */
+
+#define cgtox_rr(XG, XS)                                                    \
+        cgtix_rr(W(XG), W(XS))
+
+#define cgtox_ld(XG, MS, DS)                                                \
+        cgtix_ld(W(XG), W(MS), W(DS))
+
+#define cgton_rr(XG, XS)                                                    \
+        cgtin_rr(W(XG), W(XS))
+
+#define cgton_ld(XG, MS, DS)                                                \
+        cgtin_ld(W(XG), W(MS), W(DS))
+
+/* cge (G = G >= S ? -1 : 0) - unsigned (x), signed (n) */
+
+#define cgeox_rr(XG, XS)                                                    \
+        cgeix_rr(W(XG), W(XS))
+
+#define cgeox_ld(XG, MS, DS)                                                \
+        cgeix_ld(W(XG), W(MS), W(DS))
+
+#define cgeon_rr(XG, XS)                                                    \
+        cgein_rr(W(XG), W(XS))
+
+#define cgeon_ld(XG, MS, DS)                                                \
+        cgein_ld(W(XG), W(MS), W(DS))
+
 #endif /* RT_SIMD: 256, 128 */
 
 /******************************************************************************/
@@ -2321,6 +3519,55 @@
 #define mmvqx_st(XS, MG, DG)                                                \
         mmvdx_st(W(XS), W(MG), W(DG))
 
+/* gth (D = [M + S]) gathers elements at M + S * element-size, M: Oeax, M***
+ * sct ([M + T] = S) scatters elements at M + T * element-size, M: Oeax, M*** */
+
+#define gthqx_ld(XD, XS, MT, DT)                                            \
+        gthdx_ld(W(XD), W(XS), W(MT), W(DT))
+
+#define sctqx_st(XS, XT, MD, DD)                                            \
+        sctdx_st(W(XS), W(XT), W(MD), W(DD))
+
+/* spl (D = S[i]) broadcasts lane i, rev (D = S reversed) reverses lanes
+ * rot (D[k] = S[(k + i) mod n]) rotates lanes down by i (immediate)
+ * unl/unh (G = G, S interleaved) from lower/upper halves of G and S
+ * tbl (D[k] = S[T[k] mod n]) permutes lanes with lane-indices in T */
+
+#define splqx_ri(XD, XS, IS)                                                \
+        spldx_ri(W(XD), W(XS), W(IS))
+
+#define revqx_rr(XD, XS)                                                    \
+        revdx_rr(W(XD), W(XS))
+
+#define rotqx_ri(XD, XS, IS)                                                \
+        rotdx_ri(W(XD), W(XS), W(IS))
+
+#define unlqx_rr(XG, XS)                                                    \
+        unldx_rr(W(XG), W(XS))
+
+#define unhqx_rr(XG, XS)                                                    \
+        unhdx_rr(W(XG), W(XS))
+
+#define tblqx_rr(XD, XS, XT)                                                \
+        tbldx_rr(W(XD), W(XS), W(XT))
+
+#define tblqx_ld(XD, XS, MT, DT)                                            \
+        tbldx_ld(W(XD), W(XS), W(MT), W(DT))
+
+/* mtl (D = first RS elements from M, 0 above), count in BASE register
+ * mtl (first RT elements at M = S), lanes above the count untouched */
+
+#define mtlqx_ld(XD, RS, MT, DT)                                            \
+        mtldx_ld(W(XD), W(RS), W(MT), W(DT))
+
+#define mtlqx_st(XS, RT, MD, DD)                                            \
+        mtldx_st(W(XS), W(RT), W(MD), W(DD))
+
+/* stn (M = S) streams to aligned M bypassing caches where supported */
+
+#define stnqx_st(XS, MD, DD)                                                \
+        stndx_st(W(XS), W(MD), W(DD))
+
 /* and (G = G & S), (D = S & T) if (#D != #S) */
 
 #define andqx_rr(XG, XS)                                                    \
@@ -2520,31 +3767,86 @@
 #define cbsqs_rr(XG, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
         cbsds_rr(W(XG), W(X1), W(X2), W(XS))
 
-/* rcp (D = 1.0 / S)
- * accuracy/behavior may vary across supported targets, use accordingly */
+/* exp (D = exp S) */
 
-#define rcpqs_rr(XD, XS) /* destroys XS */                                  \
-        rcpds_rr(W(XD), W(XS))
+#define expqs_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        expds_rr(W(XD), W(X1), W(X2), W(XS))
 
-#define rceqs_rr(XD, XS)                                                    \
-        rceds_rr(W(XD), W(XS))
+/* log (D = log S) */
 
-#define rcsqs_rr(XG, XS) /* destroys XS */                                  \
-        rcsds_rr(W(XG), W(XS))
+#define logqs_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        logds_rr(W(XD), W(X1), W(X2), W(XS))
 
-/* rsq (D = 1.0 / sqrt S)
- * accuracy/behavior may vary across supported targets, use accordingly */
+/* sin (D = sin S) */
 
-#define rsqqs_rr(XD, XS) /* destroys XS */                                  \
-        rsqds_rr(W(XD), W(XS))
+#define sinqs_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        sinds_rr(W(XD), W(X1), W(X2), W(XS))
 
-#define rseqs_rr(XD, XS)                                                    \
-        rseds_rr(W(XD), W(XS))
+/* cos (D = cos S) */
 
-#define rssqs_rr(XG, XS) /* destroys XS */                                  \
-        rssds_rr(W(XG), W(XS))
+#define cosqs_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        cosds_rr(W(XD), W(X1), W(X2), W(XS))
 
-/* fma (G = G + S * T) if (#G != #S && #G != #T)
+/* tan (D = tan S) */
+
+#define tanqs_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        tands_rr(W(XD), W(X1), W(X2), W(XS))
+
+/* snc (D = sin S, C = cos S) */
+
+#define sncqs_rr(XD, XC, X1, X2, XS) /* destroys X1, X2 (temp regs) */      \
+        sncds_rr(W(XD), W(XC), W(X1), W(X2), W(XS))
+
+/* at2 (D = atan2(S, T)) */
+
+#define at2qs_rr(XD, X1, X2, XS, XT) /* destroys X1, X2 (temp regs) */      \
+        at2ds_rr(W(XD), W(X1), W(X2), W(XS), W(XT))
+
+/* rng (D = random bits), advances per-lane generator state */
+
+#define rngqx_rr(XD, X1) /* destroys X1 (temp reg) */                       \
+        rngdx_rr(W(XD), W(X1))
+
+/* rng (D = random fp in [0, 1)), advances generator state */
+
+#define rngqs_rr(XD, X1) /* destroys X1 (temp reg) */                       \
+        rngds_rr(W(XD), W(X1))
+
+/* cvx (D = fp32 S), narrows onto lower half, upper half is zeroed */
+
+#define cvxqs_rr(XD, XS)                                                    \
+        cvxds_rr(W(XD), W(XS))
+
+/* cux (G = fp32 S), narrows onto upper half, lower half is kept */
+
+#define cuxqs_rr(XG, XS)                                                    \
+        cuxds_rr(W(XG), W(XS))
+
+/* rcp (D = 1.0 / S)
+ * accuracy/behavior may vary across supported targets, use accordingly */
+
+#define rcpqs_rr(XD, XS) /* destroys XS */                                  \
+        rcpds_rr(W(XD), W(XS))
+
+#define rceqs_rr(XD, XS)                                                    \
+        rceds_rr(W(XD), W(XS))
+
+#define rcsqs_rr(XG, XS) /* destroys XS */                                  \
+        rcsds_rr(W(XG), W(XS))
+
+/* rsq (D = 1.0 / sqrt S)
+ * accuracy/behavior may vary across supported targets, use accordingly */
+
+#define rsqqs_rr(XD, XS) /* destroys XS */                                  \
+        rsqds_rr(W(XD), W(XS))
+
+#define rseqs_rr(XD, XS)                                                    \
+        rseds_rr(W(XD), W(XS))
+
+#define rssqs_rr(XG, XS) /* destroys XS */                                  \
+        rssds_rr(W(XG), W(XS))
+
+/* fma (G = G + S * T) if (#G != #S && #G != #T)
  * NOTE: x87 fpu-fallbacks for fma/fms use round-to-nearest mode by default,
  * enable RT_SIMD_COMPAT_FMR for current SIMD rounding mode to be honoured */
 
@@ -2973,6 +4275,80 @@
 #define svrqn3ld(XD, XS, MT, DT)                                            \
         svrdn3ld(W(XD), W(XS), W(MT), W(DT))
 
+/****************   packed double-precision integer compare   *****************/
+
+/* ceq (G = G == S ? -1 : 0) */
+
+#define ceqqx_rr(XG, XS)                                                    \
+        ceqdx_rr(W(XG), W(XS))
+
+#define ceqqx_ld(XG, MS, DS)                                                \
+        ceqdx_ld(W(XG), W(MS), W(DS))
+
+/* cne (G = G != S ? -1 : 0) */
+
+#define cneqx_rr(XG, XS)                                                    \
+        cnedx_rr(W(XG), W(XS))
+
+#define cneqx_ld(XG, MS, DS)                                                \
+        cnedx_ld(W(XG), W(MS), W(DS))
+
+/* clt (G = G < S ? -1 : 0) - unsigned (x), signed (n) */
+
+#define cltqx_rr(XG, XS)                                                    \
+        cltdx_rr(W(XG), W(XS))
+
+#define cltqx_ld(XG, MS, DS)                                                \
+        cltdx_ld(W(XG), W(MS), W(DS))
+
+#define cltqn_rr(XG, XS)                                                    \
+        cltdn_rr(W(XG), W(XS))
+
+#define cltqn_ld(XG, MS, DS)                                                \
+        cltdn_ld(W(XG), W(MS), W(DS))
+
+/* cle (G = G <= S ? -1 : 0) - unsigned (x), signed (n) */
+
+#define cleqx_rr(XG, XS)                                                    \
+        cledx_rr(W(XG), W(XS))
+
+#define cleqx_ld(XG, MS, DS)                                                \
+        cledx_ld(W(XG), W(MS), W(DS))
+
+#define cleqn_rr(XG, XS)                                                    \
+        cledn_rr(W(XG), W(XS))
+
+#define cleqn_ld(XG, MS, DS)                                                \
+        cledn_ld(W(XG), W(MS), W(DS))
+
+/* cgt (G = G > S ? -1 : 0) - unsigned (x), signed (n) */
+
+#define cgtqx_rr(XG, XS)                                                    \
+        cgtdx_rr(W(XG), W(XS))
+
+#define cgtqx_ld(XG, MS, DS)                                                \
+        cgtdx_ld(W(XG), W(MS), W(DS))
+
+#define cgtqn_rr(XG, XS)                                                    \
+        cgtdn_rr(W(XG), W(XS))
+
+#define cgtqn_ld(XG, MS, DS)                                                \
+        cgtdn_ld(W(XG), W(MS), W(DS))
+
+/* cge (G = G >= S ? -1 : 0) - unsigned (x), signed (n) */
+
+#define cgeqx_rr(XG, XS)                                                    \
+        cgedx_rr(W(XG), W(XS))
+
+#define cgeqx_ld(XG, MS, DS)                                                \
+        cgedx_ld(W(XG), W(MS), W(DS))
+
+#define cgeqn_rr(XG, XS)                                                    \
+        cgedn_rr(W(XG), W(XS))
+
+#define cgeqn_ld(XG, MS, DS)                                                \
+        cgedn_ld(W(XG), W(MS), W(DS))
+
 /******************************************************************************/
 /**** var-len **** SIMD instructions with fixed-64-bit element **** 128-bit ***/
 /******************************************************************************/
@@ -3010,6 +4386,55 @@
 #define mmvqx_st(XS, MG, DG)                                                \
         mmvjx_st(W(XS), W(MG), W(DG))
 
+/* gth (D = [M + S]) gathers elements at M + S * element-size, M: Oeax, M***
+ * sct ([M + T] = S) scatters elements at M + T * element-size, M: Oeax, M*** */
+
+#define gthqx_ld(XD, XS, MT, DT)                                            \
+        gthjx_ld(W(XD), W(XS), W(MT), W(DT))
+
+#define sctqx_st(XS, XT, MD, DD)                                            \
+        sctjx_st(W(XS), W(XT), W(MD), W(DD))
+
+/* spl (D = S[i]) broadcasts lane i, rev (D = S reversed) reverses lanes
+ * rot (D[k] = S[(k + i) mod n]) rotates lanes down by i (immediate)
+ * unl/unh (G = G, S interleaved) from lower/upper halves of G and S
+ * tbl (D[k] = S[T[k] mod n]) permutes lanes with lane-indices in T */
+
+#define splqx_ri(XD, XS, IS)                                                \
+        spljx_ri(W(XD), W(XS), W(IS))
+
+#define revqx_rr(XD, XS)                                                    \
+        revjx_rr(W(XD), W(XS))
+
+#define rotqx_ri(XD, XS, IS)                                                \
+        rotjx_ri(W(XD), W(XS), W(IS))
+
+#define unlqx_rr(XG, XS)                                                    \
+        unljx_rr(W(XG), W(XS))
+
+#define unhqx_rr(XG, XS)                                                    \
+        unhjx_rr(W(XG), W(XS))
+
+#define tblqx_rr(XD, XS, XT)                                                \
+        tbljx_rr(W(XD), W(XS), W(XT))
+
+#define tblqx_ld(XD, XS, MT, DT)                                            \
+        tbljx_ld(W(XD), W(XS), W(MT), W(DT))
+
+/* mtl (D = first RS elements from M, 0 above), count in BASE register
+ * mtl (first RT elements at M = S), lanes above the count untouched */
+
+#define mtlqx_ld(XD, RS, MT, DT)                                            \
+        mtljx_ld(W(XD), W(RS), W(MT), W(DT))
+
+#define mtlqx_st(XS, RT, MD, DD)                                            \
+        mtljx_st(W(XS), W(RT), W(MD), W(DD))
+
+/* stn (M = S) streams to aligned M bypassing caches where supported */
+
+#define stnqx_st(XS, MD, DD)                                                \
+        stnjx_st(W(XS), W(MD), W(DD))
+
 /* and (G = G & S), (D = S & T) if (#D != #S) */
 
 #define andqx_rr(XG, XS)                                                    \
@@ -3209,6 +4634,61 @@
 #define cbsqs_rr(XG, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
         cbsjs_rr(W(XG), W(X1), W(X2), W(XS))
 
+/* exp (D = exp S) */
+
+#define expqs_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        expjs_rr(W(XD), W(X1), W(X2), W(XS))
+
+/* log (D = log S) */
+
+#define logqs_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        logjs_rr(W(XD), W(X1), W(X2), W(XS))
+
+/* sin (D = sin S) */
+
+#define sinqs_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        sinjs_rr(W(XD), W(X1), W(X2), W(XS))
+
+/* cos (D = cos S) */
+
+#define cosqs_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        cosjs_rr(W(XD), W(X1), W(X2), W(XS))
+
+/* tan (D = tan S) */
+
+#define tanqs_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        tanjs_rr(W(XD), W(X1), W(X2), W(XS))
+
+/* snc (D = sin S, C = cos S) */
+
+#define sncqs_rr(XD, XC, X1, X2, XS) /* destroys X1, X2 (temp regs) */      \
+        sncjs_rr(W(XD), W(XC), W(X1), W(X2), W(XS))
+
+/* at2 (D = atan2(S, T)) */
+
+#define at2qs_rr(XD, X1, X2, XS, XT) /* destroys X1, X2 (temp regs) */      \
+        at2js_rr(W(XD), W(X1), W(X2), W(XS), W(XT))
+
+/* rng (D = random bits), advances per-lane generator state */
+
+#define rngqx_rr(XD, X1) /* destroys X1 (temp reg) */                       \
+        rngjx_rr(W(XD), W(X1))
+
+/* rng (D = random fp in [0, 1)), advances generator state */
+
+#define rngqs_rr(XD, X1) /* destroys X1 (temp reg) */                       \
+        rngjs_rr(W(XD), W(X1))
+
+/* cvx (D = fp32 S), narrows onto lower half, upper half is zeroed */
+
+#define cvxqs_rr(XD, XS)                                                    \
+        cvxjs_rr(W(XD), W(XS))
+
+/* cux (G = fp32 S), narrows onto upper half, lower half is kept */
+
+#define cuxqs_rr(XG, XS)                                                    \
+        cuxjs_rr(W(XG), W(XS))
+
 /* rcp (D = 1.0 / S)
  * accuracy/behavior may vary across supported targets, use accordingly */
 
@@ -3525,144 +5005,614 @@
 #define rnrqs_rr(XD, XS, mode)                                              \
         rnrjs_rr(W(XD), W(XS), mode)
 
-#define cvrqs_rr(XD, XS, mode)                                              \
-        cvrjs_rr(W(XD), W(XS), mode)
+#define cvrqs_rr(XD, XS, mode)                                              \
+        cvrjs_rr(W(XD), W(XS), mode)
+
+/************   packed double-precision integer arithmetic/shifts   ***********/
+
+/* add (G = G + S), (D = S + T) if (#D != #S) */
+
+#define addqx_rr(XG, XS)                                                    \
+        addjx_rr(W(XG), W(XS))
+
+#define addqx_ld(XG, MS, DS)                                                \
+        addjx_ld(W(XG), W(MS), W(DS))
+
+#define addqx3rr(XD, XS, XT)                                                \
+        addjx3rr(W(XD), W(XS), W(XT))
+
+#define addqx3ld(XD, XS, MT, DT)                                            \
+        addjx3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* sub (G = G - S), (D = S - T) if (#D != #S) */
+
+#define subqx_rr(XG, XS)                                                    \
+        subjx_rr(W(XG), W(XS))
+
+#define subqx_ld(XG, MS, DS)                                                \
+        subjx_ld(W(XG), W(MS), W(DS))
+
+#define subqx3rr(XD, XS, XT)                                                \
+        subjx3rr(W(XD), W(XS), W(XT))
+
+#define subqx3ld(XD, XS, MT, DT)                                            \
+        subjx3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* mul (G = G * S), (D = S * T) if (#D != #S) */
+
+#define mulqx_rr(XG, XS)                                                    \
+        muljx_rr(W(XG), W(XS))
+
+#define mulqx_ld(XG, MS, DS)                                                \
+        muljx_ld(W(XG), W(MS), W(DS))
+
+#define mulqx3rr(XD, XS, XT)                                                \
+        muljx3rr(W(XD), W(XS), W(XT))
+
+#define mulqx3ld(XD, XS, MT, DT)                                            \
+        muljx3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* shl (G = G << S), (D = S << T) if (#D != #S) - plain, unsigned
+ * for maximum compatibility, shift count mustn't exceed elem-size */
+
+#define shlqx_ri(XG, IS)                                                    \
+        shljx_ri(W(XG), W(IS))
+
+#define shlqx_ld(XG, MS, DS) /* loads SIMD, uses first elem, rest zeroed */ \
+        shljx_ld(W(XG), W(MS), W(DS))
+
+#define shlqx3ri(XD, XS, IT)                                                \
+        shljx3ri(W(XD), W(XS), W(IT))
+
+#define shlqx3ld(XD, XS, MT, DT)                                            \
+        shljx3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* shr (G = G >> S), (D = S >> T) if (#D != #S) - plain, unsigned
+ * for maximum compatibility, shift count mustn't exceed elem-size */
+
+#define shrqx_ri(XG, IS)                                                    \
+        shrjx_ri(W(XG), W(IS))
+
+#define shrqx_ld(XG, MS, DS) /* loads SIMD, uses first elem, rest zeroed */ \
+        shrjx_ld(W(XG), W(MS), W(DS))
+
+#define shrqx3ri(XD, XS, IT)                                                \
+        shrjx3ri(W(XD), W(XS), W(IT))
+
+#define shrqx3ld(XD, XS, MT, DT)                                            \
+        shrjx3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* shr (G = G >> S), (D = S >> T) if (#D != #S) - plain, signed
+ * for maximum compatibility, shift count mustn't exceed elem-size */
+
+#define shrqn_ri(XG, IS)                                                    \
+        shrjn_ri(W(XG), W(IS))
+
+#define shrqn_ld(XG, MS, DS) /* loads SIMD, uses first elem, rest zeroed */ \
+        shrjn_ld(W(XG), W(MS), W(DS))
+
+#define shrqn3ri(XD, XS, IT)                                                \
+        shrjn3ri(W(XD), W(XS), W(IT))
+
+#define shrqn3ld(XD, XS, MT, DT)                                            \
+        shrjn3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* svl (G = G << S), (D = S << T) if (#D != #S) - variable, unsigned
+ * for maximum compatibility, shift count mustn't exceed elem-size */
+
+#define svlqx_rr(XG, XS)     /* variable shift with per-elem count */       \
+        svljx_rr(W(XG), W(XS))
+
+#define svlqx_ld(XG, MS, DS) /* variable shift with per-elem count */       \
+        svljx_ld(W(XG), W(MS), W(DS))
+
+#define svlqx3rr(XD, XS, XT)                                                \
+        svljx3rr(W(XD), W(XS), W(XT))
+
+#define svlqx3ld(XD, XS, MT, DT)                                            \
+        svljx3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* svr (G = G >> S), (D = S >> T) if (#D != #S) - variable, unsigned
+ * for maximum compatibility, shift count mustn't exceed elem-size */
+
+#define svrqx_rr(XG, XS)     /* variable shift with per-elem count */       \
+        svrjx_rr(W(XG), W(XS))
+
+#define svrqx_ld(XG, MS, DS) /* variable shift with per-elem count */       \
+        svrjx_ld(W(XG), W(MS), W(DS))
+
+#define svrqx3rr(XD, XS, XT)                                                \
+        svrjx3rr(W(XD), W(XS), W(XT))
+
+#define svrqx3ld(XD, XS, MT, DT)                                            \
+        svrjx3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* svr (G = G >> S), (D = S >> T) if (#D != #S) - variable, signed
+ * for maximum compatibility, shift count mustn't exceed elem-size */
+
+#define svrqn_rr(XG, XS)     /* variable shift with per-elem count */       \
+        svrjn_rr(W(XG), W(XS))
+
+#define svrqn_ld(XG, MS, DS) /* variable shift with per-elem count */       \
+        svrjn_ld(W(XG), W(MS), W(DS))
+
+#define svrqn3rr(XD, XS, XT)                                                \
+        svrjn3rr(W(XD), W(XS), W(XT))
+
+#define svrqn3ld(XD, XS, MT, DT)                                            \
+        svrjn3ld(W(XD), W(XS), W(MT), W(DT))
+
+/****************   packed double-precision integer compare   *****************/
+
+/* ceq (G = G == S ? -1 : 0) */
+
+#define ceqqx_rr(XG, XS)                                                    \
+        ceqjx_rr(W(XG), W(XS))
+
+#define ceqqx_ld(XG, MS, DS)                                                \
+        ceqjx_ld(W(XG), W(MS), W(DS))
+
+/* cne (G = G != S ? -1 : 0) */
+
+#define cneqx_rr(XG, XS)                                                    \
+        cnejx_rr(W(XG), W(XS))
+
+#define cneqx_ld(XG, MS, DS)                                                \
+        cnejx_ld(W(XG), W(MS), W(DS))
+
+/* clt (G = G < S ? -1 : 0) - unsigned (x), signed (n) */
+
+#define cltqx_rr(XG, XS)                                                    \
+        cltjx_rr(W(XG), W(XS))
+
+#define cltqx_ld(XG, MS, DS)                                                \
+        cltjx_ld(W(XG), W(MS), W(DS))
+
+#define cltqn_rr(XG, XS)                                                    \
+        cltjn_rr(W(XG), W(XS))
+
+#define cltqn_ld(XG, MS, DS)                                                \
+        cltjn_ld(W(XG), W(MS), W(DS))
+
+/* cle (G = G <= S ? -1 : 0) - unsigned (x), signed (n) */
+
+#define cleqx_rr(XG, XS)                                                    \
+        clejx_rr(W(XG), W(XS))
+
+#define cleqx_ld(XG, MS, DS)                                                \
+        clejx_ld(W(XG), W(MS), W(DS))
+
+#define cleqn_rr(XG, XS)                                                    \
+        clejn_rr(W(XG), W(XS))
+
+#define cleqn_ld(XG, MS, DS)                                                \
+        clejn_ld(W(XG), W(MS), W(DS))
+
+/* cgt (G = G > S ? -1 : 0) - unsigned (x), signed (n) */
+
+#define cgtqx_rr(XG, XS)                                                    \
+        cgtjx_rr(W(XG), W(XS))
+
+#define cgtqx_ld(XG, MS, DS)                                                \
+        cgtjx_ld(W(XG), W(MS), W(DS))
+
+#define cgtqn_rr(XG, XS)                                                    \
+        cgtjn_rr(W(XG), W(XS))
+
+#define cgtqn_ld(XG, MS, DS)                                                \
+        cgtjn_ld(W(XG), W(MS), W(DS))
+
+/* cge (G = G >= S ? -1 : 0) - unsigned (x), signed (n) */
+
+#define cgeqx_rr(XG, XS)                                                    \
+        cgejx_rr(W(XG), W(XS))
+
+#define cgeqx_ld(XG, MS, DS)                                                \
+        cgejx_ld(W(XG), W(MS), W(DS))
+
+#define cgeqn_rr(XG, XS)                                                    \
+        cgejn_rr(W(XG), W(XS))
+
+#define cgeqn_ld(XG, MS, DS)                                                \
+        cgejn_ld(W(XG), W(MS), W(DS))
+
+#endif /* RT_SIMD: 256, 128 */
+
+/******************************************************************************/
+/**** var-len **** SIMD instructions with packed byte/half element ************/
+/******************************************************************************/
+
+/* packed byte/half integer subsets (cmdpb_, cmdph_, cmdpc_, cmdpi_) map
+ * onto 32-bit lanes regardless of configurable element, see rtbase.h */
+
+/* add (G = G + S) */
+
+#define addpb_rr(XG, XS)                                                    \
+        addob_rr(W(XG), W(XS))
+
+#define addpb_ld(XG, MS, DS)                                                \
+        addob_ld(W(XG), W(MS), W(DS))
+
+#define addph_rr(XG, XS)                                                    \
+        addoh_rr(W(XG), W(XS))
+
+#define addph_ld(XG, MS, DS)                                                \
+        addoh_ld(W(XG), W(MS), W(DS))
+
+/* sub (G = G - S) */
+
+#define subpb_rr(XG, XS)                                                    \
+        subob_rr(W(XG), W(XS))
+
+#define subpb_ld(XG, MS, DS)                                                \
+        subob_ld(W(XG), W(MS), W(DS))
+
+#define subph_rr(XG, XS)                                                    \
+        suboh_rr(W(XG), W(XS))
+
+#define subph_ld(XG, MS, DS)                                                \
+        suboh_ld(W(XG), W(MS), W(DS))
+
+/* ads (G = G + S), saturating */
+
+#define adspb_rr(XG, XS)                                                    \
+        adsob_rr(W(XG), W(XS))
+
+#define adspb_ld(XG, MS, DS)                                                \
+        adsob_ld(W(XG), W(MS), W(DS))
+
+#define adsph_rr(XG, XS)                                                    \
+        adsoh_rr(W(XG), W(XS))
+
+#define adsph_ld(XG, MS, DS)                                                \
+        adsoh_ld(W(XG), W(MS), W(DS))
+
+#define adspc_rr(XG, XS)                                                    \
+        adsoc_rr(W(XG), W(XS))
+
+#define adspc_ld(XG, MS, DS)                                                \
+        adsoc_ld(W(XG), W(MS), W(DS))
+
+#define adspi_rr(XG, XS)                                                    \
+        adsoi_rr(W(XG), W(XS))
+
+#define adspi_ld(XG, MS, DS)                                                \
+        adsoi_ld(W(XG), W(MS), W(DS))
+
+/* sbs (G = G - S), saturating */
+
+#define sbspb_rr(XG, XS)                                                    \
+        sbsob_rr(W(XG), W(XS))
+
+#define sbspb_ld(XG, MS, DS)                                                \
+        sbsob_ld(W(XG), W(MS), W(DS))
+
+#define sbsph_rr(XG, XS)                                                    \
+        sbsoh_rr(W(XG), W(XS))
+
+#define sbsph_ld(XG, MS, DS)                                                \
+        sbsoh_ld(W(XG), W(MS), W(DS))
+
+#define sbspc_rr(XG, XS)                                                    \
+        sbsoc_rr(W(XG), W(XS))
+
+#define sbspc_ld(XG, MS, DS)                                                \
+        sbsoc_ld(W(XG), W(MS), W(DS))
+
+#define sbspi_rr(XG, XS)                                                    \
+        sbsoi_rr(W(XG), W(XS))
+
+#define sbspi_ld(XG, MS, DS)                                                \
+        sbsoi_ld(W(XG), W(MS), W(DS))
+
+/* min (G = G < S ? G : S) */
+
+#define minpb_rr(XG, XS)                                                    \
+        minob_rr(W(XG), W(XS))
+
+#define minpb_ld(XG, MS, DS)                                                \
+        minob_ld(W(XG), W(MS), W(DS))
+
+#define minph_rr(XG, XS)                                                    \
+        minoh_rr(W(XG), W(XS))
+
+#define minph_ld(XG, MS, DS)                                                \
+        minoh_ld(W(XG), W(MS), W(DS))
+
+#define minpc_rr(XG, XS)                                                    \
+        minoc_rr(W(XG), W(XS))
+
+#define minpc_ld(XG, MS, DS)                                                \
+        minoc_ld(W(XG), W(MS), W(DS))
+
+#define minpi_rr(XG, XS)                                                    \
+        minoi_rr(W(XG), W(XS))
+
+#define minpi_ld(XG, MS, DS)                                                \
+        minoi_ld(W(XG), W(MS), W(DS))
+
+/* max (G = G > S ? G : S) */
+
+#define maxpb_rr(XG, XS)                                                    \
+        maxob_rr(W(XG), W(XS))
+
+#define maxpb_ld(XG, MS, DS)                                                \
+        maxob_ld(W(XG), W(MS), W(DS))
+
+#define maxph_rr(XG, XS)                                                    \
+        maxoh_rr(W(XG), W(XS))
+
+#define maxph_ld(XG, MS, DS)                                                \
+        maxoh_ld(W(XG), W(MS), W(DS))
+
+#define maxpc_rr(XG, XS)                                                    \
+        maxoc_rr(W(XG), W(XS))
+
+#define maxpc_ld(XG, MS, DS)                                                \
+        maxoc_ld(W(XG), W(MS), W(DS))
+
+#define maxpi_rr(XG, XS)                                                    \
+        maxoi_rr(W(XG), W(XS))
+
+#define maxpi_ld(XG, MS, DS)                                                \
+        maxoi_ld(W(XG), W(MS), W(DS))
+
+/* ceq (G = G == S ? -1 : 0) */
+
+#define ceqpb_rr(XG, XS)                                                    \
+        ceqob_rr(W(XG), W(XS))
+
+#define ceqpb_ld(XG, MS, DS)                                                \
+        ceqob_ld(W(XG), W(MS), W(DS))
+
+#define ceqph_rr(XG, XS)                                                    \
+        ceqoh_rr(W(XG), W(XS))
+
+#define ceqph_ld(XG, MS, DS)                                                \
+        ceqoh_ld(W(XG), W(MS), W(DS))
+
+/* cne (G = G != S ? -1 : 0) */
+
+#define cnepb_rr(XG, XS)                                                    \
+        cneob_rr(W(XG), W(XS))
+
+#define cnepb_ld(XG, MS, DS)                                                \
+        cneob_ld(W(XG), W(MS), W(DS))
+
+#define cneph_rr(XG, XS)                                                    \
+        cneoh_rr(W(XG), W(XS))
+
+#define cneph_ld(XG, MS, DS)                                                \
+        cneoh_ld(W(XG), W(MS), W(DS))
+
+/* clt (G = G < S ? -1 : 0) */
+
+#define cltpb_rr(XG, XS)                                                    \
+        cltob_rr(W(XG), W(XS))
+
+#define cltpb_ld(XG, MS, DS)                                                \
+        cltob_ld(W(XG), W(MS), W(DS))
+
+#define cltph_rr(XG, XS)                                                    \
+        cltoh_rr(W(XG), W(XS))
+
+#define cltph_ld(XG, MS, DS)                                                \
+        cltoh_ld(W(XG), W(MS), W(DS))
+
+#define cltpc_rr(XG, XS)                                                    \
+        cltoc_rr(W(XG), W(XS))
+
+#define cltpc_ld(XG, MS, DS)                                                \
+        cltoc_ld(W(XG), W(MS), W(DS))
+
+#define cltpi_rr(XG, XS)                                                    \
+        cltoi_rr(W(XG), W(XS))
+
+#define cltpi_ld(XG, MS, DS)                                                \
+        cltoi_ld(W(XG), W(MS), W(DS))
+
+/* cle (G = G <= S ? -1 : 0) */
+
+#define clepb_rr(XG, XS)                                                    \
+        cleob_rr(W(XG), W(XS))
+
+#define clepb_ld(XG, MS, DS)                                                \
+        cleob_ld(W(XG), W(MS), W(DS))
+
+#define cleph_rr(XG, XS)                                                    \
+        cleoh_rr(W(XG), W(XS))
+
+#define cleph_ld(XG, MS, DS)                                                \
+        cleoh_ld(W(XG), W(MS), W(DS))
+
+#define clepc_rr(XG, XS)                                                    \
+        cleoc_rr(W(XG), W(XS))
+
+#define clepc_ld(XG, MS, DS)                                                \
+        cleoc_ld(W(XG), W(MS), W(DS))
+
+#define clepi_rr(XG, XS)                                                    \
+        cleoi_rr(W(XG), W(XS))
+
+#define clepi_ld(XG, MS, DS)                                                \
+        cleoi_ld(W(XG), W(MS), W(DS))
+
+/* cgt (G = G > S ? -1 : 0) */
+
+#define cgtpb_rr(XG, XS)                                                    \
+        cgtob_rr(W(XG), W(XS))
+
+#define cgtpb_ld(XG, MS, DS)                                                \
+        cgtob_ld(W(XG), W(MS), W(DS))
+
+#define cgtph_rr(XG, XS)                                                    \
+        cgtoh_rr(W(XG), W(XS))
+
+#define cgtph_ld(XG, MS, DS)                                                \
+        cgtoh_ld(W(XG), W(MS), W(DS))
+
+#define cgtpc_rr(XG, XS)                                                    \
+        cgtoc_rr(W(XG), W(XS))
+
+#define cgtpc_ld(XG, MS, DS)                                                \
+        cgtoc_ld(W(XG), W(MS), W(DS))
+
+#define cgtpi_rr(XG, XS)                                                    \
+        cgtoi_rr(W(XG), W(XS))
+
+#define cgtpi_ld(XG, MS, DS)                                                \
+        cgtoi_ld(W(XG), W(MS), W(DS))
+
+/* cge (G = G >= S ? -1 : 0) */
+
+#define cgepb_rr(XG, XS)                                                    \
+        cgeob_rr(W(XG), W(XS))
+
+#define cgepb_ld(XG, MS, DS)                                                \
+        cgeob_ld(W(XG), W(MS), W(DS))
+
+#define cgeph_rr(XG, XS)                                                    \
+        cgeoh_rr(W(XG), W(XS))
+
+#define cgeph_ld(XG, MS, DS)                                                \
+        cgeoh_ld(W(XG), W(MS), W(DS))
+
+#define cgepc_rr(XG, XS)                                                    \
+        cgeoc_rr(W(XG), W(XS))
+
+#define cgepc_ld(XG, MS, DS)                                                \
+        cgeoc_ld(W(XG), W(MS), W(DS))
+
+#define cgepi_rr(XG, XS)                                                    \
+        cgeoi_rr(W(XG), W(XS))
+
+#define cgepi_ld(XG, MS, DS)                                                \
+        cgeoi_ld(W(XG), W(MS), W(DS))
 
-/************   packed double-precision integer arithmetic/shifts   ***********/
+/* shl (G = G << S) - plain, unsigned
+ * for maximum compatibility, shift count mustn't exceed elem-size */
 
-/* add (G = G + S), (D = S + T) if (#D != #S) */
+#define shlpb_ri(XG, IS)                                                    \
+        shlob_ri(W(XG), W(IS))
 
-#define addqx_rr(XG, XS)                                                    \
-        addjx_rr(W(XG), W(XS))
+#define shlpb_ld(XG, MS, DS) /* loads SIMD, uses first elem, rest zeroed */ \
+        shlob_ld(W(XG), W(MS), W(DS))
 
-#define addqx_ld(XG, MS, DS)                                                \
-        addjx_ld(W(XG), W(MS), W(DS))
+#define shlph_ri(XG, IS)                                                    \
+        shloh_ri(W(XG), W(IS))
 
-#define addqx3rr(XD, XS, XT)                                                \
-        addjx3rr(W(XD), W(XS), W(XT))
+#define shlph_ld(XG, MS, DS) /* loads SIMD, uses first elem, rest zeroed */ \
+        shloh_ld(W(XG), W(MS), W(DS))
 
-#define addqx3ld(XD, XS, MT, DT)                                            \
-        addjx3ld(W(XD), W(XS), W(MT), W(DT))
+/* shr (G = G >> S) - plain, unsigned
+ * for maximum compatibility, shift count mustn't exceed elem-size */
 
-/* sub (G = G - S), (D = S - T) if (#D != #S) */
+#define shrpb_ri(XG, IS)                                                    \
+        shrob_ri(W(XG), W(IS))
 
-#define subqx_rr(XG, XS)                                                    \
-        subjx_rr(W(XG), W(XS))
+#define shrpb_ld(XG, MS, DS) /* loads SIMD, uses first elem, rest zeroed */ \
+        shrob_ld(W(XG), W(MS), W(DS))
 
-#define subqx_ld(XG, MS, DS)                                                \
-        subjx_ld(W(XG), W(MS), W(DS))
+#define shrph_ri(XG, IS)                                                    \
+        shroh_ri(W(XG), W(IS))
 
-#define subqx3rr(XD, XS, XT)                                                \
-        subjx3rr(W(XD), W(XS), W(XT))
+#define shrph_ld(XG, MS, DS) /* loads SIMD, uses first elem, rest zeroed */ \
+        shroh_ld(W(XG), W(MS), W(DS))
 
-#define subqx3ld(XD, XS, MT, DT)                                            \
-        subjx3ld(W(XD), W(XS), W(MT), W(DT))
+/* shr (G = G >> S) - plain, signed
+ * for maximum compatibility, shift count mustn't exceed elem-size */
 
-/* mul (G = G * S), (D = S * T) if (#D != #S) */
+#define shrpc_ri(XG, IS)                                                    \
+        shroc_ri(W(XG), W(IS))
 
-#define mulqx_rr(XG, XS)                                                    \
-        muljx_rr(W(XG), W(XS))
+#define shrpc_ld(XG, MS, DS) /* loads SIMD, uses first elem, rest zeroed */ \
+        shroc_ld(W(XG), W(MS), W(DS))
 
-#define mulqx_ld(XG, MS, DS)                                                \
-        muljx_ld(W(XG), W(MS), W(DS))
+#define shrpi_ri(XG, IS)                                                    \
+        shroi_ri(W(XG), W(IS))
 
-#define mulqx3rr(XD, XS, XT)                                                \
-        muljx3rr(W(XD), W(XS), W(XT))
+#define shrpi_ld(XG, MS, DS) /* loads SIMD, uses first elem, rest zeroed */ \
+        shroi_ld(W(XG), W(MS), W(DS))
 
-#define mulqx3ld(XD, XS, MT, DT)                                            \
-        muljx3ld(W(XD), W(XS), W(MT), W(DT))
+/* cvx (D = bytes S), unsigned saturation, upper half of D is zeroed */
 
-/* shl (G = G << S), (D = S << T) if (#D != #S) - plain, unsigned
- * for maximum compatibility, shift count mustn't exceed elem-size */
+#define cvxph_rr(XD, XS)                                                    \
+        cvxoh_rr(W(XD), W(XS))
 
-#define shlqx_ri(XG, IS)                                                    \
-        shljx_ri(W(XG), W(IS))
+/* cux (G = bytes S), unsigned saturation, lower half of G is kept */
 
-#define shlqx_ld(XG, MS, DS) /* loads SIMD, uses first elem, rest zeroed */ \
-        shljx_ld(W(XG), W(MS), W(DS))
+#define cuxph_rr(XG, XS)                                                    \
+        cuxoh_rr(W(XG), W(XS))
 
-#define shlqx3ri(XD, XS, IT)                                                \
-        shljx3ri(W(XD), W(XS), W(IT))
+/* cvx (D = bytes S), signed saturation, upper half of D is zeroed */
 
-#define shlqx3ld(XD, XS, MT, DT)                                            \
-        shljx3ld(W(XD), W(XS), W(MT), W(DT))
+#define cvxpi_rr(XD, XS)                                                    \
+        cvxoi_rr(W(XD), W(XS))
 
-/* shr (G = G >> S), (D = S >> T) if (#D != #S) - plain, unsigned
- * for maximum compatibility, shift count mustn't exceed elem-size */
+/* cux (G = bytes S), signed saturation, lower half of G is kept */
 
-#define shrqx_ri(XG, IS)                                                    \
-        shrjx_ri(W(XG), W(IS))
+#define cuxpi_rr(XG, XS)                                                    \
+        cuxoi_rr(W(XG), W(XS))
 
-#define shrqx_ld(XG, MS, DS) /* loads SIMD, uses first elem, rest zeroed */ \
-        shrjx_ld(W(XG), W(MS), W(DS))
+/* cvx (D = halves S), unsigned saturation, upper half of D is zeroed */
 
-#define shrqx3ri(XD, XS, IT)                                                \
-        shrjx3ri(W(XD), W(XS), W(IT))
+#define cvxpx_rr(XD, XS)                                                    \
+        cvxox_rr(W(XD), W(XS))
 
-#define shrqx3ld(XD, XS, MT, DT)                                            \
-        shrjx3ld(W(XD), W(XS), W(MT), W(DT))
+/* cux (G = halves S), unsigned saturation, lower half of G is kept */
 
-/* shr (G = G >> S), (D = S >> T) if (#D != #S) - plain, signed
- * for maximum compatibility, shift count mustn't exceed elem-size */
+#define cuxpx_rr(XG, XS)                                                    \
+        cuxox_rr(W(XG), W(XS))
 
-#define shrqn_ri(XG, IS)                                                    \
-        shrjn_ri(W(XG), W(IS))
+/* cvx (D = halves S), signed saturation, upper half of D is zeroed */
 
-#define shrqn_ld(XG, MS, DS) /* loads SIMD, uses first elem, rest zeroed */ \
-        shrjn_ld(W(XG), W(MS), W(DS))
+#define cvxpn_rr(XD, XS)                                                    \
+        cvxon_rr(W(XD), W(XS))
 
-#define shrqn3ri(XD, XS, IT)                                                \
-        shrjn3ri(W(XD), W(XS), W(IT))
+/* cux (G = halves S), signed saturation, lower half of G is kept */
 
-#define shrqn3ld(XD, XS, MT, DT)                                            \
-        shrjn3ld(W(XD), W(XS), W(MT), W(DT))
+#define cuxpn_rr(XG, XS)                                                    \
+        cuxon_rr(W(XG), W(XS))
 
-/* svl (G = G << S), (D = S << T) if (#D != #S) - variable, unsigned
- * for maximum compatibility, shift count mustn't exceed elem-size */
+/* cvy (D = halves S), zero-extends lower half of S */
 
-#define svlqx_rr(XG, XS)     /* variable shift with per-elem count */       \
-        svljx_rr(W(XG), W(XS))
+#define cvypb_rr(XD, XS)                                                    \
+        cvyob_rr(W(XD), W(XS))
 
-#define svlqx_ld(XG, MS, DS) /* variable shift with per-elem count */       \
-        svljx_ld(W(XG), W(MS), W(DS))
+/* cuy (D = halves S), zero-extends upper half of S */
 
-#define svlqx3rr(XD, XS, XT)                                                \
-        svljx3rr(W(XD), W(XS), W(XT))
+#define cuypb_rr(XD, XS)                                                    \
+        cuyob_rr(W(XD), W(XS))
 
-#define svlqx3ld(XD, XS, MT, DT)                                            \
-        svljx3ld(W(XD), W(XS), W(MT), W(DT))
+/* cvy (D = halves S), sign-extends lower half of S */
 
-/* svr (G = G >> S), (D = S >> T) if (#D != #S) - variable, unsigned
- * for maximum compatibility, shift count mustn't exceed elem-size */
+#define cvypc_rr(XD, XS)                                                    \
+        cvyoc_rr(W(XD), W(XS))
 
-#define svrqx_rr(XG, XS)     /* variable shift with per-elem count */       \
-        svrjx_rr(W(XG), W(XS))
+/* cuy (D = halves S), sign-extends upper half of S */
 
-#define svrqx_ld(XG, MS, DS) /* variable shift with per-elem count */       \
-        svrjx_ld(W(XG), W(MS), W(DS))
+#define cuypc_rr(XD, XS)                                                    \
+        cuyoc_rr(W(XD), W(XS))
 
-#define svrqx3rr(XD, XS, XT)                                                \
-        svrjx3rr(W(XD), W(XS), W(XT))
+/* cvy (D = 32-bit S), zero-extends lower half of S */
 
-#define svrqx3ld(XD, XS, MT, DT)                                            \
-        svrjx3ld(W(XD), W(XS), W(MT), W(DT))
+#define cvyph_rr(XD, XS)                                                    \
+        cvyoh_rr(W(XD), W(XS))
 
-/* svr (G = G >> S), (D = S >> T) if (#D != #S) - variable, signed
- * for maximum compatibility, shift count mustn't exceed elem-size */
+/* cuy (D = 32-bit S), zero-extends upper half of S */
 
-#define svrqn_rr(XG, XS)     /* variable shift with per-elem count */       \
-        svrjn_rr(W(XG), W(XS))
+#define cuyph_rr(XD, XS)                                                    \
+        cuyoh_rr(W(XD), W(XS))
 
-#define svrqn_ld(XG, MS, DS) /* variable shift with per-elem count */       \
-        svrjn_ld(W(XG), W(MS), W(DS))
+/* cvy (D = 32-bit S), sign-extends lower half of S */
 
-#define svrqn3rr(XD, XS, XT)                                                \
-        svrjn3rr(W(XD), W(XS), W(XT))
+#define cvypi_rr(XD, XS)                                                    \
+        cvyoi_rr(W(XD), W(XS))
 
-#define svrqn3ld(XD, XS, MT, DT)                                            \
-        svrjn3ld(W(XD), W(XS), W(MT), W(DT))
+/* cuy (D = 32-bit S), sign-extends upper half of S */
 
-#endif /* RT_SIMD: 256, 128 */
+#define cuypi_rr(XD, XS)                                                    \
+        cuyoi_rr(W(XD), W(XS))
 
 /******************************************************************************/
 /**** var-len **** SIMD instructions with configurable element **** 32-bit ****/
@@ -3701,6 +5651,55 @@
 #define mmvpx_st(XS, MG, DG)                                                \
         mmvox_st(W(XS), W(MG), W(DG))
 
+/* gth (D = [M + S]) gathers elements at M + S * element-size, M: Oeax, M***
+ * sct ([M + T] = S) scatters elements at M + T * element-size, M: Oeax, M*** */
+
+#define gthpx_ld(XD, XS, MT, DT)                                            \
+        gthox_ld(W(XD), W(XS), W(MT), W(DT))
+
+#define sctpx_st(XS, XT, MD, DD)                                            \
+        sctox_st(W(XS), W(XT), W(MD), W(DD))
+
+/* spl (D = S[i]) broadcasts lane i, rev (D = S reversed) reverses lanes
+ * rot (D[k] = S[(k + i) mod n]) rotates lanes down by i (immediate)
+ * unl/unh (G = G, S interleaved) from lower/upper halves of G and S
+ * tbl (D[k] = S[T[k] mod n]) permutes lanes with lane-indices in T */
+
+#define splpx_ri(XD, XS, IS)                                                \
+        splox_ri(W(XD), W(XS), W(IS))
+
+#define revpx_rr(XD, XS)                                                    \
+        revox_rr(W(XD), W(XS))
+
+#define rotpx_ri(XD, XS, IS)                                                \
+        rotox_ri(W(XD), W(XS), W(IS))
+
+#define unlpx_rr(XG, XS)                                                    \
+        unlox_rr(W(XG), W(XS))
+
+#define unhpx_rr(XG, XS)                                                    \
+        unhox_rr(W(XG), W(XS))
+
+#define tblpx_rr(XD, XS, XT)                                                \
+        tblox_rr(W(XD), W(XS), W(XT))
+
+#define tblpx_ld(XD, XS, MT, DT)                                            \
+        tblox_ld(W(XD), W(XS), W(MT), W(DT))
+
+/* mtl (D = first RS elements from M, 0 above), count in BASE register
+ * mtl (first RT elements at M = S), lanes above the count untouched */
+
+#define mtlpx_ld(XD, RS, MT, DT)                                            \
+        mtlox_ld(W(XD), W(RS), W(MT), W(DT))
+
+#define mtlpx_st(XS, RT, MD, DD)                                            \
+        mtlox_st(W(XS), W(RT), W(MD), W(DD))
+
+/* stn (M = S) streams to aligned M bypassing caches where supported */
+
+#define stnpx_st(XS, MD, DD)                                                \
+        stnox_st(W(XS), W(MD), W(DD))
+
 /* and (G = G & S), (D = S & T) if (#D != #S) */
 
 #define andpx_rr(XG, XS)                                                    \
@@ -3900,6 +5899,71 @@
 #define cbsps_rr(XG, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
         cbsos_rr(W(XG), W(X1), W(X2), W(XS))
 
+/* exp (D = exp S) */
+
+#define expps_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        expos_rr(W(XD), W(X1), W(X2), W(XS))
+
+/* log (D = log S) */
+
+#define logps_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        logos_rr(W(XD), W(X1), W(X2), W(XS))
+
+/* sin (D = sin S) */
+
+#define sinps_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        sinos_rr(W(XD), W(X1), W(X2), W(XS))
+
+/* cos (D = cos S) */
+
+#define cosps_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        cosos_rr(W(XD), W(X1), W(X2), W(XS))
+
+/* tan (D = tan S) */
+
+#define tanps_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        tanos_rr(W(XD), W(X1), W(X2), W(XS))
+
+/* snc (D = sin S, C = cos S) */
+
+#define sncps_rr(XD, XC, X1, X2, XS) /* destroys X1, X2 (temp regs) */      \
+        sncos_rr(W(XD), W(XC), W(X1), W(X2), W(XS))
+
+/* at2 (D = atan2(S, T)) */
+
+#define at2ps_rr(XD, X1, X2, XS, XT) /* destroys X1, X2 (temp regs) */      \
+        at2os_rr(W(XD), W(X1), W(X2), W(XS), W(XT))
+
+/* rng (D = random bits), advances per-lane generator state */
+
+#define rngpx_rr(XD, X1) /* destroys X1 (temp reg) */                       \
+        rngox_rr(W(XD), W(X1))
+
+/* rng (D = random fp in [0, 1)), advances generator state */
+
+#define rngps_rr(XD, X1) /* destroys X1 (temp reg) */                       \
+        rngos_rr(W(XD), W(X1))
+
+/* cvx (D = fp16 S), narrows onto lower half, upper half is zeroed */
+
+#define cvxps_rr(XD, XS)                                                    \
+        cvxos_rr(W(XD), W(XS))
+
+/* cux (G = fp16 S), narrows onto upper half, lower half is kept */
+
+#define cuxps_rr(XG, XS)                                                    \
+        cuxos_rr(W(XG), W(XS))
+
+/* cvy (D = fp64 S), widens from lower half of S */
+
+#define cvyps_rr(XD, XS)                                                    \
+        cvyos_rr(W(XD), W(XS))
+
+/* cuy (D = fp64 S), widens from upper half of S */
+
+#define cuyps_rr(XD, XS)                                                    \
+        cuyos_rr(W(XD), W(XS))
+
 /* rcp (D = 1.0 / S)
  * accuracy/behavior may vary across supported targets, use accordingly */
 
@@ -4353,6 +6417,80 @@
 #define svrpn3ld(XD, XS, MT, DT)                                            \
         svron3ld(W(XD), W(XS), W(MT), W(DT))
 
+/****************   packed single-precision integer compare   *****************/
+
+/* ceq (G = G == S ? -1 : 0) */
+
+#define ceqpx_rr(XG, XS)                                                    \
+        ceqox_rr(W(XG), W(XS))
+
+#define ceqpx_ld(XG, MS, DS)                                                \
+        ceqox_ld(W(XG), W(MS), W(DS))
+
+/* cne (G = G != S ? -1 : 0) */
+
+#define cnepx_rr(XG, XS)                                                    \
+        cneox_rr(W(XG), W(XS))
+
+#define cnepx_ld(XG, MS, DS)                                                \
+        cneox_ld(W(XG), W(MS), W(DS))
+
+/* clt (G = G < S ? -1 : 0) - unsigned (x), signed (n) */
+
+#define cltpx_rr(XG, XS)                                                    \
+        cltox_rr(W(XG), W(XS))
+
+#define cltpx_ld(XG, MS, DS)                                                \
+        cltox_ld(W(XG), W(MS), W(DS))
+
+#define cltpn_rr(XG, XS)                                                    \
+        clton_rr(W(XG), W(XS))
+
+#define cltpn_ld(XG, MS, DS)                                                \
+        clton_ld(W(XG), W(MS), W(DS))
+
+/* cle (G = G <= S ? -1 : 0) - unsigned (x), signed (n) */
+
+#define clepx_rr(XG, XS)                                                    \
+        cleox_rr(W(XG), W(XS))
+
+#define clepx_ld(XG, MS, DS)                                                \
+        cleox_ld(W(XG), W(MS), W(DS))
+
+#define clepn_rr(XG, XS)                                                    \
+        cleon_rr(W(XG), W(XS))
+
+#define clepn_ld(XG, MS, DS)                                                \
+        cleon_ld(W(XG), W(MS), W(DS))
+
+/* cgt (G = G > S ? -1 : 0) - unsigned (x), signed (n) */
+
+#define cgtpx_rr(XG, XS)                                                    \
+        cgtox_rr(W(XG), W(XS))
+
+#define cgtpx_ld(XG, MS, DS)                                                \
+        cgtox_ld(W(XG), W(MS), W(DS))
+
+#define cgtpn_rr(XG, XS)                                                    \
+        cgton_rr(W(XG), W(XS))
+
+#define cgtpn_ld(XG, MS, DS)                                                \
+        cgton_ld(W(XG), W(MS), W(DS))
+
+/* cge (G = G >= S ? -1 : 0) - unsigned (x), signed (n) */
+
+#define cgepx_rr(XG, XS)                                                    \
+        cgeox_rr(W(XG), W(XS))
+
+#define cgepx_ld(XG, MS, DS)                                                \
+        cgeox_ld(W(XG), W(MS), W(DS))
+
+#define cgepn_rr(XG, XS)                                                    \
+        cgeon_rr(W(XG), W(XS))
+
+#define cgepn_ld(XG, MS, DS)                                                \
+        cgeon_ld(W(XG), W(MS), W(DS))
+
 /******************************************************************************/
 /**** 256-bit **** SIMD instructions with configurable element **** 32-bit ****/
 /******************************************************************************/
@@ -4388,6 +6526,55 @@
 #define mmvfx_st(XS, MG, DG)                                                \
         mmvcx_st(W(XS), W(MG), W(DG))
 
+/* gth (D = [M + S]) gathers elements at M + S * element-size, M: Oeax, M***
+ * sct ([M + T] = S) scatters elements at M + T * element-size, M: Oeax, M*** */
+
+#define gthfx_ld(XD, XS, MT, DT)                                            \
+        gthcx_ld(W(XD), W(XS), W(MT), W(DT))
+
+#define sctfx_st(XS, XT, MD, DD)                                            \
+        sctcx_st(W(XS), W(XT), W(MD), W(DD))
+
+/* spl (D = S[i]) broadcasts lane i, rev (D = S reversed) reverses lanes
+ * rot (D[k] = S[(k + i) mod n]) rotates lanes down by i (immediate)
+ * unl/unh (G = G, S interleaved) from lower/upper halves of G and S
+ * tbl (D[k] = S[T[k] mod n]) permutes lanes with lane-indices in T */
+
+#define splfx_ri(XD, XS, IS)                                                \
+        splcx_ri(W(XD), W(XS), W(IS))
+
+#define revfx_rr(XD, XS)                                                    \
+        revcx_rr(W(XD), W(XS))
+
+#define rotfx_ri(XD, XS, IS)                                                \
+        rotcx_ri(W(XD), W(XS), W(IS))
+
+#define unlfx_rr(XG, XS)                                                    \
+        unlcx_rr(W(XG), W(XS))
+
+#define unhfx_rr(XG, XS)                                                    \
+        unhcx_rr(W(XG), W(XS))
+
+#define tblfx_rr(XD, XS, XT)                                                \
+        tblcx_rr(W(XD), W(XS), W(XT))
+
+#define tblfx_ld(XD, XS, MT, DT)                                            \
+        tblcx_ld(W(XD), W(XS), W(MT), W(DT))
+
+/* mtl (D = first RS elements from M, 0 above), count in BASE register
+ * mtl (first RT elements at M = S), lanes above the count untouched */
+
+#define mtlfx_ld(XD, RS, MT, DT)                                            \
+        mtlcx_ld(W(XD), W(RS), W(MT), W(DT))
+
+#define mtlfx_st(XS, RT, MD, DD)                                            \
+        mtlcx_st(W(XS), W(RT), W(MD), W(DD))
+
+/* stn (M = S) streams to aligned M bypassing caches where supported */
+
+#define stnfx_st(XS, MD, DD)                                                \
+        stncx_st(W(XS), W(MD), W(DD))
+
 /* and (G = G & S), (D = S & T) if (#D != #S) */
 
 #define andfx_rr(XG, XS)                                                    \
@@ -4587,6 +6774,71 @@
 #define cbsfs_rr(XG, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
         cbscs_rr(W(XG), W(X1), W(X2), W(XS))
 
+/* exp (D = exp S) */
+
+#define expfs_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        expcs_rr(W(XD), W(X1), W(X2), W(XS))
+
+/* log (D = log S) */
+
+#define logfs_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        logcs_rr(W(XD), W(X1), W(X2), W(XS))
+
+/* sin (D = sin S) */
+
+#define sinfs_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        sincs_rr(W(XD), W(X1), W(X2), W(XS))
+
+/* cos (D = cos S) */
+
+#define cosfs_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        coscs_rr(W(XD), W(X1), W(X2), W(XS))
+
+/* tan (D = tan S) */
+
+#define tanfs_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        tancs_rr(W(XD), W(X1), W(X2), W(XS))
+
+/* snc (D = sin S, C = cos S) */
+
+#define sncfs_rr(XD, XC, X1, X2, XS) /* destroys X1, X2 (temp regs) */      \
+        snccs_rr(W(XD), W(XC), W(X1), W(X2), W(XS))
+
+/* at2 (D = atan2(S, T)) */
+
+#define at2fs_rr(XD, X1, X2, XS, XT) /* destroys X1, X2 (temp regs) */      \
+        at2cs_rr(W(XD), W(X1), W(X2), W(XS), W(XT))
+
+/* rng (D = random bits), advances per-lane generator state */
+
+#define rngfx_rr(XD, X1) /* destroys X1 (temp reg) */                       \
+        rngcx_rr(W(XD), W(X1))
+
+/* rng (D = random fp in [0, 1)), advances generator state */
+
+#define rngfs_rr(XD, X1) /* destroys X1 (temp reg) */                       \
+        rngcs_rr(W(XD), W(X1))
+
+/* cvx (D = fp16 S), narrows onto lower half, upper half is zeroed */
+
+#define cvxfs_rr(XD, XS)                                                    \
+        cvxcs_rr(W(XD), W(XS))
+
+/* cux (G = fp16 S), narrows onto upper half, lower half is kept */
+
+#define cuxfs_rr(XG, XS)                                                    \
+        cuxcs_rr(W(XG), W(XS))
+
+/* cvy (D = fp64 S), widens from lower half of S */
+
+#define cvyfs_rr(XD, XS)                                                    \
+        cvycs_rr(W(XD), W(XS))
+
+/* cuy (D = fp64 S), widens from upper half of S */
+
+#define cuyfs_rr(XD, XS)                                                    \
+        cuycs_rr(W(XD), W(XS))
+
 /* rcp (D = 1.0 / S)
  * accuracy/behavior may vary across supported targets, use accordingly */
 
@@ -5040,6 +7292,80 @@
 #define svrfn3ld(XD, XS, MT, DT)                                            \
         svrcn3ld(W(XD), W(XS), W(MT), W(DT))
 
+/****************   packed single-precision integer compare   *****************/
+
+/* ceq (G = G == S ? -1 : 0) */
+
+#define ceqfx_rr(XG, XS)                                                    \
+        ceqcx_rr(W(XG), W(XS))
+
+#define ceqfx_ld(XG, MS, DS)                                                \
+        ceqcx_ld(W(XG), W(MS), W(DS))
+
+/* cne (G = G != S ? -1 : 0) */
+
+#define cnefx_rr(XG, XS)                                                    \
+        cnecx_rr(W(XG), W(XS))
+
+#define cnefx_ld(XG, MS, DS)                                                \
+        cnecx_ld(W(XG), W(MS), W(DS))
+
+/* clt (G = G < S ? -1 : 0) - unsigned (x), signed (n) */
+
+#define cltfx_rr(XG, XS)                                                    \
+        cltcx_rr(W(XG), W(XS))
+
+#define cltfx_ld(XG, MS, DS)                                                \
+        cltcx_ld(W(XG), W(MS), W(DS))
+
+#define cltfn_rr(XG, XS)                                                    \
+        cltcn_rr(W(XG), W(XS))
+
+#define cltfn_ld(XG, MS, DS)                                                \
+        cltcn_ld(W(XG), W(MS), W(DS))
+
+/* cle (G = G <= S ? -1 : 0) - unsigned (x), signed (n) */
+
+#define clefx_rr(XG, XS)                                                    \
+        clecx_rr(W(XG), W(XS))
+
+#define clefx_ld(XG, MS, DS)                                                \
+        clecx_ld(W(XG), W(MS), W(DS))
+
+#define clefn_rr(XG, XS)                                                    \
+        clecn_rr(W(XG), W(XS))
+
+#define clefn_ld(XG, MS, DS)                                                \
+        clecn_ld(W(XG), W(MS), W(DS))
+
+/* cgt (G = G > S ? -1 : 0) - unsigned (x), signed (n) */
+
+#define cgtfx_rr(XG, XS)                                                    \
+        cgtcx_rr(W(XG), W(XS))
+
+#define cgtfx_ld(XG, MS, DS)                                                \
+        cgtcx_ld(W(XG), W(MS), W(DS))
+
+#define cgtfn_rr(XG, XS)                                                    \
+        cgtcn_rr(W(XG), W(XS))
+
+#define cgtfn_ld(XG, MS, DS)                                                \
+        cgtcn_ld(W(XG), W(MS), W(DS))
+
+/* cge (G = G >= S ? -1 : 0) - unsigned (x), signed (n) */
+
+#define cgefx_rr(XG, XS)                                                    \
+        cgecx_rr(W(XG), W(XS))
+
+#define cgefx_ld(XG, MS, DS)                                                \
+        cgecx_ld(W(XG), W(MS), W(DS))
+
+#define cgefn_rr(XG, XS)                                                    \
+        cgecn_rr(W(XG), W(XS))
+
+#define cgefn_ld(XG, MS, DS)                                                \
+        cgecn_ld(W(XG), W(MS), W(DS))
+
 /******************************************************************************/
 /**** 128-bit **** SIMD instructions with configurable element **** 32-bit ****/
 /******************************************************************************/
@@ -5063,17 +7389,66 @@
 #define movlx_st(XS, MD, DD)                                                \
         movix_st(W(XS), W(MD), W(DD))
 
-/* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
- * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
+/* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
+ * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
+
+#define mmvlx_rr(XD, XS)                                                    \
+        mmvix_rr(W(XD), W(XS))
+
+#define mmvlx_ld(XG, MS, DS)                                                \
+        mmvix_ld(W(XG), W(MS), W(DS))
+
+#define mmvlx_st(XS, MG, DG)                                                \
+        mmvix_st(W(XS), W(MG), W(DG))
+
+/* gth (D = [M + S]) gathers elements at M + S * element-size, M: Oeax, M***
+ * sct ([M + T] = S) scatters elements at M + T * element-size, M: Oeax, M*** */
+
+#define gthlx_ld(XD, XS, MT, DT)                                            \
+        gthix_ld(W(XD), W(XS), W(MT), W(DT))
+
+#define sctlx_st(XS, XT, MD, DD)                                            \
+        sctix_st(W(XS), W(XT), W(MD), W(DD))
+
+/* spl (D = S[i]) broadcasts lane i, rev (D = S reversed) reverses lanes
+ * rot (D[k] = S[(k + i) mod n]) rotates lanes down by i (immediate)
+ * unl/unh (G = G, S interleaved) from lower/upper halves of G and S
+ * tbl (D[k] = S[T[k] mod n]) permutes lanes with lane-indices in T */
+
+#define spllx_ri(XD, XS, IS)                                                \
+        splix_ri(W(XD), W(XS), W(IS))
+
+#define revlx_rr(XD, XS)                                                    \
+        revix_rr(W(XD), W(XS))
+
+#define rotlx_ri(XD, XS, IS)                                                \
+        rotix_ri(W(XD), W(XS), W(IS))
+
+#define unllx_rr(XG, XS)                                                    \
+        unlix_rr(W(XG), W(XS))
+
+#define unhlx_rr(XG, XS)                                                    \
+        unhix_rr(W(XG), W(XS))
+
+#define tbllx_rr(XD, XS, XT)                                                \
+        tblix_rr(W(XD), W(XS), W(XT))
+
+#define tbllx_ld(XD, XS, MT, DT)                                            \
+        tblix_ld(W(XD), W(XS), W(MT), W(DT))
+
+/* mtl (D = first RS elements from M, 0 above), count in BASE register
+ * mtl (first RT elements at M = S), lanes above the count untouched */
+
+#define mtllx_ld(XD, RS, MT, DT)                                            \
+        mtlix_ld(W(XD), W(RS), W(MT), W(DT))
 
-#define mmvlx_rr(XD, XS)                                                    \
-        mmvix_rr(W(XD), W(XS))
+#define mtllx_st(XS, RT, MD, DD)                                            \
+        mtlix_st(W(XS), W(RT), W(MD), W(DD))
 
-#define mmvlx_ld(XG, MS, DS)                                                \
-        mmvix_ld(W(XG), W(MS), W(DS))
+/* stn (M = S) streams to aligned M bypassing caches where supported */
 
-#define mmvlx_st(XS, MG, DG)                                                \
-        mmvix_st(W(XS), W(MG), W(DG))
+#define stnlx_st(XS, MD, DD)                                                \
+        stnix_st(W(XS), W(MD), W(DD))
 
 /* and (G = G & S), (D = S & T) if (#D != #S) */
 
@@ -5274,6 +7649,71 @@
 #define cbsls_rr(XG, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
         cbsis_rr(W(XG), W(X1), W(X2), W(XS))
 
+/* exp (D = exp S) */
+
+#define expls_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        expis_rr(W(XD), W(X1), W(X2), W(XS))
+
+/* log (D = log S) */
+
+#define logls_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        logis_rr(W(XD), W(X1), W(X2), W(XS))
+
+/* sin (D = sin S) */
+
+#define sinls_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        sinis_rr(W(XD), W(X1), W(X2), W(XS))
+
+/* cos (D = cos S) */
+
+#define cosls_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        cosis_rr(W(XD), W(X1), W(X2), W(XS))
+
+/* tan (D = tan S) */
+
+#define tanls_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        tanis_rr(W(XD), W(X1), W(X2), W(XS))
+
+/* snc (D = sin S, C = cos S) */
+
+#define sncls_rr(XD, XC, X1, X2, XS) /* destroys X1, X2 (temp regs) */      \
+        sncis_rr(W(XD), W(XC), W(X1), W(X2), W(XS))
+
+/* at2 (D = atan2(S, T)) */
+
+#define at2ls_rr(XD, X1, X2, XS, XT) /* destroys X1, X2 (temp regs) */      \
+        at2is_rr(W(XD), W(X1), W(X2), W(XS), W(XT))
+
+/* rng (D = random bits), advances per-lane generator state */
+
+#define rnglx_rr(XD, X1) /* destroys X1 (temp reg) */                       \
+        rngix_rr(W(XD), W(X1))
+
+/* rng (D = random fp in [0, 1)), advances generator state */
+
+#define rngls_rr(XD, X1) /* destroys X1 (temp reg) */                       \
+        rngis_rr(W(XD), W(X1))
+
+/* cvx (D = fp16 S), narrows onto lower half, upper half is zeroed */
+
+#define cvxls_rr(XD, XS)                                                    \
+        cvxis_rr(W(XD), W(XS))
+
+/* cux (G = fp16 S), narrows onto upper half, lower half is kept */
+
+#define cuxls_rr(XG, XS)                                                    \
+        cuxis_rr(W(XG), W(XS))
+
+/* cvy (D = fp64 S), widens from lower half of S */
+
+#define cvyls_rr(XD, XS)                                                    \
+        cvyis_rr(W(XD), W(XS))
+
+/* cuy (D = fp64 S), widens from upper half of S */
+
+#define cuyls_rr(XD, XS)                                                    \
+        cuyis_rr(W(XD), W(XS))
+
 /* rcp (D = 1.0 / S)
  * accuracy/behavior may vary across supported targets, use accordingly */
 
@@ -5727,6 +8167,80 @@
 #define svrln3ld(XD, XS, MT, DT)                                            \
         svrin3ld(W(XD), W(XS), W(MT), W(DT))
 
+/****************   packed single-precision integer compare   *****************/
+
+/* ceq (G = G == S ? -1 : 0) */
+
+#define ceqlx_rr(XG, XS)                                                    \
+        ceqix_rr(W(XG), W(XS))
+
+#define ceqlx_ld(XG, MS, DS)                                                \
+        ceqix_ld(W(XG), W(MS), W(DS))
+
+/* cne (G = G != S ? -1 : 0) */
+
+#define cnelx_rr(XG, XS)                                                    \
+        cneix_rr(W(XG), W(XS))
+
+#define cnelx_ld(XG, MS, DS)                                                \
+        cneix_ld(W(XG), W(MS), W(DS))
+
+/* clt (G = G < S ? -1 : 0) - unsigned (x), signed (n) */
+
+#define cltlx_rr(XG, XS)                                                    \
+        cltix_rr(W(XG), W(XS))
+
+#define cltlx_ld(XG, MS, DS)                                                \
+        cltix_ld(W(XG), W(MS), W(DS))
+
+#define cltln_rr(XG, XS)                                                    \
+        cltin_rr(W(XG), W(XS))
+
+#define cltln_ld(XG, MS, DS)                                                \
+        cltin_ld(W(XG), W(MS), W(DS))
+
+/* cle (G = G <= S ? -1 : 0) - unsigned (x), signed (n) */
+
+#define clelx_rr(XG, XS)                                                    \
+        cleix_rr(W(XG), W(XS))
+
+#define clelx_ld(XG, MS, DS)                                                \
+        cleix_ld(W(XG), W(MS), W(DS))
+
+#define cleln_rr(XG, XS)                                                    \
+        clein_rr(W(XG), W(XS))
+
+#define cleln_ld(XG, MS, DS)                                                \
+        clein_ld(W(XG), W(MS), W(DS))
+
+/* cgt (G = G > S ? -1 : 0) - unsigned (x), signed (n) */
+
+#define cgtlx_rr(XG, XS)                                                    \
+        cgtix_rr(W(XG), W(XS))
+
+#define cgtlx_ld(XG, MS, DS)                                                \
+        cgtix_ld(W(XG), W(MS), W(DS))
+
+#define cgtln_rr(XG, XS)                                                    \
+        cgtin_rr(W(XG), W(XS))
+
+#define cgtln_ld(XG, MS, DS)                                                \
+        cgtin_ld(W(XG), W(MS), W(DS))
+
+/* cge (G = G >= S ? -1 : 0) - unsigned (x), signed (n) */
+
+#define cgelx_rr(XG, XS)                                                    \
+        cgeix_rr(W(XG), W(XS))
+
+#define cgelx_ld(XG, MS, DS)                                                \
+        cgeix_ld(W(XG), W(MS), W(DS))
+
+#define cgeln_rr(XG, XS)                                                    \
+        cgein_rr(W(XG), W(XS))
+
+#define cgeln_ld(XG, MS, DS)                                                \
+        cgein_ld(W(XG), W(MS), W(DS))
+
 /******************************************************************************/
 /**** scalar ***** SIMD instructions with configurable element **** 32-bit ****/
 /******************************************************************************/
@@ -6003,6 +8517,55 @@
 #define mmvpx_st(XS, MG, DG)                                                \
         mmvqx_st(W(XS), W(MG), W(DG))
 
+/* gth (D = [M + S]) gathers elements at M + S * element-size, M: Oeax, M***
+ * sct ([M + T] = S) scatters elements at M + T * element-size, M: Oeax, M*** */
+
+#define gthpx_ld(XD, XS, MT, DT)                                            \
+        gthqx_ld(W(XD), W(XS), W(MT), W(DT))
+
+#define sctpx_st(XS, XT, MD, DD)                                            \
+        sctqx_st(W(XS), W(XT), W(MD), W(DD))
+
+/* spl (D = S[i]) broadcasts lane i, rev (D = S reversed) reverses lanes
+ * rot (D[k] = S[(k + i) mod n]) rotates lanes down by i (immediate)
+ * unl/unh (G = G, S interleaved) from lower/upper halves of G and S
+ * tbl (D[k] = S[T[k] mod n]) permutes lanes with lane-indices in T */
+
+#define splpx_ri(XD, XS, IS)                                                \
+        splqx_ri(W(XD), W(XS), W(IS))
+
+#define revpx_rr(XD, XS)                                                    \
+        revqx_rr(W(XD), W(XS))
+
+#define rotpx_ri(XD, XS, IS)                                                \
+        rotqx_ri(W(XD), W(XS), W(IS))
+
+#define unlpx_rr(XG, XS)                                                    \
+        unlqx_rr(W(XG), W(XS))
+
+#define unhpx_rr(XG, XS)                                                    \
+        unhqx_rr(W(XG), W(XS))
+
+#define tblpx_rr(XD, XS, XT)                                                \
+        tblqx_rr(W(XD), W(XS), W(XT))
+
+#define tblpx_ld(XD, XS, MT, DT)                                            \
+        tblqx_ld(W(XD), W(XS), W(MT), W(DT))
+
+/* mtl (D = first RS elements from M, 0 above), count in BASE register
+ * mtl (first RT elements at M = S), lanes above the count untouched */
+
+#define mtlpx_ld(XD, RS, MT, DT)                                            \
+        mtlqx_ld(W(XD), W(RS), W(MT), W(DT))
+
+#define mtlpx_st(XS, RT, MD, DD)                                            \
+        mtlqx_st(W(XS), W(RT), W(MD), W(DD))
+
+/* stn (M = S) streams to aligned M bypassing caches where supported */
+
+#define stnpx_st(XS, MD, DD)                                                \
+        stnqx_st(W(XS), W(MD), W(DD))
+
 /* and (G = G & S), (D = S & T) if (#D != #S) */
 
 #define andpx_rr(XG, XS)                                                    \
@@ -6202,6 +8765,61 @@
 #define cbsps_rr(XG, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
         cbsqs_rr(W(XG), W(X1), W(X2), W(XS))
 
+/* exp (D = exp S) */
+
+#define expps_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        expqs_rr(W(XD), W(X1), W(X2), W(XS))
+
+/* log (D = log S) */
+
+#define logps_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        logqs_rr(W(XD), W(X1), W(X2), W(XS))
+
+/* sin (D = sin S) */
+
+#define sinps_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        sinqs_rr(W(XD), W(X1), W(X2), W(XS))
+
+/* cos (D = cos S) */
+
+#define cosps_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        cosqs_rr(W(XD), W(X1), W(X2), W(XS))
+
+/* tan (D = tan S) */
+
+#define tanps_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        tanqs_rr(W(XD), W(X1), W(X2), W(XS))
+
+/* snc (D = sin S, C = cos S) */
+
+#define sncps_rr(XD, XC, X1, X2, XS) /* destroys X1, X2 (temp regs) */      \
+        sncqs_rr(W(XD), W(XC), W(X1), W(X2), W(XS))
+
+/* at2 (D = atan2(S, T)) */
+
+#define at2ps_rr(XD, X1, X2, XS, XT) /* destroys X1, X2 (temp regs) */      \
+        at2qs_rr(W(XD), W(X1), W(X2), W(XS), W(XT))
+
+/* rng (D = random bits), advances per-lane generator state */
+
+#define rngpx_rr(XD, X1) /* destroys X1 (temp reg) */                       \
+        rngqx_rr(W(XD), W(X1))
+
+/* rng (D = random fp in [0, 1)), advances generator state */
+
+#define rngps_rr(XD, X1) /* destroys X1 (temp reg) */                       \
+        rngqs_rr(W(XD), W(X1))
+
+/* cvx (D = fp32 S), narrows onto lower half, upper half is zeroed */
+
+#define cvxps_rr(XD, XS)                                                    \
+        cvxqs_rr(W(XD), W(XS))
+
+/* cux (G = fp32 S), narrows onto upper half, lower half is kept */
+
+#define cuxps_rr(XG, XS)                                                    \
+        cuxqs_rr(W(XG), W(XS))
+
 /* rcp (D = 1.0 / S)
  * accuracy/behavior may vary across supported targets, use accordingly */
 
@@ -6655,6 +9273,80 @@
 #define svrpn3ld(XD, XS, MT, DT)                                            \
         svrqn3ld(W(XD), W(XS), W(MT), W(DT))
 
+/****************   packed double-precision integer compare   *****************/
+
+/* ceq (G = G == S ? -1 : 0) */
+
+#define ceqpx_rr(XG, XS)                                                    \
+        ceqqx_rr(W(XG), W(XS))
+
+#define ceqpx_ld(XG, MS, DS)                                                \
+        ceqqx_ld(W(XG), W(MS), W(DS))
+
+/* cne (G = G != S ? -1 : 0) */
+
+#define cnepx_rr(XG, XS)                                                    \
+        cneqx_rr(W(XG), W(XS))
+
+#define cnepx_ld(XG, MS, DS)                                                \
+        cneqx_ld(W(XG), W(MS), W(DS))
+
+/* clt (G = G < S ? -1 : 0) - unsigned (x), signed (n) */
+
+#define cltpx_rr(XG, XS)                                                    \
+        cltqx_rr(W(XG), W(XS))
+
+#define cltpx_ld(XG, MS, DS)                                                \
+        cltqx_ld(W(XG), W(MS), W(DS))
+
+#define cltpn_rr(XG, XS)                                                    \
+        cltqn_rr(W(XG), W(XS))
+
+#define cltpn_ld(XG, MS, DS)                                                \
+        cltqn_ld(W(XG), W(MS), W(DS))
+
+/* cle (G = G <= S ? -1 : 0) - unsigned (x), signed (n) */
+
+#define clepx_rr(XG, XS)                                                    \
+        cleqx_rr(W(XG), W(XS))
+
+#define clepx_ld(XG, MS, DS)                                                \
+        cleqx_ld(W(XG), W(MS), W(DS))
+
+#define clepn_rr(XG, XS)                                                    \
+        cleqn_rr(W(XG), W(XS))
+
+#define clepn_ld(XG, MS, DS)                                                \
+        cleqn_ld(W(XG), W(MS), W(DS))
+
+/* cgt (G = G > S ? -1 : 0) - unsigned (x), signed (n) */
+
+#define cgtpx_rr(XG, XS)                                                    \
+        cgtqx_rr(W(XG), W(XS))
+
+#define cgtpx_ld(XG, MS, DS)                                                \
+        cgtqx_ld(W(XG), W(MS), W(DS))
+
+#define cgtpn_rr(XG, XS)                                                    \
+        cgtqn_rr(W(XG), W(XS))
+
+#define cgtpn_ld(XG, MS, DS)                                                \
+        cgtqn_ld(W(XG), W(MS), W(DS))
+
+/* cge (G = G >= S ? -1 : 0) - unsigned (x), signed (n) */
+
+#define cgepx_rr(XG, XS)                                                    \
+        cgeqx_rr(W(XG), W(XS))
+
+#define cgepx_ld(XG, MS, DS)                                                \
+        cgeqx_ld(W(XG), W(MS), W(DS))
+
+#define cgepn_rr(XG, XS)                                                    \
+        cgeqn_rr(W(XG), W(XS))
+
+#define cgepn_ld(XG, MS, DS)                                                \
+        cgeqn_ld(W(XG), W(MS), W(DS))
+
 /******************************************************************************/
 /**** 256-bit **** SIMD instructions with configurable element **** 64-bit ****/
 /******************************************************************************/
@@ -6690,6 +9382,55 @@
 #define mmvfx_st(XS, MG, DG)                                                \
         mmvdx_st(W(XS), W(MG), W(DG))
 
+/* gth (D = [M + S]) gathers elements at M + S * element-size, M: Oeax, M***
+ * sct ([M + T] = S) scatters elements at M + T * element-size, M: Oeax, M*** */
+
+#define gthfx_ld(XD, XS, MT, DT)                                            \
+        gthdx_ld(W(XD), W(XS), W(MT), W(DT))
+
+#define sctfx_st(XS, XT, MD, DD)                                            \
+        sctdx_st(W(XS), W(XT), W(MD), W(DD))
+
+/* spl (D = S[i]) broadcasts lane i, rev (D = S reversed) reverses lanes
+ * rot (D[k] = S[(k + i) mod n]) rotates lanes down by i (immediate)
+ * unl/unh (G = G, S interleaved) from lower/upper halves of G and S
+ * tbl (D[k] = S[T[k] mod n]) permutes lanes with lane-indices in T */
+
+#define splfx_ri(XD, XS, IS)                                                \
+        spldx_ri(W(XD), W(XS), W(IS))
+
+#define revfx_rr(XD, XS)                                                    \
+        revdx_rr(W(XD), W(XS))
+
+#define rotfx_ri(XD, XS, IS)                                                \
+        rotdx_ri(W(XD), W(XS), W(IS))
+
+#define unlfx_rr(XG, XS)                                                    \
+        unldx_rr(W(XG), W(XS))
+
+#define unhfx_rr(XG, XS)                                                    \
+        unhdx_rr(W(XG), W(XS))
+
+#define tblfx_rr(XD, XS, XT)                                                \
+        tbldx_rr(W(XD), W(XS), W(XT))
+
+#define tblfx_ld(XD, XS, MT, DT)                                            \
+        tbldx_ld(W(XD), W(XS), W(MT), W(DT))
+
+/* mtl (D = first RS elements from M, 0 above), count in BASE register
+ * mtl (first RT elements at M = S), lanes above the count untouched */
+
+#define mtlfx_ld(XD, RS, MT, DT)                                            \
+        mtldx_ld(W(XD), W(RS), W(MT), W(DT))
+
+#define mtlfx_st(XS, RT, MD, DD)                                            \
+        mtldx_st(W(XS), W(RT), W(MD), W(DD))
+
+/* stn (M = S) streams to aligned M bypassing caches where supported */
+
+#define stnfx_st(XS, MD, DD)                                                \
+        stndx_st(W(XS), W(MD), W(DD))
+
 /* and (G = G & S), (D = S & T) if (#D != #S) */
 
 #define andfx_rr(XG, XS)                                                    \
@@ -6889,6 +9630,61 @@
 #define cbsfs_rr(XG, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
         cbsds_rr(W(XG), W(X1), W(X2), W(XS))
 
+/* exp (D = exp S) */
+
+#define expfs_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        expds_rr(W(XD), W(X1), W(X2), W(XS))
+
+/* log (D = log S) */
+
+#define logfs_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        logds_rr(W(XD), W(X1), W(X2), W(XS))
+
+/* sin (D = sin S) */
+
+#define sinfs_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        sinds_rr(W(XD), W(X1), W(X2), W(XS))
+
+/* cos (D = cos S) */
+
+#define cosfs_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        cosds_rr(W(XD), W(X1), W(X2), W(XS))
+
+/* tan (D = tan S) */
+
+#define tanfs_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        tands_rr(W(XD), W(X1), W(X2), W(XS))
+
+/* snc (D = sin S, C = cos S) */
+
+#define sncfs_rr(XD, XC, X1, X2, XS) /* destroys X1, X2 (temp regs) */      \
+        sncds_rr(W(XD), W(XC), W(X1), W(X2), W(XS))
+
+/* at2 (D = atan2(S, T)) */
+
+#define at2fs_rr(XD, X1, X2, XS, XT) /* destroys X1, X2 (temp regs) */      \
+        at2ds_rr(W(XD), W(X1), W(X2), W(XS), W(XT))
+
+/* rng (D = random bits), advances per-lane generator state */
+
+#define rngfx_rr(XD, X1) /* destroys X1 (temp reg) */                       \
+        rngdx_rr(W(XD), W(X1))
+
+/* rng (D = random fp in [0, 1)), advances generator state */
+
+#define rngfs_rr(XD, X1) /* destroys X1 (temp reg) */                       \
+        rngds_rr(W(XD), W(X1))
+
+/* cvx (D = fp32 S), narrows onto lower half, upper half is zeroed */
+
+#define cvxfs_rr(XD, XS)                                                    \
+        cvxds_rr(W(XD), W(XS))
+
+/* cux (G = fp32 S), narrows onto upper half, lower half is kept */
+
+#define cuxfs_rr(XG, XS)                                                    \
+        cuxds_rr(W(XG), W(XS))
+
 /* rcp (D = 1.0 / S)
  * accuracy/behavior may vary across supported targets, use accordingly */
 
@@ -7342,6 +10138,80 @@
 #define svrfn3ld(XD, XS, MT, DT)                                            \
         svrdn3ld(W(XD), W(XS), W(MT), W(DT))
 
+/****************   packed double-precision integer compare   *****************/
+
+/* ceq (G = G == S ? -1 : 0) */
+
+#define ceqfx_rr(XG, XS)                                                    \
+        ceqdx_rr(W(XG), W(XS))
+
+#define ceqfx_ld(XG, MS, DS)                                                \
+        ceqdx_ld(W(XG), W(MS), W(DS))
+
+/* cne (G = G != S ? -1 : 0) */
+
+#define cnefx_rr(XG, XS)                                                    \
+        cnedx_rr(W(XG), W(XS))
+
+#define cnefx_ld(XG, MS, DS)                                                \
+        cnedx_ld(W(XG), W(MS), W(DS))
+
+/* clt (G = G < S ? -1 : 0) - unsigned (x), signed (n) */
+
+#define cltfx_rr(XG, XS)                                                    \
+        cltdx_rr(W(XG), W(XS))
+
+#define cltfx_ld(XG, MS, DS)                                                \
+        cltdx_ld(W(XG), W(MS), W(DS))
+
+#define cltfn_rr(XG, XS)                                                    \
+        cltdn_rr(W(XG), W(XS))
+
+#define cltfn_ld(XG, MS, DS)                                                \
+        cltdn_ld(W(XG), W(MS), W(DS))
+
+/* cle (G = G <= S ? -1 : 0) - unsigned (x), signed (n) */
+
+#define clefx_rr(XG, XS)                                                    \
+        cledx_rr(W(XG), W(XS))
+
+#define clefx_ld(XG, MS, DS)                                                \
+        cledx_ld(W(XG), W(MS), W(DS))
+
+#define clefn_rr(XG, XS)                                                    \
+        cledn_rr(W(XG), W(XS))
+
+#define clefn_ld(XG, MS, DS)                                                \
+        cledn_ld(W(XG), W(MS), W(DS))
+
+/* cgt (G = G > S ? -1 : 0) - unsigned (x), signed (n) */
+
+#define cgtfx_rr(XG, XS)                                                    \
+        cgtdx_rr(W(XG), W(XS))
+
+#define cgtfx_ld(XG, MS, DS)                                                \
+        cgtdx_ld(W(XG), W(MS), W(DS))
+
+#define cgtfn_rr(XG, XS)                                                    \
+        cgtdn_rr(W(XG), W(XS))
+
+#define cgtfn_ld(XG, MS, DS)                                                \
+        cgtdn_ld(W(XG), W(MS), W(DS))
+
+/* cge (G = G >= S ? -1 : 0) - unsigned (x), signed (n) */
+
+#define cgefx_rr(XG, XS)                                                    \
+        cgedx_rr(W(XG), W(XS))
+
+#define cgefx_ld(XG, MS, DS)                                                \
+        cgedx_ld(W(XG), W(MS), W(DS))
+
+#define cgefn_rr(XG, XS)                                                    \
+        cgedn_rr(W(XG), W(XS))
+
+#define cgefn_ld(XG, MS, DS)                                                \
+        cgedn_ld(W(XG), W(MS), W(DS))
+
 /******************************************************************************/
 /**** 128-bit **** SIMD instructions with configurable element **** 64-bit ****/
 /******************************************************************************/
@@ -7377,6 +10247,55 @@
 #define mmvlx_st(XS, MG, DG)                                                \
         mmvjx_st(W(XS), W(MG), W(DG))
 
+/* gth (D = [M + S]) gathers elements at M + S * element-size, M: Oeax, M***
+ * sct ([M + T] = S) scatters elements at M + T * element-size, M: Oeax, M*** */
+
+#define gthlx_ld(XD, XS, MT, DT)                                            \
+        gthjx_ld(W(XD), W(XS), W(MT), W(DT))
+
+#define sctlx_st(XS, XT, MD, DD)                                            \
+        sctjx_st(W(XS), W(XT), W(MD), W(DD))
+
+/* spl (D = S[i]) broadcasts lane i, rev (D = S reversed) reverses lanes
+ * rot (D[k] = S[(k + i) mod n]) rotates lanes down by i (immediate)
+ * unl/unh (G = G, S interleaved) from lower/upper halves of G and S
+ * tbl (D[k] = S[T[k] mod n]) permutes lanes with lane-indices in T */
+
+#define spllx_ri(XD, XS, IS)                                                \
+        spljx_ri(W(XD), W(XS), W(IS))
+
+#define revlx_rr(XD, XS)                                                    \
+        revjx_rr(W(XD), W(XS))
+
+#define rotlx_ri(XD, XS, IS)                                                \
+        rotjx_ri(W(XD), W(XS), W(IS))
+
+#define unllx_rr(XG, XS)                                                    \
+        unljx_rr(W(XG), W(XS))
+
+#define unhlx_rr(XG, XS)                                                    \
+        unhjx_rr(W(XG), W(XS))
+
+#define tbllx_rr(XD, XS, XT)                                                \
+        tbljx_rr(W(XD), W(XS), W(XT))
+
+#define tbllx_ld(XD, XS, MT, DT)                                            \
+        tbljx_ld(W(XD), W(XS), W(MT), W(DT))
+
+/* mtl (D = first RS elements from M, 0 above), count in BASE register
+ * mtl (first RT elements at M = S), lanes above the count untouched */
+
+#define mtllx_ld(XD, RS, MT, DT)                                            \
+        mtljx_ld(W(XD), W(RS), W(MT), W(DT))
+
+#define mtllx_st(XS, RT, MD, DD)                                            \
+        mtljx_st(W(XS), W(RT), W(MD), W(DD))
+
+/* stn (M = S) streams to aligned M bypassing caches where supported */
+
+#define stnlx_st(XS, MD, DD)                                                \
+        stnjx_st(W(XS), W(MD), W(DD))
+
 /* and (G = G & S), (D = S & T) if (#D != #S) */
 
 #define andlx_rr(XG, XS)                                                    \
@@ -7576,6 +10495,61 @@
 #define cbsls_rr(XG, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
         cbsjs_rr(W(XG), W(X1), W(X2), W(XS))
 
+/* exp (D = exp S) */
+
+#define expls_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        expjs_rr(W(XD), W(X1), W(X2), W(XS))
+
+/* log (D = log S) */
+
+#define logls_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        logjs_rr(W(XD), W(X1), W(X2), W(XS))
+
+/* sin (D = sin S) */
+
+#define sinls_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        sinjs_rr(W(XD), W(X1), W(X2), W(XS))
+
+/* cos (D = cos S) */
+
+#define cosls_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        cosjs_rr(W(XD), W(X1), W(X2), W(XS))
+
+/* tan (D = tan S) */
+
+#define tanls_rr(XD, X1, X2, XS) /* destroys X1, X2 (temp regs) */          \
+        tanjs_rr(W(XD), W(X1), W(X2), W(XS))
+
+/* snc (D = sin S, C = cos S) */
+
+#define sncls_rr(XD, XC, X1, X2, XS) /* destroys X1, X2 (temp regs) */      \
+        sncjs_rr(W(XD), W(XC), W(X1), W(X2), W(XS))
+
+/* at2 (D = atan2(S, T)) */
+
+#define at2ls_rr(XD, X1, X2, XS, XT) /* destroys X1, X2 (temp regs) */      \
+        at2js_rr(W(XD), W(X1), W(X2), W(XS), W(XT))
+
+/* rng (D = random bits), advances per-lane generator state */
+
+#define rnglx_rr(XD, X1) /* destroys X1 (temp reg) */                       \
+        rngjx_rr(W(XD), W(X1))
+
+/* rng (D = random fp in [0, 1)), advances generator state */
+
+#define rngls_rr(XD, X1) /* destroys X1 (temp reg) */                       \
+        rngjs_rr(W(XD), W(X1))
+
+/* cvx (D = fp32 S), narrows onto lower half, upper half is zeroed */
+
+#define cvxls_rr(XD, XS)                                                    \
+        cvxjs_rr(W(XD), W(XS))
+
+/* cux (G = fp32 S), narrows onto upper half, lower half is kept */
+
+#define cuxls_rr(XG, XS)                                                    \
+        cuxjs_rr(W(XG), W(XS))
+
 /* rcp (D = 1.0 / S)
  * accuracy/behavior may vary across supported targets, use accordingly */
 
@@ -8029,6 +11003,80 @@
 #define svrln3ld(XD, XS, MT, DT)                                            \
         svrjn3ld(W(XD), W(XS), W(MT), W(DT))
 
+/****************   packed double-precision integer compare   *****************/
+
+/* ceq (G = G == S ? -1 : 0) */
+
+#define ceqlx_rr(XG, XS)                                                    \
+        ceqjx_rr(W(XG), W(XS))
+
+#define ceqlx_ld(XG, MS, DS)                                                \
+        ceqjx_ld(W(XG), W(MS), W(DS))
+
+/* cne (G = G != S ? -1 : 0) */
+
+#define cnelx_rr(XG, XS)                                                    \
+        cnejx_rr(W(XG), W(XS))
+
+#define cnelx_ld(XG, MS, DS)                                                \
+        cnejx_ld(W(XG), W(MS), W(DS))
+
+/* clt (G = G < S ? -1 : 0) - unsigned (x), signed (n) */
+
+#define cltlx_rr(XG, XS)                                                    \
+        cltjx_rr(W(XG), W(XS))
+
+#define cltlx_ld(XG, MS, DS)                                                \
+        cltjx_ld(W(XG), W(MS), W(DS))
+
+#define cltln_rr(XG, XS)                                                    \
+        cltjn_rr(W(XG), W(XS))
+
+#define cltln_ld(XG, MS, DS)                                                \
+        cltjn_ld(W(XG), W(MS), W(DS))
+
+/* cle (G = G <= S ? -1 : 0) - unsigned (x), signed (n) */
+
+#define clelx_rr(XG, XS)                                                    \
+        clejx_rr(W(XG), W(XS))
+
+#define clelx_ld(XG, MS, DS)                                                \
+        clejx_ld(W(XG), W(MS), W(DS))
+
+#define cleln_rr(XG, XS)                                                    \
+        clejn_rr(W(XG), W(XS))
+
+#define cleln_ld(XG, MS, DS)                                                \
+        clejn_ld(W(XG), W(MS), W(DS))
+
+/* cgt (G = G > S ? -1 : 0) - unsigned (x), signed (n) */
+
+#define cgtlx_rr(XG, XS)                                                    \
+        cgtjx_rr(W(XG), W(XS))
+
+#define cgtlx_ld(XG, MS, DS)                                                \
+        cgtjx_ld(W(XG), W(MS), W(DS))
+
+#define cgtln_rr(XG, XS)                                                    \
+        cgtjn_rr(W(XG), W(XS))
+
+#define cgtln_ld(XG, MS, DS)                                                \
+        cgtjn_ld(W(XG), W(MS), W(DS))
+
+/* cge (G = G >= S ? -1 : 0) - unsigned (x), signed (n) */
+
+#define cgelx_rr(XG, XS)                                                    \
+        cgejx_rr(W(XG), W(XS))
+
+#define cgelx_ld(XG, MS, DS)                                                \
+        cgejx_ld(W(XG), W(MS), W(DS))
+
+#define cgeln_rr(XG, XS)                                                    \
+        cgejn_rr(W(XG), W(XS))
+
+#define cgeln_ld(XG, MS, DS)                                                \
+        cgejn_ld(W(XG), W(MS), W(DS))
+
 /******************************************************************************/
 /**** scalar ***** SIMD instructions with configurable element **** 64-bit ****/
 /******************************************************************************/
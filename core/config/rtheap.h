@@ -0,0 +1,509 @@
+/******************************************************************************/
+/* Copyright (c) 2013-2019 VectorChief (at github, bitbucket, sourceforge)    */
+/* Distributed under the MIT software license, see the accompanying           */
+/* file COPYING or http://www.opensource.org/licenses/mit-license.php         */
+/******************************************************************************/
+
+#ifndef RT_RTHEAP_H
+#define RT_RTHEAP_H
+
+#include <string.h>
+
+#include "rtbase.h"
+
+#if   (defined RT_WIN32) || (defined RT_WIN64) /* Win32, MSVC - Win64, GCC -- */
+
+#include <windows.h>
+
+#else /* --- Linux, GCC ----------------------------------------------------- */
+
+#include <sys/mman.h>
+
+#ifndef MAP_ANONYMOUS
+#define MAP_ANONYMOUS MAP_ANON  /* workaround for macOS compilation */
+#endif /* macOS still cannot allocate with mmap within 32-bit range */
+
+#ifndef MAP_NORESERVE
+#define MAP_NORESERVE 0
+#endif /* MAP_NORESERVE */
+
+#endif /* ------------- OS specific ----------------------------------------- */
+
+/******************************************************************************/
+/*********************************   LEGEND   *********************************/
+/******************************************************************************/
+
+/*
+ * rtheap.h: Thread-safe arena allocator for SIMD data (rt_SIMD_INFO, arrays).
+ *
+ * Heap (rt_HEAP) reserves one large region of virtual memory at init,
+ * which is placed within the 32-bit address range in 64/32-bit hybrid mode
+ * (RT_POINTER=64, RT_ADDRESS=32), as required by the 32-bit address loads
+ * of the ASM code. The region is split into chunks (RT_HEAP_CHUNK_SIZE)
+ * which are handed out to arenas with an atomic bump of the region offset,
+ * chunks returned by finished arenas are kept on a spinlock-protected list.
+ *
+ * Arena (rt_HEAP_ARENA) is owned by a single thread and hands out blocks
+ * aligned to RT_SIMD_ALIGN from its current chunk without locks or syscalls.
+ * Requests larger than a chunk take a run of contiguous chunks of their own.
+ * Blocks are not freed individually, instead the whole arena is rewound with
+ * heap_reset_arena (chunks are kept for reuse) or released with heap_done_arena
+ * (chunks go back to the heap). Heap itself can be reset in bulk with
+ * heap_reset when no arenas are in use (arenas are to be initialized again).
+ *
+ * Optional huge pages (RT_HEAP_HUGE) are requested with madvise on Linux
+ * (transparent huge pages) and with large-page allocation on Windows,
+ * which falls back to regular pages when not permitted for the process.
+ * Chunks are aligned to the common 2 MiB huge page size for that purpose.
+ */
+
+/******************************************************************************/
+/*******************************   DEFINITIONS   ******************************/
+/******************************************************************************/
+
+/*
+ * Chunk size of the heap (power of 2), also the alignment of the region,
+ * can be redefined from the outside.
+ */
+#ifndef RT_HEAP_CHUNK_SIZE
+#define RT_HEAP_CHUNK_SIZE  0x200000
+#endif /* RT_HEAP_CHUNK_SIZE */
+
+#define RT_HEAP_CHUNK_MASK  (RT_HEAP_CHUNK_SIZE - 1)
+
+/*
+ * Window for the heap region in 64/32-bit hybrid mode,
+ * addresses can't have sign bit as MIPS64 sign-extends 32-bit mem-loads.
+ */
+#ifndef RT_HEAP_ADDRESS_MIN
+#define RT_HEAP_ADDRESS_MIN ((rt_byte *)0x0000000040000000)
+#define RT_HEAP_ADDRESS_MAX ((rt_byte *)0x0000000080000000)
+#endif /* RT_HEAP_ADDRESS_MIN */
+
+/*
+ * Size of the chunk header, blocks in the chunk start right after it.
+ */
+#define RT_HEAP_HEAD        RT_SIMD_ALIGN
+#define RT_HEAP_MASK        (RT_SIMD_ALIGN - 1)
+
+/*
+ * Heap flags.
+ */
+#define RT_HEAP_HUGE        1      /* request huge pages for the region */
+
+/*
+ * Chunk header, "size" is the size of the chunk (whole chunks),
+ * "next" links chunks owned by an arena or free chunks of the heap.
+ */
+struct rt_HEAP_CHUNK
+{
+    rt_HEAP_CHUNK*  next;
+    rt_size         size;
+};
+
+/*
+ * Heap structure, region is owned by the heap, chunks are owned by arenas.
+ */
+struct rt_HEAP
+{
+    rt_byte*        base;   /* region, aligned to chunk size */
+    rt_size         size;   /* size of the region, whole chunks */
+
+    rt_pntr         resv;   /* original reservation */
+    rt_size         rlen;   /* size of the original reservation */
+
+    rt_si32         flags;  /* heap flags (RT_HEAP_HUGE) */
+    rt_bool         comm;   /* region is committed at init */
+
+    rt_HEAP_CHUNK*  free;   /* list of free chunks, protected by lock */
+
+    volatile rt_si32 lock;
+    volatile rt_size next;  /* offset of the first unused chunk */
+};
+
+/*
+ * Arena structure, "chunk" is the current chunk, "head" is the first chunk
+ * owned by the arena, chunks in between are reused after heap_reset_arena.
+ */
+struct rt_HEAP_ARENA
+{
+    rt_HEAP*        heap;
+    rt_HEAP_CHUNK*  head;
+    rt_HEAP_CHUNK*  chunk;
+    rt_size         cur;    /* offset of the first free byte in the chunk */
+};
+
+/*
+ * Atomic compare-and-swap, returns the previous value at "ptr".
+ */
+static
+rt_size heap_cas(volatile rt_size *ptr, rt_size cmp, rt_size val)
+{
+#if   (defined RT_WIN32) /* Win32, MSVC -------- for older versions --------- */
+
+    return InterlockedCompareExchange((volatile LONG *)ptr, val, cmp);
+
+#else /* --- Win64, GCC --- Linux, GCC -------------------------------------- */
+
+    return __sync_val_compare_and_swap(ptr, cmp, val);
+
+#endif /* ------------- OS specific ----------------------------------------- */
+}
+
+/*
+ * Acquire/release spinlock at "lock" (protects the list of free chunks).
+ */
+static
+rt_void heap_lock(volatile rt_si32 *lock)
+{
+#if   (defined RT_WIN32) /* Win32, MSVC -------- for older versions --------- */
+
+    while (InterlockedExchange((volatile LONG *)lock, 1) != 0)
+    {
+        Sleep(0);
+    }
+
+#else /* --- Win64, GCC --- Linux, GCC -------------------------------------- */
+
+    while (__sync_lock_test_and_set(lock, 1) != 0)
+    {
+        while (*lock != 0);
+    }
+
+#endif /* ------------- OS specific ----------------------------------------- */
+}
+
+static
+rt_void heap_unlock(volatile rt_si32 *lock)
+{
+#if   (defined RT_WIN32) /* Win32, MSVC -------- for older versions --------- */
+
+    InterlockedExchange((volatile LONG *)lock, 0);
+
+#else /* --- Win64, GCC --- Linux, GCC -------------------------------------- */
+
+    __sync_lock_release(lock);
+
+#endif /* ------------- OS specific ----------------------------------------- */
+}
+
+/*
+ * Reserve "size" bytes of virtual memory at "hint" (or anywhere if RT_NULL),
+ * return RT_NULL if the reservation can't be placed exactly at "hint".
+ */
+static
+rt_pntr heap_map(rt_HEAP *heap, rt_byte *hint, rt_size size)
+{
+    rt_pntr ptr = RT_NULL;
+
+#if   (defined RT_WIN32) || (defined RT_WIN64) /* Win32, MSVC - Win64, GCC -- */
+
+    heap->comm = RT_FALSE;
+
+    if (heap->flags & RT_HEAP_HUGE)
+    {
+        ptr = VirtualAlloc(hint, size, MEM_RESERVE | MEM_COMMIT |
+                           MEM_LARGE_PAGES, PAGE_READWRITE);
+        heap->comm = ptr != RT_NULL;
+    }
+    if (ptr == RT_NULL)
+    {
+        ptr = VirtualAlloc(hint, size, MEM_RESERVE, PAGE_READWRITE);
+    }
+    if (ptr != RT_NULL && hint != RT_NULL && ptr != hint)
+    {
+        VirtualFree(ptr, 0, MEM_RELEASE);
+        ptr = RT_NULL;
+    }
+
+#else /* --- Linux, GCC ----------------------------------------------------- */
+
+    ptr = mmap(hint, size, PROT_READ | PROT_WRITE,
+               MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+
+    if (ptr == MAP_FAILED)
+    {
+        ptr = RT_NULL;
+    }
+    if (ptr != RT_NULL && hint != RT_NULL && ptr != hint)
+    {
+        munmap(ptr, size);
+        ptr = RT_NULL;
+    }
+
+#endif /* ------------- OS specific ----------------------------------------- */
+
+    return ptr;
+}
+
+/*
+ * Initialize heap with a region of "size" bytes (rounded up to whole chunks),
+ * return RT_FALSE if the region can't be reserved.
+ */
+static
+rt_bool heap_init(rt_HEAP *heap, rt_size size, rt_si32 flags)
+{
+    memset(heap, 0, sizeof(rt_HEAP));
+
+    heap->size  = (size + RT_HEAP_CHUNK_MASK) & ~(rt_size)RT_HEAP_CHUNK_MASK;
+    heap->flags = flags;
+
+#if (RT_POINTER - RT_ADDRESS) != 0
+
+    /* probe chunk-aligned hints across the window from the top down
+     * as parts of it may already be taken by other mappings,
+     * bottom of the window is left to sequential allocators */
+    rt_byte *hint = (rt_byte *)((rt_uptr)(RT_HEAP_ADDRESS_MAX - heap->size) &
+                                                ~(rt_uptr)RT_HEAP_CHUNK_MASK);
+
+    for (; heap->resv == RT_NULL && hint >= RT_HEAP_ADDRESS_MIN;
+           hint -= RT_HEAP_CHUNK_SIZE)
+    {
+        heap->resv = heap_map(heap, hint, heap->size);
+    }
+
+    heap->rlen = heap->size;
+
+#else /* RT_POINTER == RT_ADDRESS */
+
+    /* over-reserve by a chunk to align the region,
+     * large pages on Windows are aligned as they are */
+    heap->rlen = heap->size + RT_HEAP_CHUNK_SIZE;
+    heap->resv = heap_map(heap, RT_NULL, heap->rlen);
+
+#endif /* (RT_POINTER - RT_ADDRESS) */
+
+    if (heap->resv == RT_NULL)
+    {
+        return RT_FALSE;
+    }
+
+    heap->base = (rt_byte *)(((rt_uptr)heap->resv + RT_HEAP_CHUNK_MASK) &
+                                          ~(rt_uptr)RT_HEAP_CHUNK_MASK);
+
+#if   (defined RT_WIN32) || (defined RT_WIN64) /* Win32, MSVC - Win64, GCC -- */
+
+#else /* --- Linux, GCC ----------------------------------------------------- */
+
+#ifdef MADV_HUGEPAGE
+    if (flags & RT_HEAP_HUGE)
+    {
+        madvise(heap->base, heap->size, MADV_HUGEPAGE);
+    }
+#endif /* MADV_HUGEPAGE */
+
+#endif /* ------------- OS specific ----------------------------------------- */
+
+    return RT_TRUE;
+}
+
+/*
+ * Release heap region, all arenas of the heap become invalid.
+ */
+static
+rt_void heap_done(rt_HEAP *heap)
+{
+    if (heap->resv == RT_NULL)
+    {
+        return;
+    }
+
+#if   (defined RT_WIN32) || (defined RT_WIN64) /* Win32, MSVC - Win64, GCC -- */
+
+    VirtualFree(heap->resv, 0, MEM_RELEASE);
+
+#else /* --- Linux, GCC ----------------------------------------------------- */
+
+    munmap(heap->resv, heap->rlen);
+
+#endif /* ------------- OS specific ----------------------------------------- */
+
+    memset(heap, 0, sizeof(rt_HEAP));
+}
+
+/*
+ * Reset heap in bulk, all chunks become unused (pages stay mapped).
+ * Not thread-safe, arenas are to be initialized again before use.
+ */
+static
+rt_void heap_reset(rt_HEAP *heap)
+{
+    heap->free = RT_NULL;
+    heap->next = 0;
+}
+
+/*
+ * Take a chunk of at least "size" bytes (including header) from the heap,
+ * single chunks are reused from the free list first, return RT_NULL
+ * if the region is exhausted. Safe to call from multiple threads.
+ */
+static
+rt_HEAP_CHUNK *heap_take(rt_HEAP *heap, rt_size size)
+{
+    rt_HEAP_CHUNK *chunk = RT_NULL;
+    rt_size offs, next, prev;
+
+    size = (size + RT_HEAP_CHUNK_MASK) & ~(rt_size)RT_HEAP_CHUNK_MASK;
+
+    /* unlocked check is only a hint, the list is read again under lock */
+    if (size == RT_HEAP_CHUNK_SIZE && heap->free != RT_NULL)
+    {
+        heap_lock(&heap->lock);
+
+        chunk = heap->free;
+        if (chunk != RT_NULL)
+        {
+            heap->free = chunk->next;
+        }
+
+        heap_unlock(&heap->lock);
+    }
+
+    if (chunk != RT_NULL)
+    {
+        chunk->next = RT_NULL;
+        return chunk;
+    }
+
+    /* start from a guess, failed swap returns the actual offset */
+    for (offs = 0; ; offs = prev)
+    {
+        next = offs + size;
+
+        if (next > heap->size || next < offs)
+        {
+            return RT_NULL;
+        }
+
+        prev = heap_cas(&heap->next, offs, next);
+
+        if (prev == offs)
+        {
+            break;
+        }
+    }
+
+    chunk = (rt_HEAP_CHUNK *)(heap->base + offs);
+
+#if   (defined RT_WIN32) || (defined RT_WIN64) /* Win32, MSVC - Win64, GCC -- */
+
+    if (!heap->comm
+    &&  VirtualAlloc(chunk, size, MEM_COMMIT, PAGE_READWRITE) == RT_NULL)
+    {
+        return RT_NULL; /* the range is lost until heap_reset */
+    }
+
+#endif /* ------------- OS specific ----------------------------------------- */
+
+    chunk->next = RT_NULL;
+    chunk->size = size;
+
+    return chunk;
+}
+
+/*
+ * Initialize arena of the heap, no memory is taken until the first alloc.
+ */
+static
+rt_void heap_init_arena(rt_HEAP_ARENA *arena, rt_HEAP *heap)
+{
+    arena->heap  = heap;
+    arena->head  = RT_NULL;
+    arena->chunk = RT_NULL;
+    arena->cur   = 0;
+}
+
+/*
+ * Allocate "size" bytes aligned to RT_SIMD_ALIGN from the arena,
+ * return RT_NULL if the heap is exhausted. Not thread-safe per arena.
+ */
+static
+rt_pntr heap_alloc(rt_HEAP_ARENA *arena, rt_size size)
+{
+    rt_HEAP_CHUNK *chunk = arena->chunk;
+    rt_pntr ptr;
+
+    size = (size + RT_HEAP_MASK) & ~(rt_size)RT_HEAP_MASK;
+
+    /* move to the next owned chunk which fits (after reset),
+     * take a new chunk from the heap when at the end of the list */
+    while (chunk == RT_NULL || arena->cur + size > chunk->size)
+    {
+        if (chunk != RT_NULL && chunk->next != RT_NULL)
+        {
+            chunk = chunk->next;
+        }
+        else
+        {
+            rt_HEAP_CHUNK *next = heap_take(arena->heap, RT_HEAP_HEAD + size);
+
+            if (next == RT_NULL)
+            {
+                return RT_NULL;
+            }
+            if (chunk != RT_NULL)
+            {
+                chunk->next = next;
+            }
+            else
+            {
+                arena->head = next;
+            }
+            chunk = next;
+        }
+
+        arena->chunk = chunk;
+        arena->cur   = RT_HEAP_HEAD;
+    }
+
+    ptr = (rt_byte *)chunk + arena->cur;
+    arena->cur += size;
+
+    return ptr;
+}
+
+/*
+ * Reset arena in bulk, all blocks become invalid,
+ * owned chunks are kept for subsequent allocations.
+ */
+static
+rt_void heap_reset_arena(rt_HEAP_ARENA *arena)
+{
+    arena->chunk = arena->head;
+    arena->cur   = RT_HEAP_HEAD;
+}
+
+/*
+ * Release all chunks of the arena back to the heap,
+ * runs of contiguous chunks are split into single chunks.
+ */
+static
+rt_void heap_done_arena(rt_HEAP_ARENA *arena)
+{
+    rt_HEAP *heap = arena->heap;
+    rt_HEAP_CHUNK *chunk = arena->head, *next, *part;
+    rt_size offs;
+
+    for (; chunk != RT_NULL; chunk = next)
+    {
+        next = chunk->next;
+
+        for (offs = chunk->size - RT_HEAP_CHUNK_SIZE; offs >= 0;
+             offs -= RT_HEAP_CHUNK_SIZE)
+        {
+            part = (rt_HEAP_CHUNK *)((rt_byte *)chunk + offs);
+            part->size = RT_HEAP_CHUNK_SIZE;
+
+            heap_lock(&heap->lock);
+
+            part->next = heap->free;
+            heap->free = part;
+
+            heap_unlock(&heap->lock);
+        }
+    }
+
+    heap_init_arena(arena, heap);
+}
+
+#endif /* RT_RTHEAP_H */
@@ -0,0 +1,968 @@
+/******************************************************************************/
+/* Copyright (c) 2013-2019 VectorChief (at github, bitbucket, sourceforge)    */
+/* Distributed under the MIT software license, see the accompanying           */
+/* file COPYING or http://www.opensource.org/licenses/mit-license.php         */
+/******************************************************************************/
+
+#ifndef RT_RTJIT_H
+#define RT_RTJIT_H
+
+#include <string.h>
+
+#if   (defined RT_WIN64) /* Win64, GCC -------------------------------------- */
+
+#include <windows.h>
+
+#else /* --- Linux, GCC ----------------------------------------------------- */
+
+#include <sys/mman.h>
+#include <pthread.h>
+
+#endif /* ------------- OS specific ----------------------------------------- */
+
+/******************************************************************************/
+/*********************************   LEGEND   *********************************/
+/******************************************************************************/
+
+/*
+ * rtjit.h: Run-time code generation support (enabled with RT_JIT build flag).
+ *
+ * When RT_JIT is defined, EMITB/EMITW emitters in rtarch.h no longer produce
+ * inline assembler directives, but instead write instruction bytes into a
+ * temporary code buffer at its current (cur++) offset. ASM_ENTER initializes
+ * the buffer on the stack of the calling function, while ASM_LEAVE resolves
+ * label references, copies the code into a page with code-exec rights,
+ * type-casts it to a function-pointer and calls it with Info in 1st arg.
+ *
+ * As all instruction macros expand to regular C/C++ statements in this mode,
+ * the code between ASM_ENTER and ASM_LEAVE can be specialized at run-time
+ * on data sizes, constants and the SIMD target reported by verxx_xx,
+ * although immediate/displacement values must still fit their types.
+ *
+ * Code labels (LBL) and label-targeted jumps (j**xx_lb, label_ld/st) are
+ * tracked within the buffer by their names. Jumps are first emitted in their
+ * longest form, forward and backward references are resolved when the code
+ * is complete. Each jump is then relaxed to the shortest encoding which fits
+ * its distance within the range of a given target (similar to static builds),
+ * while conditional jumps out of range are replaced with veneers (inverted
+ * conditional jump over an unconditional jump to the original label).
+ * Currently only x86_64 targets (x32/x64 ABI) support run-time generation.
+ *
+ * Generated code is kept in a process-wide code cache, so that each kernel
+ * is emitted only once and subsequent calls skip straight to the code.
+ * Cache key consists of the kernel id (unique per ASM_ENTER call site),
+ * SIMD target mask from Info (rt_SIMD_INFO::ver), RT_ELEMENT/RT_ADDRESS
+ * of the compilation unit and an optional block of specialization constants
+ * passed to ASM_ENTER_S, which must cover all run-time values the code
+ * depends on. Each entry resides in its own read-exec pages (W^X), entries
+ * not in use are evicted in LRU order when the cache exceeds its byte budget.
+ * Lookups take a shared lock and run concurrently across threads.
+ */
+
+/******************************************************************************/
+/*******************************   DEFINITIONS   ******************************/
+/******************************************************************************/
+
+#define RT_JIT_CODE_SIZE    0x1000 /* initial code buffer size, grows x2 */
+#define RT_JIT_LBLS_SIZE    64     /* maximum number of labels per block */
+#define RT_JIT_REFS_SIZE    256    /* maximum number of label references */
+#define RT_JIT_HASH_SIZE    256    /* number of code cache hash buckets */
+
+/*
+ * Default byte budget of the code cache (counted in whole pages),
+ * can be redefined from the outside or changed at run-time (jit_budget).
+ */
+#ifndef RT_JIT_CACHE_SIZE
+#define RT_JIT_CACHE_SIZE   0x1000000
+#endif /* RT_JIT_CACHE_SIZE */
+
+/*
+ * Maximum byte-address-range for un/conditional jumps (signed, in bits)
+ * based on natively-encoded offsets of label-targeted jumps across targets
+ * MIPS:18-bit, POWER:26-bit, AArch32:26-bit, AArch64:28-bit, x86:32-bit /
+ * MIPS:18-bit, POWER:16-bit, AArch32:26-bit, AArch64:21-bit, x86:32-bit
+ * Conditional range can be reduced from the outside to test veneers,
+ * unconditional range must cover the whole code buffer.
+ */
+#if   (defined RT_M32) || (defined RT_M64)
+#define RT_JIT_JMP_RANGE    18
+#define RT_JIT_JCC_DEFAULT  16
+#elif (defined RT_P32) || (defined RT_P64)
+#define RT_JIT_JMP_RANGE    26
+#define RT_JIT_JCC_DEFAULT  16
+#elif (defined RT_ARM)
+#define RT_JIT_JMP_RANGE    26
+#define RT_JIT_JCC_DEFAULT  26
+#elif (defined RT_A32) || (defined RT_A64)
+#define RT_JIT_JMP_RANGE    28
+#define RT_JIT_JCC_DEFAULT  21
+#else /* x86 */
+#define RT_JIT_JMP_RANGE    32
+#define RT_JIT_JCC_DEFAULT  32
+#endif /* all targets */
+
+#ifndef RT_JIT_JCC_RANGE
+#define RT_JIT_JCC_RANGE    RT_JIT_JCC_DEFAULT
+#endif /* RT_JIT_JCC_RANGE */
+
+#if   (RT_JIT_JCC_RANGE < 8) || (RT_JIT_JCC_RANGE > RT_JIT_JCC_DEFAULT)
+#error "conditional jump range is out of native bounds, check RT_JIT_JCC_RANGE"
+#endif /* RT_JIT_JCC_RANGE */
+
+/*
+ * Label reference types, conditional jumps use condition code (0x0 - 0xF)
+ * in the format of x86 Jcc instructions (0x4 - EQ, 0x5 - NE, 0x2 - LT, ...).
+ */
+#define RT_JIT_ADR          (-2)   /* 32-bit label-relative address field */
+#define RT_JIT_JMP          (-1)   /* label-targeted unconditional jump */
+
+/*
+ * Jump encoding forms, ordered from the shortest to the longest.
+ */
+#define RT_JIT_SHORT        0      /* 8-bit displacement */
+#define RT_JIT_NEAR         1      /* 32-bit displacement */
+#define RT_JIT_VENEER       2      /* inverted Jcc (short) over JMP (near) */
+
+/*
+ * Named code label, offset is -1 until the label is defined with LBL.
+ */
+struct rt_JIT_LABEL
+{
+    rt_pstr name;
+    rt_si32 offs;
+};
+
+/*
+ * Label reference, offset points to the first byte of the jump instruction
+ * or to the 32-bit address field (RT_JIT_ADR), "full" is the size emitted
+ * initially, "size" is the size of the relaxed form, "dist" is the distance
+ * to the label counted from the end of the instruction in the relaxed code.
+ */
+struct rt_JIT_REFER
+{
+    rt_pstr name;
+    rt_si32 offs;
+    rt_si32 type;
+    rt_si32 form;
+    rt_si32 full;
+    rt_si32 size;
+    rt_si32 dist;
+};
+
+/*
+ * Code cache entry, "refs" counts active calls (entry can't be evicted),
+ * "tick" is the cache's use counter at the last lookup (LRU order).
+ */
+struct rt_JIT_ENTRY
+{
+    rt_JIT_ENTRY*   next;   /* next entry in hash chain */
+
+    rt_pntr         site;   /* kernel id (ASM_ENTER call site) */
+    rt_ui32         ver;    /* SIMD target mask (rt_SIMD_INFO::ver) */
+    rt_ui32         mode;   /* RT_ELEMENT/RT_ADDRESS */
+    rt_ui32         hash;   /* hash of the full key */
+    rt_si32         size;   /* size of specialization constants */
+    rt_ui08*        spec;   /* specialization constants (copy) */
+
+    rt_pntr         code;   /* generated code (read-exec) */
+    rt_si32         len;    /* size of code pages */
+
+    volatile rt_si32 refs;
+    volatile rt_ui64 tick;
+};
+
+/*
+ * Process-wide code cache, hash chains are protected by the read-write lock.
+ */
+struct rt_JIT_CACHE
+{
+#if   (defined RT_WIN64) /* Win64, GCC -------------------------------------- */
+    SRWLOCK         lock;
+#else /* --- Linux, GCC ----------------------------------------------------- */
+    pthread_rwlock_t lock;
+#endif /* ------------- OS specific ----------------------------------------- */
+
+    rt_JIT_ENTRY*   tab[RT_JIT_HASH_SIZE];
+
+    rt_si64         bytes;  /* size of all code pages in the cache */
+    rt_si64         limit;  /* byte budget of the cache */
+    rt_si32         count;  /* number of entries */
+
+    volatile rt_ui64 tick;
+};
+
+/*
+ * Code buffer structure for ASM_ENTER/ASM_LEAVE in run-time generation mode.
+ * Buffer is read-write while the code is being generated and is copied
+ * into separate read-exec pages when complete (no W+X pages are used).
+ * Emission is skipped entirely if the kernel is found in the code cache.
+ */
+struct rt_JIT_CODE
+{
+    rt_JIT_ENTRY*   ent;    /* cache entry, RT_NULL until code is ready */
+    rt_pntr         site;   /* kernel id (ASM_ENTER call site) */
+    rt_ui32         ver;    /* SIMD target mask (rt_SIMD_INFO::ver) */
+    rt_ui32         hash;   /* hash of the full key */
+    rt_si32         size;   /* size of specialization constants */
+    rt_ui08*        spec;   /* specialization constants */
+
+    rt_ui08*        buf;    /* code buffer (read-write) */
+    rt_si32         cur;    /* current emitter offset */
+    rt_si32         len;    /* allocated buffer size */
+
+    rt_si32         n_lbl;  /* number of labels */
+    rt_si32         n_ref;  /* number of label references */
+
+    rt_JIT_LABEL    lbl[RT_JIT_LBLS_SIZE];
+    rt_JIT_REFER    ref[RT_JIT_REFS_SIZE];
+};
+
+/*
+ * Function type of generated code, Info is passed in 1st arg.
+ */
+typedef rt_void (*rt_FUNC_CODE)(rt_pntr info);
+
+/*
+ * Report fatal code generation error, equivalent of a failed static build.
+ */
+static
+rt_void jit_fail(rt_JIT_CODE *jit)
+{
+    free(jit->buf);
+    abort();
+}
+
+/*
+ * Return process-wide code cache (single instance across compilation units),
+ * budget of the cache is initialized with RT_JIT_CACHE_SIZE of the first unit.
+ */
+inline
+rt_JIT_CACHE *jit_cache()
+{
+    static rt_JIT_CACHE cache =
+    {
+#if   (defined RT_WIN64) /* Win64, GCC -------------------------------------- */
+        SRWLOCK_INIT,
+#else /* --- Linux, GCC ----------------------------------------------------- */
+        PTHREAD_RWLOCK_INITIALIZER,
+#endif /* ------------- OS specific ----------------------------------------- */
+        {RT_NULL}, 0, RT_JIT_CACHE_SIZE, 0, 0
+    };
+
+    return &cache;
+}
+
+/*
+ * Acquire/release code cache lock in shared (lookup) or exclusive mode.
+ */
+static
+rt_void jit_lock(rt_JIT_CACHE *cache, rt_bool excl)
+{
+#if   (defined RT_WIN64) /* Win64, GCC -------------------------------------- */
+
+    if (excl)
+    {
+        AcquireSRWLockExclusive(&cache->lock);
+    }
+    else
+    {
+        AcquireSRWLockShared(&cache->lock);
+    }
+
+#else /* --- Linux, GCC ----------------------------------------------------- */
+
+    if (excl)
+    {
+        pthread_rwlock_wrlock(&cache->lock);
+    }
+    else
+    {
+        pthread_rwlock_rdlock(&cache->lock);
+    }
+
+#endif /* ------------- OS specific ----------------------------------------- */
+}
+
+static
+rt_void jit_unlock(rt_JIT_CACHE *cache, rt_bool excl)
+{
+#if   (defined RT_WIN64) /* Win64, GCC -------------------------------------- */
+
+    if (excl)
+    {
+        ReleaseSRWLockExclusive(&cache->lock);
+    }
+    else
+    {
+        ReleaseSRWLockShared(&cache->lock);
+    }
+
+#else /* --- Linux, GCC ----------------------------------------------------- */
+
+    pthread_rwlock_unlock(&cache->lock);
+
+#endif /* ------------- OS specific ----------------------------------------- */
+}
+
+/*
+ * Return RT_ELEMENT/RT_ADDRESS of the current compilation unit.
+ */
+static
+rt_ui32 jit_mode()
+{
+    return (RT_ELEMENT << 8) | RT_ADDRESS;
+}
+
+/*
+ * Hash "size" bytes at "data" into "hash" (FNV-1a).
+ */
+static
+rt_ui32 jit_hash(rt_ui32 hash, rt_pntr data, rt_si32 size)
+{
+    rt_ui08 *p = (rt_ui08 *)data;
+    rt_si32 i;
+
+    for (i = 0; i < size; i++)
+    {
+        hash = (hash ^ p[i]) * 0x01000193;
+    }
+
+    return hash;
+}
+
+/*
+ * Find cache entry matching the key in "jit", must be called under lock.
+ */
+static
+rt_JIT_ENTRY *jit_match(rt_JIT_CACHE *cache, rt_JIT_CODE *jit)
+{
+    rt_JIT_ENTRY *ent = cache->tab[jit->hash % RT_JIT_HASH_SIZE];
+
+    for (; ent != RT_NULL; ent = ent->next)
+    {
+        if (ent->hash == jit->hash && ent->site == jit->site
+        &&  ent->ver  == jit->ver  && ent->mode == jit_mode()
+        &&  ent->size == jit->size
+        &&  memcmp(ent->spec, jit->spec, jit->size) == 0)
+        {
+            return ent;
+        }
+    }
+
+    return RT_NULL;
+}
+
+/*
+ * Look up the kernel in the code cache, if not found
+ * initialize code buffer before the first emitter.
+ * Kernel id "site" is unique per ASM_ENTER call site,
+ * "spec" points to "size" bytes of specialization constants.
+ */
+static
+rt_JIT_CODE *jit_init(rt_JIT_CODE *jit, rt_pntr site, rt_pntr info,
+                      rt_pntr spec, rt_si32 size)
+{
+    rt_JIT_CACHE *cache = jit_cache();
+    rt_ui32 mode = jit_mode();
+
+    jit->site = site;
+    jit->ver  = ((rt_SIMD_INFO *)info)->ver;
+    jit->size = spec != RT_NULL ? size : 0;
+    jit->spec = (rt_ui08 *)spec;
+
+    jit->hash = jit_hash(0x811C9DC5, &jit->site, sizeof(jit->site));
+    jit->hash = jit_hash(jit->hash, &jit->ver, sizeof(jit->ver));
+    jit->hash = jit_hash(jit->hash, &mode, sizeof(mode));
+    jit->hash = jit_hash(jit->hash, jit->spec, jit->size);
+
+    jit_lock(cache, 0);
+
+    jit->ent = jit_match(cache, jit);
+
+    if (jit->ent != RT_NULL)
+    {
+        __sync_fetch_and_add(&jit->ent->refs, 1);
+        jit->ent->tick = __sync_add_and_fetch(&cache->tick, 1);
+    }
+
+    jit_unlock(cache, 0);
+
+    jit->buf = RT_NULL;
+
+    if (jit->ent != RT_NULL)
+    {
+        return jit;
+    }
+
+    jit->len = RT_JIT_CODE_SIZE;
+    jit->buf = (rt_ui08 *)malloc(jit->len);
+    jit->cur = 0;
+
+    jit->n_lbl = 0;
+    jit->n_ref = 0;
+
+    if (jit->buf == RT_NULL)
+    {
+        jit_fail(jit);
+    }
+
+    return jit;
+}
+
+/*
+ * Grow code buffer (x2) to fit at least "size" more bytes.
+ */
+static
+rt_void jit_grow(rt_JIT_CODE *jit, rt_si32 size)
+{
+    rt_ui08 *buf;
+
+    if (jit->cur + size <= jit->len)
+    {
+        return;
+    }
+
+    buf = (rt_ui08 *)realloc(jit->buf, jit->len * 2);
+
+    if (buf == RT_NULL)
+    {
+        jit_fail(jit);
+    }
+
+    jit->buf = buf;
+    jit->len = jit->len * 2;
+}
+
+/*
+ * Emit 1 byte (EMITB).
+ */
+static inline
+rt_void jit_emitb(rt_JIT_CODE *jit, rt_ui32 b)
+{
+    jit_grow(jit, 1);
+    jit->buf[jit->cur++] = (rt_ui08)(b);
+}
+
+/*
+ * Emit 32-bit word (EMITW) in little-endian byte order.
+ */
+static inline
+rt_void jit_emitw(rt_JIT_CODE *jit, rt_ui32 w)
+{
+    jit_grow(jit, 4);
+    jit->buf[jit->cur++] = (rt_ui08)(w >> 0x00);
+    jit->buf[jit->cur++] = (rt_ui08)(w >> 0x08);
+    jit->buf[jit->cur++] = (rt_ui08)(w >> 0x10);
+    jit->buf[jit->cur++] = (rt_ui08)(w >> 0x18);
+}
+
+/*
+ * Find label by name, add it to the table if not found.
+ */
+static
+rt_JIT_LABEL *jit_find(rt_JIT_CODE *jit, rt_pstr name)
+{
+    rt_si32 i;
+
+    for (i = 0; i < jit->n_lbl; i++)
+    {
+        if (strcmp(jit->lbl[i].name, name) == 0)
+        {
+            return &jit->lbl[i];
+        }
+    }
+
+    if (jit->n_lbl >= RT_JIT_LBLS_SIZE)
+    {
+        jit_fail(jit);
+    }
+
+    jit->lbl[i].name = name;
+    jit->lbl[i].offs = -1;
+    jit->n_lbl++;
+
+    return &jit->lbl[i];
+}
+
+/*
+ * Define label at current offset (LBL).
+ */
+static
+rt_void jit_label(rt_JIT_CODE *jit, rt_pstr name)
+{
+    rt_JIT_LABEL *lbl = jit_find(jit, name);
+
+    if (lbl->offs >= 0) /* <- label redefinition */
+    {
+        jit_fail(jit);
+    }
+
+    lbl->offs = jit->cur;
+}
+
+/*
+ * Return byte size of the label reference in a given encoding form.
+ */
+static
+rt_si32 jit_size(rt_si32 type, rt_si32 form)
+{
+    if (type == RT_JIT_ADR)
+    {
+        return 4;
+    }
+
+    return form == RT_JIT_SHORT ? 2 : form == RT_JIT_VENEER ? 7 :
+                                      type == RT_JIT_JMP    ? 5 : 6;
+}
+
+/*
+ * Check if signed distance "d" fits into "bits" range.
+ */
+static
+rt_bool jit_fits(rt_si32 d, rt_si32 bits)
+{
+    return bits >= 32 || (d >= -(1 << (bits - 1)) && d < (1 << (bits - 1)));
+}
+
+/*
+ * Encode jump of a given type/form at "buf" with distance "d"
+ * counted from the end of the instruction (x86 Jcc/JMP, rel8 or rel32).
+ */
+static
+rt_void jit_code(rt_ui08 *buf, rt_si32 type, rt_si32 form, rt_si32 d)
+{
+    rt_si32 k = 0;
+
+    if (form == RT_JIT_SHORT)
+    {
+        buf[k++] = (rt_ui08)(type == RT_JIT_JMP ? 0xEB : 0x70 | type);
+        buf[k++] = (rt_ui08)(d);
+        return;
+    }
+
+    if (form == RT_JIT_VENEER)
+    {
+        buf[k++] = (rt_ui08)(0x70 | (type ^ 1)); /* <- inverted condition */
+        buf[k++] = (rt_ui08)(5);                 /* <- jump over JMP rel32 */
+        buf[k++] = (rt_ui08)(0xE9);
+    }
+    else
+    if (type == RT_JIT_JMP)
+    {
+        buf[k++] = (rt_ui08)(0xE9);
+    }
+    else
+    if (type != RT_JIT_ADR)
+    {
+        buf[k++] = (rt_ui08)(0x0F);
+        buf[k++] = (rt_ui08)(0x80 | type);
+    }
+
+    buf[k++] = (rt_ui08)(d >> 0x00);
+    buf[k++] = (rt_ui08)(d >> 0x08);
+    buf[k++] = (rt_ui08)(d >> 0x10);
+    buf[k++] = (rt_ui08)(d >> 0x18);
+}
+
+/*
+ * Record label reference of a given type at current offset and emit
+ * its longest form allowed by the target's range (relaxed in jit_link).
+ */
+static
+rt_void jit_refer(rt_JIT_CODE *jit, rt_pstr name, rt_si32 type)
+{
+    rt_JIT_REFER *ref;
+
+    if (jit->n_ref >= RT_JIT_REFS_SIZE)
+    {
+        jit_fail(jit);
+    }
+
+    ref = &jit->ref[jit->n_ref++];
+
+    ref->name = name;
+    ref->offs = jit->cur;
+    ref->type = type;
+    ref->form = type >= 0 && RT_JIT_JCC_RANGE < 32 ?
+                             RT_JIT_VENEER : RT_JIT_NEAR;
+    ref->full = jit_size(type, ref->form);
+    ref->size = ref->full;
+    ref->dist = 0;
+
+    jit_grow(jit, ref->full);
+    jit_code(jit->buf + jit->cur, type, ref->form, 0);
+    jit->cur += ref->full;
+}
+
+/*
+ * Return offset in the relaxed code for a given offset "offs" in the buffer,
+ * "shift" is the accumulated size difference before each label reference.
+ */
+static
+rt_si32 jit_move(rt_JIT_CODE *jit, rt_si32 *shift, rt_si32 offs)
+{
+    rt_JIT_REFER *ref;
+    rt_si32 i;
+
+    for (i = jit->n_ref - 1; i >= 0; i--)
+    {
+        ref = &jit->ref[i];
+
+        if (ref->offs < offs)
+        {
+            return offs + shift[i] + ref->size - ref->full;
+        }
+    }
+
+    return offs;
+}
+
+/*
+ * Resolve label references and relax jumps to their shortest forms,
+ * then rewrite the code into a new buffer with the final layout.
+ * As relaxation only shrinks jumps, distances can only get shorter,
+ * therefore the process always converges. Last pass (with no changes)
+ * computes exact distances for the final layout.
+ */
+static
+rt_void jit_link(rt_JIT_CODE *jit)
+{
+    rt_si32 shift[RT_JIT_REFS_SIZE];
+    rt_JIT_REFER *ref;
+    rt_JIT_LABEL *lbl;
+    rt_ui08 *buf;
+    rt_si32 i, k, f, n, offs, size, done = 0;
+
+    while (!done)
+    {
+        done = 1;
+
+        /* accumulate size difference before each reference */
+        for (i = 0, k = 0; i < jit->n_ref; i++)
+        {
+            ref = &jit->ref[i];
+            shift[i] = k;
+            k += ref->size - ref->full;
+        }
+
+        /* compute distances and try shorter forms */
+        for (i = 0; i < jit->n_ref; i++)
+        {
+            ref = &jit->ref[i];
+            lbl = jit_find(jit, ref->name);
+
+            if (lbl->offs < 0) /* <- label is not defined */
+            {
+                jit_fail(jit);
+            }
+
+            ref->dist = jit_move(jit, shift, lbl->offs)
+                      - (ref->offs + shift[i] + ref->size);
+
+            if (ref->type == RT_JIT_ADR)
+            {
+                continue;
+            }
+
+            for (f = RT_JIT_SHORT; f < ref->form; f++)
+            {
+                if (jit_fits(ref->dist, f == RT_JIT_SHORT ? 8 :
+                        ref->type == RT_JIT_JMP ? RT_JIT_JMP_RANGE :
+                                                  RT_JIT_JCC_RANGE))
+                {
+                    ref->form = f;
+                    ref->size = jit_size(ref->type, f);
+                    done = 0;
+                    break;
+                }
+            }
+        }
+    }
+
+    /* check final ranges (veneers and address fields use full range) */
+    for (i = 0; i < jit->n_ref; i++)
+    {
+        ref = &jit->ref[i];
+
+        if (!jit_fits(ref->dist, ref->form == RT_JIT_SHORT ? 8 :
+                ref->form == RT_JIT_NEAR && ref->type >= 0 ?
+                RT_JIT_JCC_RANGE : RT_JIT_JMP_RANGE))
+        {
+            jit_fail(jit);
+        }
+    }
+
+    /* rewrite the code with the final layout */
+    buf = (rt_ui08 *)malloc(jit->len);
+
+    if (buf == RT_NULL)
+    {
+        jit_fail(jit);
+    }
+
+    for (i = 0, offs = 0, n = 0; i <= jit->n_ref; i++)
+    {
+        size = (i < jit->n_ref ? jit->ref[i].offs : jit->cur) - offs;
+        memcpy(buf + n, jit->buf + offs, size);
+        offs += size;
+        n += size;
+
+        if (i < jit->n_ref)
+        {
+            ref = &jit->ref[i];
+            jit_code(buf + n, ref->type, ref->form, ref->dist);
+            offs += ref->full;
+            n += ref->size;
+        }
+    }
+
+    free(jit->buf);
+    jit->buf = buf;
+    jit->cur = n;
+}
+
+/*
+ * Allocate pages of "len" bytes, copy "size" bytes of code from "buf"
+ * and switch the pages to read-exec rights, return RT_NULL on failure.
+ */
+static
+rt_pntr jit_map(rt_ui08 *buf, rt_si32 size, rt_si32 len)
+{
+    rt_pntr code;
+
+#if   (defined RT_WIN64) /* Win64, GCC -------------------------------------- */
+
+    DWORD prot;
+
+    code = VirtualAlloc(NULL, len, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE);
+
+    if (code == NULL)
+    {
+        return RT_NULL;
+    }
+
+    memcpy(code, buf, size);
+
+    if (!VirtualProtect(code, len, PAGE_EXECUTE_READ, &prot))
+    {
+        VirtualFree(code, 0, MEM_RELEASE);
+        return RT_NULL;
+    }
+
+    FlushInstructionCache(GetCurrentProcess(), code, len);
+
+#else /* --- Linux, GCC ----------------------------------------------------- */
+
+    code = mmap(NULL, len, PROT_READ | PROT_WRITE,
+                           MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (code == MAP_FAILED)
+    {
+        return RT_NULL;
+    }
+
+    memcpy(code, buf, size);
+
+    if (mprotect(code, len, PROT_READ | PROT_EXEC) != 0)
+    {
+        munmap(code, len);
+        return RT_NULL;
+    }
+
+#endif /* ------------- OS specific ----------------------------------------- */
+
+    return code;
+}
+
+/*
+ * Release code pages and the cache entry.
+ */
+static
+rt_void jit_drop(rt_JIT_ENTRY *ent)
+{
+#if   (defined RT_WIN64) /* Win64, GCC -------------------------------------- */
+
+    VirtualFree(ent->code, 0, MEM_RELEASE);
+
+#else /* --- Linux, GCC ----------------------------------------------------- */
+
+    munmap(ent->code, ent->len);
+
+#endif /* ------------- OS specific ----------------------------------------- */
+
+    free(ent);
+}
+
+/*
+ * Evict least recently used entries (not in use) until "len" more bytes
+ * fit into the budget, must be called under exclusive lock.
+ */
+static
+rt_void jit_evict(rt_JIT_CACHE *cache, rt_si64 len)
+{
+    rt_JIT_ENTRY **pos, **lru, *ent;
+    rt_si32 i;
+
+    while (cache->count > 0 && cache->bytes + len > cache->limit)
+    {
+        lru = RT_NULL;
+
+        for (i = 0; i < RT_JIT_HASH_SIZE; i++)
+        {
+            for (pos = &cache->tab[i]; *pos != RT_NULL; pos = &(*pos)->next)
+            {
+                if ((*pos)->refs == 0
+                && (lru == RT_NULL || (*pos)->tick < (*lru)->tick))
+                {
+                    lru = pos;
+                }
+            }
+        }
+
+        if (lru == RT_NULL) /* <- all entries are in use, exceed budget */
+        {
+            break;
+        }
+
+        ent = *lru;
+        *lru = ent->next;
+
+        cache->bytes -= ent->len;
+        cache->count--;
+
+        jit_drop(ent);
+    }
+}
+
+/*
+ * Move completed code into read-exec pages and add it to the code cache,
+ * if the same kernel was added concurrently by another thread use that one.
+ */
+static
+rt_void jit_save(rt_JIT_CODE *jit)
+{
+    rt_JIT_CACHE *cache = jit_cache();
+    rt_JIT_ENTRY *ent, *dup;
+    rt_si32 len;
+
+    len = (jit->cur + 0xFFF) & ~0xFFF;
+
+    ent = (rt_JIT_ENTRY *)malloc(sizeof(rt_JIT_ENTRY) + jit->size);
+
+    if (ent == RT_NULL)
+    {
+        jit_fail(jit);
+    }
+
+    ent->code = jit_map(jit->buf, jit->cur, len);
+
+    if (ent->code == RT_NULL)
+    {
+        free(ent);
+        jit_fail(jit);
+    }
+
+    ent->site = jit->site;
+    ent->ver  = jit->ver;
+    ent->mode = jit_mode();
+    ent->hash = jit->hash;
+    ent->size = jit->size;
+    ent->spec = (rt_ui08 *)(ent + 1);
+    ent->len  = len;
+    ent->refs = 1;
+
+    memcpy(ent->spec, jit->spec, jit->size);
+
+    free(jit->buf);
+    jit->buf = RT_NULL;
+
+    jit_lock(cache, 1);
+
+    dup = jit_match(cache, jit);
+
+    if (dup != RT_NULL)
+    {
+        __sync_fetch_and_add(&dup->refs, 1);
+        dup->tick = __sync_add_and_fetch(&cache->tick, 1);
+    }
+    else
+    {
+        jit_evict(cache, len);
+
+        ent->tick = __sync_add_and_fetch(&cache->tick, 1);
+        ent->next = cache->tab[ent->hash % RT_JIT_HASH_SIZE];
+        cache->tab[ent->hash % RT_JIT_HASH_SIZE] = ent;
+
+        cache->bytes += len;
+        cache->count++;
+    }
+
+    jit_unlock(cache, 1);
+
+    if (dup != RT_NULL)
+    {
+        jit_drop(ent);
+        ent = dup;
+    }
+
+    jit->ent = ent;
+}
+
+/*
+ * Complete new code (resolve label references and save it in the cache)
+ * then call cached code with "info" in 1st arg.
+ */
+static
+rt_void jit_leave(rt_JIT_CODE *jit, rt_pntr info)
+{
+    if (jit->ent == RT_NULL)
+    {
+        jit_link(jit);
+        jit_save(jit);
+    }
+
+    ((rt_FUNC_CODE)jit->ent->code)(info);
+
+    __sync_fetch_and_sub(&jit->ent->refs, 1);
+}
+
+/*
+ * Set byte budget of the code cache, evict entries (not in use) over it.
+ */
+static
+rt_void jit_budget(rt_si64 limit)
+{
+    rt_JIT_CACHE *cache = jit_cache();
+
+    jit_lock(cache, 1);
+
+    cache->limit = limit;
+    jit_evict(cache, 0);
+
+    jit_unlock(cache, 1);
+}
+
+/*
+ * Release all entries of the code cache (not in use),
+ * the budget is kept for new entries.
+ */
+static
+rt_void jit_flush()
+{
+    rt_JIT_CACHE *cache = jit_cache();
+    rt_si64 limit;
+
+    jit_lock(cache, 1);
+
+    limit = cache->limit;
+    cache->limit = 0;
+    jit_evict(cache, 0);
+    cache->limit = limit;
+
+    jit_unlock(cache, 1);
+}
+
+#endif /* RT_RTJIT_H */
+
+/******************************************************************************/
+/******************************************************************************/
+/******************************************************************************/
@@ -0,0 +1,725 @@
+/******************************************************************************/
+/* Copyright (c) 2013-2019 VectorChief (at github, bitbucket, sourceforge)    */
+/* Distributed under the MIT software license, see the accompanying           */
+/* file COPYING or http://www.opensource.org/licenses/mit-license.php         */
+/******************************************************************************/
+
+#ifndef RT_RTPOOL_H
+#define RT_RTPOOL_H
+
+#include "rtheap.h"
+
+#if   (defined RT_WIN32) || (defined RT_WIN64) /* Win32, MSVC - Win64, GCC -- */
+
+#include <windows.h>
+
+#else /* --- Linux, GCC ----------------------------------------------------- */
+
+#include <unistd.h>
+#include <sched.h>
+#include <pthread.h>
+
+#endif /* ------------- OS specific ----------------------------------------- */
+
+/******************************************************************************/
+/*********************************   LEGEND   *********************************/
+/******************************************************************************/
+
+/*
+ * rtpool.h: Thread-pool executor for ASM kernels with per-thread contexts.
+ *
+ * As rt_SIMD_INFO (scratchpads, constants) and rt_SIMD_REGS are read-write
+ * in the backend, a single context can't be shared across threads.
+ * Pool (rt_POOL) pre-builds a context for each worker at init as a copy of
+ * the given (already initialized) SIMD info structure of "size" bytes,
+ * which may be an extended structure derived from rt_SIMD_INFO, each copy
+ * gets its own register file (ASM_INIT) and resides in a separate chunk.
+ * Contexts are allocated from a heap (rtheap.h) and are thus addressable
+ * in 64/32-bit hybrid mode (RT_ADDRESS=32).
+ *
+ * pool_run partitions index range [0, size) into chunks which are multiples
+ * of the SIMD width in elements (RT_SIMD_WIDTH), so that only the last chunk
+ * may have a partial vector. Chunks are initially distributed evenly across
+ * workers (calling thread is worker 0), each worker takes chunks from the
+ * front of its own range and steals half of the remaining range from the back
+ * of another worker when its own range is empty. Task function is called
+ * with the worker's context and the index range of each chunk (sets up
+ * the context and calls the ASM kernel), pool_run returns when all chunks
+ * are done. Worker state is padded to the cache line to avoid false sharing.
+ *
+ * On multi-socket (NUMA) systems memory pages are placed on the node of
+ * the thread which touches them first. Each worker thus allocates and
+ * initializes its own context from its own arena (separate chunks), while
+ * RT_POOL_PIN binds worker "k" to CPU "k" (calling thread included, its
+ * affinity is restored in pool_done), so that threads and their pages stay
+ * on the same node. pool_run_local distributes chunks the same way as
+ * pool_run without stealing, so that a given chunk is always processed by
+ * the same worker, and pool_touch first-touches arrays chunk by chunk in
+ * this order before use, which keeps data local to the worker processing it.
+ */
+
+/******************************************************************************/
+/*******************************   DEFINITIONS   ******************************/
+/******************************************************************************/
+
+#define RT_POOL_LINE        128    /* cache line (adjacent lines prefetched) */
+#define RT_POOL_MASK        (RT_POOL_LINE - 1)
+
+/*
+ * Pool flags.
+ */
+#define RT_POOL_PIN         1      /* bind worker "k" to CPU "k" */
+
+/*
+ * Maximum number of workers (including calling thread).
+ */
+#ifndef RT_POOL_SIZE
+#define RT_POOL_SIZE        64
+#endif /* RT_POOL_SIZE */
+
+/*
+ * Task function type, called for each chunk [from, to) of the index range
+ * with the worker's context and the "data" pointer passed to pool_run.
+ */
+typedef rt_void (*rt_FUNC_TASK)(rt_SIMD_INFO *info, rt_size from, rt_size to,
+                                rt_pntr data);
+
+struct rt_POOL;
+
+/*
+ * Worker structure, range [lo, hi) of chunk indices is protected by lock,
+ * each worker occupies a separate cache line.
+ */
+struct rt_POOL_WORKER
+{
+    rt_POOL*        pool;
+    rt_SIMD_INFO*   info;   /* worker's context */
+    rt_SIMD_REGS*   regs;   /* worker's register file */
+    rt_si32         index;
+
+    rt_HEAP_ARENA   arena;  /* worker's chunks, first-touched by worker */
+
+#if   (defined RT_WIN32) || (defined RT_WIN64) /* Win32, MSVC - Win64, GCC -- */
+    HANDLE          thread;
+#else /* --- Linux, GCC ----------------------------------------------------- */
+    pthread_t       thread;
+#endif /* ------------- OS specific ----------------------------------------- */
+
+    volatile rt_si32 lock;
+    volatile rt_size lo;
+    volatile rt_size hi;
+};
+
+/*
+ * Pool structure, job fields are written by pool_run before workers wake up.
+ */
+struct rt_POOL
+{
+    rt_HEAP         heap;   /* contexts and worker state */
+    rt_HEAP_ARENA   arena;
+
+    rt_POOL_WORKER* work[RT_POOL_SIZE];
+    rt_si32         count;  /* number of workers (including calling thread) */
+    rt_si32         flags;  /* pool flags (RT_POOL_PIN) */
+
+    rt_SIMD_INFO*   tmpl;   /* template of contexts, during init */
+    rt_size         tlen;   /* size of the template */
+
+    rt_FUNC_TASK    func;   /* current job */
+    rt_pntr         data;
+    rt_size         size;
+    rt_size         step;
+    rt_bool         steal;  /* chunks can be stolen across workers */
+
+#if   (defined RT_WIN32) || (defined RT_WIN64) /* Win32, MSVC - Win64, GCC -- */
+    DWORD_PTR       mask;   /* affinity of calling thread before pinning */
+#elif (defined CPU_SETSIZE) /* Linux, GCC ----------------------------------- */
+    cpu_set_t       mask;   /* affinity of calling thread before pinning */
+#endif /* ------------- OS specific ----------------------------------------- */
+
+#if   (defined RT_WIN32) || (defined RT_WIN64) /* Win32, MSVC - Win64, GCC -- */
+    CRITICAL_SECTION    mutex;
+    CONDITION_VARIABLE  wake;
+    CONDITION_VARIABLE  done;
+#else /* --- Linux, GCC ----------------------------------------------------- */
+    pthread_mutex_t mutex;
+    pthread_cond_t  wake;
+    pthread_cond_t  done;
+#endif /* ------------- OS specific ----------------------------------------- */
+
+    rt_si32         gen;    /* job generation, protected by mutex */
+    rt_si32         busy;   /* workers running current job, ditto */
+    rt_bool         stop;   /* workers are to exit, ditto */
+    rt_bool         fail;   /* worker's context failed to init, ditto */
+};
+
+/*
+ * Return number of online CPUs (at least 1).
+ */
+static
+rt_si32 pool_cpus()
+{
+    rt_si32 n = 1;
+
+#if   (defined RT_WIN32) || (defined RT_WIN64) /* Win32, MSVC - Win64, GCC -- */
+
+    SYSTEM_INFO s_sys;
+    GetSystemInfo(&s_sys);
+    n = (rt_si32)s_sys.dwNumberOfProcessors;
+
+#else /* --- Linux, GCC ----------------------------------------------------- */
+
+    n = (rt_si32)sysconf(_SC_NPROCESSORS_ONLN);
+
+#endif /* ------------- OS specific ----------------------------------------- */
+
+    return RT_MAX(n, 1);
+}
+
+/*
+ * Lock/unlock pool mutex, wait/signal pool condition variables.
+ */
+#if   (defined RT_WIN32) || (defined RT_WIN64) /* Win32, MSVC - Win64, GCC -- */
+
+#define pool_enter(pool)        EnterCriticalSection(&(pool)->mutex)
+#define pool_leave(pool)        LeaveCriticalSection(&(pool)->mutex)
+#define pool_wait(pool, cv)     SleepConditionVariableCS(&(pool)->cv,       \
+                                            &(pool)->mutex, INFINITE)
+#define pool_wake(pool, cv)     WakeAllConditionVariable(&(pool)->cv)
+
+#else /* --- Linux, GCC ----------------------------------------------------- */
+
+#define pool_enter(pool)        pthread_mutex_lock(&(pool)->mutex)
+#define pool_leave(pool)        pthread_mutex_unlock(&(pool)->mutex)
+#define pool_wait(pool, cv)     pthread_cond_wait(&(pool)->cv, &(pool)->mutex)
+#define pool_wake(pool, cv)     pthread_cond_broadcast(&(pool)->cv)
+
+#endif /* ------------- OS specific ----------------------------------------- */
+
+/*
+ * Take next chunk index from the worker's own range (front),
+ * return -1 if the range is empty.
+ */
+static
+rt_size pool_take(rt_POOL_WORKER *w)
+{
+    rt_size c = -1;
+
+    heap_lock(&w->lock);
+
+    if (w->lo < w->hi)
+    {
+        c = w->lo++;
+    }
+
+    heap_unlock(&w->lock);
+
+    return c;
+}
+
+/*
+ * Steal half of the remaining range (back) from another worker
+ * into the worker's own range, return RT_FALSE if nothing is left.
+ */
+static
+rt_bool pool_steal(rt_POOL *pool, rt_POOL_WORKER *w)
+{
+    rt_si32 k;
+
+    for (k = 1; k < pool->count; k++)
+    {
+        rt_POOL_WORKER *v = pool->work[(w->index + k) % pool->count];
+        rt_size lo = 0, hi = 0;
+
+        heap_lock(&v->lock);
+
+        if (v->lo < v->hi)
+        {
+            hi = v->hi;
+            lo = v->hi - (v->hi - v->lo + 1) / 2;
+            v->hi = lo;
+        }
+
+        heap_unlock(&v->lock);
+
+        if (lo < hi)
+        {
+            heap_lock(&w->lock);
+
+            w->lo = lo;
+            w->hi = hi;
+
+            heap_unlock(&w->lock);
+
+            return RT_TRUE;
+        }
+    }
+
+    return RT_FALSE;
+}
+
+/*
+ * Run chunks of the current job until no work is left across the pool.
+ */
+static
+rt_void pool_work(rt_POOL *pool, rt_POOL_WORKER *w)
+{
+    rt_size c, from, to;
+
+    do
+    {
+        while ((c = pool_take(w)) >= 0)
+        {
+            from = c * pool->step;
+            to   = RT_MIN(from + pool->step, pool->size);
+
+            pool->func(w->info, from, to, pool->data);
+        }
+    }
+    while (pool->steal && pool_steal(pool, w));
+}
+
+/*
+ * Bind calling thread of worker "w" to CPU of the same index (RT_POOL_PIN),
+ * affinity of the pool's calling thread is saved to be restored later.
+ */
+static
+rt_void pool_bind(rt_POOL *pool, rt_POOL_WORKER *w)
+{
+    rt_si32 cpu = w->index % pool_cpus();
+
+    if ((pool->flags & RT_POOL_PIN) == 0)
+    {
+        return;
+    }
+
+#if   (defined RT_WIN32) || (defined RT_WIN64) /* Win32, MSVC - Win64, GCC -- */
+
+    DWORD_PTR mask = SetThreadAffinityMask(GetCurrentThread(),
+                                           (DWORD_PTR)1 << cpu);
+    if (w->index == 0)
+    {
+        pool->mask = mask;
+    }
+
+#elif (defined CPU_SETSIZE) /* Linux, GCC ----------------------------------- */
+
+    cpu_set_t mask;
+    CPU_ZERO(&mask);
+    CPU_SET(cpu, &mask);
+
+    if (w->index == 0)
+    {
+        pthread_getaffinity_np(pthread_self(), sizeof(cpu_set_t), &pool->mask);
+    }
+
+    pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &mask);
+
+#endif /* ------------- OS specific ----------------------------------------- */
+}
+
+/*
+ * Allocate and initialize context of worker "w" on the calling thread
+ * (first touch) as a copy of the pool's template,
+ * return RT_FALSE if the heap is exhausted.
+ */
+static
+rt_bool pool_ctx(rt_POOL *pool, rt_POOL_WORKER *w)
+{
+    rt_size ilen = (pool->tlen + RT_POOL_MASK) & ~RT_POOL_MASK;
+    rt_byte *ptr = (rt_byte *)heap_alloc(&w->arena,
+                                         ilen + sizeof(rt_SIMD_REGS));
+    if (ptr == RT_NULL)
+    {
+        return RT_FALSE;
+    }
+
+    w->info = (rt_SIMD_INFO *)ptr;
+    w->regs = (rt_SIMD_REGS *)(ptr + ilen);
+
+    memcpy(w->info, pool->tmpl, pool->tlen);
+    ASM_INIT(w->info, w->regs)
+
+    return RT_TRUE;
+}
+
+/*
+ * Worker thread main loop, sleeps until the next job or stop.
+ */
+#if   (defined RT_WIN32) || (defined RT_WIN64) /* Win32, MSVC - Win64, GCC -- */
+static
+DWORD WINAPI pool_main(rt_pntr arg)
+#else /* --- Linux, GCC ----------------------------------------------------- */
+static
+rt_pntr pool_main(rt_pntr arg)
+#endif /* ------------- OS specific ----------------------------------------- */
+{
+    rt_POOL_WORKER *w = (rt_POOL_WORKER *)arg;
+    rt_POOL *pool = w->pool;
+    rt_si32 gen = 0;
+
+    pool_bind(pool, w);
+
+    rt_bool ok = pool_ctx(pool, w);
+
+    pool_enter(pool);
+
+    pool->fail = pool->fail || !ok;
+
+    if (--pool->busy == 0)
+    {
+        pool_wake(pool, done);
+    }
+
+    pool_leave(pool);
+
+    for (;;)
+    {
+        pool_enter(pool);
+
+        while (pool->gen == gen && !pool->stop)
+        {
+            pool_wait(pool, wake);
+        }
+
+        gen = pool->gen;
+
+        if (pool->stop)
+        {
+            pool_leave(pool);
+            break;
+        }
+
+        pool_leave(pool);
+
+        pool_work(pool, w);
+
+        pool_enter(pool);
+
+        if (--pool->busy == 0)
+        {
+            pool_wake(pool, done);
+        }
+
+        pool_leave(pool);
+    }
+
+    return 0;
+}
+
+/*
+ * Release worker threads and contexts of the pool.
+ */
+static
+rt_void pool_done(rt_POOL *pool)
+{
+    rt_si32 k;
+
+    pool_enter(pool);
+
+    pool->stop = RT_TRUE;
+    pool_wake(pool, wake);
+
+    pool_leave(pool);
+
+    for (k = 1; k < pool->count; k++)
+    {
+#if   (defined RT_WIN32) || (defined RT_WIN64) /* Win32, MSVC - Win64, GCC -- */
+
+        WaitForSingleObject(pool->work[k]->thread, INFINITE);
+        CloseHandle(pool->work[k]->thread);
+
+#else /* --- Linux, GCC ----------------------------------------------------- */
+
+        pthread_join(pool->work[k]->thread, RT_NULL);
+
+#endif /* ------------- OS specific ----------------------------------------- */
+    }
+
+    for (k = 0; k < pool->count; k++)
+    {
+        if (pool->work[k]->info != RT_NULL)
+        {
+            ASM_DONE(pool->work[k]->info)
+        }
+    }
+
+    if (pool->flags & RT_POOL_PIN)
+    {
+#if   (defined RT_WIN32) || (defined RT_WIN64) /* Win32, MSVC - Win64, GCC -- */
+
+        SetThreadAffinityMask(GetCurrentThread(), pool->mask);
+
+#elif (defined CPU_SETSIZE) /* Linux, GCC ----------------------------------- */
+
+        pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &pool->mask);
+
+#endif /* ------------- OS specific ----------------------------------------- */
+    }
+
+#if   (defined RT_WIN32) || (defined RT_WIN64) /* Win32, MSVC - Win64, GCC -- */
+
+    DeleteCriticalSection(&pool->mutex);
+
+#else /* --- Linux, GCC ----------------------------------------------------- */
+
+    pthread_cond_destroy(&pool->done);
+    pthread_cond_destroy(&pool->wake);
+    pthread_mutex_destroy(&pool->mutex);
+
+#endif /* ------------- OS specific ----------------------------------------- */
+
+    heap_done(&pool->heap);
+
+    pool->count = 0;
+}
+
+/*
+ * Initialize pool of "count" workers (including calling thread, 0 - all CPUs)
+ * with contexts copied from "info" of "size" bytes (rt_SIMD_INFO or derived)
+ * by each worker on its own thread, "flags" can be 0 or RT_POOL_PIN,
+ * return RT_FALSE if contexts can't be allocated or threads can't be started.
+ */
+static
+rt_bool pool_init(rt_POOL *pool, rt_si32 count, rt_SIMD_INFO *info,
+                  rt_size size, rt_si32 flags)
+{
+    rt_size ilen = (size + RT_POOL_MASK) & ~RT_POOL_MASK;
+    rt_size clen = RT_HEAP_HEAD + ilen + sizeof(rt_SIMD_REGS);
+    rt_size wlen = (sizeof(rt_POOL_WORKER) + RT_POOL_MASK) & ~RT_POOL_MASK;
+    rt_si32 k;
+
+    memset(pool, 0, sizeof(rt_POOL));
+
+    count = count > 0 ? count : pool_cpus();
+    count = RT_MIN(count, RT_POOL_SIZE);
+
+    /* worker structures are taken from the pool's arena (calling thread),
+     * contexts are taken from separate chunks of each worker's arena */
+    clen = (clen + RT_HEAP_CHUNK_MASK) & ~(rt_size)RT_HEAP_CHUNK_MASK;
+
+    if (!heap_init(&pool->heap, RT_HEAP_HEAD + (wlen + RT_POOL_LINE) * count
+                                             + clen * count, 0))
+    {
+        return RT_FALSE;
+    }
+
+    heap_init_arena(&pool->arena, &pool->heap);
+
+    for (k = 0; k < count; k++)
+    {
+        rt_byte *ptr = (rt_byte *)heap_alloc(&pool->arena, wlen + RT_POOL_LINE);
+        if (ptr == RT_NULL)
+        {
+            heap_done(&pool->heap);
+            return RT_FALSE;
+        }
+
+        ptr = (rt_byte *)(((rt_uptr)ptr + RT_POOL_MASK) & ~RT_POOL_MASK);
+
+        rt_POOL_WORKER *w = (rt_POOL_WORKER *)ptr;
+        memset(w, 0, sizeof(rt_POOL_WORKER));
+
+        w->pool  = pool;
+        w->index = k;
+
+        heap_init_arena(&w->arena, &pool->heap);
+
+        pool->work[k] = w;
+    }
+
+    pool->flags = flags;
+    pool->tmpl  = info;
+    pool->tlen  = size;
+
+#if   (defined RT_WIN32) || (defined RT_WIN64) /* Win32, MSVC - Win64, GCC -- */
+
+    InitializeCriticalSection(&pool->mutex);
+    InitializeConditionVariable(&pool->wake);
+    InitializeConditionVariable(&pool->done);
+
+#else /* --- Linux, GCC ----------------------------------------------------- */
+
+    pthread_mutex_init(&pool->mutex, RT_NULL);
+    pthread_cond_init(&pool->wake, RT_NULL);
+    pthread_cond_init(&pool->done, RT_NULL);
+
+#endif /* ------------- OS specific ----------------------------------------- */
+
+    /* workers report their contexts ready via busy counter */
+    pool->busy = count - 1;
+
+    for (pool->count = 1; pool->count < count; pool->count++)
+    {
+        rt_POOL_WORKER *w = pool->work[pool->count];
+
+#if   (defined RT_WIN32) || (defined RT_WIN64) /* Win32, MSVC - Win64, GCC -- */
+
+        w->thread = CreateThread(RT_NULL, 0, pool_main, w, 0, RT_NULL);
+
+        if (w->thread == RT_NULL)
+
+#else /* --- Linux, GCC ----------------------------------------------------- */
+
+        if (pthread_create(&w->thread, RT_NULL, pool_main, w) != 0)
+
+#endif /* ------------- OS specific ----------------------------------------- */
+        {
+            pool_enter(pool);
+            pool->busy -= count - pool->count;
+            pool->fail = RT_TRUE;
+            pool_leave(pool);
+            break;
+        }
+    }
+
+    pool_bind(pool, pool->work[0]);
+
+    rt_bool ok = pool_ctx(pool, pool->work[0]);
+
+    pool_enter(pool);
+
+    pool->fail = pool->fail || !ok;
+
+    while (pool->busy > 0)
+    {
+        pool_wait(pool, done);
+    }
+
+    pool_leave(pool);
+
+    pool->tmpl = RT_NULL;
+
+    if (pool->fail)
+    {
+        pool_done(pool);
+        return RT_FALSE;
+    }
+
+    return RT_TRUE;
+}
+
+/*
+ * Return context of the worker "k" (0 - calling thread), which can be
+ * adjusted between pool_run calls (for instance to set up extended fields).
+ */
+static
+rt_SIMD_INFO *pool_info(rt_POOL *pool, rt_si32 k)
+{
+    return pool->work[k]->info;
+}
+
+/*
+ * Run task function "func" over index range [0, size) split into chunks
+ * of "step" elements (rounded up to the SIMD width) across the pool,
+ * "steal" enables stealing of chunks when worker's own range is empty.
+ */
+static
+rt_void pool_exec(rt_POOL *pool, rt_FUNC_TASK func, rt_pntr data,
+                  rt_size size, rt_size step, rt_bool steal)
+{
+    rt_size n, c;
+    rt_si32 k;
+
+    if (size <= 0)
+    {
+        return;
+    }
+
+    step = (RT_MAX(step, 1) + RT_SIMD_WIDTH - 1) / RT_SIMD_WIDTH;
+    step = step * RT_SIMD_WIDTH;
+    n = (size + step - 1) / step;
+
+    pool->func  = func;
+    pool->data  = data;
+    pool->size  = size;
+    pool->step  = step;
+    pool->steal = steal;
+
+    /* workers are idle here, ranges are read after wake-up */
+    for (k = 0, c = 0; k < pool->count; k++)
+    {
+        pool->work[k]->lo = c;
+        c = n * (k + 1) / pool->count;
+        pool->work[k]->hi = c;
+    }
+
+    pool_enter(pool);
+
+    pool->busy = pool->count - 1;
+    pool->gen++;
+    pool_wake(pool, wake);
+
+    pool_leave(pool);
+
+    pool_work(pool, pool->work[0]);
+
+    pool_enter(pool);
+
+    while (pool->busy > 0)
+    {
+        pool_wait(pool, done);
+    }
+
+    pool_leave(pool);
+}
+
+/*
+ * Run task function "func" over index range [0, size) split into chunks
+ * of "step" elements (rounded up to the SIMD width) across the pool
+ * with work stealing, return when all chunks are done.
+ * Not to be called from multiple threads.
+ */
+static
+rt_void pool_run(rt_POOL *pool, rt_FUNC_TASK func, rt_pntr data,
+                 rt_size size, rt_size step)
+{
+    pool_exec(pool, func, data, size, step, RT_TRUE);
+}
+
+/*
+ * Same as pool_run, but without stealing, so that the given chunk is always
+ * processed by the same worker (for the same "size", "step" and pool size).
+ */
+static
+rt_void pool_run_local(rt_POOL *pool, rt_FUNC_TASK func, rt_pntr data,
+                       rt_size size, rt_size step)
+{
+    pool_exec(pool, func, data, size, step, RT_FALSE);
+}
+
+/*
+ * Array of "elem"-byte elements at "ptr" for pool_touch.
+ */
+struct rt_POOL_TOUCH
+{
+    rt_byte*        ptr;
+    rt_size         elem;
+};
+
+static
+rt_void pool_page(rt_SIMD_INFO *info, rt_size from, rt_size to, rt_pntr data)
+{
+    rt_POOL_TOUCH *t = (rt_POOL_TOUCH *)data;
+
+    memset(t->ptr + from * t->elem, 0, (to - from) * t->elem);
+}
+
+/*
+ * Zero-fill array of "size" elements of "elem" bytes at "ptr" chunk by chunk
+ * on the workers which process the same chunks in pool_run_local (first touch
+ * places the pages on their nodes), chunk bytes should be page multiples.
+ */
+static
+rt_void pool_touch(rt_POOL *pool, rt_pntr ptr, rt_size size, rt_size step,
+                   rt_size elem)
+{
+    rt_POOL_TOUCH t;
+
+    t.ptr  = (rt_byte *)ptr;
+    t.elem = elem;
+
+    pool_run_local(pool, pool_page, &t, size, step);
+}
+
+#endif /* RT_RTPOOL_H */
@@ -123,7 +123,7 @@
  * Working with sub-word BASE elements (byte, half) is reserved for future use.
  * However, current displacement types may not work due to natural alignment.
  * Signed/unsigned types can be supported orthogonally in cmd*n_**, cmd*x_**.
- * Working with sub-word SIMD elements (byte, half) has not been investigated.
+ * Working with sub-word SIMD elements (byte, half) is limited to packed ints.
  * However, as current major ISAs lack the ability to do sub-word fp-compute,
  * these corresponding subsets cannot be viewed as valid targets for SPMD.
  *
@@ -471,7 +471,33 @@
 #define         RT_128X1     (RT_128)
 #endif /* RT_2K8_R8, RT_1K4/_R8, RT_512/_R8, RT_256/_R8, RT_128 */
 
-#endif /* RT_ARM, RT_A32/A64, RT_M32/M64, RT_P32/P64, RT_X32/X64, RT_X86 */
+/* ------------------------------   C32, C64   ------------------------------ */
+
+#elif (defined RT_C32) || (defined RT_C64)
+
+#if   !(defined RT_512X4) && (RT_2K8_R8)
+#error "C-ref-ISA doesn't support SIMD wider than 128-bit, check build flags"
+#endif
+#if   !(defined RT_512X2) && (RT_1K4 || RT_1K4_R8)
+#error "C-ref-ISA doesn't support SIMD wider than 128-bit, check build flags"
+#endif
+#if   !(defined RT_512X1) && (RT_512)
+#error "C-ref-ISA doesn't support SIMD wider than 128-bit, check build flags"
+#endif
+#if   !(defined RT_256X2) && (RT_512_R8)
+#error "C-ref-ISA doesn't support SIMD wider than 128-bit, check build flags"
+#endif
+#if   !(defined RT_256X1) && (RT_256)
+#error "C-ref-ISA doesn't support SIMD wider than 128-bit, check build flags"
+#endif
+#if   !(defined RT_128X2) && (RT_256_R8)
+#error "C-ref-ISA doesn't support paired SIMD backends, check build flags"
+#endif
+#if   !(defined RT_128X1) && (RT_128)
+#define         RT_128X1     (RT_128)
+#endif /* RT_2K8_R8, RT_1K4/_R8, RT_512/_R8, RT_256/_R8, RT_128 */
+
+#endif /* RT_ARM, RT_A32/A64, RT_M32/M64, RT_P32/P64, RT_X32/X64, X86, C32/64 */
 
 /******************************************************************************/
 /******************************************************************************/
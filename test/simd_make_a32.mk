@@ -8,7 +8,8 @@ SRC_LIST =                              \
 LIB_PATH =
 
 LIB_LIST =                              \
-        -lm
+        -lm                             \
+        -lpthread
 
 
 build: simd_test_a32
@@ -0,0 +1,77 @@
+INC_PATH =                              \
+        -I../core/config/
+
+SRC_LIST =                              \
+        simd_test.cpp
+
+LIB_PATH =
+
+LIB_LIST =                              \
+        -lm                             \
+        -lpthread
+
+
+build: build_c64
+
+strip:
+	strip simd_test.c64*
+
+clean:
+	rm simd_test.c64*
+
+
+build_c64: simd_test_c64_32 simd_test_c64_64 simd_test_c64f32 simd_test_c64f64
+
+simd_test_c64_32:
+	g++ -O3 -g -frounding-math -ffp-contract=off \
+        -DRT_LINUX -DRT_C64 -DRT_128=1 -DRT_DEBUG=0 \
+        -DRT_POINTER=64 -DRT_ADDRESS=32 -DRT_ELEMENT=32 -DRT_ENDIAN=0 \
+        ${INC_PATH} ${SRC_LIST} ${LIB_PATH} ${LIB_LIST} -o simd_test.c64_32
+
+simd_test_c64_64:
+	g++ -O3 -g -frounding-math -ffp-contract=off \
+        -DRT_LINUX -DRT_C64 -DRT_128=1 -DRT_DEBUG=0 \
+        -DRT_POINTER=64 -DRT_ADDRESS=32 -DRT_ELEMENT=64 -DRT_ENDIAN=0 \
+        ${INC_PATH} ${SRC_LIST} ${LIB_PATH} ${LIB_LIST} -o simd_test.c64_64
+
+simd_test_c64f32:
+	g++ -O3 -g -frounding-math -ffp-contract=off \
+        -DRT_LINUX -DRT_C64 -DRT_128=1 -DRT_DEBUG=0 \
+        -DRT_POINTER=64 -DRT_ADDRESS=64 -DRT_ELEMENT=32 -DRT_ENDIAN=0 \
+        ${INC_PATH} ${SRC_LIST} ${LIB_PATH} ${LIB_LIST} -o simd_test.c64f32
+
+simd_test_c64f64:
+	g++ -O3 -g -frounding-math -ffp-contract=off \
+        -DRT_LINUX -DRT_C64 -DRT_128=1 -DRT_DEBUG=0 \
+        -DRT_POINTER=64 -DRT_ADDRESS=64 -DRT_ELEMENT=64 -DRT_ENDIAN=0 \
+        ${INC_PATH} ${SRC_LIST} ${LIB_PATH} ${LIB_LIST} -o simd_test.c64f64
+
+
+# The C reference target (rtarch_c64.h) emulates BASE and SIMD instructions
+# in plain C on any host with GCC or Clang (labels-as-values are required),
+# it serves as a bit-exact oracle and a naive baseline for native targets.
+#
+# Prerequisites for the build:
+# native-compiler (GNU or Clang) is installed and in the PATH variable.
+# sudo apt-get install g++
+#
+# Building/running SIMD test:
+# make -f simd_make_c64.mk
+# ./simd_test.c64_32 -c 1
+# ./simd_test.c64_64 -c 1
+# ./simd_test.c64f32 -c 1
+# ./simd_test.c64f64 -c 1
+#
+# For single-stepping emulated instructions in a debugger use (replace):
+# -O0 -g (in place of -O3 -g), then "gdb ./simd_test.c64f32" and "step"
+# -frounding-math keeps rounding-mode changes from being optimized away,
+# -ffp-contract=off prevents fused multiply-add in place of separate ops.
+
+# Clang compilation works too, use (replace):
+# clang++ (in place of g++)
+# sudo apt-get install clang
+
+# For interpretation of SIMD build flags check compatibility layer in rtzero.h
+
+# For 128-bit build use (replace): RT_128=1               (30 SIMD registers)
+# Only 128-bit SIMD (fp32/fp64 subsets) is emulated, flush-to-zero is not.
@@ -8,7 +8,8 @@ SRC_LIST =                              \
 LIB_PATH =
 
 LIB_LIST =                              \
-        -lm
+        -lm                             \
+        -lpthread
 
 
 build: build_p9 build_pX build_le build_be
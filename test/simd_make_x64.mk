@@ -8,7 +8,8 @@ SRC_LIST =                              \
 LIB_PATH =
 
 LIB_LIST =                              \
-        -lm
+        -lm                             \
+        -lpthread
 
 
 build: build_x64 build_x64avx build_x64avx512
@@ -123,6 +124,237 @@ simd_test_x64f64avx512:
       ${INC_PATH} ${SRC_LIST} ${LIB_PATH} ${LIB_LIST} -o simd_test.x64f64avx512
 
 
+# Multi-target builds compile simd_test.cpp for each SIMD target separately
+# (namespaced with RT_SIMD_SPACE), simd_multi.cpp binds the widest at runtime
+
+build_x64multi: simd_test_x64_32multi simd_test_x64_64multi \
+                simd_test_x64f32multi simd_test_x64f64multi
+
+simd_test_x64_32multi:
+	g++ -O3 -g -c \
+        -DRT_LINUX -DRT_X64 -DRT_128=4 -DRT_DEBUG=0 \
+        -DRT_POINTER=64 -DRT_ADDRESS=32 -DRT_ELEMENT=32 -DRT_ENDIAN=0 \
+        -DRT_SIMD_SPACE=simd_128v4 \
+      ${INC_PATH} ${SRC_LIST} -o simd_test_128v4.x64_32.o
+	g++ -O3 -g -c \
+        -DRT_LINUX -DRT_X64 -DRT_256=1 -DRT_DEBUG=0 \
+        -DRT_POINTER=64 -DRT_ADDRESS=32 -DRT_ELEMENT=32 -DRT_ENDIAN=0 \
+        -DRT_SIMD_SPACE=simd_256v1 \
+      ${INC_PATH} ${SRC_LIST} -o simd_test_256v1.x64_32.o
+	g++ -O3 -g -c \
+        -DRT_LINUX -DRT_X64 -DRT_256=2 -DRT_DEBUG=0 \
+        -DRT_POINTER=64 -DRT_ADDRESS=32 -DRT_ELEMENT=32 -DRT_ENDIAN=0 \
+        -DRT_SIMD_SPACE=simd_256v2 \
+      ${INC_PATH} ${SRC_LIST} -o simd_test_256v2.x64_32.o
+	g++ -O3 -g -c \
+        -DRT_LINUX -DRT_X64 -DRT_512=1 -DRT_DEBUG=0 \
+        -DRT_POINTER=64 -DRT_ADDRESS=32 -DRT_ELEMENT=32 -DRT_ENDIAN=0 \
+        -DRT_SIMD_SPACE=simd_512v1 \
+      ${INC_PATH} ${SRC_LIST} -o simd_test_512v1.x64_32.o
+	g++ -O3 -g -c \
+        -DRT_LINUX -DRT_X64 -DRT_512=2 -DRT_DEBUG=0 \
+        -DRT_POINTER=64 -DRT_ADDRESS=32 -DRT_ELEMENT=32 -DRT_ENDIAN=0 \
+        -DRT_SIMD_SPACE=simd_512v2 \
+      ${INC_PATH} ${SRC_LIST} -o simd_test_512v2.x64_32.o
+	g++ -O3 -g \
+        -DRT_LINUX -DRT_X64 -DRT_128=4 -DRT_256=1+2 -DRT_512=1+2 \
+        -DRT_POINTER=64 -DRT_ADDRESS=32 -DRT_ELEMENT=32 -DRT_ENDIAN=0 \
+        -DRT_DEBUG=0 ${INC_PATH} simd_multi.cpp simd_test_*.x64_32.o \
+      ${LIB_PATH} ${LIB_LIST} -o simd_test.x64_32multi
+	rm simd_test_*.x64_32.o
+
+simd_test_x64_64multi:
+	g++ -O3 -g -c \
+        -DRT_LINUX -DRT_X64 -DRT_128=4 -DRT_DEBUG=0 \
+        -DRT_POINTER=64 -DRT_ADDRESS=32 -DRT_ELEMENT=64 -DRT_ENDIAN=0 \
+        -DRT_SIMD_SPACE=simd_128v4 \
+      ${INC_PATH} ${SRC_LIST} -o simd_test_128v4.x64_64.o
+	g++ -O3 -g -c \
+        -DRT_LINUX -DRT_X64 -DRT_256=1 -DRT_DEBUG=0 \
+        -DRT_POINTER=64 -DRT_ADDRESS=32 -DRT_ELEMENT=64 -DRT_ENDIAN=0 \
+        -DRT_SIMD_SPACE=simd_256v1 \
+      ${INC_PATH} ${SRC_LIST} -o simd_test_256v1.x64_64.o
+	g++ -O3 -g -c \
+        -DRT_LINUX -DRT_X64 -DRT_256=2 -DRT_DEBUG=0 \
+        -DRT_POINTER=64 -DRT_ADDRESS=32 -DRT_ELEMENT=64 -DRT_ENDIAN=0 \
+        -DRT_SIMD_SPACE=simd_256v2 \
+      ${INC_PATH} ${SRC_LIST} -o simd_test_256v2.x64_64.o
+	g++ -O3 -g -c \
+        -DRT_LINUX -DRT_X64 -DRT_512=1 -DRT_DEBUG=0 \
+        -DRT_POINTER=64 -DRT_ADDRESS=32 -DRT_ELEMENT=64 -DRT_ENDIAN=0 \
+        -DRT_SIMD_SPACE=simd_512v1 \
+      ${INC_PATH} ${SRC_LIST} -o simd_test_512v1.x64_64.o
+	g++ -O3 -g -c \
+        -DRT_LINUX -DRT_X64 -DRT_512=2 -DRT_DEBUG=0 \
+        -DRT_POINTER=64 -DRT_ADDRESS=32 -DRT_ELEMENT=64 -DRT_ENDIAN=0 \
+        -DRT_SIMD_SPACE=simd_512v2 \
+      ${INC_PATH} ${SRC_LIST} -o simd_test_512v2.x64_64.o
+	g++ -O3 -g \
+        -DRT_LINUX -DRT_X64 -DRT_128=4 -DRT_256=1+2 -DRT_512=1+2 \
+        -DRT_POINTER=64 -DRT_ADDRESS=32 -DRT_ELEMENT=64 -DRT_ENDIAN=0 \
+        -DRT_DEBUG=0 ${INC_PATH} simd_multi.cpp simd_test_*.x64_64.o \
+      ${LIB_PATH} ${LIB_LIST} -o simd_test.x64_64multi
+	rm simd_test_*.x64_64.o
+
+simd_test_x64f32multi:
+	g++ -O3 -g -c \
+        -DRT_LINUX -DRT_X64 -DRT_128=4 -DRT_DEBUG=0 \
+        -DRT_POINTER=64 -DRT_ADDRESS=64 -DRT_ELEMENT=32 -DRT_ENDIAN=0 \
+        -DRT_SIMD_SPACE=simd_128v4 \
+      ${INC_PATH} ${SRC_LIST} -o simd_test_128v4.x64f32.o
+	g++ -O3 -g -c \
+        -DRT_LINUX -DRT_X64 -DRT_256=1 -DRT_DEBUG=0 \
+        -DRT_POINTER=64 -DRT_ADDRESS=64 -DRT_ELEMENT=32 -DRT_ENDIAN=0 \
+        -DRT_SIMD_SPACE=simd_256v1 \
+      ${INC_PATH} ${SRC_LIST} -o simd_test_256v1.x64f32.o
+	g++ -O3 -g -c \
+        -DRT_LINUX -DRT_X64 -DRT_256=2 -DRT_DEBUG=0 \
+        -DRT_POINTER=64 -DRT_ADDRESS=64 -DRT_ELEMENT=32 -DRT_ENDIAN=0 \
+        -DRT_SIMD_SPACE=simd_256v2 \
+      ${INC_PATH} ${SRC_LIST} -o simd_test_256v2.x64f32.o
+	g++ -O3 -g -c \
+        -DRT_LINUX -DRT_X64 -DRT_512=1 -DRT_DEBUG=0 \
+        -DRT_POINTER=64 -DRT_ADDRESS=64 -DRT_ELEMENT=32 -DRT_ENDIAN=0 \
+        -DRT_SIMD_SPACE=simd_512v1 \
+      ${INC_PATH} ${SRC_LIST} -o simd_test_512v1.x64f32.o
+	g++ -O3 -g -c \
+        -DRT_LINUX -DRT_X64 -DRT_512=2 -DRT_DEBUG=0 \
+        -DRT_POINTER=64 -DRT_ADDRESS=64 -DRT_ELEMENT=32 -DRT_ENDIAN=0 \
+        -DRT_SIMD_SPACE=simd_512v2 \
+      ${INC_PATH} ${SRC_LIST} -o simd_test_512v2.x64f32.o
+	g++ -O3 -g \
+        -DRT_LINUX -DRT_X64 -DRT_128=4 -DRT_256=1+2 -DRT_512=1+2 \
+        -DRT_POINTER=64 -DRT_ADDRESS=64 -DRT_ELEMENT=32 -DRT_ENDIAN=0 \
+        -DRT_DEBUG=0 ${INC_PATH} simd_multi.cpp simd_test_*.x64f32.o \
+      ${LIB_PATH} ${LIB_LIST} -o simd_test.x64f32multi
+	rm simd_test_*.x64f32.o
+
+simd_test_x64f64multi:
+	g++ -O3 -g -c \
+        -DRT_LINUX -DRT_X64 -DRT_128=4 -DRT_DEBUG=0 \
+        -DRT_POINTER=64 -DRT_ADDRESS=64 -DRT_ELEMENT=64 -DRT_ENDIAN=0 \
+        -DRT_SIMD_SPACE=simd_128v4 \
+      ${INC_PATH} ${SRC_LIST} -o simd_test_128v4.x64f64.o
+	g++ -O3 -g -c \
+        -DRT_LINUX -DRT_X64 -DRT_256=1 -DRT_DEBUG=0 \
+        -DRT_POINTER=64 -DRT_ADDRESS=64 -DRT_ELEMENT=64 -DRT_ENDIAN=0 \
+        -DRT_SIMD_SPACE=simd_256v1 \
+      ${INC_PATH} ${SRC_LIST} -o simd_test_256v1.x64f64.o
+	g++ -O3 -g -c \
+        -DRT_LINUX -DRT_X64 -DRT_256=2 -DRT_DEBUG=0 \
+        -DRT_POINTER=64 -DRT_ADDRESS=64 -DRT_ELEMENT=64 -DRT_ENDIAN=0 \
+        -DRT_SIMD_SPACE=simd_256v2 \
+      ${INC_PATH} ${SRC_LIST} -o simd_test_256v2.x64f64.o
+	g++ -O3 -g -c \
+        -DRT_LINUX -DRT_X64 -DRT_512=1 -DRT_DEBUG=0 \
+        -DRT_POINTER=64 -DRT_ADDRESS=64 -DRT_ELEMENT=64 -DRT_ENDIAN=0 \
+        -DRT_SIMD_SPACE=simd_512v1 \
+      ${INC_PATH} ${SRC_LIST} -o simd_test_512v1.x64f64.o
+	g++ -O3 -g -c \
+        -DRT_LINUX -DRT_X64 -DRT_512=2 -DRT_DEBUG=0 \
+        -DRT_POINTER=64 -DRT_ADDRESS=64 -DRT_ELEMENT=64 -DRT_ENDIAN=0 \
+        -DRT_SIMD_SPACE=simd_512v2 \
+      ${INC_PATH} ${SRC_LIST} -o simd_test_512v2.x64f64.o
+	g++ -O3 -g \
+        -DRT_LINUX -DRT_X64 -DRT_128=4 -DRT_256=1+2 -DRT_512=1+2 \
+        -DRT_POINTER=64 -DRT_ADDRESS=64 -DRT_ELEMENT=64 -DRT_ENDIAN=0 \
+        -DRT_DEBUG=0 ${INC_PATH} simd_multi.cpp simd_test_*.x64f64.o \
+      ${LIB_PATH} ${LIB_LIST} -o simd_test.x64f64multi
+	rm simd_test_*.x64f64.o
+
+build_x64jit: simd_test_x64_32jit simd_test_x64_64jit \
+              simd_test_x64f32jit simd_test_x64f64jit
+
+simd_test_x64_32jit:
+	g++ -O3 -g \
+        -DRT_LINUX -DRT_X64 -DRT_128=4 -DRT_DEBUG=0 -DRT_JIT \
+        -DRT_POINTER=64 -DRT_ADDRESS=32 -DRT_ELEMENT=32 -DRT_ENDIAN=0 \
+      ${INC_PATH} ${SRC_LIST} ${LIB_PATH} ${LIB_LIST} -o simd_test.x64_32jit
+
+simd_test_x64_64jit:
+	g++ -O3 -g \
+        -DRT_LINUX -DRT_X64 -DRT_128=4 -DRT_DEBUG=0 -DRT_JIT \
+        -DRT_POINTER=64 -DRT_ADDRESS=32 -DRT_ELEMENT=64 -DRT_ENDIAN=0 \
+      ${INC_PATH} ${SRC_LIST} ${LIB_PATH} ${LIB_LIST} -o simd_test.x64_64jit
+
+simd_test_x64f32jit:
+	g++ -O3 -g \
+        -DRT_LINUX -DRT_X64 -DRT_256_R8=4 -DRT_DEBUG=0 -DRT_JIT \
+        -DRT_POINTER=64 -DRT_ADDRESS=64 -DRT_ELEMENT=32 -DRT_ENDIAN=0 \
+      ${INC_PATH} ${SRC_LIST} ${LIB_PATH} ${LIB_LIST} -o simd_test.x64f32jit
+
+simd_test_x64f64jit:
+	g++ -O3 -g \
+        -DRT_LINUX -DRT_X64 -DRT_256_R8=4 -DRT_DEBUG=0 -DRT_JIT \
+        -DRT_POINTER=64 -DRT_ADDRESS=64 -DRT_ELEMENT=64 -DRT_ENDIAN=0 \
+      ${INC_PATH} ${SRC_LIST} ${LIB_PATH} ${LIB_LIST} -o simd_test.x64f64jit
+
+
+# Fast builds turn off full-precision fallbacks (RT_SIMD_COMPAT_*=0),
+# which are enabled by default for bit-exact results across targets
+
+build_x64fast: simd_test_x64_32fast simd_test_x64_64fast \
+               simd_test_x64f32fast simd_test_x64f64fast
+
+simd_test_x64_32fast:
+	g++ -O3 -g \
+        -DRT_LINUX -DRT_X64 -DRT_128=4 -DRT_DEBUG=0 \
+        -DRT_SIMD_COMPAT_RCP=0 -DRT_SIMD_COMPAT_RSQ=0 \
+        -DRT_SIMD_COMPAT_FMA=0 -DRT_SIMD_COMPAT_FMS=0 \
+        -DRT_POINTER=64 -DRT_ADDRESS=32 -DRT_ELEMENT=32 -DRT_ENDIAN=0 \
+      ${INC_PATH} ${SRC_LIST} ${LIB_PATH} ${LIB_LIST} -o simd_test.x64_32fast
+
+simd_test_x64_64fast:
+	g++ -O3 -g \
+        -DRT_LINUX -DRT_X64 -DRT_128=4 -DRT_DEBUG=0 \
+        -DRT_SIMD_COMPAT_RCP=0 -DRT_SIMD_COMPAT_RSQ=0 \
+        -DRT_SIMD_COMPAT_FMA=0 -DRT_SIMD_COMPAT_FMS=0 \
+        -DRT_POINTER=64 -DRT_ADDRESS=32 -DRT_ELEMENT=64 -DRT_ENDIAN=0 \
+      ${INC_PATH} ${SRC_LIST} ${LIB_PATH} ${LIB_LIST} -o simd_test.x64_64fast
+
+simd_test_x64f32fast:
+	g++ -O3 -g \
+        -DRT_LINUX -DRT_X64 -DRT_256_R8=4 -DRT_DEBUG=0 \
+        -DRT_SIMD_COMPAT_RCP=0 -DRT_SIMD_COMPAT_RSQ=0 \
+        -DRT_SIMD_COMPAT_FMA=0 -DRT_SIMD_COMPAT_FMS=0 \
+        -DRT_POINTER=64 -DRT_ADDRESS=64 -DRT_ELEMENT=32 -DRT_ENDIAN=0 \
+      ${INC_PATH} ${SRC_LIST} ${LIB_PATH} ${LIB_LIST} -o simd_test.x64f32fast
+
+simd_test_x64f64fast:
+	g++ -O3 -g \
+        -DRT_LINUX -DRT_X64 -DRT_256_R8=4 -DRT_DEBUG=0 \
+        -DRT_SIMD_COMPAT_RCP=0 -DRT_SIMD_COMPAT_RSQ=0 \
+        -DRT_SIMD_COMPAT_FMA=0 -DRT_SIMD_COMPAT_FMS=0 \
+        -DRT_POINTER=64 -DRT_ADDRESS=64 -DRT_ELEMENT=64 -DRT_ENDIAN=0 \
+      ${INC_PATH} ${SRC_LIST} ${LIB_PATH} ${LIB_LIST} -o simd_test.x64f64fast
+
+
+# Cost model of full-precision fallbacks builds run levels 2 (div),
+# 7 (rcp/sqr), 13 (rsq/cbr), 20 (fma/fms) in every combination of
+# RT_SIMD_COMPAT_RCP/RSQ/FMA/FMS and reports elem/ns with max ulps from C
+
+COMPAT_SIMD = -DRT_128=4
+COMPAT_ELEM = 32
+COMPAT_REPS = 9
+
+bench_x64compat:
+	for c in 0 1 2 3 4 5 6 7 8 9 10 11 12 13 14 15; do \
+	g++ -O3 -g \
+        -DRT_LINUX -DRT_X64 ${COMPAT_SIMD} -DRT_DEBUG=0 \
+        -DRT_SIMD_COMPAT_RCP=$$(($$c >> 3 & 1)) \
+        -DRT_SIMD_COMPAT_RSQ=$$(($$c >> 2 & 1)) \
+        -DRT_SIMD_COMPAT_FMA=$$(($$c >> 1 & 1)) \
+        -DRT_SIMD_COMPAT_FMS=$$(($$c >> 0 & 1)) \
+        -DRT_POINTER=64 -DRT_ADDRESS=64 -DRT_ELEMENT=${COMPAT_ELEM} \
+        -DRT_ENDIAN=0 \
+      ${INC_PATH} ${SRC_LIST} ${LIB_PATH} ${LIB_LIST} -o simd_test.x64compat \
+      || exit 1; \
+	for l in 2 7 13 20; do \
+	./simd_test.x64compat -b $$l -e $$l -r ${COMPAT_REPS} -u | grep "^Cost.*ulp"; \
+	done; done
+	rm simd_test.x64compat
+
+
 # Prerequisites for the build:
 # native-compiler for x86_64 is installed and in the PATH variable.
 # sudo apt-get install g++
@@ -143,6 +375,26 @@ simd_test_x64f64avx512:
 # sde64 -skx -- ./simd_test.x64f32avx512 -c 1
 # Use "-c 1" option to reduce test time when emulating with Intel SDE
 
+# Run-time code generation (JIT) builds of the SIMD test (x86_64 only):
+# make -f simd_make_x64.mk build_x64jit
+# ./simd_test.x64f32jit
+# Each ASM_ENTER/ASM_LEAVE block is generated at run-time with RT_JIT option
+# on its first call and then reused from the code cache on subsequent calls.
+# To test code cache eviction use (add): -DRT_JIT_CACHE_SIZE=0x2000
+# For other SIMD targets add -DRT_JIT to any of the build options below
+# To test jump veneers in JIT builds use (add): -DRT_JIT_JCC_RANGE=8
+
+# Bit-exact verification of fp-compute across targets (any ISA, same width):
+# ./simd_test.x64_32 -x x64_32.bits  (dump raw bits of output arrays to file)
+# qemu-aarch64 -cpu cortex-a57 simd_test.a64_32 -g x64_32.bits  (diff them)
+# Levels are reported as bit-exact or with the number of differing elements
+# and max ulp distance, add "-d 0" to also compare C and S results exactly.
+# Cost of full-precision fallbacks against fast builds (RT_SIMD_COMPAT_*=0):
+# make -f simd_make_x64.mk bench_x64compat COMPAT_SIMD=-DRT_256=2
+# make -f simd_make_x64.mk build_x64fast
+# ./simd_test.x64_32 -r 15 -o strict.csv && ./simd_test.x64_32fast -r 15 \
+#                                             -o fast.csv -g x64_32.bits
+
 # Clang compilation works too (takes much longer prior to 3.8), use (replace):
 # clang++ (in place of g++)
 # sudo apt-get install clang
@@ -0,0 +1,163 @@
+/******************************************************************************/
+/* Copyright (c) 2013-2019 VectorChief (at github, bitbucket, sourceforge)    */
+/* Distributed under the MIT software license, see the accompanying           */
+/* file COPYING or http://www.opensource.org/licenses/mit-license.php         */
+/******************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+
+#include "rtbase.h"
+
+/******************************************************************************/
+/*********************************   LEGEND   *********************************/
+/******************************************************************************/
+
+/*
+ * simd_multi.cpp: Runtime SIMD target dispatcher for multi-target builds.
+ *
+ * simd_test.cpp is compiled once for each SIMD target into a separate
+ * translation unit with RT_SIMD_SPACE naming the namespace which wraps it
+ * (simd_128v4, simd_256v1, simd_256v2, ...), while this file is compiled
+ * with all of the targets combined in build flags (RT_128=4, RT_256=1+2,
+ * RT_512=1+2) to generate the table below (widest targets first).
+ *
+ * At startup verxx_xx is run (via the narrowest target) to obtain SIMD
+ * targets supported by the CPU, which are then matched against mask_init
+ * for each entry of the table, main is bound to the first one supported.
+ * Option -m n limits the width of the chosen target to n-bit (n >= 128),
+ * so that every variant built into the binary can be tested on one CPU.
+ * Check simd_test_x64f32multi in simd_make_x64.mk for build options.
+ */
+
+/******************************************************************************/
+/*******************************   DEFINITIONS   ******************************/
+/******************************************************************************/
+
+#define RT_LOGI             printf
+#define RT_LOGE             printf
+
+/*
+ * Declare entry points of SIMD target compiled into namespace "space".
+ */
+#define RT_SIMD_DECL(space)                                                 \
+namespace space                                                             \
+{                                                                           \
+    rt_si32 get_vers();                                                     \
+    rt_si32 main(rt_si32 argc, rt_char *argv[]);                            \
+}
+
+/*
+ * Fill table entry for SIMD target with "simd" parameters in mask_init format.
+ */
+#define RT_SIMD_ITEM(space, n_simd, s_type, k_size)                         \
+    {                                                                       \
+        (k_size << 16) | (s_type << 8) | n_simd,                            \
+        space::get_vers, space::main                                        \
+    },
+
+/******************************************************************************/
+/***************************   VARS, FUNCS, TYPES   ***************************/
+/******************************************************************************/
+
+#if (RT_512 & 2)
+RT_SIMD_DECL(simd_512v2)
+#endif /* RT_512 & 2 */
+#if (RT_512 & 1)
+RT_SIMD_DECL(simd_512v1)
+#endif /* RT_512 & 1 */
+#if (RT_256 & 2)
+RT_SIMD_DECL(simd_256v2)
+#endif /* RT_256 & 2 */
+#if (RT_256 & 1)
+RT_SIMD_DECL(simd_256v1)
+#endif /* RT_256 & 1 */
+#if (RT_128 & 8)
+RT_SIMD_DECL(simd_128v8)
+#endif /* RT_128 & 8 */
+#if (RT_128 & 4)
+RT_SIMD_DECL(simd_128v4)
+#endif /* RT_128 & 4 */
+
+typedef rt_si32 (*versXX)();
+
+typedef rt_si32 (*mainXX)(rt_si32 argc, rt_char *argv[]);
+
+struct rt_SIMD_TARGET
+{
+    rt_si32 simd;
+    versXX  vers;
+    mainXX  main;
+};
+
+rt_SIMD_TARGET t_list[] =
+{
+#if (RT_512 & 2)
+    RT_SIMD_ITEM(simd_512v2, 4, 2, 1)
+#endif /* RT_512 & 2 */
+#if (RT_512 & 1)
+    RT_SIMD_ITEM(simd_512v1, 4, 1, 1)
+#endif /* RT_512 & 1 */
+#if (RT_256 & 2)
+    RT_SIMD_ITEM(simd_256v2, 2, 2, 1)
+#endif /* RT_256 & 2 */
+#if (RT_256 & 1)
+    RT_SIMD_ITEM(simd_256v1, 2, 1, 1)
+#endif /* RT_256 & 1 */
+#if (RT_128 & 8)
+    RT_SIMD_ITEM(simd_128v8, 1, 8, 1)
+#endif /* RT_128 & 8 */
+#if (RT_128 & 4)
+    RT_SIMD_ITEM(simd_128v4, 1, 4, 1)
+#endif /* RT_128 & 4 */
+};
+
+/******************************************************************************/
+/**********************************   MAIN   **********************************/
+/******************************************************************************/
+
+rt_si32 main(rt_si32 argc, rt_char *argv[])
+{
+    rt_si32 i, k, l, r, t;
+    rt_si32 n = RT_ARR_SIZE(t_list), m = 2048;
+
+    for (k = 1; k < argc; k++)
+    {
+        if (k < argc && strcmp(argv[k], "-m") == 0 && ++k < argc)
+        {
+            for (l = strlen(argv[k]), r = 1, t = 0; l > 0; l--, r *= 10)
+            {
+                t += (argv[k][l-1] - '0') * r;
+            }
+            if (t >= 128)
+            {
+                m = t;
+            }
+            else
+            {
+                RT_LOGI("SIMD-width-limit value out of range\n");
+                return 0;
+            }
+        }
+    }
+
+    rt_si32 ver = t_list[n-1].vers();
+
+    for (i = 0; i < n; i++)
+    {
+        if ((t_list[i].simd & 0xFF) * 128 <= m
+        &&  (mask_init(t_list[i].simd) & ver) != 0)
+        {
+            return t_list[i].main(argc, argv);
+        }
+    }
+
+    RT_LOGI("None of SIMD targets is supported, check build flags\n");
+
+    return 0;
+}
+
+/******************************************************************************/
+/******************************************************************************/
+/******************************************************************************/
@@ -23,13 +23,46 @@
  */
 #define RT_DATA 8
 
+/*
+ * RT_SIMD_SPACE (if defined in build flags) wraps this file into a namespace
+ * with the given name, so that the same source can be compiled for several
+ * SIMD targets in separate translation units linked into a single binary,
+ * where simd_multi.cpp binds main to the widest target supported at runtime.
+ * System headers are included ahead of the namespace to keep them global.
+ */
+#if (defined RT_SIMD_SPACE)
+
+#include <math.h>
+#include <float.h>
+
+#if   (defined RT_WIN32) || (defined RT_WIN64) /* Win32, MSVC - Win64, GCC -- */
+
+#include <windows.h>
+
+#else /* --- Linux, GCC ----------------------------------------------------- */
+
+#include <unistd.h>
+#include <sched.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/time.h>
+#include <time.h>
+
+#endif /* ------------- OS specific ----------------------------------------- */
+
+namespace RT_SIMD_SPACE
+{
+
+#endif /* RT_SIMD_SPACE */
+
 #include "rtbase.h"
+#include "rtpool.h"
 
 /******************************************************************************/
 /*******************************   DEFINITIONS   ******************************/
 /******************************************************************************/
 
-#define RUN_LEVEL           29
+#define RUN_LEVEL           42
 #define CYC_SIZE            1000000
 
 #define ARR_SIZE            S*3 /* hardcoded in ASM sections, S = SIMD elems */
@@ -52,6 +85,19 @@
 #define RT_LOGI             printf
 #define RT_LOGE             printf
 
+#if   (defined __clang__)
+#define RT_CC_NAME          "clang " __clang_version__
+#elif (defined __GNUC__)
+#define RT_CC_NAME          "gcc " __VERSION__
+#elif (defined _MSC_VER)
+#define RT_CC_NAME          "msvc " RT_CC_STR(_MSC_VER)
+#else  /* compiler */
+#define RT_CC_NAME          "unknown"
+#endif /* compiler */
+
+#define RT_CC_STR(v)        RT_CC_VAL(v)
+#define RT_CC_VAL(v)        #v
+
 /******************************************************************************/
 /***************************   VARS, FUNCS, TYPES   ***************************/
 /******************************************************************************/
@@ -61,12 +107,27 @@ rt_si32     n_done      = RUN_LEVEL-1;  /* subtest-done (from command-line) */
 rt_si32     t_diff      = 2;          /* diff-threshold (from command-line) */
 rt_si32     r_test      = CYC_SIZE;   /* test-redundant (from command-line) */
 rt_bool     v_mode      = RT_FALSE;     /* verbose mode (from command-line) */
+rt_si32     b_reps      = 0;         /* bench-repeats (from command-line) */
+FILE       *o_file      = NULL;        /* output-records (from command-line) */
+rt_bool     o_csv       = RT_FALSE;    /* output-records (from command-line) */
+rt_si32     w_size      = 0;          /* sweep-max-MiB (from command-line) */
+rt_si32     t_thrd      = 0;     /* thread-pool size (from command-line) */
+rt_POOL    *t_pool      = RT_NULL;   /* thread-pool (initialized in main) */
+rt_si32     s_size      = 0;         /* stream-MiB (from command-line) */
+FILE       *x_file      = NULL;        /* raw-bits dump (from command-line) */
+rt_bool     g_mode      = RT_FALSE;  /* golden-bits diff (from command-line) */
+rt_bool     u_mode      = RT_FALSE;     /* cost report (from command-line) */
 
 /*
  * Get system time in milliseconds.
  */
 rt_time get_time();
 
+/*
+ * Get monotonic time in nanoseconds.
+ */
+rt_time get_nsec();
+
 /*
  * Allocate memory from system heap.
  */
@@ -4310,367 +4371,4480 @@ rt_void p_test29(rt_SIMD_INFOX *info)
 #endif /* RUN_LEVEL 29 */
 
 /******************************************************************************/
-/*********************************   TABLES   *********************************/
+/******************************   RUN LEVEL 30   ******************************/
 /******************************************************************************/
 
-typedef rt_void (*testXX)(rt_SIMD_INFOX *);
+#if RUN_LEVEL >= 30
 
-testXX c_test[RUN_LEVEL] =
+rt_void c_test30(rt_SIMD_INFOX *info)
 {
-#if RUN_LEVEL >=  1
-    c_test01,
-#endif /* RUN_LEVEL  1 */
-
-#if RUN_LEVEL >=  2
-    c_test02,
-#endif /* RUN_LEVEL  2 */
+    rt_si32 i, j, n = info->size;
 
-#if RUN_LEVEL >=  3
-    c_test03,
-#endif /* RUN_LEVEL  3 */
+    rt_real *far0 = info->far0;
+    rt_real *fco1 = info->fco1;
 
-#if RUN_LEVEL >=  4
-    c_test04,
-#endif /* RUN_LEVEL  4 */
+    i = info->cyc;
+    while (i-->0)
+    {
+        j = n;
+        while (j-->0)
+        {
+            fco1[j] = far0[j] + far0[(j + S) % n];
+        }
+    }
+}
 
-#if RUN_LEVEL >=  5
-    c_test05,
-#endif /* RUN_LEVEL  5 */
+/*
+ * ASM_ENTER_R/ASM_LEAVE save/load only BASE/SIMD registers listed in masks,
+ * which reduces the fixed cost of short ASM sections called very often.
+ * The same section is timed in p_test30 with full ASM_ENTER for reference.
+ */
+rt_void s_test30(rt_SIMD_INFOX *info)
+{
+    rt_si32 i;
 
-#if RUN_LEVEL >=  6
-    c_test06,
-#endif /* RUN_LEVEL  6 */
+    i = info->cyc;
+    while (i-->0)
+    {
+        ASM_ENTER_R(info, RT_BASE_Recx | RT_BASE_Redx, 0x0003) /* Xmm0,1 */
 
-#if RUN_LEVEL >=  7
-    c_test07,
-#endif /* RUN_LEVEL  7 */
+        movxx_ld(Recx, Mebp, inf_FAR0)
+        movxx_ld(Redx, Mebp, inf_FSO1)
 
-#if RUN_LEVEL >=  8
-    c_test08,
-#endif /* RUN_LEVEL  8 */
+        movpx_ld(Xmm0, Mecx, AJ0)
+        movpx_ld(Xmm1, Mecx, AJ1)
+        addps_rr(Xmm0, Xmm1)
+        movpx_st(Xmm0, Medx, AJ0)
 
-#if RUN_LEVEL >=  9
-    c_test09,
-#endif /* RUN_LEVEL  9 */
+        movpx_ld(Xmm0, Mecx, AJ1)
+        addps_ld(Xmm0, Mecx, AJ2)
+        movpx_st(Xmm0, Medx, AJ1)
 
-#if RUN_LEVEL >= 10
-    c_test10,
-#endif /* RUN_LEVEL 10 */
+        movpx_ld(Xmm0, Mecx, AJ2)
+        addps_ld(Xmm0, Mecx, AJ0)
+        movpx_st(Xmm0, Medx, AJ2)
 
-#if RUN_LEVEL >= 11
-    c_test11,
-#endif /* RUN_LEVEL 11 */
+        ASM_LEAVE(info)
+    }
+}
 
-#if RUN_LEVEL >= 12
-    c_test12,
-#endif /* RUN_LEVEL 12 */
+rt_void s_full30(rt_SIMD_INFOX *info)
+{
+    rt_si32 i;
 
-#if RUN_LEVEL >= 13
-    c_test13,
-#endif /* RUN_LEVEL 13 */
+    i = info->cyc;
+    while (i-->0)
+    {
+        ASM_ENTER(info)
 
-#if RUN_LEVEL >= 14
-    c_test14,
-#endif /* RUN_LEVEL 14 */
+        movxx_ld(Recx, Mebp, inf_FAR0)
+        movxx_ld(Redx, Mebp, inf_FSO1)
 
-#if RUN_LEVEL >= 15
-    c_test15,
-#endif /* RUN_LEVEL 15 */
+        movpx_ld(Xmm0, Mecx, AJ0)
+        movpx_ld(Xmm1, Mecx, AJ1)
+        addps_rr(Xmm0, Xmm1)
+        movpx_st(Xmm0, Medx, AJ0)
 
-#if RUN_LEVEL >= 16
-    c_test16,
-#endif /* RUN_LEVEL 16 */
+        movpx_ld(Xmm0, Mecx, AJ1)
+        addps_ld(Xmm0, Mecx, AJ2)
+        movpx_st(Xmm0, Medx, AJ1)
 
-#if RUN_LEVEL >= 17
-    c_test17,
-#endif /* RUN_LEVEL 17 */
+        movpx_ld(Xmm0, Mecx, AJ2)
+        addps_ld(Xmm0, Mecx, AJ0)
+        movpx_st(Xmm0, Medx, AJ2)
 
-#if RUN_LEVEL >= 18
-    c_test18,
-#endif /* RUN_LEVEL 18 */
+        ASM_LEAVE(info)
+    }
+}
 
-#if RUN_LEVEL >= 19
-    c_test19,
-#endif /* RUN_LEVEL 19 */
+rt_void p_test30(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = info->size;
 
-#if RUN_LEVEL >= 20
-    c_test20,
-#endif /* RUN_LEVEL 20 */
+    rt_real *far0 = info->far0;
+    rt_real *fco1 = info->fco1;
+    rt_real *fso1 = info->fso1;
 
-#if RUN_LEVEL >= 21
-    c_test21,
-#endif /* RUN_LEVEL 21 */
+    rt_time time1 = 0;
+    rt_time time2 = 0;
+    rt_time tF = 0;
+    rt_time tR = 0;
 
-#if RUN_LEVEL >= 22
-    c_test22,
-#endif /* RUN_LEVEL 22 */
+    time1 = get_nsec();
 
-#if RUN_LEVEL >= 23
-    c_test23,
-#endif /* RUN_LEVEL 23 */
+    s_full30(info);
 
-#if RUN_LEVEL >= 24
-    c_test24,
-#endif /* RUN_LEVEL 24 */
+    time2 = get_nsec();
+    tF = time2 - time1;
 
-#if RUN_LEVEL >= 25
-    c_test25,
-#endif /* RUN_LEVEL 25 */
+    time1 = get_nsec();
 
-#if RUN_LEVEL >= 26
-    c_test26,
-#endif /* RUN_LEVEL 26 */
+    s_test30(info);
 
-#if RUN_LEVEL >= 27
-    c_test27,
-#endif /* RUN_LEVEL 27 */
+    time2 = get_nsec();
+    tR = time2 - time1;
 
-#if RUN_LEVEL >= 28
-    c_test28,
-#endif /* RUN_LEVEL 28 */
+    j = RT_MAX(info->cyc, 1);
+    RT_LOGI("Call S = %.1f ns (ASM_ENTER), %.1f ns (ASM_ENTER_R)\n",
+            (rt_fp64)tF / j, (rt_fp64)tR / j);
 
-#if RUN_LEVEL >= 29
-    c_test29,
-#endif /* RUN_LEVEL 29 */
-};
+    j = n;
+    while (j-->0)
+    {
+        if (FEQ(fco1[j], fso1[j]) && !v_mode)
+        {
+            continue;
+        }
 
-testXX s_test[RUN_LEVEL] =
-{
-#if RUN_LEVEL >=  1
-    s_test01,
-#endif /* RUN_LEVEL  1 */
+        RT_LOGI("farr[%d] = %e, farr[%d] = %e\n",
+                j, far0[j], (j + S) % n, far0[(j + S) % n]);
 
-#if RUN_LEVEL >=  2
-    s_test02,
-#endif /* RUN_LEVEL  2 */
+        RT_LOGI("C farr[%d]+farr[%d] = %e\n",
+                j, (j + S) % n, fco1[j]);
 
-#if RUN_LEVEL >=  3
-    s_test03,
-#endif /* RUN_LEVEL  3 */
+        RT_LOGI("S farr[%d]+farr[%d] = %e\n",
+                j, (j + S) % n, fso1[j]);
+    }
+}
 
-#if RUN_LEVEL >=  4
-    s_test04,
-#endif /* RUN_LEVEL  4 */
+#endif /* RUN_LEVEL 30 */
 
-#if RUN_LEVEL >=  5
-    s_test05,
-#endif /* RUN_LEVEL  5 */
+/******************************************************************************/
+/******************************   RUN LEVEL 31   ******************************/
+/******************************************************************************/
 
-#if RUN_LEVEL >=  6
-    s_test06,
-#endif /* RUN_LEVEL  6 */
+#if RUN_LEVEL >= 31
 
-#if RUN_LEVEL >=  7
-    s_test07,
-#endif /* RUN_LEVEL  7 */
+rt_void c_test31(rt_SIMD_INFOX *info)
+{
+    rt_si32 i, j, k, n = info->size;
 
-#if RUN_LEVEL >=  8
-    s_test08,
-#endif /* RUN_LEVEL  8 */
+    rt_real *far0 = info->far0;
+    rt_real *fco1 = info->fco1;
+    rt_real *fco2 = info->fco2;
 
-#if RUN_LEVEL >=  9
-    s_test09,
-#endif /* RUN_LEVEL  9 */
+    rt_real sum, min, max;
 
-#if RUN_LEVEL >= 10
-    s_test10,
-#endif /* RUN_LEVEL 10 */
+    i = info->cyc;
+    while (i-->0)
+    {
+        j = n;
+        while (j-->0)
+        {
+            k = S;
+            sum = 0.0f;
+            min = +RT_INF;
+            max = -RT_INF;
+            while (k-->0)
+            {
+                sum += far0[(j / S) * S + k];
+                min = RT_MIN(min, far0[(j / S) * S + k]);
+                max = RT_MAX(max, far0[(j / S) * S + k]);
+            }
+            fco1[j] = sum;
+            fco2[j] = min + max;
+        }
+    }
+}
 
-#if RUN_LEVEL >= 11
-    s_test11,
-#endif /* RUN_LEVEL 11 */
+/*
+ * Horizontal reductions (adh, mnh, mxh) are timed here in a loop
+ * within a single ASM section to measure their throughput in isolation,
+ * p_test31 reports average time per reduction along with the results.
+ */
+rt_void s_test31(rt_SIMD_INFOX *info)
+{
+    ASM_ENTER(info)
 
-#if RUN_LEVEL >= 12
-    s_test12,
-#endif /* RUN_LEVEL 12 */
+        movwx_ld(Reax, Mebp, inf_CYC)
+        movwx_st(Reax, Mebp, inf_LOC)
 
-#if RUN_LEVEL >= 13
-    s_test13,
-#endif /* RUN_LEVEL 13 */
+    LBL(red_ini)
 
-#if RUN_LEVEL >= 14
-    s_test14,
-#endif /* RUN_LEVEL 14 */
+        movxx_ld(Recx, Mebp, inf_FAR0)
+        movxx_ld(Redx, Mebp, inf_FSO1)
+        movxx_ld(Rebx, Mebp, inf_FSO2)
 
-#if RUN_LEVEL >= 15
+        movpx_ld(Xmm0, Mecx, AJ0)
+        adhps_rr(Xmm1, Xmm0)
+        mnhps_rr(Xmm2, Xmm0)
+        mxhps_rr(Xmm3, Xmm0)
+        addps_rr(Xmm2, Xmm3)
+        movpx_st(Xmm1, Medx, AJ0)
+        movpx_st(Xmm2, Mebx, AJ0)
+
+        adhps_ld(Xmm4, Mecx, AJ1)
+        mnhps_ld(Xmm5, Mecx, AJ1)
+        mxhps_ld(Xmm6, Mecx, AJ1)
+        addps_rr(Xmm5, Xmm6)
+        movpx_st(Xmm4, Medx, AJ1)
+        movpx_st(Xmm5, Mebx, AJ1)
+
+        movpx_ld(Xmm1, Mecx, AJ2)
+        movpx_rr(Xmm2, Xmm1)
+        movpx_rr(Xmm3, Xmm1)
+        adhps_rr(Xmm1, Xmm1)
+        mnhps_rr(Xmm2, Xmm2)
+        mxhps_rr(Xmm3, Xmm3)
+        addps_rr(Xmm2, Xmm3)
+        movpx_st(Xmm1, Medx, AJ2)
+        movpx_st(Xmm2, Mebx, AJ2)
+
+        subwx_mi(Mebp, inf_LOC, IB(1))
+        cmjwx_mz(Mebp, inf_LOC,
+        /* if */ GT_x, red_ini)
+
+    ASM_LEAVE(info)
+}
+
+rt_void p_test31(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = info->size;
+
+    rt_real *far0 = info->far0;
+    rt_real *fco1 = info->fco1;
+    rt_real *fco2 = info->fco2;
+    rt_real *fso1 = info->fso1;
+    rt_real *fso2 = info->fso2;
+
+    rt_time time1 = 0;
+    rt_time time2 = 0;
+    rt_time tS = 0;
+
+    time1 = get_nsec();
+
+    s_test31(info);
+
+    time2 = get_nsec();
+    tS = time2 - time1;
+
+    j = RT_MAX(info->cyc, 1) * 9;
+    RT_LOGI("Call S = %.1f ns per reduction (adh, mnh, mxh)\n",
+            (rt_fp64)tS / j);
+
+    j = n;
+    while (j-->0)
+    {
+        if (FEQ(fco1[j], fso1[j]) && FEQ(fco2[j], fso2[j]) && !v_mode)
+        {
+            continue;
+        }
+
+        RT_LOGI("farr[%d] = %e\n",
+                j, far0[j]);
+
+        RT_LOGI("C SUM(vec[%d]) = %e, MIN(vec[%d])+MAX(vec[%d]) = %e\n",
+                j / S, fco1[j], j / S, j / S, fco2[j]);
+
+        RT_LOGI("S SUM(vec[%d]) = %e, MIN(vec[%d])+MAX(vec[%d]) = %e\n",
+                j / S, fso1[j], j / S, j / S, fso2[j]);
+    }
+}
+
+#endif /* RUN_LEVEL 31 */
+
+/******************************************************************************/
+/******************************   RUN LEVEL 32   ******************************/
+/******************************************************************************/
+
+#if RUN_LEVEL >= 32
+
+/*
+ * Index vectors for gather/scatter: strided (1st), scrambled (2nd)
+ * and duplicated (3rd), the latter resolves scatter collisions in favor
+ * of the highest lane, as gth/sct process lanes in ascending order.
+ */
+static rt_elem i_test32(rt_si32 j, rt_si32 n)
+{
+    rt_si32 k = j % S;
+
+    switch (j / S)
+    {
+        case 0:
+        return 3 * k;
+
+        case 1:
+        return (k * 37 + k * k * 13 + S) % n;
+
+        default:
+        return S + k / 2;
+    }
+}
+
+rt_void c_test32(rt_SIMD_INFOX *info)
+{
+    rt_si32 i, j, n = info->size;
+
+    rt_real *far0 = info->far0;
+    rt_real *fco1 = info->fco1;
+    rt_real *fco2 = info->fco2;
+    rt_elem *ico1 = info->ico1;
+
+    i = info->cyc;
+    while (i-->0)
+    {
+        j = n;
+        while (j-->0)
+        {
+            ico1[j] = i_test32(j, n);
+            fco1[j] = far0[ico1[j]];
+            fco2[j] = 0.0f;
+        }
+        j = 0;
+        while (j < n)
+        {
+            fco2[ico1[j]] = far0[j];
+            j++;
+        }
+    }
+}
+
+rt_void s_test32(rt_SIMD_INFOX *info)
+{
+    rt_si32 i, j, n = info->size;
+
+    rt_real *fso2 = info->fso2;
+    rt_elem *iso1 = info->iso1;
+
+    i = info->cyc;
+    while (i-->0)
+    {
+        j = n;
+        while (j-->0)
+        {
+            iso1[j] = i_test32(j, n);
+            fso2[j] = 0.0f;
+        }
+
+        ASM_ENTER(info)
+
+        movxx_ld(Recx, Mebp, inf_FAR0)
+        movxx_ld(Redx, Mebp, inf_FSO1)
+        movxx_ld(Rebx, Mebp, inf_ISO1)
+
+        movpx_ld(Xmm0, Mebx, AJ0)
+        gthpx_ld(Xmm1, Xmm0, Mecx, AJ0)
+        movpx_st(Xmm1, Medx, AJ0)
+
+        movpx_ld(Xmm2, Mebx, AJ1)
+        gthpx_ld(Xmm2, Xmm2, Mecx, AJ0)
+        movpx_st(Xmm2, Medx, AJ1)
+
+        movpx_ld(Xmm3, Mebx, AJ2)
+        gthpx_ld(Xmm4, Xmm3, Mecx, AJ0)
+        movpx_st(Xmm4, Medx, AJ2)
+
+        movxx_ld(Redx, Mebp, inf_FSO2)
+
+        movpx_ld(Xmm5, Mecx, AJ0)
+        sctpx_st(Xmm5, Xmm0, Medx, AJ0)
+
+        movpx_ld(Xmm6, Mecx, AJ1)
+        movpx_ld(Xmm7, Mebx, AJ1)
+        sctpx_st(Xmm6, Xmm7, Medx, AJ0)
+
+        movpx_ld(Xmm1, Mecx, AJ2)
+        sctpx_st(Xmm1, Xmm3, Medx, AJ0)
+
+        ASM_LEAVE(info)
+    }
+}
+
+rt_void p_test32(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = info->size;
+
+    rt_real *far0 = info->far0;
+    rt_real *fco1 = info->fco1;
+    rt_real *fco2 = info->fco2;
+    rt_real *fso1 = info->fso1;
+    rt_real *fso2 = info->fso2;
+    rt_elem *ico1 = info->ico1;
+    rt_elem *iso1 = info->iso1;
+
+    j = n;
+    while (j-->0)
+    {
+        if (FEQ(fco1[j], fso1[j]) && FEQ(fco2[j], fso2[j]) && !v_mode)
+        {
+            continue;
+        }
+
+        RT_LOGI("farr[%d] = %e, idx[%d] = %" PR_L "d\n",
+                j, far0[j], j, ico1[j]);
+
+        RT_LOGI("C farr[idx[%d]] = %e, sct(farr)[%d] = %e\n",
+                j, fco1[j], j, fco2[j]);
+
+        RT_LOGI("S farr[idx[%d]] = %e, sct(farr)[%d] = %e, idx = %" PR_L "d\n",
+                j, fso1[j], j, fso2[j], iso1[j]);
+    }
+}
+
+#endif /* RUN_LEVEL 32 */
+
+/******************************************************************************/
+/******************************   RUN LEVEL 33   ******************************/
+/******************************************************************************/
+
+#if RUN_LEVEL >= 33
+
+/*
+ * Lane-indices for table-driven permutes, some of them exceed the number
+ * of lanes to check that indices are taken modulo lane-count.
+ */
+static rt_elem i_test33(rt_si32 j)
+{
+    return (j % S) * 5 + (j / S) * 7 + 3;
+}
+
+rt_void c_test33(rt_SIMD_INFOX *info)
+{
+    rt_si32 i, j, k;
+
+    rt_real *far0 = info->far0;
+    rt_real *fco1 = info->fco1;
+    rt_real *fco2 = info->fco2;
+    rt_elem *iar0 = info->iar0;
+    rt_elem *ico1 = info->ico1;
+    rt_elem *ico2 = info->ico2;
+
+    i = info->cyc;
+    while (i-->0)
+    {
+        k = S;
+        while (k-->0)
+        {
+            fco1[0*S + k] = far0[0*S + 1 % S];
+            fco2[0*S + k] = far0[0*S + S - 1 - k];
+            fco1[1*S + k] = far0[1*S + (k + 3) % S];
+            fco2[1*S + k] = far0[(k % 2 + 0)*S + k / 2];
+            fco1[2*S + k] = far0[(k % 2 + 1)*S + k / 2 + S / 2];
+
+            for (j = 0; j < 3; j++)
+            {
+                ico1[j*S + k] = i_test33(j*S + k);
+                ico2[j*S + k] = iar0[j*S + ico1[j*S + k] % S];
+            }
+
+            fco2[2*S + k] = far0[2*S + ico1[2*S + k] % S];
+        }
+    }
+}
+
+rt_void s_test33(rt_SIMD_INFOX *info)
+{
+    rt_si32 i, j, n = info->size;
+
+    rt_elem *iso1 = info->iso1;
+
+    i = info->cyc;
+    while (i-->0)
+    {
+        j = n;
+        while (j-->0)
+        {
+            iso1[j] = i_test33(j);
+        }
+
+        ASM_ENTER(info)
+
+        movxx_ld(Recx, Mebp, inf_FAR0)
+        movxx_ld(Redx, Mebp, inf_FSO1)
+        movxx_ld(Rebx, Mebp, inf_FSO2)
+
+        movpx_ld(Xmm0, Mecx, AJ0)
+        splpx_ri(Xmm1, Xmm0, IB(1))
+        movpx_st(Xmm1, Medx, AJ0)
+        movpx_rr(Xmm2, Xmm0)
+        revpx_rr(Xmm2, Xmm2)
+        movpx_st(Xmm2, Mebx, AJ0)
+
+        movpx_ld(Xmm3, Mecx, AJ1)
+        rotpx_ri(Xmm4, Xmm3, IB(3))
+        movpx_st(Xmm4, Medx, AJ1)
+        unlpx_rr(Xmm0, Xmm3)
+        movpx_st(Xmm0, Mebx, AJ1)
+
+        movpx_ld(Xmm5, Mecx, AJ2)
+        unhpx_rr(Xmm3, Xmm5)
+        movpx_st(Xmm3, Medx, AJ2)
+
+        movxx_ld(Recx, Mebp, inf_ISO1)
+        movpx_ld(Xmm6, Mecx, AJ2)
+        tblpx_rr(Xmm5, Xmm5, Xmm6)
+        movpx_st(Xmm5, Mebx, AJ2)
+
+        movxx_ld(Redx, Mebp, inf_IAR0)
+        movxx_ld(Rebx, Mebp, inf_ISO2)
+
+        movpx_ld(Xmm7, Medx, AJ0)
+        tblpx_ld(Xmm7, Xmm7, Mecx, AJ0)
+        movpx_st(Xmm7, Mebx, AJ0)
+
+        movpx_ld(Xmm7, Medx, AJ1)
+        tblpx_ld(Xmm1, Xmm7, Mecx, AJ1)
+        movpx_st(Xmm1, Mebx, AJ1)
+
+        movpx_ld(Xmm7, Medx, AJ2)
+        tblpx_ld(Xmm2, Xmm7, Mecx, AJ2)
+        movpx_st(Xmm2, Mebx, AJ2)
+
+        ASM_LEAVE(info)
+    }
+}
+
+rt_void p_test33(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = info->size;
+
+    rt_real *far0 = info->far0;
+    rt_real *fco1 = info->fco1;
+    rt_real *fco2 = info->fco2;
+    rt_real *fso1 = info->fso1;
+    rt_real *fso2 = info->fso2;
+    rt_elem *ico2 = info->ico2;
+    rt_elem *iso2 = info->iso2;
+
+    j = n;
+    while (j-->0)
+    {
+        if (FEQ(fco1[j], fso1[j]) && FEQ(fco2[j], fso2[j])
+        &&  IEQ(ico2[j], iso2[j]) && !v_mode)
+        {
+            continue;
+        }
+
+        RT_LOGI("farr[%d] = %e\n",
+                j, far0[j]);
+
+        RT_LOGI("C prm1[%d] = %e, prm2[%d] = %e, tbl[%d] = %" PR_L "X\n",
+                j, fco1[j], j, fco2[j], j, ico2[j]);
+
+        RT_LOGI("S prm1[%d] = %e, prm2[%d] = %e, tbl[%d] = %" PR_L "X\n",
+                j, fso1[j], j, fso2[j], j, iso2[j]);
+    }
+}
+
+#endif /* RUN_LEVEL 33 */
+
+/******************************************************************************/
+/******************************   RUN LEVEL 34   ******************************/
+/******************************************************************************/
+
+#if RUN_LEVEL >= 34
+
+rt_void c_test34(rt_SIMD_INFOX *info)
+{
+    rt_si32 i, j, k, n = info->size;
+
+    rt_real *far0 = info->far0;
+    rt_real *fco1 = info->fco1;
+    rt_real *fco2 = info->fco2;
+
+    i = info->cyc;
+    while (i-->0)
+    {
+        j = n;
+        while (j-->0)
+        {
+            fco1[j] = 0;
+            fco2[j] = 0;
+        }
+
+        j = S - 1;
+        while (j > 0)
+        {
+            k = S;
+            while (k-->0)
+            {
+                fco1[0*S + k] += k < j ? far0[0*S + k] : 0;
+                fco1[1*S + k] += k < j ? far0[1*S + k] : 0;
+            }
+            j--;
+        }
+
+        k = S;
+        while (k-->0)
+        {
+            fco1[2*S + k] = far0[2*S + k];
+            fco2[0*S + k] = far0[0*S + k];
+            fco2[2*S + k] = k < S - 1 ? far0[2*S + k] : 0;
+        }
+    }
+}
+
+/*
+ * Masked tails are checked for every count from S-1 down to 1 in a loop,
+ * partial loads are accumulated in fso1[0] while partial stores accumulate
+ * in fso1[1] (lanes above the count must stay intact), counts 0 and above S
+ * are checked separately, fso1[2] is expected to be left untouched.
+ */
+rt_void s_test34(rt_SIMD_INFOX *info)
+{
+    rt_si32 i, j, n = info->size;
+
+    rt_real *far0 = info->far0;
+    rt_real *fso1 = info->fso1;
+    rt_real *fso2 = info->fso2;
+
+    i = info->cyc;
+    while (i-->0)
+    {
+        j = n;
+        while (j-->0)
+        {
+            fso1[j] = j < 2*S ? 0 : far0[j];
+            fso2[j] = 0;
+        }
+
+        ASM_ENTER(info)
+
+        movwx_mi(Mebp, inf_LOC, IB(S - 1))
+
+    LBL(mtl_ini)
+
+        movwx_ld(Reax, Mebp, inf_LOC)
+        movxx_ld(Recx, Mebp, inf_FAR0)
+        movxx_ld(Redx, Mebp, inf_FSO1)
+
+        mtlpx_ld(Xmm0, Reax, Mecx, AJ0)
+        addps_ld(Xmm0, Medx, AJ0)
+        movpx_st(Xmm0, Medx, AJ0)
+
+        movpx_ld(Xmm1, Medx, AJ1)
+        addps_ld(Xmm1, Mecx, AJ1)
+        mtlpx_st(Xmm1, Reax, Medx, AJ1)
+
+        subwx_mi(Mebp, inf_LOC, IB(1))
+        cmjwx_mz(Mebp, inf_LOC,
+        /* if */ GT_x, mtl_ini)
+
+        movxx_ld(Rebx, Mebp, inf_FSO2)
+        movwx_ri(Resi, IB(S + 3))
+        mtlpx_ld(Xmm2, Resi, Mecx, AJ0)
+        movpx_st(Xmm2, Mebx, AJ0)
+        movwx_ri(Resi, IB(0))
+        mtlpx_st(Xmm2, Resi, Mebx, AJ1)
+        movwx_ri(Resi, IB(S - 1))
+        mtlpx_ld(Xmm3, Resi, Mecx, AJ2)
+        movpx_st(Xmm3, Mebx, AJ2)
+        movwx_ri(Resi, IB(0))
+        mtlpx_st(Xmm3, Resi, Medx, AJ2)
+
+        ASM_LEAVE(info)
+    }
+}
+
+rt_void p_test34(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = info->size;
+
+    rt_real *far0 = info->far0;
+    rt_real *fco1 = info->fco1;
+    rt_real *fco2 = info->fco2;
+    rt_real *fso1 = info->fso1;
+    rt_real *fso2 = info->fso2;
+
+    j = n;
+    while (j-->0)
+    {
+        if (FEQ(fco1[j], fso1[j]) && FEQ(fco2[j], fso2[j]) && !v_mode)
+        {
+            continue;
+        }
+
+        RT_LOGI("farr[%d] = %e\n",
+                j, far0[j]);
+
+        RT_LOGI("C mtl1[%d] = %e, mtl2[%d] = %e\n",
+                j, fco1[j], j, fco2[j]);
+
+        RT_LOGI("S mtl1[%d] = %e, mtl2[%d] = %e\n",
+                j, fso1[j], j, fso2[j]);
+    }
+}
+
+#endif /* RUN_LEVEL 34 */
+
+/******************************************************************************/
+/******************************   RUN LEVEL 35   ******************************/
+/******************************************************************************/
+
+#if RUN_LEVEL >= 35
+
+#define BND_SIZE            (16*1024*1024) /* elems per array, beyond LLC */
+#define BND_PASS            4 /* passes over arrays per store flavour */
+
+rt_void c_test35(rt_SIMD_INFOX *info)
+{
+    rt_si32 i, j, n = info->size;
+
+    rt_real *far0 = info->far0;
+    rt_real *fco1 = info->fco1;
+    rt_real *fco2 = info->fco2;
+
+    i = info->cyc;
+    while (i-->0)
+    {
+        j = n;
+        while (j-->0)
+        {
+            fco1[j] = far0[j];
+            fco2[j] = far0[j];
+        }
+    }
+}
+
+/*
+ * Streaming stores (stn) and prefetch (prf) are checked here against
+ * regular stores on the test arrays, while m_test35/n_test35 below copy
+ * the same way through arrays well beyond the LLC, which p_test35 times
+ * to report the bandwidth of regular and streaming stores in MB/s.
+ */
+rt_void s_test35(rt_SIMD_INFOX *info)
+{
+    ASM_ENTER(info)
+
+        movwx_ld(Reax, Mebp, inf_CYC)
+        movwx_st(Reax, Mebp, inf_LOC)
+
+    LBL(stn_cyc)
+
+        movxx_ld(Recx, Mebp, inf_FAR0)
+        movxx_ld(Rebx, Mebp, inf_FSO1)
+        movxx_ld(Resi, Mebp, inf_FSO2)
+        movwx_ld(Redi, Mebp, inf_SIZE)
+
+    LBL(stn_loc)
+
+        prfxx_ld(Mecx, DP(Q*0x40), PF_NT)
+        movpx_ld(Xmm0, Mecx, AJ0)
+        stnpx_st(Xmm0, Mebx, AJ0)
+        movpx_st(Xmm0, Mesi, AJ0)
+
+        addxx_ri(Recx, IM(Q*0x10))
+        addxx_ri(Rebx, IM(Q*0x10))
+        addxx_ri(Resi, IM(Q*0x10))
+        subwx_ri(Redi, IB(S))
+        cmjwx_rz(Redi,
+        /* if */ GT_x, stn_loc)
+
+        subwx_mi(Mebp, inf_LOC, IB(1))
+        cmjwx_mz(Mebp, inf_LOC,
+        /* if */ GT_x, stn_cyc)
+
+    ASM_LEAVE(info)
+}
+
+rt_void m_test35(rt_SIMD_INFOX *info)
+{
+    ASM_ENTER(info)
+
+        movwx_ld(Reax, Mebp, inf_CYC)
+        movwx_st(Reax, Mebp, inf_LOC)
+
+    LBL(mbw_cyc)
+
+        movxx_ld(Recx, Mebp, inf_FAR0)
+        movxx_ld(Rebx, Mebp, inf_FSO1)
+        movwx_ld(Redi, Mebp, inf_SIZE)
+
+    LBL(mbw_loc)
+
+        movpx_ld(Xmm0, Mecx, AJ0)
+        movpx_ld(Xmm1, Mecx, AJ1)
+        movpx_st(Xmm0, Mebx, AJ0)
+        movpx_st(Xmm1, Mebx, AJ1)
+
+        addxx_ri(Recx, IM(Q*0x20))
+        addxx_ri(Rebx, IM(Q*0x20))
+        subwx_ri(Redi, IB(S*2))
+        cmjwx_rz(Redi,
+        /* if */ GT_x, mbw_loc)
+
+        subwx_mi(Mebp, inf_LOC, IB(1))
+        cmjwx_mz(Mebp, inf_LOC,
+        /* if */ GT_x, mbw_cyc)
+
+    ASM_LEAVE(info)
+}
+
+rt_void n_test35(rt_SIMD_INFOX *info)
+{
+    ASM_ENTER(info)
+
+        movwx_ld(Reax, Mebp, inf_CYC)
+        movwx_st(Reax, Mebp, inf_LOC)
+
+    LBL(nbw_cyc)
+
+        movxx_ld(Recx, Mebp, inf_FAR0)
+        movxx_ld(Rebx, Mebp, inf_FSO1)
+        movwx_ld(Redi, Mebp, inf_SIZE)
+
+    LBL(nbw_loc)
+
+        prfxx_ld(Mecx, DP(Q*0x100), PF_NT)
+        movpx_ld(Xmm0, Mecx, AJ0)
+        movpx_ld(Xmm1, Mecx, AJ1)
+        stnpx_st(Xmm0, Mebx, AJ0)
+        stnpx_st(Xmm1, Mebx, AJ1)
+
+        addxx_ri(Recx, IM(Q*0x20))
+        addxx_ri(Rebx, IM(Q*0x20))
+        subwx_ri(Redi, IB(S*2))
+        cmjwx_rz(Redi,
+        /* if */ GT_x, nbw_loc)
+
+        subwx_mi(Mebp, inf_LOC, IB(1))
+        cmjwx_mz(Mebp, inf_LOC,
+        /* if */ GT_x, nbw_cyc)
+
+    ASM_LEAVE(info)
+}
+
+rt_void p_test35(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = info->size;
+
+    rt_real *far0 = info->far0;
+    rt_real *fco1 = info->fco1;
+    rt_real *fco2 = info->fco2;
+    rt_real *fso1 = info->fso1;
+    rt_real *fso2 = info->fso2;
+
+    j = n;
+    while (j-->0)
+    {
+        if (FEQ(fco1[j], fso1[j]) && FEQ(fco2[j], fso2[j]) && !v_mode)
+        {
+            continue;
+        }
+
+        RT_LOGI("farr[%d] = %e\n",
+                j, far0[j]);
+
+        RT_LOGI("C stn[%d] = %e, mov[%d] = %e\n",
+                j, fco1[j], j, fco2[j]);
+
+        RT_LOGI("S stn[%d] = %e, mov[%d] = %e\n",
+                j, fso1[j], j, fso2[j]);
+    }
+
+    rt_size size = BND_SIZE * sizeof(rt_real) + MASK;
+    rt_pntr bsrc = sys_alloc(size);
+    rt_pntr bdst = sys_alloc(size);
+
+    rt_real *bsr0 = (rt_real *)(((rt_full)bsrc + MASK) & ~MASK);
+    rt_real *bds0 = (rt_real *)(((rt_full)bdst + MASK) & ~MASK);
+
+    memset(bsr0, 0, BND_SIZE * sizeof(rt_real));
+    memset(bds0, 0, BND_SIZE * sizeof(rt_real));
+
+    rt_si32 cyc = info->cyc;
+
+    info->far0 = bsr0;
+    info->fso1 = bds0;
+    info->size = BND_SIZE;
+    info->cyc  = BND_PASS;
+
+    rt_time time1 = 0;
+    rt_time time2 = 0;
+    rt_time tM = 0;
+    rt_time tN = 0;
+
+    time1 = get_nsec();
+
+    m_test35(info);
+
+    time2 = get_nsec();
+    tM = time2 - time1;
+
+    time1 = get_nsec();
+
+    n_test35(info);
+
+    time2 = get_nsec();
+    tN = time2 - time1;
+
+    info->far0 = far0;
+    info->fso1 = fso1;
+    info->size = n;
+    info->cyc  = cyc;
+
+    sys_free(bdst, size);
+    sys_free(bsrc, size);
+
+    /* bytes read plus bytes written per pass, time in ns */
+    rt_fp64 mb = 2.0 * BND_SIZE * sizeof(rt_real) * BND_PASS / 1000000.0;
+
+    RT_LOGI("Call S = %.0f MB/s with movpx_st, %.0f MB/s with stnpx_st\n",
+            mb * 1e9 / RT_MAX(tM, 1), mb * 1e9 / RT_MAX(tN, 1));
+}
+
+#endif /* RUN_LEVEL 35 */
+
+/******************************************************************************/
+/******************************   RUN LEVEL 36   ******************************/
+/******************************************************************************/
+
+#if RUN_LEVEL >= 36
+
+#define THR_SIZE            (4*1024*1024) /* elems per array, for timing */
+#define THR_STEP            (64*1024) /* elems per chunk of thread-pool */
+#define THR_PASS            8 /* passes over arrays per timing */
+
+rt_void c_test36(rt_SIMD_INFOX *info)
+{
+    rt_si32 i, j, n = info->size;
+
+    rt_real *far0 = info->far0;
+    rt_real *fco1 = info->fco1;
+    rt_real *fco2 = info->fco2;
+
+    i = info->cyc;
+    while (i-->0)
+    {
+        j = n;
+        while (j-->0)
+        {
+            fco1[j] = far0[j] * far0[j] + far0[j];
+            fco2[j] = far0[j] * far0[j] - far0[j];
+        }
+    }
+}
+
+/*
+ * Kernel below walks "size" elements of its arrays (whole SIMD vectors)
+ * and is run by t_task36 on per-thread contexts of the thread-pool (rtpool.h)
+ * for each chunk of the index range, so that s_test36 checks the results
+ * of chunks computed across threads, while p_test36 times the same kernel
+ * on arrays beyond the LLC on a single thread and across the thread-pool.
+ */
+rt_void k_test36(rt_SIMD_INFOX *info)
+{
+    ASM_ENTER(info)
+
+        movwx_ld(Reax, Mebp, inf_CYC)
+        movwx_st(Reax, Mebp, inf_LOC)
+
+    LBL(thr_cyc)
+
+        movxx_ld(Recx, Mebp, inf_FAR0)
+        movxx_ld(Redx, Mebp, inf_FSO1)
+        movxx_ld(Rebx, Mebp, inf_FSO2)
+        movwx_ld(Redi, Mebp, inf_SIZE)
+
+    LBL(thr_loc)
+
+        movpx_ld(Xmm0, Mecx, AJ0)
+        movpx_rr(Xmm1, Xmm0)
+        mulps_rr(Xmm1, Xmm0)
+        movpx_rr(Xmm2, Xmm1)
+        addps_rr(Xmm2, Xmm0)
+        subps_rr(Xmm1, Xmm0)
+        movpx_st(Xmm2, Medx, AJ0)
+        movpx_st(Xmm1, Mebx, AJ0)
+
+        addxx_ri(Recx, IM(Q*0x10))
+        addxx_ri(Redx, IM(Q*0x10))
+        addxx_ri(Rebx, IM(Q*0x10))
+        arjxx_ri(Redi, IB(S),
+        sub_x,   NZ_x, thr_loc)
+
+        arjwx_mi(Mebp, inf_LOC, IB(1),
+        sub_x,   NZ_x, thr_cyc)
+
+    ASM_LEAVE(info)
+}
+
+/*
+ * Set up worker's context "info" for chunk [from, to) of arrays from "data"
+ * (info of the calling thread) and run the kernel.
+ */
+rt_void t_task36(rt_SIMD_INFO *info, rt_size from, rt_size to, rt_pntr data)
+{
+    rt_SIMD_INFOX *inf0 = (rt_SIMD_INFOX *)data;
+    rt_SIMD_INFOX *inf1 = (rt_SIMD_INFOX *)info;
+
+    inf1->far0 = inf0->far0 + from;
+    inf1->fso1 = inf0->fso1 + from;
+    inf1->fso2 = inf0->fso2 + from;
+    inf1->size = (rt_si32)(to - from);
+    inf1->cyc  = inf0->cyc;
+
+    k_test36(inf1);
+}
+
+rt_void s_test36(rt_SIMD_INFOX *info)
+{
+    pool_run(t_pool, t_task36, info, info->size, S);
+}
+
+rt_void p_test36(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = info->size;
+
+    rt_real *far0 = info->far0;
+    rt_real *fco1 = info->fco1;
+    rt_real *fco2 = info->fco2;
+    rt_real *fso1 = info->fso1;
+    rt_real *fso2 = info->fso2;
+
+    j = n;
+    while (j-->0)
+    {
+        if (FEQ(fco1[j], fso1[j]) && FEQ(fco2[j], fso2[j]) && !v_mode)
+        {
+            continue;
+        }
+
+        RT_LOGI("farr[%d] = %e\n",
+                j, far0[j]);
+
+        RT_LOGI("C farr*farr+farr[%d] = %e, farr*farr-farr[%d] = %e\n",
+                j, fco1[j], j, fco2[j]);
+
+        RT_LOGI("S farr*farr+farr[%d] = %e, farr*farr-farr[%d] = %e\n",
+                j, fso1[j], j, fso2[j]);
+    }
+
+    rt_size size = THR_SIZE * sizeof(rt_real) * 3 + MASK;
+    rt_pntr barr = sys_alloc(size);
+
+    rt_real *bar0 = (rt_real *)(((rt_full)barr + MASK) & ~MASK);
+
+    memset(bar0, 0, THR_SIZE * sizeof(rt_real) * 3);
+
+    rt_si32 cyc = info->cyc;
+
+    info->far0 = bar0 + THR_SIZE * 0;
+    info->fso1 = bar0 + THR_SIZE * 1;
+    info->fso2 = bar0 + THR_SIZE * 2;
+    info->size = THR_SIZE;
+    info->cyc  = 1;
+
+    rt_time time1 = 0;
+    rt_time time2 = 0;
+    rt_time tK = 0;
+    rt_time tT = 0;
+
+    k_test36(info);
+
+    info->cyc  = THR_PASS;
+
+    time1 = get_nsec();
+
+    k_test36(info);
+
+    time2 = get_nsec();
+    tK = time2 - time1;
+
+    info->cyc  = 1;
+
+    time1 = get_nsec();
+
+    for (j = 0; j < THR_PASS; j++)
+    {
+        pool_run(t_pool, t_task36, info, THR_SIZE, THR_STEP);
+    }
+
+    time2 = get_nsec();
+    tT = time2 - time1;
+
+    info->far0 = far0;
+    info->fso1 = fso1;
+    info->fso2 = fso2;
+    info->size = n;
+    info->cyc  = cyc;
+
+    sys_free(barr, size);
+
+    RT_LOGI("Call S = %.3f ms on 1 thread, %.3f ms on %d threads\n",
+            tK / 1000000.0, tT / 1000000.0, t_pool->count);
+}
+
+#endif /* RUN_LEVEL 36 */
+
+/******************************************************************************/
+/******************************   RUN LEVEL 37   ******************************/
+/******************************************************************************/
+
+#if RUN_LEVEL >= 37
+
+rt_void c_test37(rt_SIMD_INFOX *info)
+{
+    rt_si32 i, j, n = info->size;
+
+    rt_real *far0 = info->far0;
+    rt_real *fco1 = info->fco1;
+    rt_real *fco2 = info->fco2;
+
+    i = info->cyc;
+    while (i-->0)
+    {
+        j = n;
+        while (j-->0)
+        {
+            rt_real y = RT_LOG(far0[j]);
+            fco1[j] = RT_TAN(RT_EXP(-far0[j])) + y;
+            fco2[j] = RT_ATAN2(RT_SIN(y), RT_COS(y)) + RT_SIN(y) * RT_COS(y);
+        }
+    }
+}
+
+/*
+ * Transcendental instructions are chained here to keep their arguments
+ * within the documented ranges for all values of farr: exp(-farr) feeds tan,
+ * while log(farr) feeds sin and cos, whose results are combined with at2
+ * (recovering log(farr) wrapped to [-pi, +pi]) and with snc.
+ */
+rt_void s_test37(rt_SIMD_INFOX *info)
+{
+    rt_si32 i;
+
+    i = info->cyc;
+    while (i-->0)
+    {
+        ASM_ENTER(info)
+
+        movxx_ld(Recx, Mebp, inf_FAR0)
+        movxx_ld(Redx, Mebp, inf_FSO1)
+        movxx_ld(Rebx, Mebp, inf_FSO2)
+
+        movpx_ld(Xmm0, Mecx, AJ0)
+        logps_rr(Xmm1, Xmm5, Xmm6, Xmm0) /* destroys Xmm5, Xmm6 */
+        negps_rx(Xmm0)
+        expps_rr(Xmm2, Xmm5, Xmm6, Xmm0) /* destroys Xmm5, Xmm6 */
+        tanps_rr(Xmm3, Xmm5, Xmm6, Xmm2) /* destroys Xmm5, Xmm6 */
+        addps_rr(Xmm3, Xmm1)
+        movpx_st(Xmm3, Medx, AJ0)
+        sinps_rr(Xmm2, Xmm5, Xmm6, Xmm1) /* destroys Xmm5, Xmm6 */
+        cosps_rr(Xmm3, Xmm5, Xmm6, Xmm1) /* destroys Xmm5, Xmm6 */
+        at2ps_rr(Xmm4, Xmm5, Xmm6, Xmm2, Xmm3) /* destroys Xmm5, Xmm6 */
+        sncps_rr(Xmm2, Xmm3, Xmm5, Xmm6, Xmm1) /* destroys Xmm5, Xmm6 */
+        mulps_rr(Xmm2, Xmm3)
+        addps_rr(Xmm4, Xmm2)
+        movpx_st(Xmm4, Mebx, AJ0)
+
+        movpx_ld(Xmm0, Mecx, AJ1)
+        logps_rr(Xmm1, Xmm5, Xmm6, Xmm0) /* destroys Xmm5, Xmm6 */
+        negps_rx(Xmm0)
+        expps_rr(Xmm2, Xmm5, Xmm6, Xmm0) /* destroys Xmm5, Xmm6 */
+        tanps_rr(Xmm3, Xmm5, Xmm6, Xmm2) /* destroys Xmm5, Xmm6 */
+        addps_rr(Xmm3, Xmm1)
+        movpx_st(Xmm3, Medx, AJ1)
+        sinps_rr(Xmm2, Xmm5, Xmm6, Xmm1) /* destroys Xmm5, Xmm6 */
+        cosps_rr(Xmm3, Xmm5, Xmm6, Xmm1) /* destroys Xmm5, Xmm6 */
+        at2ps_rr(Xmm4, Xmm5, Xmm6, Xmm2, Xmm3) /* destroys Xmm5, Xmm6 */
+        sncps_rr(Xmm2, Xmm3, Xmm5, Xmm6, Xmm1) /* destroys Xmm5, Xmm6 */
+        mulps_rr(Xmm2, Xmm3)
+        addps_rr(Xmm4, Xmm2)
+        movpx_st(Xmm4, Mebx, AJ1)
+
+        movpx_ld(Xmm0, Mecx, AJ2)
+        logps_rr(Xmm1, Xmm5, Xmm6, Xmm0) /* destroys Xmm5, Xmm6 */
+        negps_rx(Xmm0)
+        expps_rr(Xmm2, Xmm5, Xmm6, Xmm0) /* destroys Xmm5, Xmm6 */
+        tanps_rr(Xmm3, Xmm5, Xmm6, Xmm2) /* destroys Xmm5, Xmm6 */
+        addps_rr(Xmm3, Xmm1)
+        movpx_st(Xmm3, Medx, AJ2)
+        sinps_rr(Xmm2, Xmm5, Xmm6, Xmm1) /* destroys Xmm5, Xmm6 */
+        cosps_rr(Xmm3, Xmm5, Xmm6, Xmm1) /* destroys Xmm5, Xmm6 */
+        at2ps_rr(Xmm4, Xmm5, Xmm6, Xmm2, Xmm3) /* destroys Xmm5, Xmm6 */
+        sncps_rr(Xmm2, Xmm3, Xmm5, Xmm6, Xmm1) /* destroys Xmm5, Xmm6 */
+        mulps_rr(Xmm2, Xmm3)
+        addps_rr(Xmm4, Xmm2)
+        movpx_st(Xmm4, Mebx, AJ2)
+
+        ASM_LEAVE(info)
+    }
+}
+
+rt_void p_test37(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = info->size;
+
+    rt_real *far0 = info->far0;
+    rt_real *fco1 = info->fco1;
+    rt_real *fco2 = info->fco2;
+    rt_real *fso1 = info->fso1;
+    rt_real *fso2 = info->fso2;
+
+    j = n;
+    while (j-->0)
+    {
+        if (FEQ(fco1[j], fso1[j]) && FEQ(fco2[j], fso2[j]) && !v_mode)
+        {
+            continue;
+        }
+
+        RT_LOGI("farr[%d] = %e\n",
+                j, far0[j]);
+
+        RT_LOGI("C tan(exp(-farr))+log(farr)[%d] = %e, "
+                    "at2(sin,cos)+sin*cos(log(farr))[%d] = %e\n",
+                j, fco1[j], j, fco2[j]);
+
+        RT_LOGI("S tan(exp(-farr))+log(farr)[%d] = %e, "
+                    "at2(sin,cos)+sin*cos(log(farr))[%d] = %e\n",
+                j, fso1[j], j, fso2[j]);
+    }
+}
+
+#endif /* RUN_LEVEL 37 */
+
+/******************************************************************************/
+/******************************   RUN LEVEL 38   ******************************/
+/******************************************************************************/
+
+#if RUN_LEVEL >= 38
+
+#define RNG_SEED            ULL(0x0123456789ABCDEF)
+
+/*
+ * Scalar model of rng instructions, lane k of the generator is seeded
+ * from RNG_SEED and k as in rng_seed, then advanced by its step per call.
+ */
+rt_elem rng_test38(rt_si32 k, rt_si32 call)
+{
+    rt_ui64 z = RNG_SEED + (rt_ui64)(2*k + 1) * ULL(0x9E3779B97F4A7C15);
+
+#if   RT_ELEMENT == 32
+    rt_ui32 s = (rt_ui32)(rng_mix64(z) >> 32);
+    rt_ui32 g = (rt_ui32)(rng_mix64(z + ULL(0x9E3779B97F4A7C15)) >> 32) | 1;
+
+    s = s + (rt_ui32)(call + 1) * g;
+    s = (s ^ (s >> 16)) * 0x85EBCA6B;
+    s = (s ^ (s >> 13)) * 0xC2B2AE35;
+    return (rt_elem)(s ^ (s >> 16));
+#elif RT_ELEMENT == 64
+    rt_ui64 s = rng_mix64(z);
+    rt_ui64 g = rng_mix64(z + ULL(0x9E3779B97F4A7C15)) | 1;
+
+    return (rt_elem)rng_mix64(s + (rt_ui64)(call + 1) * g);
+#endif /* RT_ELEMENT */
+}
+
+rt_void c_test38(rt_SIMD_INFOX *info)
+{
+    rt_si32 i, j, n = info->size;
+
+    rt_elem *ico1 = info->ico1;
+    rt_real *fco2 = info->fco2;
+
+    i = info->cyc;
+    while (i-->0)
+    {
+        j = n;
+        while (j-->0)
+        {
+            rt_uelm r = (rt_uelm)rng_test38(j % S, (j / S) * 2 + 1);
+            rt_si32 m = RT_ELEMENT == 32 ? 23 : 52;
+
+            ico1[j] = rng_test38(j % S, (j / S) * 2 + 0);
+            fco2[j] = (rt_real)(r >> (RT_ELEMENT - m));
+            fco2[j] = fco2[j] / (rt_real)((rt_uelm)1 << m);
+        }
+    }
+}
+
+/*
+ * Generator is reseeded before each ASM section to produce the same output
+ * on every cycle, bits and fp values are taken from alternating calls.
+ */
+rt_void s_test38(rt_SIMD_INFOX *info)
+{
+    rt_si32 i;
+
+    i = info->cyc;
+    while (i-->0)
+    {
+        rng_seed(info, RNG_SEED);
+
+        ASM_ENTER(info)
+
+        movxx_ld(Redx, Mebp, inf_ISO1)
+        movxx_ld(Rebx, Mebp, inf_FSO2)
+
+        rngpx_rr(Xmm0, Xmm1) /* destroys Xmm1 */
+        rngps_rr(Xmm2, Xmm1) /* destroys Xmm1 */
+        movpx_st(Xmm0, Medx, AJ0)
+        movpx_st(Xmm2, Mebx, AJ0)
+
+        rngpx_rr(Xmm0, Xmm1) /* destroys Xmm1 */
+        rngps_rr(Xmm2, Xmm1) /* destroys Xmm1 */
+        movpx_st(Xmm0, Medx, AJ1)
+        movpx_st(Xmm2, Mebx, AJ1)
+
+        rngpx_rr(Xmm0, Xmm1) /* destroys Xmm1 */
+        rngps_rr(Xmm2, Xmm1) /* destroys Xmm1 */
+        movpx_st(Xmm0, Medx, AJ2)
+        movpx_st(Xmm2, Mebx, AJ2)
+
+        ASM_LEAVE(info)
+    }
+}
+
+rt_void p_test38(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = info->size;
+
+    rt_elem *ico1 = info->ico1;
+    rt_real *fco2 = info->fco2;
+    rt_elem *iso1 = info->iso1;
+    rt_real *fso2 = info->fso2;
+
+    j = n;
+    while (j-->0)
+    {
+        if (IEQ(ico1[j], iso1[j]) && FEQ(fco2[j], fso2[j]) && !v_mode)
+        {
+            continue;
+        }
+
+        RT_LOGI("C rngpx[%d] = %" PR_L "d, rngps[%d] = %e\n",
+                j, ico1[j], j, fco2[j]);
+
+        RT_LOGI("S rngpx[%d] = %" PR_L "d, rngps[%d] = %e\n",
+                j, iso1[j], j, fso2[j]);
+    }
+}
+
+#endif /* RUN_LEVEL 38 */
+
+/******************************************************************************/
+/******************************   RUN LEVEL 39   ******************************/
+/******************************************************************************/
+
+#if RUN_LEVEL >= 39
+
+/*
+ * Special fp32 inputs for fp16 converters: signed zeros, fp16 max and
+ * its rounding ties, smallest denormals and ties, infinities, quiet NaNs.
+ */
+rt_ui32 f16_spec39[16] =
+{
+    0x00000000, 0x80000000, 0x3F800000, 0x477FE000,
+    0x477FF000, 0x477FEFFF, 0x33800000, 0x33000000,
+    0x33000001, 0x38800000, 0x387FC000, 0x7F800000,
+    0xFF800000, 0x7FC00000, 0xFFC00000, 0xC0490FDB,
+};
+
+/*
+ * Input fp32 bits for lane k, exponents span fp16 denormals to overflows,
+ * every fifth mantissa is a rounding tie.
+ */
+rt_ui32 f16_input39(rt_si32 k)
+{
+    rt_ui32 e, m;
+
+    if (k < 16)
+    {
+        return f16_spec39[k];
+    }
+
+    e = 100 + (rt_ui32)(k * 7) % 44;
+    m = ((rt_ui32)k * 0x9E3779B1) & 0x007FFFFF;
+    m = k % 5 == 0 ? (m & 0x007FE000) | 0x1000 : m;
+
+    return ((rt_ui32)(k & 1) << 31) | (e << 23) | m;
+}
+
+/*
+ * Round (v >> sh) to nearest even.
+ */
+rt_ui32 f16_round39(rt_ui32 v, rt_ui32 sh)
+{
+    rt_ui32 r = v >> sh, h = 1 << (sh - 1), t = v & ((h << 1) - 1);
+
+    return r + (t > h || (t == h && (r & 1)));
+}
+
+/*
+ * Scalar model of cvx (fp32 to fp16 bits), NaN gives canonical quiet NaN.
+ */
+rt_half f16_cvx39(rt_ui32 f)
+{
+    rt_ui32 s = (f >> 16) & 0x8000, e = (f >> 23) & 0xFF, m = f & 0x7FFFFF;
+    rt_ui32 r;
+
+    if (e == 0xFF)
+    {
+        return (rt_half)(s | (m != 0 ? 0x7E00 : 0x7C00));
+    }
+    if (e > 112)
+    {
+        r = ((e - 112) << 10) + f16_round39(m, 13);
+        r = RT_MIN(r, 0x7C00);
+    }
+    else
+    {
+        r = 126 - e > 25 ? 0 : f16_round39(m | 0x800000, 126 - e);
+    }
+
+    return (rt_half)(s | r);
+}
+
+/*
+ * Scalar model of cvy (fp16 to fp32 bits), conversion is exact.
+ */
+rt_ui32 f16_cvy39(rt_half h)
+{
+    rt_ui32 s = (rt_ui32)(h & 0x8000) << 16;
+    rt_ui32 e = (h >> 10) & 0x1F, m = h & 0x3FF;
+
+    if (e == 0x1F)
+    {
+        return s | 0x7F800000 | (m << 13);
+    }
+    if (e == 0)
+    {
+        if (m == 0)
+        {
+            return s;
+        }
+        e = 1;
+        while ((m & 0x400) == 0)
+        {
+            m <<= 1;
+            e--;
+        }
+        m &= 0x3FF;
+    }
+
+    return s | ((e + 112) << 23) | (m << 13);
+}
+
+/*
+ * Arrays are viewed as fixed-32-bit lanes (Q*4 per SIMD register) regardless
+ * of RT_ELEMENT, 3 registers of inputs are narrowed into 1.5 registers of
+ * fp16 (upper half of the second one is zeroed) and widened back.
+ */
+rt_void c_test39(rt_SIMD_INFOX *info)
+{
+    rt_si32 i, k, m = Q*12;
+
+    rt_half *ico1 = (rt_half *)info->ico1;
+    rt_ui32 *ico2 = (rt_ui32 *)info->ico2;
+
+    i = info->cyc;
+    while (i-->0)
+    {
+        k = Q*16;
+        while (k-->0)
+        {
+            ico1[k] = k < m ? f16_cvx39(f16_input39(k)) : 0;
+        }
+        k = m;
+        while (k-->0)
+        {
+            ico2[k] = f16_cvy39(ico1[k]);
+        }
+    }
+}
+
+rt_void s_test39(rt_SIMD_INFOX *info)
+{
+    rt_si32 i, k, m = Q*12;
+
+    rt_ui32 *fso1 = (rt_ui32 *)info->fso1;
+
+    k = m;
+    while (k-->0)
+    {
+        fso1[k] = f16_input39(k);
+    }
+
+    i = info->cyc;
+    while (i-->0)
+    {
+        ASM_ENTER(info)
+
+        movxx_ld(Recx, Mebp, inf_FSO1)
+        movxx_ld(Redx, Mebp, inf_ISO1)
+        movxx_ld(Rebx, Mebp, inf_ISO2)
+
+        movox_ld(Xmm0, Mecx, AJ0)
+        movox_ld(Xmm1, Mecx, AJ1)
+        cvxos_rr(Xmm2, Xmm0)
+        cuxos_rr(Xmm2, Xmm1)
+        movmx_st(Xmm2, Medx, AJ0)
+
+        movox_ld(Xmm0, Mecx, AJ2)
+        cvxos_rr(Xmm2, Xmm0)
+        movmx_st(Xmm2, Medx, AJ1)
+
+        movmx_ld(Xmm5, Medx, AJ0)
+        cvyms_rr(Xmm3, Xmm5)
+        cuyms_rr(Xmm4, Xmm5)
+        movox_st(Xmm3, Mebx, AJ0)
+        movox_st(Xmm4, Mebx, AJ1)
+
+        movmx_ld(Xmm5, Medx, AJ1)
+        cvyms_rr(Xmm3, Xmm5)
+        movox_st(Xmm3, Mebx, AJ2)
+
+        ASM_LEAVE(info)
+    }
+}
+
+rt_void p_test39(rt_SIMD_INFOX *info)
+{
+    rt_si32 k, m = Q*12;
+
+    rt_half *ico1 = (rt_half *)info->ico1;
+    rt_ui32 *ico2 = (rt_ui32 *)info->ico2;
+    rt_half *iso1 = (rt_half *)info->iso1;
+    rt_ui32 *iso2 = (rt_ui32 *)info->iso2;
+
+    k = Q*16;
+    while (k-->0)
+    {
+        if (IEQ(ico1[k], iso1[k]) && (k >= m || IEQ(ico2[k], iso2[k]))
+        &&  !v_mode)
+        {
+            continue;
+        }
+
+        RT_LOGI("C cvxms[%d] = %04X, cvyms[%d] = %08X, in = %08X\n",
+                k, ico1[k], k, k < m ? ico2[k] : 0, k < m ? f16_input39(k) : 0);
+
+        RT_LOGI("S cvxms[%d] = %04X, cvyms[%d] = %08X, in = %08X\n",
+                k, iso1[k], k, k < m ? iso2[k] : 0, k < m ? f16_input39(k) : 0);
+    }
+}
+
+#endif /* RUN_LEVEL 39 */
+
+/******************************************************************************/
+/******************************   RUN LEVEL 40   ******************************/
+/******************************************************************************/
+
+#if RUN_LEVEL >= 40
+
+/*
+ * Special fp64 inputs for fp32 converters: signed zeros, fp32 max and
+ * its rounding ties, smallest denormals and ties, infinities, quiet NaNs,
+ * ordered so that 128-bit targets (6 lanes) still cover NaN, overflow
+ * and denormal ties.
+ */
+rt_ui64 f32_spec40[16] =
+{
+    ULL(0xFFF8000000000000), ULL(0x47EFFFFFF0000000),
+    ULL(0x3690000000000000), ULL(0x380FFFFFF0000000),
+    ULL(0xFFF0000000000000), ULL(0x3690000000000001),
+    ULL(0x8000000000000000), ULL(0x47EFFFFFEFFFFFFF),
+    ULL(0x36A0000000000000), ULL(0x7FF8000000000000),
+    ULL(0x3FF0000000000000), ULL(0x47EFFFFFE0000000),
+    ULL(0x3810000000000000), ULL(0x7FF0000000000000),
+    ULL(0x0000000000000000), ULL(0xC00921FB54442D18),
+};
+
+/*
+ * Input fp64 bits for lane k, exponents span fp32 denormals to overflows,
+ * every fifth mantissa is a rounding tie.
+ */
+rt_ui64 f32_input40(rt_si32 k)
+{
+    rt_ui64 e, m;
+
+    if (k < 16)
+    {
+        return f32_spec40[k];
+    }
+
+    e = 870 + (rt_ui64)(k * 13) % 290;
+    m = ((rt_ui64)k * ULL(0x9E3779B97F4A7C15)) & ULL(0x000FFFFFFFFFFFFF);
+    m = k % 5 == 0 ? (m & ULL(0x000FFFFFE0000000)) | 0x10000000 : m;
+
+    return ((rt_ui64)(k & 1) << 63) | (e << 52) | m;
+}
+
+/*
+ * Round (v >> sh) to nearest even.
+ */
+rt_ui64 f32_round40(rt_ui64 v, rt_ui32 sh)
+{
+    rt_ui64 r = v >> sh, h = (rt_ui64)1 << (sh - 1), t = v & ((h << 1) - 1);
+
+    return r + (t > h || (t == h && (r & 1)));
+}
+
+/*
+ * Scalar model of cvx (fp64 to fp32 bits), NaN gives canonical quiet NaN.
+ */
+rt_ui32 f32_cvx40(rt_ui64 d)
+{
+    rt_ui32 s = (rt_ui32)(d >> 32) & 0x80000000, e = (rt_ui32)(d >> 52) & 0x7FF;
+    rt_ui64 m = d & ULL(0x000FFFFFFFFFFFFF), r;
+
+    if (e == 0x7FF)
+    {
+        return s | (m != 0 ? 0x7FC00000 : 0x7F800000);
+    }
+    if (e > 896)
+    {
+        r = ((rt_ui64)(e - 896) << 23) + f32_round40(m, 29);
+        r = RT_MIN(r, 0x7F800000);
+    }
+    else
+    {
+        m = m | ULL(0x0010000000000000);
+        r = 926 - e > 53 ? 0 : f32_round40(m, 926 - e);
+    }
+
+    return s | (rt_ui32)r;
+}
+
+/*
+ * Scalar model of cvy (fp32 to fp64 bits), conversion is exact.
+ */
+rt_ui64 f32_cvy40(rt_ui32 f)
+{
+    rt_ui64 s = (rt_ui64)(f & 0x80000000) << 32;
+    rt_ui64 e = (f >> 23) & 0xFF, m = f & 0x7FFFFF;
+
+    if (e == 0xFF)
+    {
+        return s | ULL(0x7FF0000000000000) | (m << 29) |
+                   (m != 0 ? ULL(0x0008000000000000) : 0);
+    }
+    if (e == 0)
+    {
+        if (m == 0)
+        {
+            return s;
+        }
+        e = 1;
+        while ((m & 0x800000) == 0)
+        {
+            m <<= 1;
+            e--;
+        }
+        m &= 0x7FFFFF;
+    }
+
+    return s | ((e + 896) << 52) | (m << 29);
+}
+
+/*
+ * NaN payloads may differ between generic and native forms,
+ * NaNs of the same sign compare equal.
+ */
+rt_bool f32_eq40(rt_ui32 a, rt_ui32 b)
+{
+    return a == b || (((a ^ b) & 0x80000000) == 0 &&
+           (a & 0x7FFFFFFF) > 0x7F800000 && (b & 0x7FFFFFFF) > 0x7F800000);
+}
+
+rt_bool f64_eq40(rt_ui64 a, rt_ui64 b)
+{
+    rt_ui64 n = ULL(0x7FF0000000000000), x = ULL(0x7FFFFFFFFFFFFFFF);
+
+    return a == b || ((a ^ b) <= x && (a & x) > n && (b & x) > n);
+}
+
+/*
+ * Arrays are viewed as fixed-64-bit lanes (Q*2 per SIMD register) regardless
+ * of RT_ELEMENT, 3 registers of inputs are narrowed into 1.5 registers of
+ * fp32 (upper half of the second one is zeroed) and widened back.
+ * Targets without 64-bit SIMD subsets (x86, ARMv7) skip this test.
+ */
+rt_void c_test40(rt_SIMD_INFOX *info)
+{
+#if !(defined RT_X86) && !(defined RT_ARM)
+
+    rt_si32 i, k, m = Q*6;
+
+    rt_ui32 *ico1 = (rt_ui32 *)info->ico1;
+    rt_ui64 *ico2 = (rt_ui64 *)info->ico2;
+
+    i = info->cyc;
+    while (i-->0)
+    {
+        k = Q*8;
+        while (k-->0)
+        {
+            ico1[k] = k < m ? f32_cvx40(f32_input40(k)) : 0;
+        }
+        k = m;
+        while (k-->0)
+        {
+            ico2[k] = f32_cvy40(ico1[k]);
+        }
+    }
+
+#endif /* RT_X86, RT_ARM */
+}
+
+rt_void s_test40(rt_SIMD_INFOX *info)
+{
+#if !(defined RT_X86) && !(defined RT_ARM)
+
+    rt_si32 i, k, m = Q*6;
+
+    rt_ui64 *fso1 = (rt_ui64 *)info->fso1;
+
+    k = m;
+    while (k-->0)
+    {
+        fso1[k] = f32_input40(k);
+    }
+
+    i = info->cyc;
+    while (i-->0)
+    {
+        ASM_ENTER(info)
+
+        movxx_ld(Recx, Mebp, inf_FSO1)
+        movxx_ld(Redx, Mebp, inf_ISO1)
+        movxx_ld(Rebx, Mebp, inf_ISO2)
+
+        movqx_ld(Xmm0, Mecx, AJ0)
+        movqx_ld(Xmm1, Mecx, AJ1)
+        cvxqs_rr(Xmm2, Xmm0)
+        cuxqs_rr(Xmm2, Xmm1)
+        movox_st(Xmm2, Medx, AJ0)
+
+        movqx_ld(Xmm0, Mecx, AJ2)
+        cvxqs_rr(Xmm2, Xmm0)
+        movox_st(Xmm2, Medx, AJ1)
+
+        movox_ld(Xmm5, Medx, AJ0)
+        cvyos_rr(Xmm3, Xmm5)
+        cuyos_rr(Xmm4, Xmm5)
+        movqx_st(Xmm3, Mebx, AJ0)
+        movqx_st(Xmm4, Mebx, AJ1)
+
+        movox_ld(Xmm5, Medx, AJ1)
+        cvyos_rr(Xmm3, Xmm5)
+        movqx_st(Xmm3, Mebx, AJ2)
+
+        ASM_LEAVE(info)
+    }
+
+#endif /* RT_X86, RT_ARM */
+}
+
+rt_void p_test40(rt_SIMD_INFOX *info)
+{
+#if !(defined RT_X86) && !(defined RT_ARM)
+
+    rt_si32 k, m = Q*6;
+
+    rt_ui32 *ico1 = (rt_ui32 *)info->ico1;
+    rt_ui64 *ico2 = (rt_ui64 *)info->ico2;
+    rt_ui32 *iso1 = (rt_ui32 *)info->iso1;
+    rt_ui64 *iso2 = (rt_ui64 *)info->iso2;
+
+    k = Q*8;
+    while (k-->0)
+    {
+        if (f32_eq40(ico1[k], iso1[k])
+        &&  (k >= m || f64_eq40(ico2[k], iso2[k])) && !v_mode)
+        {
+            continue;
+        }
+
+        RT_LOGI("C cvxos[%d] = %08X, cvyos[%d] = %016" PR_Z "X, "
+                "in = %016" PR_Z "X\n", k, ico1[k],
+                k, k < m ? ico2[k] : 0, k < m ? f32_input40(k) : 0);
+
+        RT_LOGI("S cvxos[%d] = %08X, cvyos[%d] = %016" PR_Z "X, "
+                "in = %016" PR_Z "X\n", k, iso1[k],
+                k, k < m ? iso2[k] : 0, k < m ? f32_input40(k) : 0);
+    }
+
+#endif /* RT_X86, RT_ARM */
+}
+
+#endif /* RUN_LEVEL 40 */
+
+/******************************************************************************/
+/******************************   RUN LEVEL 41   ******************************/
+/******************************************************************************/
+
+#if RUN_LEVEL >= 41
+
+/*
+ * Special bytes for packed byte/half subsets, adjacent pairs also form
+ * special halves on little-endian targets: 0, -1, 0x7FFF, 0x8000, 0x00FF.
+ */
+rt_byte sub_spec41[32] =
+{
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x80,
+    0x01, 0x00, 0x80, 0xFF, 0x7F, 0x80, 0xFE, 0x01,
+    0xFF, 0x00, 0x00, 0x01, 0x7F, 0x00, 0x80, 0x00,
+    0x7F, 0xFF, 0x81, 0xFF, 0x00, 0x7F, 0x01, 0x80,
+};
+
+/*
+ * Special 32-bit inputs for narrowing converters, around half/byte limits.
+ */
+rt_ui32 sub_wspec41[16] =
+{
+    0x00000000, 0x0000FFFF, 0x00010000, 0x00007FFF,
+    0x00008000, 0xFFFF8000, 0xFFFF7FFF, 0xFFFFFFFF,
+    0x80000000, 0x7FFFFFFF, 0x000000FF, 0x00000100,
+    0x0000007F, 0x00000080, 0xFFFFFF80, 0xFFFFFF7F,
+};
+
+/*
+ * Input byte k of G (k < Q*16) or S (k >= Q*16), every third 32-bit lane
+ * of S repeats G to produce equal bytes and halves for compares.
+ */
+rt_byte sub_input41(rt_si32 k)
+{
+    rt_si32 j = k % (Q*16);
+
+    if (k >= Q*16 && (j / 4) % 3 == 0)
+    {
+        return sub_input41(j);
+    }
+    if (k < 32)
+    {
+        return sub_spec41[k];
+    }
+    if (k >= Q*16 && j < 32)
+    {
+        return sub_spec41[31 - j];
+    }
+    if (k % 7 == 0)
+    {
+        return sub_spec41[(k / 7) % 32];
+    }
+
+    return (rt_byte)(((rt_ui32)k * 0x9E3779B1) >> 24);
+}
+
+/*
+ * Input 32-bit lane k for narrowing converters.
+ */
+rt_ui32 sub_wide41(rt_si32 k)
+{
+    if (k < 16)
+    {
+        return sub_wspec41[k];
+    }
+
+    return (rt_ui32)((rt_si32)((rt_ui32)k * 0x9E3779B1) >> (k % 31));
+}
+
+enum
+{
+    ADD41, SUB41, ADS41, SBS41, MIN41, MAX41,
+    CEQ41, CNE41, CLT41, CLE41, CGT41, CGE41, SHL41, SHR41,
+};
+
+/*
+ * Scalar model of packed byte/half ops on a single w-bit lane,
+ * sg selects signed forms, b is a shift count for shl/shr.
+ */
+rt_ui32 sub_op41(rt_si32 op, rt_ui32 a, rt_ui32 b, rt_si32 w, rt_bool sg)
+{
+    rt_ui32 m = (1 << w) - 1, h = 1 << (w - 1);
+    rt_si32 x = sg ? (rt_si32)((a ^ h) - h) : (rt_si32)a;
+    rt_si32 y = sg ? (rt_si32)((b ^ h) - h) : (rt_si32)b;
+    rt_si32 lo = sg ? -(rt_si32)h : 0, hi = sg ? (rt_si32)h - 1 : (rt_si32)m;
+    rt_si32 r = 0;
+
+    switch (op)
+    {
+        case ADD41: r = x + y; break;
+        case SUB41: r = x - y; break;
+        case ADS41: r = RT_MIN(RT_MAX(x + y, lo), hi); break;
+        case SBS41: r = RT_MIN(RT_MAX(x - y, lo), hi); break;
+        case MIN41: r = RT_MIN(x, y); break;
+        case MAX41: r = RT_MAX(x, y); break;
+        case CEQ41: r = x == y ? -1 : 0; break;
+        case CNE41: r = x != y ? -1 : 0; break;
+        case CLT41: r = x <  y ? -1 : 0; break;
+        case CLE41: r = x <= y ? -1 : 0; break;
+        case CGT41: r = x >  y ? -1 : 0; break;
+        case CGE41: r = x >= y ? -1 : 0; break;
+        case SHL41: r = (rt_si32)(a << b); break;
+        case SHR41: r = sg ? x >> b : (rt_si32)(a >> b); break;
+    }
+
+    return (rt_ui32)r & m;
+}
+
+/*
+ * Apply op to all lanes of a SIMD register, count c is used if b is NULL.
+ */
+rt_void sub_lanes41(rt_byte *d, rt_si32 op, rt_si32 w, rt_bool sg,
+                    rt_byte *a, rt_byte *b, rt_ui32 c)
+{
+    rt_si32 k;
+
+    for (k = 0; k < Q*16 && w == 8; k++)
+    {
+        d[k] = (rt_byte)sub_op41(op, a[k], b ? b[k] : c, w, sg);
+    }
+    for (k = 0; k < Q*8 && w == 16; k++)
+    {
+        ((rt_half *)d)[k] = (rt_half)sub_op41(op, ((rt_half *)a)[k],
+                            b ? ((rt_half *)b)[k] : c, w, sg);
+    }
+}
+
+/*
+ * Pack results of 8 compares into lanes of one register (1st at bit 0),
+ * as done in s_test41 with shifts: D = (D >> 1) | (cmp << (w - 1)).
+ */
+rt_void sub_pack41(rt_byte *d, rt_si32 w, const rt_si32 *op,
+                   const rt_bool *sg, rt_byte *a, rt_byte *b)
+{
+    rt_byte t[Q*16];
+    rt_si32 i, k;
+
+    memset(d, 0, Q*16);
+    for (i = 0; i < 8; i++)
+    {
+        sub_lanes41(t, op[i], w, sg[i], a, b, 0);
+        for (k = 0; k < Q*16 && w == 8; k++)
+        {
+            d[k] = (rt_byte)((d[k] >> 1) | (t[k] & 0x80));
+        }
+        for (k = 0; k < Q*8 && w == 16; k++)
+        {
+            ((rt_half *)d)[k] = (rt_half)((((rt_half *)d)[k] >> 1) |
+                                          (((rt_half *)t)[k] & 0x8000));
+        }
+    }
+}
+
+rt_si32 sub_cmp1_41[8] = {CEQ41, CNE41, CLT41, CLT41, CLE41, CLE41,
+                          CGT41, CGT41};
+rt_bool sub_sgn1_41[8] = {0, 0, 0, 1, 0, 1, 0, 1};
+rt_si32 sub_cmp2_41[8] = {CGE41, CGE41, CEQ41, CNE41, CLT41, CLE41,
+                          CGT41, CGE41};
+rt_bool sub_sgn2_41[8] = {0, 1, 0, 0, 0, 1, 1, 0};
+
+/*
+ * Scalar model of narrowing converters, saturates w-bit lane v to w/2 bits.
+ */
+rt_ui32 sub_cvx41(rt_ui32 v, rt_si32 w, rt_bool sg)
+{
+    rt_ui32 h = 1 << (w / 2 - 1);
+    rt_si32 x = w == 16 ? (rt_si32)((v ^ 0x8000) - 0x8000) : (rt_si32)v;
+
+    if (sg)
+    {
+        return (rt_ui32)RT_MIN(RT_MAX(x, -(rt_si32)h), (rt_si32)h - 1)
+                        & (2 * h - 1);
+    }
+
+    return RT_MIN(v, 2 * h - 1);
+}
+
+#define SUB_GRP41   8
+#define SUB_OUT41   (Q*24) /* 6 registers of 32-bit lanes per group */
+
+rt_ui32 c_out41[SUB_GRP41][SUB_OUT41];
+rt_ui32 s_out41[SUB_GRP41][SUB_OUT41];
+
+/*
+ * Packed byte/half integer subsets (cmdpb_, cmdph_) and their converters,
+ * arrays are viewed as bytes (halves) regardless of RT_ELEMENT, G and S
+ * are registers 0 and 1 of inputs, register 2 holds 32-bit inputs.
+ * Each of 8 groups produces 6 registers of results, which are copied out
+ * of ISO1/ISO2 after each ASM section and compared together at the end.
+ */
+rt_void c_test41(rt_SIMD_INFOX *info)
+{
+    rt_si32 i, k, w, g;
+
+    rt_byte *fco1 = (rt_byte *)info->fco1;
+    rt_byte *a = fco1, *b = fco1 + Q*16, *u = fco1 + Q*32, *d;
+
+    rt_half *h6 = (rt_half *)c_out41[6], *h7 = (rt_half *)c_out41[7];
+    rt_ui32 *w6 = (rt_ui32 *)c_out41[6], *w7 = (rt_ui32 *)c_out41[7];
+
+    k = Q*32;
+    while (k-->0)
+    {
+        fco1[k] = sub_input41(k);
+    }
+    k = Q*4;
+    while (k-->0)
+    {
+        ((rt_ui32 *)fco1)[Q*8 + k] = sub_wide41(k);
+    }
+
+    i = info->cyc;
+    while (i-->0)
+    {
+        for (g = 0; g < 6; g++)
+        {
+            d = (rt_byte *)c_out41[g];
+            w = g < 3 ? 8 : 16;
+            switch (g % 3)
+            {
+                case 0:
+                sub_lanes41(d + Q*0x00, ADD41, w, 0, a, b, 0);
+                sub_lanes41(d + Q*0x10, SUB41, w, 0, a, b, 0);
+                sub_lanes41(d + Q*0x20, ADS41, w, 0, a, b, 0);
+                sub_lanes41(d + Q*0x30, ADS41, w, 1, a, b, 0);
+                sub_lanes41(d + Q*0x40, SBS41, w, 0, a, b, 0);
+                sub_lanes41(d + Q*0x50, SBS41, w, 1, a, b, 0);
+                break;
+
+                case 1:
+                sub_lanes41(d + Q*0x00, MIN41, w, 0, a, b, 0);
+                sub_lanes41(d + Q*0x10, MIN41, w, 1, a, b, 0);
+                sub_lanes41(d + Q*0x20, MAX41, w, 0, a, b, 0);
+                sub_lanes41(d + Q*0x30, MAX41, w, 1, a, b, 0);
+                sub_lanes41(d + Q*0x40, SHL41, w, 0, a, RT_NULL, 3);
+                sub_lanes41(d + Q*0x50, SHR41, w, 0, a, RT_NULL, 5);
+                break;
+
+                case 2:
+                sub_lanes41(d + Q*0x00, SHR41, w, 1, a, RT_NULL, 2);
+                sub_lanes41(d + Q*0x10, SHL41, w, 0, b, RT_NULL, 5);
+                sub_lanes41(d + Q*0x20, SHR41, w, 1, b, RT_NULL, 5);
+                sub_pack41(d + Q*0x30, w, sub_cmp1_41, sub_sgn1_41, a, b);
+                sub_pack41(d + Q*0x40, w, sub_cmp2_41, sub_sgn2_41, a, b);
+                sub_lanes41(d + Q*0x50, SHR41, w, 1, b, RT_NULL, w - 1);
+                break;
+            }
+        }
+
+        for (k = 0; k < Q*8; k++)
+        {
+            h6[Q*0x00 + k] = a[k];
+            h6[Q*0x08 + k] = a[Q*8 + k];
+            h6[Q*0x10 + k] = (rt_half)((b[k] ^ 0x80) - 0x80);
+            h6[Q*0x18 + k] = (rt_half)((b[Q*8 + k] ^ 0x80) - 0x80);
+        }
+        for (k = 0; k < Q*4; k++)
+        {
+            w6[Q*0x10 + k] = ((rt_half *)a)[k];
+            w6[Q*0x14 + k] = ((rt_half *)b)[Q*4 + k];
+            w7[Q*0x00 + k] = (rt_ui32)(rt_si16)((rt_half *)a)[k];
+            w7[Q*0x04 + k] = (rt_ui32)(rt_si16)((rt_half *)b)[Q*4 + k];
+        }
+        d = (rt_byte *)c_out41[7];
+        for (k = 0; k < Q*8; k++)
+        {
+            d[Q*0x20 + k] = (rt_byte)sub_cvx41(((rt_half *)a)[k], 16, 0);
+            d[Q*0x28 + k] = (rt_byte)sub_cvx41(((rt_half *)b)[k], 16, 0);
+            d[Q*0x30 + k] = (rt_byte)sub_cvx41(((rt_half *)b)[k], 16, 1);
+            d[Q*0x38 + k] = (rt_byte)sub_cvx41(((rt_half *)a)[k], 16, 1);
+        }
+        for (k = 0; k < Q*4; k++)
+        {
+            h7[Q*0x20 + k] = (rt_half)sub_cvx41(((rt_ui32 *)u)[k], 32, 0);
+            h7[Q*0x24 + k] = (rt_half)sub_cvx41(((rt_ui32 *)a)[k], 32, 0);
+            h7[Q*0x28 + k] = (rt_half)sub_cvx41(((rt_ui32 *)u)[k], 32, 1);
+            h7[Q*0x2C + k] = (rt_half)sub_cvx41(((rt_ui32 *)b)[k], 32, 1);
+        }
+    }
+}
+
+rt_void s_test41(rt_SIMD_INFOX *info)
+{
+    rt_si32 i, k;
+
+    rt_byte *fso1 = (rt_byte *)info->fso1;
+    rt_ui32 *fso2 = (rt_ui32 *)info->fso2;
+
+    k = Q*32;
+    while (k-->0)
+    {
+        fso1[k] = sub_input41(k);
+    }
+    k = Q*4;
+    while (k-->0)
+    {
+        ((rt_ui32 *)fso1)[Q*8 + k] = sub_wide41(k);
+        fso2[k] = k == 0 ? 5 : 0;
+    }
+
+    i = info->cyc;
+    while (i-->0)
+    {
+        ASM_ENTER(info)
+
+        movxx_ld(Recx, Mebp, inf_FSO1)
+        movxx_ld(Redx, Mebp, inf_ISO1)
+        movxx_ld(Rebx, Mebp, inf_ISO2)
+
+        movox_ld(Xmm0, Mecx, AJ0)
+        movox_ld(Xmm1, Mecx, AJ1)
+        addpb_rr(Xmm0, Xmm1)
+        movox_st(Xmm0, Medx, AJ0)
+
+        movox_ld(Xmm0, Mecx, AJ0)
+        subpb_ld(Xmm0, Mecx, AJ1)
+        movox_st(Xmm0, Medx, AJ1)
+
+        movox_ld(Xmm0, Mecx, AJ0)
+        adspb_rr(Xmm0, Xmm1)
+        movox_st(Xmm0, Medx, AJ2)
+
+        movox_ld(Xmm0, Mecx, AJ0)
+        adspc_ld(Xmm0, Mecx, AJ1)
+        movox_st(Xmm0, Mebx, AJ0)
+
+        movox_ld(Xmm0, Mecx, AJ0)
+        sbspb_ld(Xmm0, Mecx, AJ1)
+        movox_st(Xmm0, Mebx, AJ1)
+
+        movox_ld(Xmm0, Mecx, AJ0)
+        sbspc_rr(Xmm0, Xmm1)
+        movox_st(Xmm0, Mebx, AJ2)
+
+        ASM_LEAVE(info)
+
+        memcpy(s_out41[0], info->iso1, Q*0x30);
+        memcpy(s_out41[0] + Q*12, info->iso2, Q*0x30);
+
+        ASM_ENTER(info)
+
+        movxx_ld(Recx, Mebp, inf_FSO1)
+        movxx_ld(Redx, Mebp, inf_ISO1)
+        movxx_ld(Rebx, Mebp, inf_ISO2)
+        movxx_ld(Resi, Mebp, inf_FSO2)
+
+        movox_ld(Xmm0, Mecx, AJ0)
+        movox_ld(Xmm1, Mecx, AJ1)
+        minpb_rr(Xmm0, Xmm1)
+        movox_st(Xmm0, Medx, AJ0)
+
+        movox_ld(Xmm0, Mecx, AJ0)
+        minpc_ld(Xmm0, Mecx, AJ1)
+        movox_st(Xmm0, Medx, AJ1)
+
+        movox_ld(Xmm0, Mecx, AJ0)
+        maxpb_ld(Xmm0, Mecx, AJ1)
+        movox_st(Xmm0, Medx, AJ2)
+
+        movox_ld(Xmm0, Mecx, AJ0)
+        maxpc_rr(Xmm0, Xmm1)
+        movox_st(Xmm0, Mebx, AJ0)
+
+        movox_ld(Xmm0, Mecx, AJ0)
+        shlpb_ri(Xmm0, IB(3))
+        movox_st(Xmm0, Mebx, AJ1)
+
+        movox_ld(Xmm0, Mecx, AJ0)
+        shrpb_ld(Xmm0, Mesi, AJ0)
+        movox_st(Xmm0, Mebx, AJ2)
+
+        ASM_LEAVE(info)
+
+        memcpy(s_out41[1], info->iso1, Q*0x30);
+        memcpy(s_out41[1] + Q*12, info->iso2, Q*0x30);
+
+        ASM_ENTER(info)
+
+        movxx_ld(Recx, Mebp, inf_FSO1)
+        movxx_ld(Redx, Mebp, inf_ISO1)
+        movxx_ld(Rebx, Mebp, inf_ISO2)
+        movxx_ld(Resi, Mebp, inf_FSO2)
+
+        movox_ld(Xmm0, Mecx, AJ0)
+        shrpc_ri(Xmm0, IB(2))
+        movox_st(Xmm0, Medx, AJ0)
+
+        movox_ld(Xmm0, Mecx, AJ1)
+        shlpb_ld(Xmm0, Mesi, AJ0)
+        movox_st(Xmm0, Medx, AJ1)
+
+        movox_ld(Xmm0, Mecx, AJ1)
+        shrpc_ld(Xmm0, Mesi, AJ0)
+        movox_st(Xmm0, Medx, AJ2)
+
+        movox_ld(Xmm1, Mecx, AJ1)
+        xorox_rr(Xmm2, Xmm2)
+        movox_ld(Xmm0, Mecx, AJ0)
+        ceqpb_rr(Xmm0, Xmm1)
+        shlpb_ri(Xmm0, IB(7))
+        shrpb_ri(Xmm2, IB(1))
+        orrox_rr(Xmm2, Xmm0)
+        movox_ld(Xmm0, Mecx, AJ0)
+        cnepb_rr(Xmm0, Xmm1)
+        shlpb_ri(Xmm0, IB(7))
+        shrpb_ri(Xmm2, IB(1))
+        orrox_rr(Xmm2, Xmm0)
+        movox_ld(Xmm0, Mecx, AJ0)
+        cltpb_rr(Xmm0, Xmm1)
+        shlpb_ri(Xmm0, IB(7))
+        shrpb_ri(Xmm2, IB(1))
+        orrox_rr(Xmm2, Xmm0)
+        movox_ld(Xmm0, Mecx, AJ0)
+        cltpc_rr(Xmm0, Xmm1)
+        shlpb_ri(Xmm0, IB(7))
+        shrpb_ri(Xmm2, IB(1))
+        orrox_rr(Xmm2, Xmm0)
+        movox_ld(Xmm0, Mecx, AJ0)
+        clepb_rr(Xmm0, Xmm1)
+        shlpb_ri(Xmm0, IB(7))
+        shrpb_ri(Xmm2, IB(1))
+        orrox_rr(Xmm2, Xmm0)
+        movox_ld(Xmm0, Mecx, AJ0)
+        clepc_rr(Xmm0, Xmm1)
+        shlpb_ri(Xmm0, IB(7))
+        shrpb_ri(Xmm2, IB(1))
+        orrox_rr(Xmm2, Xmm0)
+        movox_ld(Xmm0, Mecx, AJ0)
+        cgtpb_rr(Xmm0, Xmm1)
+        shlpb_ri(Xmm0, IB(7))
+        shrpb_ri(Xmm2, IB(1))
+        orrox_rr(Xmm2, Xmm0)
+        movox_ld(Xmm0, Mecx, AJ0)
+        cgtpc_rr(Xmm0, Xmm1)
+        shlpb_ri(Xmm0, IB(7))
+        shrpb_ri(Xmm2, IB(1))
+        orrox_rr(Xmm2, Xmm0)
+        movox_st(Xmm2, Mebx, AJ0)
+
+        xorox_rr(Xmm2, Xmm2)
+        movox_ld(Xmm0, Mecx, AJ0)
+        cgepb_rr(Xmm0, Xmm1)
+        shlpb_ri(Xmm0, IB(7))
+        shrpb_ri(Xmm2, IB(1))
+        orrox_rr(Xmm2, Xmm0)
+        movox_ld(Xmm0, Mecx, AJ0)
+        cgepc_rr(Xmm0, Xmm1)
+        shlpb_ri(Xmm0, IB(7))
+        shrpb_ri(Xmm2, IB(1))
+        orrox_rr(Xmm2, Xmm0)
+        movox_ld(Xmm0, Mecx, AJ0)
+        ceqpb_ld(Xmm0, Mecx, AJ1)
+        shlpb_ri(Xmm0, IB(7))
+        shrpb_ri(Xmm2, IB(1))
+        orrox_rr(Xmm2, Xmm0)
+        movox_ld(Xmm0, Mecx, AJ0)
+        cnepb_ld(Xmm0, Mecx, AJ1)
+        shlpb_ri(Xmm0, IB(7))
+        shrpb_ri(Xmm2, IB(1))
+        orrox_rr(Xmm2, Xmm0)
+        movox_ld(Xmm0, Mecx, AJ0)
+        cltpb_ld(Xmm0, Mecx, AJ1)
+        shlpb_ri(Xmm0, IB(7))
+        shrpb_ri(Xmm2, IB(1))
+        orrox_rr(Xmm2, Xmm0)
+        movox_ld(Xmm0, Mecx, AJ0)
+        clepc_ld(Xmm0, Mecx, AJ1)
+        shlpb_ri(Xmm0, IB(7))
+        shrpb_ri(Xmm2, IB(1))
+        orrox_rr(Xmm2, Xmm0)
+        movox_ld(Xmm0, Mecx, AJ0)
+        cgtpc_ld(Xmm0, Mecx, AJ1)
+        shlpb_ri(Xmm0, IB(7))
+        shrpb_ri(Xmm2, IB(1))
+        orrox_rr(Xmm2, Xmm0)
+        movox_ld(Xmm0, Mecx, AJ0)
+        cgepb_ld(Xmm0, Mecx, AJ1)
+        shlpb_ri(Xmm0, IB(7))
+        shrpb_ri(Xmm2, IB(1))
+        orrox_rr(Xmm2, Xmm0)
+        movox_st(Xmm2, Mebx, AJ1)
+
+        movox_ld(Xmm0, Mecx, AJ1)
+        shrpc_ri(Xmm0, IB(7))
+        movox_st(Xmm0, Mebx, AJ2)
+
+        ASM_LEAVE(info)
+
+        memcpy(s_out41[2], info->iso1, Q*0x30);
+        memcpy(s_out41[2] + Q*12, info->iso2, Q*0x30);
+
+        ASM_ENTER(info)
+
+        movxx_ld(Recx, Mebp, inf_FSO1)
+        movxx_ld(Redx, Mebp, inf_ISO1)
+        movxx_ld(Rebx, Mebp, inf_ISO2)
+
+        movox_ld(Xmm0, Mecx, AJ0)
+        movox_ld(Xmm1, Mecx, AJ1)
+        addph_rr(Xmm0, Xmm1)
+        movox_st(Xmm0, Medx, AJ0)
+
+        movox_ld(Xmm0, Mecx, AJ0)
+        subph_ld(Xmm0, Mecx, AJ1)
+        movox_st(Xmm0, Medx, AJ1)
+
+        movox_ld(Xmm0, Mecx, AJ0)
+        adsph_rr(Xmm0, Xmm1)
+        movox_st(Xmm0, Medx, AJ2)
+
+        movox_ld(Xmm0, Mecx, AJ0)
+        adspi_ld(Xmm0, Mecx, AJ1)
+        movox_st(Xmm0, Mebx, AJ0)
+
+        movox_ld(Xmm0, Mecx, AJ0)
+        sbsph_ld(Xmm0, Mecx, AJ1)
+        movox_st(Xmm0, Mebx, AJ1)
+
+        movox_ld(Xmm0, Mecx, AJ0)
+        sbspi_rr(Xmm0, Xmm1)
+        movox_st(Xmm0, Mebx, AJ2)
+
+        ASM_LEAVE(info)
+
+        memcpy(s_out41[3], info->iso1, Q*0x30);
+        memcpy(s_out41[3] + Q*12, info->iso2, Q*0x30);
+
+        ASM_ENTER(info)
+
+        movxx_ld(Recx, Mebp, inf_FSO1)
+        movxx_ld(Redx, Mebp, inf_ISO1)
+        movxx_ld(Rebx, Mebp, inf_ISO2)
+        movxx_ld(Resi, Mebp, inf_FSO2)
+
+        movox_ld(Xmm0, Mecx, AJ0)
+        movox_ld(Xmm1, Mecx, AJ1)
+        minph_rr(Xmm0, Xmm1)
+        movox_st(Xmm0, Medx, AJ0)
+
+        movox_ld(Xmm0, Mecx, AJ0)
+        minpi_ld(Xmm0, Mecx, AJ1)
+        movox_st(Xmm0, Medx, AJ1)
+
+        movox_ld(Xmm0, Mecx, AJ0)
+        maxph_ld(Xmm0, Mecx, AJ1)
+        movox_st(Xmm0, Medx, AJ2)
+
+        movox_ld(Xmm0, Mecx, AJ0)
+        maxpi_rr(Xmm0, Xmm1)
+        movox_st(Xmm0, Mebx, AJ0)
+
+        movox_ld(Xmm0, Mecx, AJ0)
+        shlph_ri(Xmm0, IB(3))
+        movox_st(Xmm0, Mebx, AJ1)
+
+        movox_ld(Xmm0, Mecx, AJ0)
+        shrph_ld(Xmm0, Mesi, AJ0)
+        movox_st(Xmm0, Mebx, AJ2)
+
+        ASM_LEAVE(info)
+
+        memcpy(s_out41[4], info->iso1, Q*0x30);
+        memcpy(s_out41[4] + Q*12, info->iso2, Q*0x30);
+
+        ASM_ENTER(info)
+
+        movxx_ld(Recx, Mebp, inf_FSO1)
+        movxx_ld(Redx, Mebp, inf_ISO1)
+        movxx_ld(Rebx, Mebp, inf_ISO2)
+        movxx_ld(Resi, Mebp, inf_FSO2)
+
+        movox_ld(Xmm0, Mecx, AJ0)
+        shrpi_ri(Xmm0, IB(2))
+        movox_st(Xmm0, Medx, AJ0)
+
+        movox_ld(Xmm0, Mecx, AJ1)
+        shlph_ld(Xmm0, Mesi, AJ0)
+        movox_st(Xmm0, Medx, AJ1)
+
+        movox_ld(Xmm0, Mecx, AJ1)
+        shrpi_ld(Xmm0, Mesi, AJ0)
+        movox_st(Xmm0, Medx, AJ2)
+
+        movox_ld(Xmm1, Mecx, AJ1)
+        xorox_rr(Xmm2, Xmm2)
+        movox_ld(Xmm0, Mecx, AJ0)
+        ceqph_rr(Xmm0, Xmm1)
+        shlph_ri(Xmm0, IB(15))
+        shrph_ri(Xmm2, IB(1))
+        orrox_rr(Xmm2, Xmm0)
+        movox_ld(Xmm0, Mecx, AJ0)
+        cneph_rr(Xmm0, Xmm1)
+        shlph_ri(Xmm0, IB(15))
+        shrph_ri(Xmm2, IB(1))
+        orrox_rr(Xmm2, Xmm0)
+        movox_ld(Xmm0, Mecx, AJ0)
+        cltph_rr(Xmm0, Xmm1)
+        shlph_ri(Xmm0, IB(15))
+        shrph_ri(Xmm2, IB(1))
+        orrox_rr(Xmm2, Xmm0)
+        movox_ld(Xmm0, Mecx, AJ0)
+        cltpi_rr(Xmm0, Xmm1)
+        shlph_ri(Xmm0, IB(15))
+        shrph_ri(Xmm2, IB(1))
+        orrox_rr(Xmm2, Xmm0)
+        movox_ld(Xmm0, Mecx, AJ0)
+        cleph_rr(Xmm0, Xmm1)
+        shlph_ri(Xmm0, IB(15))
+        shrph_ri(Xmm2, IB(1))
+        orrox_rr(Xmm2, Xmm0)
+        movox_ld(Xmm0, Mecx, AJ0)
+        clepi_rr(Xmm0, Xmm1)
+        shlph_ri(Xmm0, IB(15))
+        shrph_ri(Xmm2, IB(1))
+        orrox_rr(Xmm2, Xmm0)
+        movox_ld(Xmm0, Mecx, AJ0)
+        cgtph_rr(Xmm0, Xmm1)
+        shlph_ri(Xmm0, IB(15))
+        shrph_ri(Xmm2, IB(1))
+        orrox_rr(Xmm2, Xmm0)
+        movox_ld(Xmm0, Mecx, AJ0)
+        cgtpi_rr(Xmm0, Xmm1)
+        shlph_ri(Xmm0, IB(15))
+        shrph_ri(Xmm2, IB(1))
+        orrox_rr(Xmm2, Xmm0)
+        movox_st(Xmm2, Mebx, AJ0)
+
+        xorox_rr(Xmm2, Xmm2)
+        movox_ld(Xmm0, Mecx, AJ0)
+        cgeph_rr(Xmm0, Xmm1)
+        shlph_ri(Xmm0, IB(15))
+        shrph_ri(Xmm2, IB(1))
+        orrox_rr(Xmm2, Xmm0)
+        movox_ld(Xmm0, Mecx, AJ0)
+        cgepi_rr(Xmm0, Xmm1)
+        shlph_ri(Xmm0, IB(15))
+        shrph_ri(Xmm2, IB(1))
+        orrox_rr(Xmm2, Xmm0)
+        movox_ld(Xmm0, Mecx, AJ0)
+        ceqph_ld(Xmm0, Mecx, AJ1)
+        shlph_ri(Xmm0, IB(15))
+        shrph_ri(Xmm2, IB(1))
+        orrox_rr(Xmm2, Xmm0)
+        movox_ld(Xmm0, Mecx, AJ0)
+        cneph_ld(Xmm0, Mecx, AJ1)
+        shlph_ri(Xmm0, IB(15))
+        shrph_ri(Xmm2, IB(1))
+        orrox_rr(Xmm2, Xmm0)
+        movox_ld(Xmm0, Mecx, AJ0)
+        cltph_ld(Xmm0, Mecx, AJ1)
+        shlph_ri(Xmm0, IB(15))
+        shrph_ri(Xmm2, IB(1))
+        orrox_rr(Xmm2, Xmm0)
+        movox_ld(Xmm0, Mecx, AJ0)
+        clepi_ld(Xmm0, Mecx, AJ1)
+        shlph_ri(Xmm0, IB(15))
+        shrph_ri(Xmm2, IB(1))
+        orrox_rr(Xmm2, Xmm0)
+        movox_ld(Xmm0, Mecx, AJ0)
+        cgtpi_ld(Xmm0, Mecx, AJ1)
+        shlph_ri(Xmm0, IB(15))
+        shrph_ri(Xmm2, IB(1))
+        orrox_rr(Xmm2, Xmm0)
+        movox_ld(Xmm0, Mecx, AJ0)
+        cgeph_ld(Xmm0, Mecx, AJ1)
+        shlph_ri(Xmm0, IB(15))
+        shrph_ri(Xmm2, IB(1))
+        orrox_rr(Xmm2, Xmm0)
+        movox_st(Xmm2, Mebx, AJ1)
+
+        movox_ld(Xmm0, Mecx, AJ1)
+        shrpi_ri(Xmm0, IB(15))
+        movox_st(Xmm0, Mebx, AJ2)
+
+        ASM_LEAVE(info)
+
+        memcpy(s_out41[5], info->iso1, Q*0x30);
+        memcpy(s_out41[5] + Q*12, info->iso2, Q*0x30);
+
+        ASM_ENTER(info)
+
+        movxx_ld(Recx, Mebp, inf_FSO1)
+        movxx_ld(Redx, Mebp, inf_ISO1)
+        movxx_ld(Rebx, Mebp, inf_ISO2)
+
+        movox_ld(Xmm0, Mecx, AJ0)
+        movox_ld(Xmm1, Mecx, AJ1)
+        cvypb_rr(Xmm2, Xmm0)
+        movox_st(Xmm2, Medx, AJ0)
+        cuypb_rr(Xmm2, Xmm0)
+        movox_st(Xmm2, Medx, AJ1)
+        cvypc_rr(Xmm2, Xmm1)
+        movox_st(Xmm2, Medx, AJ2)
+        cuypc_rr(Xmm2, Xmm1)
+        movox_st(Xmm2, Mebx, AJ0)
+        cvyph_rr(Xmm2, Xmm0)
+        movox_st(Xmm2, Mebx, AJ1)
+        cuyph_rr(Xmm2, Xmm1)
+        movox_st(Xmm2, Mebx, AJ2)
+
+        ASM_LEAVE(info)
+
+        memcpy(s_out41[6], info->iso1, Q*0x30);
+        memcpy(s_out41[6] + Q*12, info->iso2, Q*0x30);
+
+        ASM_ENTER(info)
+
+        movxx_ld(Recx, Mebp, inf_FSO1)
+        movxx_ld(Redx, Mebp, inf_ISO1)
+        movxx_ld(Rebx, Mebp, inf_ISO2)
+
+        movox_ld(Xmm0, Mecx, AJ0)
+        movox_ld(Xmm1, Mecx, AJ1)
+        movox_ld(Xmm3, Mecx, AJ2)
+        cvypi_rr(Xmm2, Xmm0)
+        movox_st(Xmm2, Medx, AJ0)
+        cuypi_rr(Xmm2, Xmm1)
+        movox_st(Xmm2, Medx, AJ1)
+        cvxph_rr(Xmm2, Xmm0)
+        cuxph_rr(Xmm2, Xmm1)
+        movox_st(Xmm2, Medx, AJ2)
+        cvxpi_rr(Xmm2, Xmm1)
+        cuxpi_rr(Xmm2, Xmm0)
+        movox_st(Xmm2, Mebx, AJ0)
+        cvxpx_rr(Xmm2, Xmm3)
+        cuxpx_rr(Xmm2, Xmm0)
+        movox_st(Xmm2, Mebx, AJ1)
+        cvxpn_rr(Xmm2, Xmm3)
+        cuxpn_rr(Xmm2, Xmm1)
+        movox_st(Xmm2, Mebx, AJ2)
+
+        ASM_LEAVE(info)
+
+        memcpy(s_out41[7], info->iso1, Q*0x30);
+        memcpy(s_out41[7] + Q*12, info->iso2, Q*0x30);
+    }
+}
+
+rt_void p_test41(rt_SIMD_INFOX *info)
+{
+    rt_si32 g, k;
+
+    for (g = 0; g < SUB_GRP41; g++)
+    {
+        k = SUB_OUT41;
+        while (k-->0)
+        {
+            if (IEQ(c_out41[g][k], s_out41[g][k]) && !v_mode)
+            {
+                continue;
+            }
+
+            RT_LOGI("C grp[%d] reg[%d] lane[%d] = %08X, "
+                    "in = %08X, %08X\n", g, k / (Q*4), k % (Q*4),
+                    c_out41[g][k], ((rt_ui32 *)info->fco1)[k % (Q*4)],
+                    ((rt_ui32 *)info->fco1)[Q*4 + k % (Q*4)]);
+
+            RT_LOGI("S grp[%d] reg[%d] lane[%d] = %08X, "
+                    "in = %08X, %08X\n", g, k / (Q*4), k % (Q*4),
+                    s_out41[g][k], ((rt_ui32 *)info->fso1)[k % (Q*4)],
+                    ((rt_ui32 *)info->fso1)[Q*4 + k % (Q*4)]);
+        }
+    }
+}
+
+#endif /* RUN_LEVEL 41 */
+
+/******************************************************************************/
+/******************************   RUN LEVEL 42   ******************************/
+/******************************************************************************/
+
+#if RUN_LEVEL >= 42
+
+/*
+ * Integer compares (cmdpx_ unsigned, cmdpn_ signed) are checked in four sets:
+ * (x, y), (x << K, y << K) into ico1 and (-x, y), (x, x) into ico2, where each
+ * compare shifts one bit into the result as done in s_test42 with subtract:
+ * D = (D << 1) - cmp, shifted operands cover signed overflow within lanes.
+ */
+rt_uelm cmp_bits42(rt_elem x, rt_elem y, rt_uelm acc)
+{
+    rt_uelm u = (rt_uelm)x, v = (rt_uelm)y;
+
+    acc = (acc << 1) | (x == y ? 1 : 0); /* ceqpx */
+    acc = (acc << 1) | (x != y ? 1 : 0); /* cnepx */
+    acc = (acc << 1) | (u < v ? 1 : 0); /* cltpx */
+    acc = (acc << 1) | (x < y ? 1 : 0); /* cltpn */
+    acc = (acc << 1) | (u <= v ? 1 : 0); /* clepx */
+    acc = (acc << 1) | (x <= y ? 1 : 0); /* clepn */
+    acc = (acc << 1) | (u > v ? 1 : 0); /* cgtpx */
+    acc = (acc << 1) | (x > y ? 1 : 0); /* cgtpn */
+    acc = (acc << 1) | (u >= v ? 1 : 0); /* cgepx */
+    acc = (acc << 1) | (x >= y ? 1 : 0); /* cgepn */
+
+    return acc;
+}
+
+rt_void c_test42(rt_SIMD_INFOX *info)
+{
+    rt_si32 i, j, n = info->size;
+
+    rt_elem *iar0 = info->iar0;
+    rt_elem *ico1 = info->ico1;
+    rt_elem *ico2 = info->ico2;
+
+    i = info->cyc;
+    while (i-->0)
+    {
+        j = n;
+        while (j-->0)
+        {
+            rt_elem x = iar0[j], y = iar0[(j + S) % n];
+            rt_elem p = (rt_elem)((rt_uelm)x << (20+32*(L-1)));
+            rt_elem q = (rt_elem)((rt_uelm)y << (20+32*(L-1)));
+            rt_elem m = (rt_elem)(0 - (rt_uelm)x);
+
+            ico1[j] = (rt_elem)cmp_bits42(p, q, cmp_bits42(x, y, 0));
+            ico2[j] = (rt_elem)cmp_bits42(x, x, cmp_bits42(m, y, 0));
+        }
+    }
+}
+
+/*
+ * As ASM_ENTER/ASM_LEAVE save/load a sizeable portion of registers onto/from
+ * the stack, they are considered heavy and therefore best suited for compute
+ * intensive parts of the program, in which case the ASM overhead is minimized.
+ * The test code below was designed mainly for assembler validation purposes
+ * and therefore may not fully represent its unlocked performance potential.
+ * For optimal results keep ASM sections in separate functions away from
+ * complex C/C++ logic, while making sure those functions are not inlined.
+ * This is needed for better compatibility with modern optimizing compilers.
+ */
+rt_void s_test42(rt_SIMD_INFOX *info)
+{
+    rt_si32 i;
+
+    i = info->cyc;
+    while (i-->0)
+    {
+        ASM_ENTER(info)
+
+        movxx_ld(Resi, Mebp, inf_IAR0)
+        movxx_ld(Redx, Mebp, inf_ISO1)
+        movxx_ld(Rebx, Mebp, inf_ISO2)
+
+        movpx_ld(Xmm0, Mesi, AJ0)
+        movpx_ld(Xmm1, Mesi, AJ1)
+        xorpx_rr(Xmm3, Xmm3)
+        movpx_rr(Xmm2, Xmm0)
+        ceqpx_rr(Xmm2, Xmm1)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm0)
+        cnepx_rr(Xmm2, Xmm1)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm0)
+        cltpx_rr(Xmm2, Xmm1)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm0)
+        cltpn_rr(Xmm2, Xmm1)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm0)
+        clepx_rr(Xmm2, Xmm1)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm0)
+        clepn_rr(Xmm2, Xmm1)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm0)
+        cgtpx_rr(Xmm2, Xmm1)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm0)
+        cgtpn_rr(Xmm2, Xmm1)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm0)
+        cgepx_rr(Xmm2, Xmm1)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm0)
+        cgepn_rr(Xmm2, Xmm1)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm4, Xmm0)
+        shlpx_ri(Xmm4, IB((20+32*(L-1))))
+        movpx_rr(Xmm5, Xmm1)
+        shlpx_ri(Xmm5, IB((20+32*(L-1))))
+        movpx_rr(Xmm2, Xmm4)
+        ceqpx_rr(Xmm2, Xmm5)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm4)
+        cnepx_rr(Xmm2, Xmm5)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm4)
+        cltpx_rr(Xmm2, Xmm5)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm4)
+        cltpn_rr(Xmm2, Xmm5)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm4)
+        clepx_rr(Xmm2, Xmm5)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm4)
+        clepn_rr(Xmm2, Xmm5)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm4)
+        cgtpx_rr(Xmm2, Xmm5)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm4)
+        cgtpn_rr(Xmm2, Xmm5)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm4)
+        cgepx_rr(Xmm2, Xmm5)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm4)
+        cgepn_rr(Xmm2, Xmm5)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_st(Xmm3, Medx, AJ0)
+
+        xorpx_rr(Xmm4, Xmm4)
+        subpx_rr(Xmm4, Xmm0)
+        xorpx_rr(Xmm3, Xmm3)
+        movpx_rr(Xmm2, Xmm4)
+        ceqpx_ld(Xmm2, Mesi, AJ1)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm4)
+        cnepx_ld(Xmm2, Mesi, AJ1)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm4)
+        cltpx_ld(Xmm2, Mesi, AJ1)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm4)
+        cltpn_ld(Xmm2, Mesi, AJ1)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm4)
+        clepx_ld(Xmm2, Mesi, AJ1)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm4)
+        clepn_ld(Xmm2, Mesi, AJ1)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm4)
+        cgtpx_ld(Xmm2, Mesi, AJ1)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm4)
+        cgtpn_ld(Xmm2, Mesi, AJ1)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm4)
+        cgepx_ld(Xmm2, Mesi, AJ1)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm4)
+        cgepn_ld(Xmm2, Mesi, AJ1)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm0)
+        ceqpx_ld(Xmm2, Mesi, AJ0)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm0)
+        cnepx_ld(Xmm2, Mesi, AJ0)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm0)
+        cltpx_ld(Xmm2, Mesi, AJ0)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm0)
+        cltpn_ld(Xmm2, Mesi, AJ0)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm0)
+        clepx_ld(Xmm2, Mesi, AJ0)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm0)
+        clepn_ld(Xmm2, Mesi, AJ0)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm0)
+        cgtpx_ld(Xmm2, Mesi, AJ0)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm0)
+        cgtpn_ld(Xmm2, Mesi, AJ0)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm0)
+        cgepx_ld(Xmm2, Mesi, AJ0)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm0)
+        cgepn_ld(Xmm2, Mesi, AJ0)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_st(Xmm3, Mebx, AJ0)
+
+        movpx_ld(Xmm0, Mesi, AJ1)
+        movpx_ld(Xmm1, Mesi, AJ2)
+        xorpx_rr(Xmm3, Xmm3)
+        movpx_rr(Xmm2, Xmm0)
+        ceqpx_rr(Xmm2, Xmm1)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm0)
+        cnepx_rr(Xmm2, Xmm1)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm0)
+        cltpx_rr(Xmm2, Xmm1)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm0)
+        cltpn_rr(Xmm2, Xmm1)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm0)
+        clepx_rr(Xmm2, Xmm1)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm0)
+        clepn_rr(Xmm2, Xmm1)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm0)
+        cgtpx_rr(Xmm2, Xmm1)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm0)
+        cgtpn_rr(Xmm2, Xmm1)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm0)
+        cgepx_rr(Xmm2, Xmm1)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm0)
+        cgepn_rr(Xmm2, Xmm1)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm4, Xmm0)
+        shlpx_ri(Xmm4, IB((20+32*(L-1))))
+        movpx_rr(Xmm5, Xmm1)
+        shlpx_ri(Xmm5, IB((20+32*(L-1))))
+        movpx_rr(Xmm2, Xmm4)
+        ceqpx_rr(Xmm2, Xmm5)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm4)
+        cnepx_rr(Xmm2, Xmm5)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm4)
+        cltpx_rr(Xmm2, Xmm5)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm4)
+        cltpn_rr(Xmm2, Xmm5)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm4)
+        clepx_rr(Xmm2, Xmm5)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm4)
+        clepn_rr(Xmm2, Xmm5)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm4)
+        cgtpx_rr(Xmm2, Xmm5)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm4)
+        cgtpn_rr(Xmm2, Xmm5)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm4)
+        cgepx_rr(Xmm2, Xmm5)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm4)
+        cgepn_rr(Xmm2, Xmm5)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_st(Xmm3, Medx, AJ1)
+
+        xorpx_rr(Xmm4, Xmm4)
+        subpx_rr(Xmm4, Xmm0)
+        xorpx_rr(Xmm3, Xmm3)
+        movpx_rr(Xmm2, Xmm4)
+        ceqpx_ld(Xmm2, Mesi, AJ2)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm4)
+        cnepx_ld(Xmm2, Mesi, AJ2)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm4)
+        cltpx_ld(Xmm2, Mesi, AJ2)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm4)
+        cltpn_ld(Xmm2, Mesi, AJ2)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm4)
+        clepx_ld(Xmm2, Mesi, AJ2)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm4)
+        clepn_ld(Xmm2, Mesi, AJ2)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm4)
+        cgtpx_ld(Xmm2, Mesi, AJ2)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm4)
+        cgtpn_ld(Xmm2, Mesi, AJ2)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm4)
+        cgepx_ld(Xmm2, Mesi, AJ2)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm4)
+        cgepn_ld(Xmm2, Mesi, AJ2)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm0)
+        ceqpx_ld(Xmm2, Mesi, AJ1)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm0)
+        cnepx_ld(Xmm2, Mesi, AJ1)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm0)
+        cltpx_ld(Xmm2, Mesi, AJ1)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm0)
+        cltpn_ld(Xmm2, Mesi, AJ1)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm0)
+        clepx_ld(Xmm2, Mesi, AJ1)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm0)
+        clepn_ld(Xmm2, Mesi, AJ1)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm0)
+        cgtpx_ld(Xmm2, Mesi, AJ1)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm0)
+        cgtpn_ld(Xmm2, Mesi, AJ1)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm0)
+        cgepx_ld(Xmm2, Mesi, AJ1)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm0)
+        cgepn_ld(Xmm2, Mesi, AJ1)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_st(Xmm3, Mebx, AJ1)
+
+        movpx_ld(Xmm0, Mesi, AJ2)
+        movpx_ld(Xmm1, Mesi, AJ0)
+        xorpx_rr(Xmm3, Xmm3)
+        movpx_rr(Xmm2, Xmm0)
+        ceqpx_rr(Xmm2, Xmm1)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm0)
+        cnepx_rr(Xmm2, Xmm1)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm0)
+        cltpx_rr(Xmm2, Xmm1)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm0)
+        cltpn_rr(Xmm2, Xmm1)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm0)
+        clepx_rr(Xmm2, Xmm1)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm0)
+        clepn_rr(Xmm2, Xmm1)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm0)
+        cgtpx_rr(Xmm2, Xmm1)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm0)
+        cgtpn_rr(Xmm2, Xmm1)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm0)
+        cgepx_rr(Xmm2, Xmm1)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm0)
+        cgepn_rr(Xmm2, Xmm1)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm4, Xmm0)
+        shlpx_ri(Xmm4, IB((20+32*(L-1))))
+        movpx_rr(Xmm5, Xmm1)
+        shlpx_ri(Xmm5, IB((20+32*(L-1))))
+        movpx_rr(Xmm2, Xmm4)
+        ceqpx_rr(Xmm2, Xmm5)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm4)
+        cnepx_rr(Xmm2, Xmm5)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm4)
+        cltpx_rr(Xmm2, Xmm5)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm4)
+        cltpn_rr(Xmm2, Xmm5)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm4)
+        clepx_rr(Xmm2, Xmm5)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm4)
+        clepn_rr(Xmm2, Xmm5)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm4)
+        cgtpx_rr(Xmm2, Xmm5)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm4)
+        cgtpn_rr(Xmm2, Xmm5)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm4)
+        cgepx_rr(Xmm2, Xmm5)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm4)
+        cgepn_rr(Xmm2, Xmm5)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_st(Xmm3, Medx, AJ2)
+
+        xorpx_rr(Xmm4, Xmm4)
+        subpx_rr(Xmm4, Xmm0)
+        xorpx_rr(Xmm3, Xmm3)
+        movpx_rr(Xmm2, Xmm4)
+        ceqpx_ld(Xmm2, Mesi, AJ0)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm4)
+        cnepx_ld(Xmm2, Mesi, AJ0)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm4)
+        cltpx_ld(Xmm2, Mesi, AJ0)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm4)
+        cltpn_ld(Xmm2, Mesi, AJ0)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm4)
+        clepx_ld(Xmm2, Mesi, AJ0)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm4)
+        clepn_ld(Xmm2, Mesi, AJ0)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm4)
+        cgtpx_ld(Xmm2, Mesi, AJ0)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm4)
+        cgtpn_ld(Xmm2, Mesi, AJ0)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm4)
+        cgepx_ld(Xmm2, Mesi, AJ0)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm4)
+        cgepn_ld(Xmm2, Mesi, AJ0)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm0)
+        ceqpx_ld(Xmm2, Mesi, AJ2)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm0)
+        cnepx_ld(Xmm2, Mesi, AJ2)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm0)
+        cltpx_ld(Xmm2, Mesi, AJ2)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm0)
+        cltpn_ld(Xmm2, Mesi, AJ2)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm0)
+        clepx_ld(Xmm2, Mesi, AJ2)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm0)
+        clepn_ld(Xmm2, Mesi, AJ2)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm0)
+        cgtpx_ld(Xmm2, Mesi, AJ2)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm0)
+        cgtpn_ld(Xmm2, Mesi, AJ2)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm0)
+        cgepx_ld(Xmm2, Mesi, AJ2)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_rr(Xmm2, Xmm0)
+        cgepn_ld(Xmm2, Mesi, AJ2)
+        shlpx_ri(Xmm3, IB(1))
+        subpx_rr(Xmm3, Xmm2)
+        movpx_st(Xmm3, Mebx, AJ2)
+
+        ASM_LEAVE(info)
+    }
+}
+
+rt_void p_test42(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = info->size;
+
+    rt_elem *iar0 = info->iar0;
+    rt_elem *ico1 = info->ico1;
+    rt_elem *ico2 = info->ico2;
+    rt_elem *iso1 = info->iso1;
+    rt_elem *iso2 = info->iso2;
+
+    j = n;
+    while (j-->0)
+    {
+        if (IEQ(ico1[j], iso1[j]) && IEQ(ico2[j], iso2[j]) && !v_mode)
+        {
+            continue;
+        }
+
+        RT_LOGI("iarr[%d] = %" PR_L "d, iarr[%d] = %" PR_L "d\n",
+                j, iar0[j], (j + S) % n, iar0[(j + S) % n]);
+
+        RT_LOGI("C cmp(iarr[%d], iarr[%d]) = %" PR_L "X, "
+                  "cmp(-iarr[%d], iarr[%d]) = %" PR_L "X\n",
+                j, (j + S) % n, ico1[j], j, (j + S) % n, ico2[j]);
+
+        RT_LOGI("S cmp(iarr[%d], iarr[%d]) = %" PR_L "X, "
+                  "cmp(-iarr[%d], iarr[%d]) = %" PR_L "X\n",
+                j, (j + S) % n, iso1[j], j, (j + S) % n, iso2[j]);
+    }
+}
+
+#endif /* RUN_LEVEL 42 */
+
+/******************************************************************************/
+/*********************************   TABLES   *********************************/
+/******************************************************************************/
+
+typedef rt_void (*testXX)(rt_SIMD_INFOX *);
+
+testXX c_test[RUN_LEVEL] =
+{
+#if RUN_LEVEL >=  1
+    c_test01,
+#endif /* RUN_LEVEL  1 */
+
+#if RUN_LEVEL >=  2
+    c_test02,
+#endif /* RUN_LEVEL  2 */
+
+#if RUN_LEVEL >=  3
+    c_test03,
+#endif /* RUN_LEVEL  3 */
+
+#if RUN_LEVEL >=  4
+    c_test04,
+#endif /* RUN_LEVEL  4 */
+
+#if RUN_LEVEL >=  5
+    c_test05,
+#endif /* RUN_LEVEL  5 */
+
+#if RUN_LEVEL >=  6
+    c_test06,
+#endif /* RUN_LEVEL  6 */
+
+#if RUN_LEVEL >=  7
+    c_test07,
+#endif /* RUN_LEVEL  7 */
+
+#if RUN_LEVEL >=  8
+    c_test08,
+#endif /* RUN_LEVEL  8 */
+
+#if RUN_LEVEL >=  9
+    c_test09,
+#endif /* RUN_LEVEL  9 */
+
+#if RUN_LEVEL >= 10
+    c_test10,
+#endif /* RUN_LEVEL 10 */
+
+#if RUN_LEVEL >= 11
+    c_test11,
+#endif /* RUN_LEVEL 11 */
+
+#if RUN_LEVEL >= 12
+    c_test12,
+#endif /* RUN_LEVEL 12 */
+
+#if RUN_LEVEL >= 13
+    c_test13,
+#endif /* RUN_LEVEL 13 */
+
+#if RUN_LEVEL >= 14
+    c_test14,
+#endif /* RUN_LEVEL 14 */
+
+#if RUN_LEVEL >= 15
+    c_test15,
+#endif /* RUN_LEVEL 15 */
+
+#if RUN_LEVEL >= 16
+    c_test16,
+#endif /* RUN_LEVEL 16 */
+
+#if RUN_LEVEL >= 17
+    c_test17,
+#endif /* RUN_LEVEL 17 */
+
+#if RUN_LEVEL >= 18
+    c_test18,
+#endif /* RUN_LEVEL 18 */
+
+#if RUN_LEVEL >= 19
+    c_test19,
+#endif /* RUN_LEVEL 19 */
+
+#if RUN_LEVEL >= 20
+    c_test20,
+#endif /* RUN_LEVEL 20 */
+
+#if RUN_LEVEL >= 21
+    c_test21,
+#endif /* RUN_LEVEL 21 */
+
+#if RUN_LEVEL >= 22
+    c_test22,
+#endif /* RUN_LEVEL 22 */
+
+#if RUN_LEVEL >= 23
+    c_test23,
+#endif /* RUN_LEVEL 23 */
+
+#if RUN_LEVEL >= 24
+    c_test24,
+#endif /* RUN_LEVEL 24 */
+
+#if RUN_LEVEL >= 25
+    c_test25,
+#endif /* RUN_LEVEL 25 */
+
+#if RUN_LEVEL >= 26
+    c_test26,
+#endif /* RUN_LEVEL 26 */
+
+#if RUN_LEVEL >= 27
+    c_test27,
+#endif /* RUN_LEVEL 27 */
+
+#if RUN_LEVEL >= 28
+    c_test28,
+#endif /* RUN_LEVEL 28 */
+
+#if RUN_LEVEL >= 29
+    c_test29,
+#endif /* RUN_LEVEL 29 */
+
+#if RUN_LEVEL >= 30
+    c_test30,
+#endif /* RUN_LEVEL 30 */
+
+#if RUN_LEVEL >= 31
+    c_test31,
+#endif /* RUN_LEVEL 31 */
+
+#if RUN_LEVEL >= 32
+    c_test32,
+#endif /* RUN_LEVEL 32 */
+
+#if RUN_LEVEL >= 33
+    c_test33,
+#endif /* RUN_LEVEL 33 */
+
+#if RUN_LEVEL >= 34
+    c_test34,
+#endif /* RUN_LEVEL 34 */
+
+#if RUN_LEVEL >= 35
+    c_test35,
+#endif /* RUN_LEVEL 35 */
+
+#if RUN_LEVEL >= 36
+    c_test36,
+#endif /* RUN_LEVEL 36 */
+
+#if RUN_LEVEL >= 37
+    c_test37,
+#endif /* RUN_LEVEL 37 */
+
+#if RUN_LEVEL >= 38
+    c_test38,
+#endif /* RUN_LEVEL 38 */
+
+#if RUN_LEVEL >= 39
+    c_test39,
+#endif /* RUN_LEVEL 39 */
+
+#if RUN_LEVEL >= 40
+    c_test40,
+#endif /* RUN_LEVEL 40 */
+
+#if RUN_LEVEL >= 41
+    c_test41,
+#endif /* RUN_LEVEL 41 */
+
+#if RUN_LEVEL >= 42
+    c_test42,
+#endif /* RUN_LEVEL 42 */
+};
+
+testXX s_test[RUN_LEVEL] =
+{
+#if RUN_LEVEL >=  1
+    s_test01,
+#endif /* RUN_LEVEL  1 */
+
+#if RUN_LEVEL >=  2
+    s_test02,
+#endif /* RUN_LEVEL  2 */
+
+#if RUN_LEVEL >=  3
+    s_test03,
+#endif /* RUN_LEVEL  3 */
+
+#if RUN_LEVEL >=  4
+    s_test04,
+#endif /* RUN_LEVEL  4 */
+
+#if RUN_LEVEL >=  5
+    s_test05,
+#endif /* RUN_LEVEL  5 */
+
+#if RUN_LEVEL >=  6
+    s_test06,
+#endif /* RUN_LEVEL  6 */
+
+#if RUN_LEVEL >=  7
+    s_test07,
+#endif /* RUN_LEVEL  7 */
+
+#if RUN_LEVEL >=  8
+    s_test08,
+#endif /* RUN_LEVEL  8 */
+
+#if RUN_LEVEL >=  9
+    s_test09,
+#endif /* RUN_LEVEL  9 */
+
+#if RUN_LEVEL >= 10
+    s_test10,
+#endif /* RUN_LEVEL 10 */
+
+#if RUN_LEVEL >= 11
+    s_test11,
+#endif /* RUN_LEVEL 11 */
+
+#if RUN_LEVEL >= 12
+    s_test12,
+#endif /* RUN_LEVEL 12 */
+
+#if RUN_LEVEL >= 13
+    s_test13,
+#endif /* RUN_LEVEL 13 */
+
+#if RUN_LEVEL >= 14
+    s_test14,
+#endif /* RUN_LEVEL 14 */
+
+#if RUN_LEVEL >= 15
     s_test15,
 #endif /* RUN_LEVEL 15 */
 
-#if RUN_LEVEL >= 16
-    s_test16,
-#endif /* RUN_LEVEL 16 */
+#if RUN_LEVEL >= 16
+    s_test16,
+#endif /* RUN_LEVEL 16 */
+
+#if RUN_LEVEL >= 17
+    s_test17,
+#endif /* RUN_LEVEL 17 */
+
+#if RUN_LEVEL >= 18
+    s_test18,
+#endif /* RUN_LEVEL 18 */
+
+#if RUN_LEVEL >= 19
+    s_test19,
+#endif /* RUN_LEVEL 19 */
+
+#if RUN_LEVEL >= 20
+    s_test20,
+#endif /* RUN_LEVEL 20 */
+
+#if RUN_LEVEL >= 21
+    s_test21,
+#endif /* RUN_LEVEL 21 */
+
+#if RUN_LEVEL >= 22
+    s_test22,
+#endif /* RUN_LEVEL 22 */
+
+#if RUN_LEVEL >= 23
+    s_test23,
+#endif /* RUN_LEVEL 23 */
+
+#if RUN_LEVEL >= 24
+    s_test24,
+#endif /* RUN_LEVEL 24 */
+
+#if RUN_LEVEL >= 25
+    s_test25,
+#endif /* RUN_LEVEL 25 */
+
+#if RUN_LEVEL >= 26
+    s_test26,
+#endif /* RUN_LEVEL 26 */
+
+#if RUN_LEVEL >= 27
+    s_test27,
+#endif /* RUN_LEVEL 27 */
+
+#if RUN_LEVEL >= 28
+    s_test28,
+#endif /* RUN_LEVEL 28 */
+
+#if RUN_LEVEL >= 29
+    s_test29,
+#endif /* RUN_LEVEL 29 */
+
+#if RUN_LEVEL >= 30
+    s_test30,
+#endif /* RUN_LEVEL 30 */
+
+#if RUN_LEVEL >= 31
+    s_test31,
+#endif /* RUN_LEVEL 31 */
+
+#if RUN_LEVEL >= 32
+    s_test32,
+#endif /* RUN_LEVEL 32 */
+
+#if RUN_LEVEL >= 33
+    s_test33,
+#endif /* RUN_LEVEL 33 */
+
+#if RUN_LEVEL >= 34
+    s_test34,
+#endif /* RUN_LEVEL 34 */
+
+#if RUN_LEVEL >= 35
+    s_test35,
+#endif /* RUN_LEVEL 35 */
+
+#if RUN_LEVEL >= 36
+    s_test36,
+#endif /* RUN_LEVEL 36 */
+
+#if RUN_LEVEL >= 37
+    s_test37,
+#endif /* RUN_LEVEL 37 */
+
+#if RUN_LEVEL >= 38
+    s_test38,
+#endif /* RUN_LEVEL 38 */
+
+#if RUN_LEVEL >= 39
+    s_test39,
+#endif /* RUN_LEVEL 39 */
+
+#if RUN_LEVEL >= 40
+    s_test40,
+#endif /* RUN_LEVEL 40 */
+
+#if RUN_LEVEL >= 41
+    s_test41,
+#endif /* RUN_LEVEL 41 */
+
+#if RUN_LEVEL >= 42
+    s_test42,
+#endif /* RUN_LEVEL 42 */
+};
+
+testXX p_test[RUN_LEVEL] =
+{
+#if RUN_LEVEL >=  1
+    p_test01,
+#endif /* RUN_LEVEL  1 */
+
+#if RUN_LEVEL >=  2
+    p_test02,
+#endif /* RUN_LEVEL  2 */
+
+#if RUN_LEVEL >=  3
+    p_test03,
+#endif /* RUN_LEVEL  3 */
+
+#if RUN_LEVEL >=  4
+    p_test04,
+#endif /* RUN_LEVEL  4 */
+
+#if RUN_LEVEL >=  5
+    p_test05,
+#endif /* RUN_LEVEL  5 */
+
+#if RUN_LEVEL >=  6
+    p_test06,
+#endif /* RUN_LEVEL  6 */
+
+#if RUN_LEVEL >=  7
+    p_test07,
+#endif /* RUN_LEVEL  7 */
+
+#if RUN_LEVEL >=  8
+    p_test08,
+#endif /* RUN_LEVEL  8 */
+
+#if RUN_LEVEL >=  9
+    p_test09,
+#endif /* RUN_LEVEL  9 */
+
+#if RUN_LEVEL >= 10
+    p_test10,
+#endif /* RUN_LEVEL 10 */
+
+#if RUN_LEVEL >= 11
+    p_test11,
+#endif /* RUN_LEVEL 11 */
+
+#if RUN_LEVEL >= 12
+    p_test12,
+#endif /* RUN_LEVEL 12 */
+
+#if RUN_LEVEL >= 13
+    p_test13,
+#endif /* RUN_LEVEL 13 */
+
+#if RUN_LEVEL >= 14
+    p_test14,
+#endif /* RUN_LEVEL 14 */
+
+#if RUN_LEVEL >= 15
+    p_test15,
+#endif /* RUN_LEVEL 15 */
+
+#if RUN_LEVEL >= 16
+    p_test16,
+#endif /* RUN_LEVEL 16 */
+
+#if RUN_LEVEL >= 17
+    p_test17,
+#endif /* RUN_LEVEL 17 */
+
+#if RUN_LEVEL >= 18
+    p_test18,
+#endif /* RUN_LEVEL 18 */
+
+#if RUN_LEVEL >= 19
+    p_test19,
+#endif /* RUN_LEVEL 19 */
+
+#if RUN_LEVEL >= 20
+    p_test20,
+#endif /* RUN_LEVEL 20 */
+
+#if RUN_LEVEL >= 21
+    p_test21,
+#endif /* RUN_LEVEL 21 */
+
+#if RUN_LEVEL >= 22
+    p_test22,
+#endif /* RUN_LEVEL 22 */
+
+#if RUN_LEVEL >= 23
+    p_test23,
+#endif /* RUN_LEVEL 23 */
+
+#if RUN_LEVEL >= 24
+    p_test24,
+#endif /* RUN_LEVEL 24 */
+
+#if RUN_LEVEL >= 25
+    p_test25,
+#endif /* RUN_LEVEL 25 */
+
+#if RUN_LEVEL >= 26
+    p_test26,
+#endif /* RUN_LEVEL 26 */
+
+#if RUN_LEVEL >= 27
+    p_test27,
+#endif /* RUN_LEVEL 27 */
+
+#if RUN_LEVEL >= 28
+    p_test28,
+#endif /* RUN_LEVEL 28 */
+
+#if RUN_LEVEL >= 29
+    p_test29,
+#endif /* RUN_LEVEL 29 */
+
+#if RUN_LEVEL >= 30
+    p_test30,
+#endif /* RUN_LEVEL 30 */
+
+#if RUN_LEVEL >= 31
+    p_test31,
+#endif /* RUN_LEVEL 31 */
+
+#if RUN_LEVEL >= 32
+    p_test32,
+#endif /* RUN_LEVEL 32 */
+
+#if RUN_LEVEL >= 33
+    p_test33,
+#endif /* RUN_LEVEL 33 */
+
+#if RUN_LEVEL >= 34
+    p_test34,
+#endif /* RUN_LEVEL 34 */
+
+#if RUN_LEVEL >= 35
+    p_test35,
+#endif /* RUN_LEVEL 35 */
+
+#if RUN_LEVEL >= 36
+    p_test36,
+#endif /* RUN_LEVEL 36 */
+
+#if RUN_LEVEL >= 37
+    p_test37,
+#endif /* RUN_LEVEL 37 */
+
+#if RUN_LEVEL >= 38
+    p_test38,
+#endif /* RUN_LEVEL 38 */
+
+#if RUN_LEVEL >= 39
+    p_test39,
+#endif /* RUN_LEVEL 39 */
+
+#if RUN_LEVEL >= 40
+    p_test40,
+#endif /* RUN_LEVEL 40 */
+
+#if RUN_LEVEL >= 41
+    p_test41,
+#endif /* RUN_LEVEL 41 */
+
+#if RUN_LEVEL >= 42
+    p_test42,
+#endif /* RUN_LEVEL 42 */
+};
+
+/******************************************************************************/
+/*********************************   BENCH   **********************************/
+/******************************************************************************/
+
+/*
+ * Compare function for sorting of timing samples.
+ */
+rt_si32 t_comp(const rt_void *p1, const rt_void *p2)
+{
+    rt_time t1 = *(const rt_time *)p1;
+    rt_time t2 = *(const rt_time *)p2;
+
+    return t1 < t2 ? -1 : t1 > t2 ? +1 : 0;
+}
+
+/*
+ * Run the test (C or S) "reps" times after a warm-up run,
+ * store per-run time in nanoseconds in "tarr" sorted in ascending order.
+ */
+rt_void b_test(testXX test, rt_SIMD_INFOX *info, rt_time *tarr, rt_si32 reps)
+{
+    rt_time time1 = 0;
+    rt_time time2 = 0;
+
+    rt_si32 k;
+
+    test(info);
+
+    for (k = 0; k < reps; k++)
+    {
+        time1 = get_nsec();
+
+        test(info);
+
+        time2 = get_nsec();
+        tarr[k] = time2 - time1;
+    }
+
+    qsort(tarr, reps, sizeof(rt_time), t_comp);
+}
+
+/*
+ * Print median, p10/p90 of sorted samples along with elements-per-ns,
+ * where elements are array entries processed by one run (size * cyc).
+ */
+rt_void b_print(const rt_char *name, rt_time *tarr, rt_si32 reps,
+                rt_SIMD_INFOX *info)
+{
+    rt_fp64 elem = (rt_fp64)info->size * RT_MAX(info->cyc, 1);
+    rt_time tmed = tarr[reps / 2];
+
+    RT_LOGI("Bench %s = %.0f ns median, %.0f ns p10, %.0f ns p90, "
+            "%.3f elem/ns\n", name, (rt_fp64)tmed,
+            (rt_fp64)tarr[(reps - 1) * 10 / 100],
+            (rt_fp64)tarr[(reps - 1) * 90 / 100],
+            elem / RT_MAX(tmed, 1));
+}
+
+/*
+ * Write one machine-readable record per run level to "o_file"
+ * as a JSON line or a CSV row (with a header before the first row),
+ * times are in nanoseconds, bench fields are 0 if not in benchmark mode.
+ */
+rt_void o_print(rt_si32 level, rt_time tC, rt_time tS, rt_time *tarC,
+                rt_time *tarS, rt_SIMD_INFOX *info, rt_si32 simd)
+{
+    static rt_bool head = RT_FALSE;
+
+    rt_fp64 elem = (rt_fp64)info->size * RT_MAX(info->cyc, 1);
+    rt_time mC = b_reps > 0 ? tarC[b_reps / 2] : 0;
+    rt_time mS = b_reps > 0 ? tarS[b_reps / 2] : 0;
+
+    rt_char smd[32];
+    sprintf(smd, "%dx%dv%d", (simd & 0xFF) * 128,
+                             (simd >> 16) & 0xFF, (simd >> 8) & 0xFF);
+
+    if (o_csv && !head)
+    {
+        fprintf(o_file, "level,time_c_ns,time_s_ns,median_c_ns,median_s_ns,"
+                "elements,rt_simd,simd,element,address,pointer,ver,cc\n");
+        head = RT_TRUE;
+    }
+
+    fprintf(o_file, o_csv ?
+            "%d,%.0f,%.0f,%.0f,%.0f,%.0f,%d,%s,%d,%d,%d,0x%08X,\"%s\"\n" :
+            "{\"level\": %d, \"time_c_ns\": %.0f, \"time_s_ns\": %.0f, "
+            "\"median_c_ns\": %.0f, \"median_s_ns\": %.0f, "
+            "\"elements\": %.0f, \"rt_simd\": %d, \"simd\": \"%s\", "
+            "\"element\": %d, \"address\": %d, \"pointer\": %d, "
+            "\"ver\": \"0x%08X\", \"cc\": \"%s\"}\n",
+            level, (rt_fp64)tC, (rt_fp64)tS, (rt_fp64)mC, (rt_fp64)mS,
+            elem, RT_SIMD, smd, RT_ELEMENT, RT_ADDRESS, RT_POINTER,
+            info->ver, RT_CC_NAME);
+
+    fflush(o_file);
+}
+
+/******************************************************************************/
+/*********************************   GOLDEN   *********************************/
+/******************************************************************************/
+
+#define GLD_ARRS            8 /* output arrays compared per run level */
+
+/* names of output arrays in raw-bits records, order of x_arrays */
+const rt_char *g_name[GLD_ARRS] =
+{
+    "fco1", "fco2", "fso1", "fso2", "ico1", "ico2", "iso1", "iso2",
+};
+
+rt_uelm    *g_bits[RUN_LEVEL][GLD_ARRS];  /* golden records (from g_load) */
+rt_si32     g_size[RUN_LEVEL][GLD_ARRS];  /* golden records (from g_load) */
+rt_si32     g_same      = 0;        /* bit-exact run levels (from g_print) */
+rt_si32     g_runs      = 0;         /* compared run levels (from g_print) */
+
+/*
+ * Fill "arr" with output arrays of all run levels viewed as raw bits,
+ * fp and int outputs have the same element size (RT_ELEMENT).
+ */
+rt_void x_arrays(rt_SIMD_INFOX *info, rt_uelm **arr)
+{
+    arr[0] = (rt_uelm *)info->fco1;
+    arr[1] = (rt_uelm *)info->fco2;
+    arr[2] = (rt_uelm *)info->fso1;
+    arr[3] = (rt_uelm *)info->fso2;
+    arr[4] = (rt_uelm *)info->ico1;
+    arr[5] = (rt_uelm *)info->ico2;
+    arr[6] = (rt_uelm *)info->iso1;
+    arr[7] = (rt_uelm *)info->iso2;
+}
+
+/*
+ * Clear output arrays prior to each run level in raw-bits modes,
+ * so that arrays not written by the level don't carry stale values.
+ */
+rt_void x_clear(rt_SIMD_INFOX *info)
+{
+    rt_uelm *arr[GLD_ARRS];
+    rt_si32 j;
+
+    x_arrays(info, arr);
+
+    for (j = 0; j < GLD_ARRS; j++)
+    {
+        memset(arr[j], 0, info->size * sizeof(rt_uelm));
+    }
+}
+
+/*
+ * Print full-precision compatibility flags of the build into "str",
+ * DIV/SQR flags are only defined on targets lacking native div/sqrt.
+ */
+rt_void x_compat(rt_char *str)
+{
+    sprintf(str, "RCP=%d RSQ=%d FMA=%d FMS=%d",
+            RT_SIMD_COMPAT_RCP, RT_SIMD_COMPAT_RSQ,
+            RT_SIMD_COMPAT_FMA, RT_SIMD_COMPAT_FMS);
+#if (defined RT_SIMD_COMPAT_DIV)
+    sprintf(str + strlen(str), " DIV=%d", RT_SIMD_COMPAT_DIV);
+#endif /* RT_SIMD_COMPAT_DIV */
+#if (defined RT_SIMD_COMPAT_SQR)
+    sprintf(str + strlen(str), " SQR=%d", RT_SIMD_COMPAT_SQR);
+#endif /* RT_SIMD_COMPAT_SQR */
+}
+
+/*
+ * Write output arrays of run "level" to "x_file" as raw bits in hex,
+ * one line per array: level, array name, number of elements, elements,
+ * a "#" line with traits of the build is written before the first level.
+ */
+rt_void x_print(rt_si32 level, rt_SIMD_INFOX *info, rt_si32 simd)
+{
+    static rt_bool head = RT_FALSE;
+
+    rt_uelm *arr[GLD_ARRS];
+    rt_si32 j, k;
+
+    if (!head)
+    {
+        rt_char cmp[64];
+        x_compat(cmp);
+
+        fprintf(x_file, "# element = %d, simd = %dx%dv%d, ver = 0x%08X, "
+                "compat = %s, cc = %s\n", RT_ELEMENT, (simd & 0xFF) * 128,
+                (simd >> 16) & 0xFF, (simd >> 8) & 0xFF, info->ver,
+                cmp, RT_CC_NAME);
+        head = RT_TRUE;
+    }
+
+    x_arrays(info, arr);
+
+    for (j = 0; j < GLD_ARRS; j++)
+    {
+        fprintf(x_file, "%d %s %d", level, g_name[j], info->size);
+
+        for (k = 0; k < info->size; k++)
+        {
+#if   RT_ELEMENT == 32
+            fprintf(x_file, " %08X", arr[j][k]);
+#elif RT_ELEMENT == 64
+            fprintf(x_file, " %08X%08X", (rt_ui32)(arr[j][k] >> 32),
+                                         (rt_ui32)(arr[j][k] >>  0));
+#endif /* RT_ELEMENT */
+        }
+
+        fprintf(x_file, "\n");
+    }
+
+    fflush(x_file);
+}
+
+/*
+ * Return distance in ulps between fp values given as raw bits "a" and "b"
+ * mapped to ordered integers, so that adjacent fp values are 1 apart.
+ */
+rt_uelm x_ulps(rt_uelm a, rt_uelm b)
+{
+    rt_uelm sign = (rt_uelm)1 << (RT_ELEMENT - 1);
+
+    a = a & sign ? ~a : a | sign;
+    b = b & sign ? ~b : b | sign;
+
+    return a > b ? a - b : b - a;
+}
+
+/*
+ * Convert raw bits of one element from hex string "str".
+ */
+rt_uelm g_parse(const rt_char *str)
+{
+    rt_uelm bits = 0;
+
+    for (; *str != '\0'; str++)
+    {
+        bits = bits << 4 | (*str >= 'a' ? *str - 'a' + 10 :
+                            *str >= 'A' ? *str - 'A' + 10 : *str - '0');
+    }
+
+    return bits;
+}
+
+/*
+ * Load golden records written by x_print on any target from file "name",
+ * records of different element size are rejected, return RT_FALSE
+ * if the file can't be opened or its contents are malformed.
+ */
+rt_bool g_load(const rt_char *name)
+{
+    FILE *file = fopen(name, "r");
+
+    if (file == NULL)
+    {
+        return RT_FALSE;
+    }
+
+    rt_bool ok = RT_TRUE;
+    rt_char str[32];
+    rt_si32 c, j, k, level, size, elem;
 
-#if RUN_LEVEL >= 17
-    s_test17,
-#endif /* RUN_LEVEL 17 */
+    while (ok && (c = fgetc(file)) != EOF)
+    {
+        if (c == ' ' || c == '\t' || c == '\r' || c == '\n')
+        {
+            continue;
+        }
+        if (c == '#')
+        {
+            if (fscanf(file, " element = %d", &elem) == 1)
+            {
+                ok = elem == RT_ELEMENT;
+            }
+            while (c != '\n' && c != EOF)
+            {
+                c = fgetc(file);
+            }
+            continue;
+        }
 
-#if RUN_LEVEL >= 18
-    s_test18,
-#endif /* RUN_LEVEL 18 */
+        ungetc(c, file);
 
-#if RUN_LEVEL >= 19
-    s_test19,
-#endif /* RUN_LEVEL 19 */
+        if (fscanf(file, "%d %7s %d", &level, str, &size) != 3
+        ||  level < 1 || level > RUN_LEVEL || size < 0)
+        {
+            ok = RT_FALSE;
+            break;
+        }
 
-#if RUN_LEVEL >= 20
-    s_test20,
-#endif /* RUN_LEVEL 20 */
+        for (j = 0; j < GLD_ARRS && strcmp(str, g_name[j]) != 0; j++);
 
-#if RUN_LEVEL >= 21
-    s_test21,
-#endif /* RUN_LEVEL 21 */
+        if (j == GLD_ARRS)
+        {
+            ok = RT_FALSE;
+            break;
+        }
 
-#if RUN_LEVEL >= 22
-    s_test22,
-#endif /* RUN_LEVEL 22 */
+        rt_uelm *bits = (rt_uelm *)malloc(RT_MAX(size, 1) * sizeof(rt_uelm));
 
-#if RUN_LEVEL >= 23
-    s_test23,
-#endif /* RUN_LEVEL 23 */
+        for (k = 0; k < size && fscanf(file, "%31s", str) == 1; k++)
+        {
+            bits[k] = g_parse(str);
+        }
 
-#if RUN_LEVEL >= 24
-    s_test24,
-#endif /* RUN_LEVEL 24 */
+        free(g_bits[level-1][j]);
+        g_bits[level-1][j] = bits;
+        g_size[level-1][j] = size;
 
-#if RUN_LEVEL >= 25
-    s_test25,
-#endif /* RUN_LEVEL 25 */
+        ok = k == size;
+    }
 
-#if RUN_LEVEL >= 26
-    s_test26,
-#endif /* RUN_LEVEL 26 */
+    fclose(file);
 
-#if RUN_LEVEL >= 27
-    s_test27,
-#endif /* RUN_LEVEL 27 */
+    return ok;
+}
 
-#if RUN_LEVEL >= 28
-    s_test28,
-#endif /* RUN_LEVEL 28 */
+/*
+ * Compare output arrays of run "level" bit by bit against golden records,
+ * report the number of differing elements, names of arrays with differences
+ * and max distance in ulps for fp arrays. As test arrays hold 3 SIMD vectors
+ * rotated by vector length, records are only comparable if sizes match.
+ */
+rt_void g_print(rt_si32 level, rt_SIMD_INFOX *info)
+{
+    rt_uelm *arr[GLD_ARRS];
+    rt_uelm ulps = 0;
+    rt_si32 j, k, m = 0, n = 0;
+    rt_char str[64] = "";
 
-#if RUN_LEVEL >= 29
-    s_test29,
-#endif /* RUN_LEVEL 29 */
-};
+    x_arrays(info, arr);
 
-testXX p_test[RUN_LEVEL] =
+    for (j = 0; j < GLD_ARRS; j++)
+    {
+        rt_uelm *bits = g_bits[level-1][j];
+        rt_si32 size = g_size[level-1][j];
+        rt_si32 diff = 0;
+
+        if (bits != RT_NULL && size != info->size)
+        {
+            RT_LOGI("Golden = %d elems per array in records vs %d, "
+                    "SIMD widths differ\n", size, info->size);
+            return;
+        }
+
+        for (k = 0; k < size; k++)
+        {
+            rt_uelm a = arr[j][k], b = bits[k];
+
+            if (a == b)
+            {
+                continue;
+            }
+
+            diff++;
+
+            if (j < 4)
+            {
+                ulps = RT_MAX(ulps, x_ulps(a, b));
+            }
+        }
+
+        if (diff > 0)
+        {
+            strcat(str, " ");
+            strcat(str, g_name[j]);
+        }
+
+        m += diff;
+        n += size;
+    }
+
+    if (n == 0)
+    {
+        RT_LOGI("Golden = no records for this level\n");
+        return;
+    }
+
+    g_runs++;
+
+    if (m == 0)
+    {
+        g_same++;
+        RT_LOGI("Golden = bit-exact, %d elems\n", n);
+    }
+    else
+    {
+        RT_LOGI("Golden = %d of %d elems differ (%s), max %.0f ulp\n",
+                m, n, str + 1, (rt_fp64)ulps);
+    }
+}
+
+/*
+ * Report cost of run "level" with current RT_SIMD_COMPAT_* flags: throughput
+ * of S code in elements per ns (median of bench repeats if enabled) and max
+ * distance in ulps of S results from C results over fp output arrays.
+ */
+rt_void u_print(rt_si32 level, rt_time tS, rt_time *tarS, rt_SIMD_INFOX *info)
 {
-#if RUN_LEVEL >=  1
-    p_test01,
-#endif /* RUN_LEVEL  1 */
+    rt_uelm *arr[GLD_ARRS];
+    rt_uelm ulps = 0;
+    rt_si32 j, k;
+    rt_char cmp[64];
 
-#if RUN_LEVEL >=  2
-    p_test02,
-#endif /* RUN_LEVEL  2 */
+    rt_fp64 elem = (rt_fp64)info->size * RT_MAX(info->cyc, 1);
+    rt_time tmed = b_reps > 0 ? tarS[b_reps / 2] : tS;
 
-#if RUN_LEVEL >=  3
-    p_test03,
-#endif /* RUN_LEVEL  3 */
+    x_arrays(info, arr);
 
-#if RUN_LEVEL >=  4
-    p_test04,
-#endif /* RUN_LEVEL  4 */
+    for (j = 0; j < 2; j++)
+    {
+        for (k = 0; k < info->size; k++)
+        {
+            ulps = RT_MAX(ulps, x_ulps(arr[j][k], arr[j+2][k]));
+        }
+    }
 
-#if RUN_LEVEL >=  5
-    p_test05,
-#endif /* RUN_LEVEL  5 */
+    x_compat(cmp);
 
-#if RUN_LEVEL >=  6
-    p_test06,
-#endif /* RUN_LEVEL  6 */
+    RT_LOGI("Cost %s, level %2d = %8.3f elem/ns, %.0f ulp max\n",
+            cmp, level, elem / RT_MAX(tmed, 1), (rt_fp64)ulps);
+}
 
-#if RUN_LEVEL >=  7
-    p_test07,
-#endif /* RUN_LEVEL  7 */
+/*
+ * Free golden records loaded by g_load.
+ */
+rt_void g_done()
+{
+    rt_si32 i, j;
 
-#if RUN_LEVEL >=  8
-    p_test08,
-#endif /* RUN_LEVEL  8 */
+    for (i = 0; i < RUN_LEVEL; i++)
+    {
+        for (j = 0; j < GLD_ARRS; j++)
+        {
+            free(g_bits[i][j]);
+            g_bits[i][j] = RT_NULL;
+        }
+    }
+}
 
-#if RUN_LEVEL >=  9
-    p_test09,
-#endif /* RUN_LEVEL  9 */
+/******************************************************************************/
+/*********************************   SWEEP   **********************************/
+/******************************************************************************/
 
-#if RUN_LEVEL >= 10
-    p_test10,
-#endif /* RUN_LEVEL 10 */
+/* 64/32-bit hybrid mode allocates within 1 GiB window, leave room for rest */
+#if RT_ADDRESS == 32
+#define SWP_SIZE            512 /* max working set in MiB, all buffers */
+#else  /* RT_ADDRESS == 64 */
+#define SWP_SIZE            1024 /* max working set in MiB, all buffers */
+#endif /* RT_ADDRESS */
 
-#if RUN_LEVEL >= 11
-    p_test11,
-#endif /* RUN_LEVEL 11 */
+/*
+ * Working-set sweep kernels walk whole buffers instead of the 3 test vectors
+ * to measure memory behaviour of selected run levels across cache levels:
+ * w_test01 - binary op (level 1):  D = A + B
+ * w_test06 - conversion (level 6): D = cvz(A)
+ * w_test20 - fused mul-add (level 20): D = C + A * B
+ * A, B, C, D are taken from far0, fco1, fco2, fso1, buffer length
+ * in elements is taken from size, number of passes is taken from cyc.
+ */
+rt_void w_test01(rt_SIMD_INFOX *info)
+{
+    ASM_ENTER(info)
 
-#if RUN_LEVEL >= 12
-    p_test12,
-#endif /* RUN_LEVEL 12 */
+        movwx_ld(Reax, Mebp, inf_CYC)
+        movwx_st(Reax, Mebp, inf_LOC)
+
+    LBL(w01_cyc)
+
+        movxx_ld(Recx, Mebp, inf_FAR0)
+        movxx_ld(Rebx, Mebp, inf_FCO1)
+        movxx_ld(Resi, Mebp, inf_FSO1)
+        movwx_ld(Redi, Mebp, inf_SIZE)
+
+    LBL(w01_loc)
+
+        movpx_ld(Xmm0, Mecx, AJ0)
+        addps_ld(Xmm0, Mebx, AJ0)
+        movpx_st(Xmm0, Mesi, AJ0)
+
+        addxx_ri(Recx, IM(Q*0x10))
+        addxx_ri(Rebx, IM(Q*0x10))
+        addxx_ri(Resi, IM(Q*0x10))
+        arjxx_ri(Redi, IB(S),
+        sub_x,   NZ_x, w01_loc)
+
+        arjwx_mi(Mebp, inf_LOC, IB(1),
+        sub_x,   NZ_x, w01_cyc)
+
+    ASM_LEAVE(info)
+}
+
+rt_void w_test06(rt_SIMD_INFOX *info)
+{
+    ASM_ENTER(info)
+
+        movwx_ld(Reax, Mebp, inf_CYC)
+        movwx_st(Reax, Mebp, inf_LOC)
+
+    LBL(w06_cyc)
+
+        movxx_ld(Recx, Mebp, inf_FAR0)
+        movxx_ld(Resi, Mebp, inf_FSO1)
+        movwx_ld(Redi, Mebp, inf_SIZE)
+
+    LBL(w06_loc)
+
+        cvzps_ld(Xmm0, Mecx, AJ0)
+        movpx_st(Xmm0, Mesi, AJ0)
+
+        addxx_ri(Recx, IM(Q*0x10))
+        addxx_ri(Resi, IM(Q*0x10))
+        arjxx_ri(Redi, IB(S),
+        sub_x,   NZ_x, w06_loc)
+
+        arjwx_mi(Mebp, inf_LOC, IB(1),
+        sub_x,   NZ_x, w06_cyc)
+
+    ASM_LEAVE(info)
+}
+
+rt_void w_test20(rt_SIMD_INFOX *info)
+{
+    ASM_ENTER(info)
+
+        movwx_ld(Reax, Mebp, inf_CYC)
+        movwx_st(Reax, Mebp, inf_LOC)
+
+    LBL(w20_cyc)
+
+        movxx_ld(Recx, Mebp, inf_FAR0)
+        movxx_ld(Rebx, Mebp, inf_FCO1)
+        movxx_ld(Redx, Mebp, inf_FCO2)
+        movxx_ld(Resi, Mebp, inf_FSO1)
+        movwx_ld(Redi, Mebp, inf_SIZE)
+
+    LBL(w20_loc)
+
+        movpx_ld(Xmm0, Medx, AJ0)
+        movpx_ld(Xmm1, Mecx, AJ0)
+        fmaps_ld(Xmm0, Xmm1, Mebx, AJ0)
+        movpx_st(Xmm0, Mesi, AJ0)
+
+        addxx_ri(Recx, IM(Q*0x10))
+        addxx_ri(Rebx, IM(Q*0x10))
+        addxx_ri(Redx, IM(Q*0x10))
+        addxx_ri(Resi, IM(Q*0x10))
+        arjxx_ri(Redi, IB(S),
+        sub_x,   NZ_x, w20_loc)
+
+        arjwx_mi(Mebp, inf_LOC, IB(1),
+        sub_x,   NZ_x, w20_cyc)
+
+    ASM_LEAVE(info)
+}
+
+/*
+ * Run sweep kernel "test" using "narr" buffers of equal size placed in "bar0"
+ * for working sets (all buffers together) from 4 KiB up to "wmax" KiB,
+ * report GB/s of bytes loaded and stored per size (median of 3 runs).
+ */
+rt_void w_sweep(testXX test, rt_si32 level, rt_si32 narr,
+                rt_SIMD_INFOX *info, rt_byte *bar0, rt_si32 wmax)
+{
+    rt_real *far0 = info->far0;
+    rt_real *fco1 = info->fco1;
+    rt_real *fco2 = info->fco2;
+    rt_real *fso1 = info->fso1;
+
+    rt_si32 size = info->size;
+    rt_si32 cyc  = info->cyc;
+
+    rt_time tarr[3];
+    rt_si32 k, kb;
+
+    for (kb = 4; kb <= wmax; kb *= 2)
+    {
+        /* bytes per buffer, multiple of SIMD width */
+        rt_size blen = (rt_size)kb * 1024 / narr / (Q*16) * (Q*16);
+
+        info->far0 = (rt_real *)(bar0 + blen * 0);
+        info->fco1 = (rt_real *)(bar0 + blen * (narr > 2 ? 1 : 0));
+        info->fco2 = (rt_real *)(bar0 + blen * (narr > 3 ? 2 : 0));
+        info->fso1 = (rt_real *)(bar0 + blen * (narr - 1));
+
+        /* keep at least 256 MiB of traffic per timed run */
+        info->size = (rt_si32)(blen / sizeof(rt_real));
+        info->cyc  = (rt_si32)RT_MAX((256 << 20) / (blen * narr), 1);
+
+        b_test(test, info, tarr, 3);
+
+        rt_fp64 byte = (rt_fp64)blen * narr * info->cyc;
+
+        RT_LOGI("Sweep %2d = %8d KiB, %8.2f GB/s\n",
+                level, kb, byte / RT_MAX(tarr[1], 1));
+    }
+
+    info->far0 = far0;
+    info->fco1 = fco1;
+    info->fco2 = fco2;
+    info->fso1 = fso1;
+
+    info->size = size;
+    info->cyc  = cyc;
+}
+
+/*
+ * Stream benchmark runs sweep kernels over arrays well beyond the LLC
+ * on the thread-pool with threads pinned to CPUs, comparing arrays touched
+ * first by the calling thread (all pages on its node) and processed with
+ * work stealing against arrays touched first by the workers processing
+ * the same chunks later (pages spread across nodes of the workers).
+ */
+#if RT_ADDRESS == 32
+#define STR_SIZE            512 /* max working set in MiB, all arrays */
+#else  /* RT_ADDRESS == 64 */
+#define STR_SIZE            65536 /* max working set in MiB, all arrays */
+#endif /* RT_ADDRESS */
+
+#define STR_STEP            (256*1024) /* elems per chunk, page multiple */
+#define STR_PASS            4 /* timed passes over arrays */
+
+/*
+ * Sweep kernel and arrays of the calling thread for t_stream.
+ */
+struct rt_STREAM
+{
+    testXX          test;
+    rt_SIMD_INFOX*  info;
+};
+
+/*
+ * Set up worker's context "info" for chunk [from, to) of arrays from "data"
+ * and run the sweep kernel once over the chunk.
+ */
+rt_void t_stream(rt_SIMD_INFO *info, rt_size from, rt_size to, rt_pntr data)
+{
+    rt_STREAM *st = (rt_STREAM *)data;
+    rt_SIMD_INFOX *inf0 = st->info;
+    rt_SIMD_INFOX *inf1 = (rt_SIMD_INFOX *)info;
+
+    inf1->far0 = inf0->far0 + from;
+    inf1->fco1 = inf0->fco1 + from;
+    inf1->fco2 = inf0->fco2 + from;
+    inf1->fso1 = inf0->fso1 + from;
+    inf1->size = (rt_si32)(to - from);
+    inf1->cyc  = 1;
+
+    st->test(inf1);
+}
+
+/*
+ * Run stream benchmark of sweep kernel "test" using "narr" arrays
+ * of "smax" MiB in total on 1, 2, 4, ... up to "tmax" pinned threads,
+ * report GB/s of bytes loaded and stored with first touch
+ * by the calling thread (naive) and by the workers (local).
+ */
+rt_void s_stream(testXX test, rt_si32 level, rt_si32 narr,
+                 rt_SIMD_INFOX *info, rt_si32 smax, rt_si32 tmax)
+{
+    rt_real *far0 = info->far0;
+    rt_real *fco1 = info->fco1;
+    rt_real *fco2 = info->fco2;
+    rt_real *fso1 = info->fso1;
+
+    rt_size n = (rt_size)smax * 1024 * 1024 / narr / sizeof(rt_real);
+    rt_size alen = n / STR_STEP * STR_STEP * sizeof(rt_real);
+
+    n = alen / sizeof(rt_real);
 
-#if RUN_LEVEL >= 13
-    p_test13,
-#endif /* RUN_LEVEL 13 */
+    rt_STREAM st;
+    st.test = test;
+    st.info = info;
 
-#if RUN_LEVEL >= 14
-    p_test14,
-#endif /* RUN_LEVEL 14 */
+    rt_si32 t, k, m;
 
-#if RUN_LEVEL >= 15
-    p_test15,
-#endif /* RUN_LEVEL 15 */
+    for (t = 1; n > 0; t = RT_MIN(t * 2, tmax))
+    {
+        rt_POOL pool;
+        rt_fp64 gbs[2];
 
-#if RUN_LEVEL >= 16
-    p_test16,
-#endif /* RUN_LEVEL 16 */
+        if (!pool_init(&pool, t, info, sizeof(rt_SIMD_INFOX), RT_POOL_PIN))
+        {
+            RT_LOGE("thread-pool init failed, exiting...\n");
+            exit(EXIT_FAILURE);
+        }
 
-#if RUN_LEVEL >= 17
-    p_test17,
-#endif /* RUN_LEVEL 17 */
+        for (m = 0; m < 2; m++)
+        {
+            rt_HEAP heap;
+            rt_HEAP_ARENA arena;
+            rt_byte *bar0 = RT_NULL;
 
-#if RUN_LEVEL >= 18
-    p_test18,
-#endif /* RUN_LEVEL 18 */
+            if (heap_init(&heap, alen * narr + RT_HEAP_HEAD, 0))
+            {
+                heap_init_arena(&arena, &heap);
+                bar0 = (rt_byte *)heap_alloc(&arena, alen * narr);
+            }
+            if (bar0 == RT_NULL)
+            {
+                RT_LOGE("alloc failed for stream arrays, exiting...\n");
+                exit(EXIT_FAILURE);
+            }
 
-#if RUN_LEVEL >= 19
-    p_test19,
-#endif /* RUN_LEVEL 19 */
+            info->far0 = (rt_real *)(bar0 + alen * 0);
+            info->fco1 = (rt_real *)(bar0 + alen * (narr > 2 ? 1 : 0));
+            info->fco2 = (rt_real *)(bar0 + alen * (narr > 3 ? 2 : 0));
+            info->fso1 = (rt_real *)(bar0 + alen * (narr - 1));
 
-#if RUN_LEVEL >= 20
-    p_test20,
-#endif /* RUN_LEVEL 20 */
+            if (m == 0)
+            {
+                memset(bar0, 0, alen * narr);
+            }
+            else
+            {
+                for (k = 0; k < narr; k++)
+                {
+                    pool_touch(&pool, bar0 + alen * k, n, STR_STEP,
+                                                        sizeof(rt_real));
+                }
+            }
 
-#if RUN_LEVEL >= 21
-    p_test21,
-#endif /* RUN_LEVEL 21 */
+            rt_time time1 = 0;
+            rt_time time2 = 0;
 
-#if RUN_LEVEL >= 22
-    p_test22,
-#endif /* RUN_LEVEL 22 */
+            time1 = get_nsec();
 
-#if RUN_LEVEL >= 23
-    p_test23,
-#endif /* RUN_LEVEL 23 */
+            for (k = 0; k < STR_PASS; k++)
+            {
+                if (m == 0)
+                {
+                    pool_run(&pool, t_stream, &st, n, STR_STEP);
+                }
+                else
+                {
+                    pool_run_local(&pool, t_stream, &st, n, STR_STEP);
+                }
+            }
 
-#if RUN_LEVEL >= 24
-    p_test24,
-#endif /* RUN_LEVEL 24 */
+            time2 = get_nsec();
 
-#if RUN_LEVEL >= 25
-    p_test25,
-#endif /* RUN_LEVEL 25 */
+            gbs[m] = (rt_fp64)alen * narr * STR_PASS /
+                                        RT_MAX(time2 - time1, 1);
 
-#if RUN_LEVEL >= 26
-    p_test26,
-#endif /* RUN_LEVEL 26 */
+            heap_done(&heap);
+        }
 
-#if RUN_LEVEL >= 27
-    p_test27,
-#endif /* RUN_LEVEL 27 */
+        RT_LOGI("Stream %2d = %2d threads, %8.2f GB/s naive, "
+                "%8.2f GB/s local\n", level, pool.count, gbs[0], gbs[1]);
 
-#if RUN_LEVEL >= 28
-    p_test28,
-#endif /* RUN_LEVEL 28 */
+        pool_done(&pool);
 
-#if RUN_LEVEL >= 29
-    p_test29,
-#endif /* RUN_LEVEL 29 */
-};
+        if (t >= tmax)
+        {
+            break;
+        }
+    }
+
+    info->far0 = far0;
+    info->fco1 = fco1;
+    info->fco2 = fco2;
+    info->fso1 = fso1;
+}
 
 /******************************************************************************/
 /**********************************   MAIN   **********************************/
@@ -4684,6 +8858,41 @@ testXX p_test[RUN_LEVEL] =
 
 rt_time get_time();
 
+rt_time get_nsec();
+
+#if (defined RT_SIMD_SPACE)
+
+/*
+ * Return SIMD targets supported at runtime (in rt_SIMD_INFO->ver format).
+ * Called by the dispatcher in simd_multi.cpp prior to binding main,
+ * only BASE instructions are emitted here as SIMD-regs are turned off.
+ */
+rt_si32 get_vers()
+{
+    rt_pntr info = sys_alloc(sizeof(rt_SIMD_INFO) + MASK);
+    rt_SIMD_INFO *inf0 = (rt_SIMD_INFO *)(((rt_full)info + MASK) & ~MASK);
+
+    rt_pntr regs = sys_alloc(sizeof(rt_SIMD_REGS) + MASK);
+    rt_SIMD_REGS *reg0 = (rt_SIMD_REGS *)(((rt_full)regs + MASK) & ~MASK);
+
+    ASM_INIT(inf0, reg0)
+
+    ASM_ENTER(inf0)
+        verxx_xx()
+    ASM_LEAVE(inf0)
+
+    rt_si32 ver = inf0->ver;
+
+    ASM_DONE(inf0)
+
+    sys_free(regs, sizeof(rt_SIMD_REGS) + MASK);
+    sys_free(info, sizeof(rt_SIMD_INFO) + MASK);
+
+    return ver;
+}
+
+#endif /* RT_SIMD_SPACE */
+
 /*
  * info - info original pointer
  * inf0 - info aligned pointer
@@ -4716,6 +8925,17 @@ rt_si32 main(rt_si32 argc, rt_char *argv[])
         RT_LOGI(" -e n, specify subtest # at which testing ends, n <= max\n");
         RT_LOGI(" -d n, override diff-threshold for qualification, n >= 0\n");
         RT_LOGI(" -c n, override counter of redundant test cycles, n >= 1\n");
+        RT_LOGI(" -r n, benchmark mode, time n repeats of each test, n >= 1\n");
+        RT_LOGI(" -o f, write records per test to file f (.csv or JSON)\n");
+        RT_LOGI(" -w n, sweep levels 1, 6, 20 over 4 KiB to n MiB buffers\n");
+        RT_LOGI(" -t n, run thread-pool tests on n threads, n >= 1\n");
+        RT_LOGI(" -s n, stream add/fma over n MiB on 1 to t threads\n");
+        RT_LOGI(" -x f, dump raw bits of output arrays per test to file f\n");
+        RT_LOGI(" -g f, diff raw bits of output arrays with golden file f\n");
+        RT_LOGI(" -u, report elem/ns and max ulps from C per test (cost)\n");
+#if (defined RT_SIMD_SPACE)
+        RT_LOGI(" -m n, limit runtime SIMD target to n-bit, n >= 128\n");
+#endif /* RT_SIMD_SPACE */
         RT_LOGI(" -v, enable verbose mode, always print values from tests\n");
         RT_LOGI("all options can be used together\n");
         RT_LOGI("--------------------------------------------------------\n");
@@ -4791,6 +9011,118 @@ rt_si32 main(rt_si32 argc, rt_char *argv[])
                 return 0;
             }
         }
+        if (k < argc && strcmp(argv[k], "-r") == 0 && ++k < argc)
+        {
+            for (l = strlen(argv[k]), r = 1, t = 0; l > 0; l--, r *= 10)
+            {
+                t += (argv[k][l-1] - '0') * r;
+            }
+            if (t >= 1)
+            {
+                RT_LOGI("Bench-repeats overridden: %d\n", t);
+                b_reps = t;
+            }
+            else
+            {
+                RT_LOGI("Bench-repeats value out of range\n");
+                return 0;
+            }
+        }
+        if (k < argc && strcmp(argv[k], "-o") == 0 && ++k < argc)
+        {
+            l = strlen(argv[k]);
+            o_csv = l >= 4 && strcmp(argv[k] + l - 4, ".csv") == 0;
+            if (o_file == NULL && (o_file = fopen(argv[k], "w")) != NULL)
+            {
+                RT_LOGI("Output-records enabled: %s\n", argv[k]);
+            }
+            else
+            {
+                RT_LOGI("Output-records file can't be opened\n");
+                return 0;
+            }
+        }
+        if (k < argc && strcmp(argv[k], "-w") == 0 && ++k < argc)
+        {
+            for (l = strlen(argv[k]), r = 1, t = 0; l > 0; l--, r *= 10)
+            {
+                t += (argv[k][l-1] - '0') * r;
+            }
+            if (t >= 1 && t <= SWP_SIZE)
+            {
+                RT_LOGI("Sweep-max-size overridden: %d MiB\n", t);
+                w_size = t;
+            }
+            else
+            {
+                RT_LOGI("Sweep-max-size value out of range\n");
+                return 0;
+            }
+        }
+        if (k < argc && strcmp(argv[k], "-t") == 0 && ++k < argc)
+        {
+            for (l = strlen(argv[k]), r = 1, t = 0; l > 0; l--, r *= 10)
+            {
+                t += (argv[k][l-1] - '0') * r;
+            }
+            if (t >= 1 && t <= RT_POOL_SIZE)
+            {
+                RT_LOGI("Thread-pool-size overridden: %d\n", t);
+                t_thrd = t;
+            }
+            else
+            {
+                RT_LOGI("Thread-pool-size value out of range\n");
+                return 0;
+            }
+        }
+        if (k < argc && strcmp(argv[k], "-s") == 0 && ++k < argc)
+        {
+            for (l = strlen(argv[k]), r = 1, t = 0; l > 0; l--, r *= 10)
+            {
+                t += (argv[k][l-1] - '0') * r;
+            }
+            if (t >= 1 && t <= STR_SIZE)
+            {
+                RT_LOGI("Stream-size overridden: %d MiB\n", t);
+                s_size = t;
+            }
+            else
+            {
+                RT_LOGI("Stream-size value out of range\n");
+                return 0;
+            }
+        }
+        if (k < argc && strcmp(argv[k], "-x") == 0 && ++k < argc)
+        {
+            if (x_file == NULL && (x_file = fopen(argv[k], "w")) != NULL)
+            {
+                RT_LOGI("Raw-bits dump enabled: %s\n", argv[k]);
+            }
+            else
+            {
+                RT_LOGI("Raw-bits dump file can't be opened\n");
+                return 0;
+            }
+        }
+        if (k < argc && strcmp(argv[k], "-g") == 0 && ++k < argc)
+        {
+            if (!g_mode && g_load(argv[k]))
+            {
+                RT_LOGI("Golden-bits diff enabled: %s\n", argv[k]);
+                g_mode = RT_TRUE;
+            }
+            else
+            {
+                RT_LOGI("Golden-bits file can't be loaded\n");
+                return 0;
+            }
+        }
+        if (k < argc && strcmp(argv[k], "-u") == 0 && !u_mode)
+        {
+            u_mode = RT_TRUE;
+            RT_LOGI("Cost report enabled\n");
+        }
         if (k < argc && strcmp(argv[k], "-v") == 0 && !v_mode)
         {
             v_mode = RT_TRUE;
@@ -4958,46 +9290,173 @@ rt_si32 main(rt_si32 argc, rt_char *argv[])
     simd = (1 << 16) | (RT_128X1 << 8) | 1;
 #endif /* RT_128 */
 
+    rt_POOL pool;
+
+    if (!pool_init(&pool, t_thrd, inf0, sizeof(rt_SIMD_INFOX), 0))
+    {
+        RT_LOGE("thread-pool init failed, exiting...\n");
+        exit(EXIT_FAILURE);
+    }
+
+    t_pool = &pool;
+
     rt_time time1 = 0;
     rt_time time2 = 0;
     rt_time tC = 0;
     rt_time tS = 0;
 
+    rt_time *tarC = (rt_time *)malloc(RT_MAX(b_reps, 1) * sizeof(rt_time));
+    rt_time *tarS = (rt_time *)malloc(RT_MAX(b_reps, 1) * sizeof(rt_time));
+
     rt_si32 i;
 
+    if (x_file != NULL || g_mode || u_mode)
+    {
+        rt_char cmp[64];
+        x_compat(cmp);
+
+        RT_LOGI("Compat flags: %s\n", cmp);
+    }
+
     for (i = n_init; i <= n_done; i++)
     {
         RT_LOGI("-------------------  RUN LEVEL = %2d  - ptr/fp = %d%s%d --\n",
                     i+1, RT_POINTER, RT_ADDRESS == 32 ? "_" : "f", RT_ELEMENT);
 
-        time1 = get_time();
+        if (x_file != NULL || g_mode || u_mode)
+        {
+            x_clear(inf0);
+        }
+
+        time1 = get_nsec();
 
         c_test[i](inf0);
 
-        time2 = get_time();
+        time2 = get_nsec();
         tC = time2 - time1;
-        RT_LOGI("Time C = %d\n", (rt_si32)tC);
+        RT_LOGI("Time C = %d\n", (rt_si32)(tC / 1000000));
 
         /* --------------------------------- */
 
-        time1 = get_time();
+        time1 = get_nsec();
 
         s_test[i](inf0);
 
-        time2 = get_time();
+        time2 = get_nsec();
         tS = time2 - time1;
-        RT_LOGI("Time S = %d\n", (rt_si32)tS);
+        RT_LOGI("Time S = %d\n", (rt_si32)(tS / 1000000));
 
         /* --------------------------------- */
 
         p_test[i](inf0);
 
+        /* --------------------------------- */
+
+        if (x_file != NULL)
+        {
+            x_print(i+1, inf0, simd);
+        }
+
+        if (g_mode)
+        {
+            g_print(i+1, inf0);
+        }
+
+        if (b_reps > 0)
+        {
+            b_test(c_test[i], inf0, tarC, b_reps);
+            b_test(s_test[i], inf0, tarS, b_reps);
+
+            b_print("C", tarC, b_reps, inf0);
+            b_print("S", tarS, b_reps, inf0);
+
+            RT_LOGI("Bench C/S = %.2fx speedup (median)\n",
+                    (rt_fp64)tarC[b_reps / 2] / RT_MAX(tarS[b_reps / 2], 1));
+        }
+
+        if (u_mode)
+        {
+            u_print(i+1, tS, tarS, inf0);
+        }
+
+        if (o_file != NULL)
+        {
+            o_print(i+1, tC, tS, tarC, tarS, inf0, simd);
+        }
+
+        RT_LOGI("-------------------------------------- simd = %4dx%dv%d -\n",
+                (simd & 0xFF) * 128, (simd >> 16) & 0xFF, (simd >> 8) & 0xFF);
+    }
+
+    if (g_mode && n_done >= 0)
+    {
+        RT_LOGI("Golden levels = %d of %d bit-exact\n", g_same, g_runs);
+    }
+
+    if (w_size > 0 && n_done >= 0)
+    {
+        RT_LOGI("--------------  SWEEP MAX = %4d MiB  - ptr/fp = %d%s%d --\n",
+                w_size, RT_POINTER, RT_ADDRESS == 32 ? "_" : "f", RT_ELEMENT);
+
+        rt_size wlen = (rt_size)w_size * 1024 * 1024;
+        rt_HEAP heap;
+        rt_HEAP_ARENA arena;
+        rt_byte *war0 = RT_NULL;
+
+        if (heap_init(&heap, wlen + RT_HEAP_HEAD, RT_HEAP_HUGE))
+        {
+            heap_init_arena(&arena, &heap);
+            war0 = (rt_byte *)heap_alloc(&arena, wlen);
+        }
+        if (war0 == RT_NULL)
+        {
+            RT_LOGE("alloc failed for sweep buffers, exiting...\n");
+            exit(EXIT_FAILURE);
+        }
+
+        memset(war0, 0, wlen);
+
+        w_sweep(w_test01,  1, 3, inf0, war0, w_size * 1024);
+        w_sweep(w_test06,  6, 2, inf0, war0, w_size * 1024);
+        w_sweep(w_test20, 20, 4, inf0, war0, w_size * 1024);
+
+        heap_done(&heap);
+
+        RT_LOGI("-------------------------------------- simd = %4dx%dv%d -\n",
+                (simd & 0xFF) * 128, (simd >> 16) & 0xFF, (simd >> 8) & 0xFF);
+    }
+
+    if (s_size > 0 && n_done >= 0)
+    {
+        RT_LOGI("--------------  STREAM = %5d MiB  - ptr/fp = %d%s%d --\n",
+                s_size, RT_POINTER, RT_ADDRESS == 32 ? "_" : "f", RT_ELEMENT);
+
+        s_stream(w_test01,  1, 3, inf0, s_size, pool.count);
+        s_stream(w_test20, 20, 4, inf0, s_size, pool.count);
+
         RT_LOGI("-------------------------------------- simd = %4dx%dv%d -\n",
                 (simd & 0xFF) * 128, (simd >> 16) & 0xFF, (simd >> 8) & 0xFF);
     }
 
+    pool_done(&pool);
+
     ASM_DONE(inf0)
 
+    free(tarS);
+    free(tarC);
+
+    if (o_file != NULL)
+    {
+        fclose(o_file);
+    }
+
+    if (x_file != NULL)
+    {
+        fclose(x_file);
+    }
+
+    g_done();
+
     sys_free(regs, sizeof(rt_SIMD_REGS) + MASK);
     sys_free(info, sizeof(rt_SIMD_INFOX) + MASK);
     sys_free(marr, 10 * ARR_SIZE * sizeof(rt_ui32) + MASK);
@@ -5053,6 +9512,19 @@ rt_time get_time()
     return (rt_time)(tm.QuadPart * 1000 / fr.QuadPart);
 }
 
+/*
+ * Get monotonic time in nanoseconds.
+ */
+rt_time get_nsec()
+{
+    LARGE_INTEGER fr;
+    QueryPerformanceFrequency(&fr);
+    LARGE_INTEGER tm;
+    QueryPerformanceCounter(&tm);
+    return (rt_time)(tm.QuadPart / fr.QuadPart * 1000000000 +
+                     tm.QuadPart % fr.QuadPart * 1000000000 / fr.QuadPart);
+}
+
 DWORD s_step = 0;
 
 SYSTEM_INFO s_sys = {0};
@@ -5150,6 +9622,23 @@ rt_time get_time()
     return (rt_time)(tm.tv_sec * 1000 + tm.tv_usec / 1000);
 }
 
+#include <time.h>
+
+/*
+ * Get monotonic time in nanoseconds,
+ * raw clock is used where available to avoid NTP slewing.
+ */
+rt_time get_nsec()
+{
+    timespec tm;
+#if (defined CLOCK_MONOTONIC_RAW)
+    clock_gettime(CLOCK_MONOTONIC_RAW, &tm);
+#else  /* CLOCK_MONOTONIC_RAW */
+    clock_gettime(CLOCK_MONOTONIC, &tm);
+#endif /* CLOCK_MONOTONIC_RAW */
+    return (rt_time)tm.tv_sec * 1000000000 + tm.tv_nsec;
+}
+
 #if RT_POINTER == 64
 
 #include <sys/mman.h>
@@ -5239,6 +9728,12 @@ rt_void sys_free(rt_pntr ptr, rt_size size)
 
 #endif /* ------------- OS specific ----------------------------------------- */
 
+#if (defined RT_SIMD_SPACE)
+
+} /* namespace RT_SIMD_SPACE */
+
+#endif /* RT_SIMD_SPACE */
+
 /******************************************************************************/
 /******************************************************************************/
 /******************************************************************************/